@@ -0,0 +1,154 @@
+"""
+Packs the 1-bpp icon bitmaps from icons.h into a run-length encoded blob.
+
+Run it after editing icons.h:
+
+    python3 firmware/icons/pack_icons.py
+
+Output goes to firmware/src/gfx/icon_pack.h and icon_pack.cpp. The firmware
+never compiles icons.h itself, only the packed blob, which is decoded on demand
+by IconStore (see firmware/src/gfx/icon_store.h).
+
+Encoding: pixels are walked row by row (row padding bits are dropped) as
+alternating runs of background and foreground, starting with background. Run
+lengths are written as a nibble stream, high nibble first:
+
+    0x0 - 0xD    run of 0 - 13 pixels
+    0xE a b      run of 14 + 0xab pixels
+    0xF a b c d  run of 0xabcd pixels
+
+Every icon starts on a byte boundary.
+"""
+
+from pathlib import Path
+import re
+import sys
+
+# Icons whose size can't be taken from the _NN name suffix (NN x NN)
+ICON_SIZES = {
+    "letter_A": (20, 20),
+    "snowflake": (20, 20),
+    "fire": (20, 20),
+    "wind": (20, 20),
+    "seedlabs_logo": (96, 96),
+    "lamp_solid": (80, 80),
+    "lamp_regular": (80, 80),
+    "volume_30_1": (44, 30),
+    "volume_30_2": (44, 30),
+    "volume_30_3": (44, 30),
+    "volume_30_4": (44, 30),
+    "omnitrix_char_1": (75, 174),
+    "omnitrix_char_2": (85, 174),
+}
+
+ARRAY_PATTERN = re.compile(r"const unsigned char (\w+)\[\] = \{(.*?)\};", re.S)
+BYTE_PATTERN = re.compile(r"0x[0-9a-fA-F]{2}")
+
+
+def icon_size(name):
+    if name in ICON_SIZES:
+        return ICON_SIZES[name]
+    match = re.search(r"_(\d+)$", name)
+    if match is None:
+        sys.exit(f"No size known for icon {name}, add it to ICON_SIZES")
+    size = int(match.group(1))
+    return (size, size)
+
+
+def encode_run(length):
+    if length < 14:
+        return [length]
+    if length < 14 + 256:
+        length -= 14
+        return [0xE, length >> 4, length & 0xF]
+    assert length < 0x10000, "run too long"
+    return [0xF, length >> 12, (length >> 8) & 0xF, (length >> 4) & 0xF, length & 0xF]
+
+
+def pack(name, bitmap, width, height):
+    byte_width = (width + 7) // 8
+    if len(bitmap) < byte_width * height:
+        sys.exit(f"Icon {name} has {len(bitmap)} bytes, {width}x{height} needs {byte_width * height}")
+
+    encoded = []  # nibbles
+    current = 0
+    run = 0
+    for y in range(height):
+        for x in range(width):
+            pixel = (bitmap[y * byte_width + x // 8] >> (7 - (x & 7))) & 1
+            if pixel != current:
+                encoded += encode_run(run)
+                current = pixel
+                run = 0
+            run += 1
+    encoded += encode_run(run)
+
+    if len(encoded) % 2:
+        encoded.append(0)
+    return [(encoded[i] << 4) | encoded[i + 1] for i in range(0, len(encoded), 2)]
+
+
+def format_bytes(data, indent="    "):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ", ".join(f"0x{b:02x}" for b in data[i : i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def run():
+    SCRIPT_PATH = Path(__file__).absolute().parent
+    REPO_ROOT = SCRIPT_PATH.parent.parent
+
+    source = (SCRIPT_PATH / "icons.h").read_text()
+    output_path = REPO_ROOT / "firmware" / "src" / "gfx"
+
+    icons = []
+    blob = []
+    raw_bytes = 0
+    for match in ARRAY_PATTERN.finditer(source):
+        name = match.group(1)
+        bitmap = [int(b, 16) for b in BYTE_PATTERN.findall(match.group(2))]
+        width, height = icon_size(name)
+        encoded = pack(name, bitmap, width, height)
+        icons.append((name, width, height, len(blob), len(encoded)))
+        blob += encoded
+        raw_bytes += ((width + 7) // 8) * height
+
+    assert len(icons) > 0, "No icons found!"
+
+    header = [
+        "#pragma once",
+        "",
+        "// Generated by firmware/icons/pack_icons.py from firmware/icons/icons.h, do not edit.",
+        "",
+        '#include "packed_icon.h"',
+        "",
+        f"const uint32_t ICON_PACK_RAW_BYTES = {raw_bytes};",
+        f"const uint32_t ICON_PACK_PACKED_BYTES = {len(blob)};",
+        "",
+    ]
+    header += [f"extern const PackedIcon {name};" for name, *_ in icons]
+
+    source_lines = [
+        "// Generated by firmware/icons/pack_icons.py from firmware/icons/icons.h, do not edit.",
+        "",
+        '#include "icon_pack.h"',
+        "",
+        "static const uint8_t icon_pack_data[] = {",
+        format_bytes(blob),
+        "};",
+        "",
+    ]
+    source_lines += [
+        f"const PackedIcon {name} = {{{width}, {height}, icon_pack_data + {offset}, {size}}};"
+        for name, width, height, offset, size in icons
+    ]
+
+    (output_path / "icon_pack.h").write_text("\n".join(header) + "\n")
+    (output_path / "icon_pack.cpp").write_text("\n".join(source_lines) + "\n")
+
+    print(f"Packed {len(icons)} icons: {raw_bytes} bytes raw, {len(blob)} bytes packed")
+
+
+if __name__ == "__main__":
+    run()
@@ -3,17 +3,12 @@
 #include <Arduino.h>
 #include "configuration.h"
 #include "cJSON.h"
+#include "virtual_button.h"
 
 // TODO: move it into the app.h
 const uint32_t APP_ID_SETTINGS = 7;
 const uint32_t APP_ID_HOME_ASSISTANT = 6;
 
-const uint8_t VIRTUAL_BUTTON_IDLE = 0;
-const uint8_t VIRTUAL_BUTTON_SHORT_PRESSED = 1;
-const uint8_t VIRTUAL_BUTTON_SHORT_RELEASED = 2;
-const uint8_t VIRTUAL_BUTTON_LONG_PRESSED = 3;
-const uint8_t VIRTUAL_BUTTON_LONG_RELEASED = 4;
-
 struct ConnectivityState
 {
     bool is_connected;
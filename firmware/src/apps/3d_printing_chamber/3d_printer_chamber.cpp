@@ -28,8 +28,8 @@ PrinterChamberApp::PrinterChamberApp(TFT_eSprite *spr_, char *entity_name) : App
 
     num_positions = motor_config.max_position - motor_config.min_position;
 
-    big_icon = printer_80;
-    small_icon = printer_40;
+    big_icon = &printer_80;
+    small_icon = &printer_40;
     // friendly_name = "3D Printer";
     sprintf(friendly_name, "%s", "3D Printer");
 }
@@ -146,7 +146,7 @@ TFT_eSprite *PrinterChamberApp::render()
         power_icon_color = TFT_YELLOW;
     }
 
-    spr_->drawBitmap(center_h - icon_size / 2, center_v - 74, lightning_50, icon_size, icon_size, power_icon_color, background);
+    IconStore::getInstance().drawIcon(spr_, center_h - icon_size / 2, center_v - 74, &lightning_50, power_icon_color, background);
 
     spr_->setTextColor(TFT_WHITE);
     spr_->setFreeFont(&NDS1210pt7b);
@@ -18,6 +18,10 @@ void App::updateStateFromSystem(AppState state)
 {
 }
 
+void App::updateStateFromBeat(MusicBeat beat)
+{
+}
+
 int8_t App::navigationNext()
 {
     return next;
@@ -4,7 +4,7 @@
 #include <TFT_eSPI.h>
 #include "../proto_gen/smartknob.pb.h"
 #include "../app_config.h"
-#include "icons.h"
+#include "../gfx/icon_store.h"
 #include "../events/events.h"
 #include "../notify/motor_notifier/motor_notifier.h"
 
@@ -33,6 +33,7 @@ public:
     virtual EntityStateUpdate updateStateFromKnob(PB_SmartKnobState state);
     virtual void updateStateFromHASS(MQTTStateUpdate mqtt_state_update);
     virtual void updateStateFromSystem(AppState state);
+    virtual void updateStateFromBeat(MusicBeat beat);
 
     void setMotorNotifier(MotorNotifier *motor_notifier);
     void triggerMotorConfigUpdate();
@@ -52,8 +53,8 @@ public:
         return "App";
     }
 
-    const unsigned char *small_icon;
-    const unsigned char *big_icon;
+    const PackedIcon *small_icon;
+    const PackedIcon *big_icon;
     char friendly_name[64] = "";
     char app_id[64] = "";
     char entity_id[64] = "";
@@ -29,6 +29,43 @@ void MenuApp::add_item(int8_t id, std::shared_ptr<MenuItem> item)
     menu_items_count++;
 };
 
+void MenuApp::prerenderTiles()
+{
+    tiles.clear();
+
+    for (auto &item : items)
+    {
+        if (item.second == nullptr)
+        {
+            continue;
+        }
+
+        MenuTile tile;
+        tile.big = renderTile(item.second->big_icon, MENU_ICON_SIZE_ACTIVE);
+        tile.small = renderTile(item.second->small_icon, MENU_ICON_SIZE_INACTIVE);
+        tiles[item.first] = std::move(tile);
+    }
+}
+
+std::unique_ptr<IndexedLayer> MenuApp::renderTile(const IconItem &icon, uint8_t size)
+{
+    const uint8_t transparent_color = 0;
+    const uint8_t icon_color = 1;
+
+    std::unique_ptr<IndexedLayer> layer(new IndexedLayer(spr_));
+    if (!layer->create(size, size))
+    {
+        LOGE("Failed to allocate menu tile");
+        return nullptr;
+    }
+
+    layer->setTransparentIndex(transparent_color);
+    layer->setPaletteColor(icon_color, icon.color);
+    IconStore::getInstance().drawIcon(layer->sprite(), 0, 0, icon.icon, layer->ink(icon_color), layer->ink(transparent_color));
+
+    return layer;
+}
+
 EntityStateUpdate MenuApp::updateStateFromKnob(PB_SmartKnobState state)
 {
     // TODO: cache menu size
@@ -50,23 +87,10 @@ EntityStateUpdate MenuApp::updateStateFromKnob(PB_SmartKnobState state)
     uint8_t current_menu_position = position_for_menu_calc % get_menu_items_count();
     set_menu_position(current_menu_position);
 
-    if (current_menu_position == 0)
-    {
-        prev_item = find_item(get_menu_items_count() - 1);
-        next_item = find_item(current_menu_position + 1);
-    }
-    else if (current_menu_position == get_menu_items_count() - 1)
-    {
-        prev_item = find_item(current_menu_position - 1);
-        next_item = find_item(0);
-    }
-    else
-    {
-        prev_item = find_item(current_menu_position - 1);
-        next_item = find_item(current_menu_position + 1);
-    }
+    current_item = find_item(current_menu_position);
 
-    next = find_item(current_menu_position)->app_id;
+    // Positive sub position heads towards the next item
+    scroll_q8 = CLAMP<int32_t>(lroundf(state.sub_position_unit * 256), -256, 256);
 
     return EntityStateUpdate{};
 }
@@ -75,46 +99,67 @@ void MenuApp::updateStateFromSystem(AppState state) {}
 
 TFT_eSprite *MenuApp::render()
 {
-    if (prev_item == nullptr || next_item == nullptr)
+    if (current_item == nullptr)
     {
         return this->spr_;
     }
 
-    current_item = find_item(current_menu_position);
-
-    uint32_t background = spr_->color565(0, 0, 0);
-
-    uint16_t center_h = TFT_WIDTH / 2;
-    uint16_t center_v = TFT_WIDTH / 2;
+    int32_t center_h = TFT_WIDTH / 2;
+    int32_t center_v = TFT_WIDTH / 2;
 
-    int8_t room_lable_w = 100;
     int8_t room_lable_h = 30;
     int8_t label_vertical_offset = 25;
 
-    uint8_t icon_size_active = 80;
-    uint8_t icon_size_inactive = 40;
-
     spr_->setTextDatum(CC_DATUM);
 
-    // spr_->fillRect(center_h - room_lable_w / 2, label_vertical_offset, room_lable_w, room_lable_h + 1, current_item->screen_name.color); // +1 for height to draw circle right
-    // spr_->fillCircle(center_h - room_lable_w / 2, label_vertical_offset + room_lable_h / 2, room_lable_h / 2, current_item->screen_name.color);
-    // spr_->fillCircle(center_h + room_lable_w / 2, label_vertical_offset + room_lable_h / 2, room_lable_h / 2, current_item->screen_name.color);
+    if (room[0] != '\0')
+    {
+        GlyphCache::getInstance().drawString(spr_, &Roboto_Thin_Bold_24, room, center_h, label_vertical_offset + room_lable_h / 2 - 1, TFT_BLACK);
+    }
 
-    spr_->setTextColor(TFT_BLACK);
-    spr_->setFreeFont(&Roboto_Thin_Bold_24);
-    spr_->drawString(room, center_h, label_vertical_offset + room_lable_h / 2 - 1, 1);
+    // Whole items in scroll_q8 pick the centre item, the eased fraction slides the row towards the next one
+    int32_t base = scroll_q8 >> 8;
+    int32_t fraction = scroll_q8 & 0xFF;
+    int32_t shift = (smoothstepQ8(fraction) * MENU_CAROUSEL_STEP) >> 8;
 
-    spr_->drawBitmap(center_h - icon_size_active / 2, center_v - icon_size_active / 2, current_item->big_icon.icon, icon_size_active, icon_size_active, current_item->big_icon.color, background);
+    int32_t count = get_menu_items_count();
+    int32_t reach = count > 1 ? 2 : 0;
+    for (int32_t k = -reach; k <= reach + 1; k++)
+    {
+        if (count == 1 && k != 0)
+        {
+            continue;
+        }
+        uint8_t position = ((current_menu_position + base + k) % count + count) % count;
+        drawTile(position, center_h + k * MENU_CAROUSEL_STEP - shift, center_v);
+    }
 
-    // left one
-    spr_->drawBitmap(center_h - icon_size_active / 2 - 20 - icon_size_inactive, center_v - icon_size_inactive / 2, prev_item->small_icon.icon, icon_size_inactive, icon_size_inactive, next_item->small_icon.color, background);
+    GlyphCache::getInstance().drawString(spr_, &Roboto_Thin_24, current_item->screen_name.text, center_h, center_v + MENU_ICON_SIZE_ACTIVE / 2 + 30, current_item->screen_name.color);
 
-    // right one
-    spr_->drawBitmap(center_h + icon_size_active / 2 + 20, center_v - icon_size_inactive / 2, next_item->small_icon.icon, icon_size_inactive, icon_size_inactive, next_item->small_icon.color, background);
+    return this->spr_;
+}
 
-    spr_->setTextColor(current_item->screen_name.color);
-    spr_->setFreeFont(&Roboto_Thin_24);
-    spr_->drawString(current_item->screen_name.text, center_h, center_v + icon_size_active / 2 + 30, 1);
+void MenuApp::drawTile(uint8_t position, int32_t x_center, int32_t y_center)
+{
+    auto it = tiles.find(position);
+    if (it == tiles.end())
+    {
+        return;
+    }
 
-    return this->spr_;
-}
\ No newline at end of file
+    // The item closest to the centre is the active one
+    bool active = abs(x_center - TFT_WIDTH / 2) <= MENU_CAROUSEL_STEP / 2;
+    IndexedLayer *layer = active ? it->second.big.get() : it->second.small.get();
+    if (layer == nullptr)
+    {
+        return;
+    }
+
+    int32_t size = layer->width();
+    if (x_center + size / 2 < 0 || x_center - size / 2 >= TFT_WIDTH)
+    {
+        return;
+    }
+
+    layer->compose(spr_, x_center - size / 2, y_center - size / 2);
+}
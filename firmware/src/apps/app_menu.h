@@ -1,12 +1,29 @@
 #pragma once
 #include "menu.h"
 #include "font/roboto_thin_bold_24.h"
+#include "../gfx/glyph_cache.h"
+#include "../gfx/indexed_layer.h"
+#include "../util.h"
 
 #include <map>
+#include <memory>
 
 const uint8_t SCREEN_NAME_LENGTH = 20;
 const uint8_t MEX_MENU_ITEMS = 12;
 
+const uint8_t MENU_ICON_SIZE_ACTIVE = 80;
+const uint8_t MENU_ICON_SIZE_INACTIVE = 40;
+const uint8_t MENU_ICON_SPACING = 20;
+// Distance between neighbouring items on the carousel
+const int16_t MENU_CAROUSEL_STEP = (MENU_ICON_SIZE_ACTIVE + MENU_ICON_SIZE_INACTIVE) / 2 + MENU_ICON_SPACING;
+
+// Item icons rendered once into 4-bpp layers: index 0 transparent, index 1 the icon colour
+struct MenuTile
+{
+    std::unique_ptr<IndexedLayer> big;
+    std::unique_ptr<IndexedLayer> small;
+};
+
 class MenuApp : public Menu
 {
 public:
@@ -18,10 +35,19 @@ public:
     void add_item(int8_t id, std::shared_ptr<MenuItem> item);
     void update();
 
+    // Renders the icon tiles of every item, call once after adding the items
+    void prerenderTiles();
+
 private:
-    char room[12];
+    char room[12] = "";
 
     std::shared_ptr<MenuItem> current_item;
-    std::shared_ptr<MenuItem> prev_item;
-    std::shared_ptr<MenuItem> next_item;
-};
\ No newline at end of file
+
+    std::map<uint8_t, MenuTile> tiles;
+
+    // sub_position_unit in Q8, drives the carousel between detents
+    int16_t scroll_q8 = 0;
+
+    std::unique_ptr<IndexedLayer> renderTile(const IconItem &icon, uint8_t size);
+    void drawTile(uint8_t position, int32_t x_center, int32_t y_center);
+};
@@ -2,7 +2,7 @@
 #include "apps.h"
 #include "menu.h"
 #include "app_menu.h"
-#include "settings.h"
+#include "settings/settings.h"
 
 #include <typeinfo>
 #include <iterator>
@@ -32,9 +32,13 @@ void Apps::add(uint8_t id, App *app)
 
 void Apps::clear()
 {
+    // Apps release their sprite leases when they are destroyed
     lock();
     apps.clear();
     unlock();
+
+    // Layers only the removed apps used are not needed anymore
+    SpriteArena::getInstance().trim();
 }
 
 EntityStateUpdate Apps::update(AppState state)
@@ -105,7 +109,7 @@ void Apps::setActive(int8_t id)
 void Apps::updateMenu()
 {
     lock();
-    menu = std::make_shared<MenuApp>(spr_);
+    std::shared_ptr<MenuApp> menu_app = std::make_shared<MenuApp>(spr_);
 
     std::map<uint8_t, std::shared_ptr<App>>::iterator it;
     uint16_t position = 0;
@@ -114,7 +118,7 @@ void Apps::updateMenu()
 
     for (it = apps.begin(); it != apps.end(); it++)
     {
-        menu->add_item(
+        menu_app->add_item(
             position,
             std::make_shared<MenuItem>(
                 (int8_t)it->first,
@@ -127,6 +131,9 @@ void Apps::updateMenu()
         position++;
     }
 
+    menu_app->prerenderTiles();
+    menu = menu_app;
+
     unlock();
     setActive(MENU);
 }
@@ -7,6 +7,7 @@
 #include "../app_config.h"
 #include "../notify/motor_notifier/motor_notifier.h"
 #include "../navigation/navigation.h"
+#include "../gfx/sprite_arena.h"
 
 // include all apps
 #include "apps/3d_printing_chamber/3d_printer_chamber.h"
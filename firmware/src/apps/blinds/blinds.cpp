@@ -23,8 +23,8 @@ BlindsApp::BlindsApp(TFT_eSprite *spr_, char *app_id, char *friendly_name, char
         27,
     };
 
-    big_icon = shades_80;
-    small_icon = shades_40;
+    big_icon = &shades_80;
+    small_icon = &shades_40;
 }
 
 int8_t BlindsApp::navigationNext()
@@ -124,7 +124,7 @@ TFT_eSprite *BlindsApp::render()
     if (current_closed_position == 0)
     {
         sprintf(buf_, "%s", "Opened");
-        spr_->drawBitmap(center - arrow_size / 2, TFT_HEIGHT - 20 - arrow_size, arrow_down_50, arrow_size, arrow_size, shade_bar_color, light_background);
+        IconStore::getInstance().drawIcon(spr_, center - arrow_size / 2, TFT_HEIGHT - 20 - arrow_size, &arrow_down_50, shade_bar_color, light_background);
     }
     else if (current_closed_position == 10)
     {
@@ -133,12 +133,12 @@ TFT_eSprite *BlindsApp::render()
     else if (current_closed_position == 20)
     {
         sprintf(buf_, "%s", "Closed");
-        spr_->drawBitmap(center - arrow_size / 2, TFT_HEIGHT - 20 - arrow_size, arrow_up_50, arrow_size, arrow_size, shade_bar_color, shade_color);
+        IconStore::getInstance().drawIcon(spr_, center - arrow_size / 2, TFT_HEIGHT - 20 - arrow_size, &arrow_up_50, shade_bar_color, shade_color);
     }
     else
     {
         sprintf(buf_, "%d%%", current_closed_position * 5);
-        // spr_->drawBitmap(center - arrow_size / 2, TFT_HEIGHT - 20 - arrow_size, arrow_up_50, arrow_size, arrow_size, TFT_OLIVE, TFT_TRANSPARENT);
+        // IconStore::getInstance().drawIcon(spr_, center - arrow_size / 2, TFT_HEIGHT - 20 - arrow_size, &arrow_up_50, TFT_OLIVE, TFT_TRANSPARENT);
     }
 
     spr_->drawString(buf_, TFT_WIDTH / 2, TFT_HEIGHT / 2, 1);
@@ -1,6 +1,9 @@
 #include "climate.h"
 
-ClimateApp::ClimateApp(TFT_eSprite *spr_, char *app_id, char *friendly_name, char *entity_id) : App(spr_)
+IndexedLayer *ClimateApp::dial_layer = nullptr;
+ClimateApp::DialKey ClimateApp::dial_key = {};
+
+ClimateApp::ClimateApp(TFT_eSprite *spr_, char *app_id, char *friendly_name, char *entity_id) : App(spr_), icon_row_layer(spr_)
 {
     // this->app_id = app_id;
     // this->friendly_name = friendly_name;
@@ -34,8 +37,8 @@ ClimateApp::ClimateApp(TFT_eSprite *spr_, char *app_id, char *friendly_name, cha
 
     num_positions = CLIMATE_APP_MAX_TEMP - CLIMATE_APP_MIN_TEMP;
 
-    big_icon = hvac_80;
-    small_icon = hvac_40;
+    big_icon = &hvac_80;
+    small_icon = &hvac_40;
 }
 
 EntityStateUpdate ClimateApp::updateStateFromKnob(PB_SmartKnobState state)
@@ -217,12 +220,41 @@ int8_t ClimateApp::navigationNext()
 
 void ClimateApp::drawDots()
 {
-    // colors
-    uint16_t inactive_color = spr_->color565(71, 71, 71);
-    uint32_t cooling_color = spr_->color565(80, 100, 200);
-    uint32_t cooling_color_dark = spr_->color565(62, 78, 156);
-    uint32_t heating_color = spr_->color565(255, 128, 0);
-    uint32_t heating_color_dark = spr_->color565(199, 109, 18);
+    if (dial_layer == nullptr)
+    {
+        dial_layer = new IndexedLayer(spr_);
+    }
+
+    // Ticks only change with the mode, the current temperature and the range, or when another climate app drew them
+    DialKey key = {mode, current_temperature, min_temp, num_positions, motor_config.position_width_radians};
+    if (!dial_layer->created() || key != dial_key)
+    {
+        renderDialLayer(key);
+    }
+    dial_layer->compose(spr_, 0, 0);
+}
+
+void ClimateApp::renderDialLayer(const DialKey &key)
+{
+    // palette
+    const uint8_t transparent = 0;
+    const uint8_t inactive_color = 1;
+    const uint8_t cooling_color_dark = 2;
+    const uint8_t heating_color_dark = 3;
+    const uint8_t white = 4;
+
+    if (!dial_layer->create(TFT_WIDTH, TFT_HEIGHT))
+    {
+        LOGE("Failed to allocate climate dial layer");
+        return;
+    }
+    dial_layer->setTransparentIndex(transparent);
+    dial_layer->setPaletteColor(inactive_color, spr_->color565(71, 71, 71));
+    dial_layer->setPaletteColor(cooling_color_dark, spr_->color565(62, 78, 156));
+    dial_layer->setPaletteColor(heating_color_dark, spr_->color565(199, 109, 18));
+    dial_layer->setPaletteColor(white, TFT_WHITE);
+
+    TFT_eSprite *layer = dial_layer->sprite();
 
     // screen center
     uint16_t center_h = TFT_WIDTH / 2;
@@ -234,7 +266,7 @@ void ClimateApp::drawDots()
     float left_bound = PI / 2 + range_radians / 2;
     float right_bound = PI / 2 - range_radians / 2;
 
-    uint32_t dot_color = inactive_color;
+    uint8_t dot_color = inactive_color;
     uint8_t dot_radius = 2;
 
     // draw left tick
@@ -244,7 +276,7 @@ void ClimateApp::drawDots()
     }
 
     float dot_position = left_bound;
-    spr_->fillCircle(TFT_WIDTH / 2 + (screen_radius - 10) * cosf(dot_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(dot_position), dot_radius, dot_color);
+    layer->fillCircle(TFT_WIDTH / 2 + (screen_radius - 10) * cosf(dot_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(dot_position), dot_radius, dial_layer->ink(dot_color));
 
     if (mode == CLIMATE_APP_MODE_AUTO || mode == CLIMATE_APP_MODE_HEAT)
     {
@@ -252,7 +284,7 @@ void ClimateApp::drawDots()
     }
 
     dot_position = right_bound;
-    spr_->fillCircle(TFT_WIDTH / 2 + (screen_radius - 10) * cosf(dot_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(dot_position), dot_radius, dot_color);
+    layer->fillCircle(TFT_WIDTH / 2 + (screen_radius - 10) * cosf(dot_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(dot_position), dot_radius, dial_layer->ink(dot_color));
 
     for (int i = 1; i < num_positions + 1; i++)
     {
@@ -269,7 +301,7 @@ void ClimateApp::drawDots()
         }
         else if (min_temp + i == current_temperature)
         {
-            dot_color = TFT_WHITE;
+            dot_color = white;
         }
         else
         {
@@ -284,8 +316,49 @@ void ClimateApp::drawDots()
         }
 
         float dot_position = left_bound - (range_radians / (num_positions)) * i;
-        spr_->fillCircle(TFT_WIDTH / 2 + (screen_radius - 10) * cosf(dot_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(dot_position), dot_radius, dot_color);
+        layer->fillCircle(TFT_WIDTH / 2 + (screen_radius - 10) * cosf(dot_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(dot_position), dot_radius, dial_layer->ink(dot_color));
+    }
+
+    dial_key = key;
+}
+
+void ClimateApp::drawIconRow(uint16_t auto_color, uint16_t snowflake_color, uint16_t fire_color, uint16_t wind_color)
+{
+    // palette, one entry per icon so a colour change needs no redraw
+    const uint8_t transparent = 0;
+    const uint8_t background = 1;
+    const uint8_t auto_icon = 2;
+    const uint8_t snowflake_icon = 3;
+    const uint8_t fire_icon = 4;
+    const uint8_t wind_icon = 5;
+
+    uint16_t icon_size = 20;
+    uint16_t icon_margin = 3;
+
+    if (!icon_row_layer.created())
+    {
+        if (!icon_row_layer.create(icon_size * 4 + icon_margin * 6, icon_size))
+        {
+            LOGE("Failed to allocate climate icon row layer");
+            return;
+        }
+        icon_row_layer.setTransparentIndex(transparent);
+        icon_row_layer.setPaletteColor(background, TFT_BLACK);
+
+        TFT_eSprite *layer = icon_row_layer.sprite();
+        uint16_t background_ink = icon_row_layer.ink(background);
+        IconStore::getInstance().drawIcon(layer, 0, 0, &letter_A, icon_row_layer.ink(auto_icon), background_ink);
+        IconStore::getInstance().drawIcon(layer, icon_size + icon_margin * 2, 0, &snowflake, icon_row_layer.ink(snowflake_icon), background_ink);
+        IconStore::getInstance().drawIcon(layer, icon_size * 2 + icon_margin * 4, 0, &fire, icon_row_layer.ink(fire_icon), background_ink);
+        IconStore::getInstance().drawIcon(layer, icon_size * 3 + icon_margin * 6, 0, &wind, icon_row_layer.ink(wind_icon), background_ink);
     }
+
+    icon_row_layer.setPaletteColor(auto_icon, auto_color);
+    icon_row_layer.setPaletteColor(snowflake_icon, snowflake_color);
+    icon_row_layer.setPaletteColor(fire_icon, fire_color);
+    icon_row_layer.setPaletteColor(wind_icon, wind_color);
+
+    icon_row_layer.compose(spr_, TFT_WIDTH / 2 - icon_size * 2 - icon_margin * 3, TFT_HEIGHT - 30);
 }
 
 // TODO: make this real temp, when sensor is connected
@@ -321,9 +394,7 @@ TFT_eSprite *ClimateApp::render()
     {
         text_color = inactive_color;
     }
-    spr_->setTextColor(text_color);
-    spr_->setFreeFont(&NDS125_small);
-    spr_->drawString(buf_, TFT_WIDTH / 2 + (screen_radius - 10) * cosf(min_number_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(min_number_position), 1);
+    GlyphCache::getInstance().drawString(spr_, &NDS125_small, buf_, TFT_WIDTH / 2 + (screen_radius - 10) * cosf(min_number_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(min_number_position), text_color);
 
     float max_number_position = right_bound - (range_radians / num_positions) * 1.5;
     sprintf(buf_, "%d", max_temp);
@@ -335,9 +406,7 @@ TFT_eSprite *ClimateApp::render()
     {
         text_color = inactive_color;
     }
-    spr_->setTextColor(text_color);
-    spr_->setFreeFont(&NDS125_small);
-    spr_->drawString(buf_, TFT_WIDTH / 2 + (screen_radius - 10) * cosf(max_number_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(max_number_position), 1);
+    GlyphCache::getInstance().drawString(spr_, &NDS125_small, buf_, TFT_WIDTH / 2 + (screen_radius - 10) * cosf(max_number_position), TFT_HEIGHT / 2 - (screen_radius - 10) * sinf(max_number_position), text_color);
 
     uint32_t auto_color = inactive_color;
     uint32_t snowflake_color = inactive_color;
@@ -380,10 +449,11 @@ TFT_eSprite *ClimateApp::render()
 
     // draw current mode with text and color
     std::string status = "";
+    uint32_t status_color = TFT_WHITE;
 
     if (wanted_temperature > current_temperature)
     {
-        spr_->setTextColor(heating_color);
+        status_color = heating_color;
         if (mode == CLIMATE_APP_MODE_AUTO || mode == CLIMATE_APP_MODE_HEAT)
         {
             fire_color = heating_color;
@@ -402,7 +472,7 @@ TFT_eSprite *ClimateApp::render()
     }
     else if (wanted_temperature == current_temperature)
     {
-        spr_->setTextColor(TFT_WHITE);
+        status_color = TFT_WHITE;
         status = "idle";
         if (mode == CLIMATE_APP_MODE_AUTO || mode == CLIMATE_APP_MODE_FAN_ONLY)
         {
@@ -428,7 +498,7 @@ TFT_eSprite *ClimateApp::render()
     }
     else
     {
-        spr_->setTextColor(cooling_color);
+        status_color = cooling_color;
         if (mode == CLIMATE_APP_MODE_AUTO || mode == CLIMATE_APP_MODE_COOL)
         {
             snowflake_color = cooling_color;
@@ -446,32 +516,20 @@ TFT_eSprite *ClimateApp::render()
         }
     }
 
-    spr_->setFreeFont(&NDS1210pt7b);
-    spr_->drawString(status.c_str(), TFT_WIDTH / 2, TFT_HEIGHT / 2 - 45, 1);
+    GlyphCache::getInstance().drawString(spr_, &NDS1210pt7b, status.c_str(), TFT_WIDTH / 2, TFT_HEIGHT / 2 - 45, status_color);
 
     // draw wanted temperature
-    spr_->setFreeFont(&Pixel62mr11pt7b);
     sprintf(buf_, "%d°C", wanted_temperature);
-    spr_->drawString(buf_, TFT_WIDTH / 2, TFT_HEIGHT / 2 - 15, 1);
+    GlyphCache::getInstance().drawString(spr_, &Pixel62mr11pt7b, buf_, TFT_WIDTH / 2, TFT_HEIGHT / 2 - 15, status_color);
 
     // draw current temperature
-    spr_->setTextColor(TFT_WHITE);
-    spr_->setFreeFont(&NDS1210pt7b);
     sprintf(buf_, "%d°C", current_temperature);
-    spr_->drawString(buf_, TFT_WIDTH / 2, TFT_HEIGHT / 2 + 30, 1);
-
-    uint16_t center = TFT_WIDTH / 2;
-
-    // draw bottom icons
+    GlyphCache::getInstance().drawString(spr_, &NDS1210pt7b, buf_, TFT_WIDTH / 2, TFT_HEIGHT / 2 + 30, TFT_WHITE);
 
     drawDots();
 
-    uint16_t icon_size = 20;
-    uint16_t icon_margin = 3;
+    // draw bottom icons
+    drawIconRow(auto_color, snowflake_color, fire_color, wind_color);
 
-    spr_->drawBitmap(center - icon_size * 2 - icon_margin * 3, TFT_HEIGHT - 30, letter_A, icon_size, icon_size, auto_color, TFT_BLACK);
-    spr_->drawBitmap(center - icon_size - icon_margin, TFT_HEIGHT - 30, snowflake, icon_size, icon_size, snowflake_color, TFT_BLACK);
-    spr_->drawBitmap(center + icon_margin, TFT_HEIGHT - 30, fire, icon_size, icon_size, fire_color, TFT_BLACK);
-    spr_->drawBitmap(center + icon_size + icon_margin * 3, TFT_HEIGHT - 30, wind, icon_size, icon_size, wind_color, TFT_BLACK);
     return this->spr_;
 };
\ No newline at end of file
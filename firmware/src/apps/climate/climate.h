@@ -4,6 +4,8 @@
 #include "../../font/NDS1210pt7b.h"
 #include "../../font/NDS125_small.h"
 #include "../../font/Pixel62mr11pt7b.h"
+#include "../../gfx/glyph_cache.h"
+#include "../../gfx/indexed_layer.h"
 
 const uint8_t CLIMATE_APP_MODE_OFF = 0;
 const uint8_t CLIMATE_APP_MODE_HEAT = 1;
@@ -45,7 +47,31 @@ private:
     uint8_t last_wanted_temperature = 0;
     long startTime = 0;
 
+    // Everything the dial ticks depend on
+    struct DialKey
+    {
+        uint8_t mode;
+        uint8_t current_temperature;
+        uint8_t min_temp;
+        uint8_t num_positions;
+        float position_width_radians;
+
+        bool operator!=(const DialKey &other) const
+        {
+            return mode != other.mode || current_temperature != other.current_temperature || min_temp != other.min_temp ||
+                   num_positions != other.num_positions || position_width_radians != other.position_width_radians;
+        }
+    };
+
     void drawDots();
+    void renderDialLayer(const DialKey &key);
+    void drawIconRow(uint16_t auto_color, uint16_t snowflake_color, uint16_t fire_color, uint16_t wind_color);
+
+    // static chrome, 4-bpp. Only one climate app is on screen at a time, so they all
+    // share the full-screen dial layer and redraw it when its key doesn't match.
+    static IndexedLayer *dial_layer;
+    static DialKey dial_key;
+    IndexedLayer icon_row_layer;
 
     bool first_run = false;
 };
\ No newline at end of file
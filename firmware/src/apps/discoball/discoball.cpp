@@ -24,12 +24,8 @@ DiscoballApp::DiscoballApp(TFT_eSprite *spr_, char *app_id, char *friendly_name,
         27,
     };
 
-    big_icon = discoball_80;
-    small_icon = discoball_40;
-
-    backgroundSprite = new TFT_eSprite(spr_);
-    backgroundSprite->createSprite(TFT_WIDTH, TFT_HEIGHT);
-    renderBackground();
+    big_icon = &discoball_80;
+    small_icon = &discoball_40;
 
     uint8_t peerAddress[] = {0x30, 0x30, 0xF9, 0xFB, 0x89, 0xD0};
     memcpy(this->peerAddress, peerAddress, 6);
@@ -61,10 +57,15 @@ int8_t DiscoballApp::navigationNext()
         // After mode type, go to mode speed
         current_mode = DISCOBALL_APP_MODE_MODE_SPEED;
     }
+    else if (current_mode == DISCOBALL_APP_MODE_COLOR)
+    {
+        // The spectrum view sits between color and speed
+        current_mode = DISCOBALL_APP_MODE_SPECTRUM;
+    }
     else
     {
         // Normal navigation between speed and color modes
-        current_mode = static_cast<DiscoballAppMode>((current_mode + 1) % 2);
+        current_mode = current_mode == DISCOBALL_APP_MODE_SPEED ? DISCOBALL_APP_MODE_COLOR : DISCOBALL_APP_MODE_SPEED;
     }
 
     switch (current_mode)
@@ -144,6 +145,26 @@ int8_t DiscoballApp::navigationNext()
             27,
         };
         break;
+
+    case DISCOBALL_APP_MODE_SPECTRUM:
+        // Two detents, beat sync off and on
+        motor_config = PB_SmartKnobConfig{
+            beat_sync ? 1 : 0,
+            0,
+            0,
+            0,
+            1,
+            PI / 8,
+            1,
+            1,
+            1.1,
+            "SKDEMO_Discoball_Spectrum",
+            0,
+            {},
+            0,
+            27,
+        };
+        break;
     }
 
     motor_config.position_nonce = motor_config.position;
@@ -426,15 +447,86 @@ EntityStateUpdate DiscoballApp::updateStateFromKnob(PB_SmartKnobState state)
             discoball.mode_speed = newSpeed;
         }
     }
+    else if (current_mode == DISCOBALL_APP_MODE_SPECTRUM)
+    {
+        bool sync = state.current_position > 0;
+        if (sync != beat_sync)
+        {
+            beat_sync = sync;
+            synced_beats = 0;
+            motor_config.position_nonce = state.current_position;
+            motor_config.position = state.current_position;
+            LOGI("Discoball beat sync %s", beat_sync ? "on" : "off");
+        }
+    }
 
     return new_state;
 }
 
 void DiscoballApp::updateStateFromSystem(AppState state) {}
 
+void DiscoballApp::updateStateFromBeat(MusicBeat beat)
+{
+    if (!beat_sync)
+    {
+        return;
+    }
+
+    // Rotation speed is set on the first beat of every bar, faster music spins the ball faster
+    if (synced_beats % DISCOBALL_BEATS_PER_BAR == 0)
+    {
+        float t = (CLAMP(beat.bpm, DISCOBALL_SYNC_MIN_BPM, DISCOBALL_SYNC_MAX_BPM) - DISCOBALL_SYNC_MIN_BPM) / (DISCOBALL_SYNC_MAX_BPM - DISCOBALL_SYNC_MIN_BPM);
+        int speed = DISCOBALL_SYNC_MIN_SPEED + t * (DISCOBALL_SYNC_MAX_SPEED - DISCOBALL_SYNC_MIN_SPEED);
+        if (speed != discoball.speed)
+        {
+            discoball.speed = speed;
+            lastUpdateTime = millis();
+            LOGI("ESP-NOW: Sending beat synced speed: %d at %.1f BPM", discoball.speed, beat.bpm);
+            esp_now_send(peerAddress, (uint8_t *)&discoball, sizeof(discoball));
+        }
+    }
+
+    // An RF command takes a noticeable time to send, so the spotlights only change every few bars
+    if (discoball.on && synced_beats % (DISCOBALL_BEATS_PER_BAR * DISCOBALL_BARS_PER_RF_CHANGE) == 0)
+    {
+        switch (current_color)
+        {
+        case COLOR_RED:
+            current_color = COLOR_GREEN;
+            sendRfCommand(CMD_GREEN);
+            break;
+        case COLOR_GREEN:
+            current_color = COLOR_BLUE;
+            sendRfCommand(CMD_BLUE);
+            break;
+        case COLOR_BLUE:
+            current_color = COLOR_WHITE;
+            sendRfCommand(CMD_WHITE);
+            break;
+        default:
+            current_color = COLOR_RED;
+            sendRfCommand(CMD_RED);
+            break;
+        }
+    }
+
+    synced_beats++;
+}
+
 TFT_eSprite *DiscoballApp::render()
 {
-    backgroundSprite->pushToSprite(spr_, 0, 0);
+    // Backing store is shared with other apps, it is only ours while we are on screen
+    bool background_valid = false;
+    backgroundSprite = SpriteArena::getInstance().acquire(SPRITE_LAYER_BACKGROUND, background_lease, TFT_WIDTH, TFT_HEIGHT, &background_valid);
+    if (backgroundSprite != nullptr)
+    {
+        if (!background_valid)
+        {
+            renderBackground();
+        }
+        backgroundSprite->pushToSprite(spr_, 0, 0);
+    }
+
     if (current_mode == DISCOBALL_APP_MODE_SPEED)
     {
         int radius = 120;
@@ -675,11 +767,85 @@ TFT_eSprite *DiscoballApp::render()
             }
         }
     }
+    else if (current_mode == DISCOBALL_APP_MODE_SPECTRUM)
+    {
+        renderSpectrum();
+    }
     return this->spr_;
 };
 
+void DiscoballApp::renderSpectrum()
+{
+    spr_->setTextColor(TFT_WHITE);
+    spr_->setFreeFont(&Roboto_Thin_24);
+    spr_->drawString("SPECTRUM", centerX, centerY - 80, 1);
+
+    // Latest analysis straight from the microphone task, no queue in between
+    AudioBands bands = {};
+    AudioBandsChannel::getInstance().read(&bands);
+
+    if (bands.beat_count != spectrumBeatCount)
+    {
+        spectrumBeatCount = bands.beat_count;
+        spectrumBeatFlash = 255;
+    }
+    else
+    {
+        spectrumBeatFlash = spectrumBeatFlash * 0.85;
+    }
+
+    // Beat pulse as a ring around the bars
+    if (spectrumBeatFlash > 0)
+    {
+        uint16_t pulseColor = spr_->color565(spectrumBeatFlash, spectrumBeatFlash, spectrumBeatFlash);
+        for (int r = 108; r < 114; r++)
+        {
+            spr_->drawCircle(centerX, centerY, r, pulseColor);
+        }
+    }
+
+    // One bar per analyzer band, coloured from red (bass) to blue (treble)
+    const float coarse[3] = {bands.low, bands.mid, bands.high};
+    const float *levels = bands.num_bands > 0 ? bands.bands : coarse;
+    const int numBars = bands.num_bands > 0 ? bands.num_bands : 3;
+    const int maxBarHeight = 110;
+    const int baseY = centerY + 65;
+    const int totalWidth = 180;
+    const int barPitch = totalWidth / numBars;
+    const int barWidth = max(barPitch - 2, 1);
+    int startX = centerX - (numBars * barPitch) / 2;
+
+    for (int i = 0; i < numBars; i++)
+    {
+        spectrumPeaks[i] = max(max(levels[i], 0.02f), spectrumPeaks[i] * 0.99f);
+        int height = constrain(levels[i] / spectrumPeaks[i], 0.0f, 1.0f) * maxBarHeight;
+        int x = startX + i * barPitch;
+        RGBColor color = uint32ToRGB(ToRGBA(240.0f * i / max(numBars - 1, 1)));
+
+        spr_->drawRect(x, baseY - maxBarHeight, barWidth, maxBarHeight, TFT_DARKGREY);
+        spr_->fillRect(x, baseY - height, barWidth, height, spr_->color565(color.r, color.g, color.b));
+    }
+
+    char label[24] = "";
+    if (bands.bpm > 0)
+    {
+        sprintf(label, beat_sync ? "SYNC %d BPM" : "%d BPM", (int)roundf(bands.bpm));
+    }
+    else if (beat_sync)
+    {
+        sprintf(label, "SYNC");
+    }
+    spr_->setFreeFont(&Roboto_Thin_20);
+    spr_->drawString(label, centerX, baseY + 20, 1);
+}
+
 void DiscoballApp::renderBackground()
 {
+    if (backgroundSprite == nullptr)
+    {
+        return;
+    }
+
     backgroundSprite->fillSprite(TFT_BLACK); // Clear the sprite
     uint32_t baseColor;
 
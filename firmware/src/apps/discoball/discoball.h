@@ -6,6 +6,9 @@
 #include <cJSON.h>
 #include <esp_now.h>
 
+#include "../../gfx/sprite_arena.h"
+#include "../../microphone/audio_bands.h"
+#include "../../util.h"
 #include "../../font/roboto_thin_20.h"
 #include "../../font/roboto_light_60.h"
 
@@ -33,7 +36,8 @@ enum DiscoballAppMode
     DISCOBALL_APP_MODE_SPEED,
     DISCOBALL_APP_MODE_COLOR,
     DISCOBALL_APP_MODE_MODE_TYPE,
-    DISCOBALL_APP_MODE_MODE_SPEED
+    DISCOBALL_APP_MODE_MODE_SPEED,
+    DISCOBALL_APP_MODE_SPECTRUM
 };
 
 // RF command codes
@@ -49,6 +53,15 @@ static const char *CMD_BREATHE = "1110010000001001000011110";
 static const char *CMD_SPEED_MINUS = "1110010000001001000100000";
 static const char *CMD_SPEED_PLUS = "1110010000001001000100100";
 
+// Beat sync: rotation follows the tempo on every bar, the spotlights change colour every few bars
+static const uint8_t DISCOBALL_BEATS_PER_BAR = 4;
+static const uint8_t DISCOBALL_BARS_PER_RF_CHANGE = 4;
+// Tempo range mapped onto the rotation speed range
+static const float DISCOBALL_SYNC_MIN_BPM = 60;
+static const float DISCOBALL_SYNC_MAX_BPM = 200;
+static const int DISCOBALL_SYNC_MIN_SPEED = 20;
+static const int DISCOBALL_SYNC_MAX_SPEED = 100;
+
 class DiscoballApp : public App
 {
 public:
@@ -57,10 +70,12 @@ public:
     void updateStateFromHASS(MQTTStateUpdate mqtt_state_update) override;
     EntityStateUpdate updateStateFromKnob(PB_SmartKnobState state) override;
     void updateStateFromSystem(AppState state) override;
+    void updateStateFromBeat(MusicBeat beat) override;
     TFT_eSprite *render() override;
 
 private:
     void renderBackground();
+    void renderSpectrum();
     uint32_t getRainbowColor(float longitude);
     uint32_t interpolateColors(uint32_t color1, uint32_t color2, float t);
     void sendRfCommand(const char *command);
@@ -74,7 +89,8 @@ private:
     unsigned long lastUpdateTime = 0;
     const unsigned long debounceDelay = 100;
 
-    TFT_eSprite *backgroundSprite;
+    TFT_eSprite *backgroundSprite = nullptr;
+    SpriteLease background_lease;
     uint8_t peerAddress[6];
     float tiltAngle = PI / 12; // 15 degrees tilt
     int centerX = TFT_WIDTH / 2;
@@ -97,4 +113,13 @@ private:
     float trailLongitudes[30]; // Trail positions
     int trailLength = 50;      // Number of trail segments
     float trailFadeRate = 0.9; // Controls fade speed of the trail
+
+    // Spectrum view, bars are relative to a slowly falling peak per band
+    float spectrumPeaks[AUDIO_MAX_BANDS] = {};
+    uint32_t spectrumBeatCount = 0;
+    uint8_t spectrumBeatFlash = 0;
+
+    // Set from the spectrum view, beats from the microphone then drive rotation and spotlights
+    bool beat_sync = false;
+    uint32_t synced_beats = 0;
 };
@@ -78,6 +78,13 @@ void HassApps::handleEvent(WiFiEvent event)
 
         // cJSON_Delete(event.body.mqtt_state_update.state);
         break;
+    case SK_MUSIC_BEAT:
+        // Apps keep following the music while they are not on screen
+        for (auto &app : apps)
+        {
+            app.second->updateStateFromBeat(event.body.music_beat);
+        }
+        break;
     default:
         break;
     }
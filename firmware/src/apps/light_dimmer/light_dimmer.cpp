@@ -27,8 +27,8 @@ LightDimmerApp::LightDimmerApp(TFT_eSprite *spr_, char *app_id, char *friendly_n
 
     num_positions = motor_config.max_position - motor_config.min_position;
 
-    big_icon = light_top_80;
-    small_icon = light_top_40;
+    big_icon = &light_top_80;
+    small_icon = &light_top_40;
 
     json = cJSON_CreateObject();
 }
@@ -363,14 +363,10 @@ TFT_eSprite *LightDimmerApp::renderHUEWheel()
     HEXColor current_color_hex = hToHEX(app_hue_position);
 
     sprintf(buf_, "#%02X%02X%02X", current_color_hex.r, current_color_hex.g, current_color_hex.b);
-    spr_->setTextColor(current_color);
-    spr_->setFreeFont(&NDS1210pt7b);
-    spr_->drawString(buf_, center_h, center_v, 1);
+    GlyphCache::getInstance().drawString(spr_, &NDS1210pt7b, buf_, center_h, center_v, current_color);
 
     sprintf(buf_, "HEX", app_hue_position);
-    spr_->setFreeFont(&NDS1210pt7b);
-    spr_->setTextColor(color_light_grey);
-    spr_->drawString(buf_, center_h, center_v + 30, 1);
+    GlyphCache::getInstance().drawString(spr_, &NDS1210pt7b, buf_, center_h, center_v + 30, color_light_grey);
 
     return this->spr_;
 }
@@ -447,12 +443,8 @@ TFT_eSprite *LightDimmerApp::render()
     }
 
     spr_->fillRect(0, 0, TFT_WIDTH, TFT_HEIGHT, background_color);
-    spr_->setTextColor(foreground_color);
-    spr_->setFreeFont(&NDS1210pt7b);
-
-    spr_->drawString(friendly_name, center_h, center_v + 20, 1);
-    spr_->setFreeFont(&Pixel62mr11pt7b);
-    spr_->drawString(buf_, center_h, center_v - 22, 1);
+    GlyphCache::getInstance().drawString(spr_, &NDS1210pt7b, friendly_name, center_h, center_v + 20, foreground_color);
+    GlyphCache::getInstance().drawString(spr_, &Pixel62mr11pt7b, buf_, center_h, center_v - 22, foreground_color);
 
     if (current_position > 0)
     {
@@ -38,8 +38,8 @@ LightSwitchApp::LightSwitchApp(TFT_eSprite *spr_, char *app_id, char *friendly_n
         27,               // led_hue
     };
 
-    big_icon = light_switch_80;
-    small_icon = light_switch_40;
+    big_icon = &light_switch_80;
+    small_icon = &light_switch_40;
 }
 
 EntityStateUpdate LightSwitchApp::updateStateFromKnob(PB_SmartKnobState state)
@@ -133,7 +133,7 @@ TFT_eSprite *LightSwitchApp::render()
     if (current_position == 0)
     {
         spr_->fillRect(0, 0, TFT_WIDTH, TFT_HEIGHT, off_background);
-        spr_->drawBitmap(center_h - icon_size / 2, center_v - icon_size / 2 - offset_vertical, lamp_regular, icon_size, icon_size, off_lamp_color, off_background);
+        IconStore::getInstance().drawIcon(spr_, center_h - icon_size / 2, center_v - icon_size / 2 - offset_vertical, &lamp_regular, off_lamp_color, off_background);
         spr_->setTextColor(off_lamp_color);
         spr_->setFreeFont(&Roboto_Thin_24);
         spr_->drawString(friendly_name, center_h, center_v + icon_size / 2 + 30 - offset_vertical, 1);
@@ -141,7 +141,7 @@ TFT_eSprite *LightSwitchApp::render()
     else
     {
         spr_->fillRect(0, 0, TFT_WIDTH, TFT_HEIGHT, on_background);
-        spr_->drawBitmap(center_h - icon_size / 2, center_v - icon_size / 2 - offset_vertical, lamp_solid, icon_size, icon_size, on_lamp_color, on_background);
+        IconStore::getInstance().drawIcon(spr_, center_h - icon_size / 2, center_v - icon_size / 2 - offset_vertical, &lamp_solid, on_lamp_color, on_background);
         spr_->setTextColor(on_lamp_color);
         spr_->setFreeFont(&Roboto_Thin_24);
         spr_->drawString(friendly_name, center_h, center_v + icon_size / 2 + 30 - offset_vertical, 1);
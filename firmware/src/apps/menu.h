@@ -16,10 +16,10 @@ struct TextItem
 
 struct IconItem
 {
-    const unsigned char *icon;
+    const PackedIcon *icon;
     uint16_t color;
 
-    IconItem(const unsigned char *icon = nullptr, uint16_t color = 0) : icon(icon), color(color){};
+    IconItem(const PackedIcon *icon = nullptr, uint16_t color = 0) : icon(icon), color(color){};
 };
 
 struct MenuItem
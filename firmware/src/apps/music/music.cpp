@@ -23,8 +23,8 @@ MusicApp::MusicApp(TFT_eSprite *spr_, std::string entity_name) : App(spr_)
         90,
     };
 
-    big_icon = spotify_80;
-    small_icon = spotify_40;
+    big_icon = &spotify_80;
+    small_icon = &spotify_40;
     // friendly_name = "Music";
     sprintf(friendly_name, "%s", "Music");
 }
@@ -80,7 +80,7 @@ TFT_eSprite *MusicApp::render()
     uint16_t color_spotify = spr_->color565(30, 215, 96);
 
     spr_->fillRect(0, 0, TFT_WIDTH, TFT_HEIGHT, off_background);
-    spr_->drawBitmap(center_h - icon_width / 2, center_v - icon_height / 2 - offset_vertical, spotify_80, icon_width, icon_height, color_spotify, off_background);
+    IconStore::getInstance().drawIcon(spr_, center_h - icon_width / 2, center_v - icon_height / 2 - offset_vertical, &spotify_80, color_spotify, off_background);
 
     spr_->setTextColor(TFT_WHITE);
     spr_->setFreeFont(&Roboto_Thin_Bold_24);
@@ -141,23 +141,23 @@ TFT_eSprite *MusicApp::render()
 
     if (current_volume_position > 15)
     {
-        spr_->drawBitmap(center_h - icon_width / 2 - 30, footer_position + image_offset, volume_30_4, icon_width, icon_height, color_red_dark, off_lamp_color);
+        IconStore::getInstance().drawIcon(spr_, center_h - icon_width / 2 - 30, footer_position + image_offset, &volume_30_4, color_red_dark, off_lamp_color);
     }
     else if (current_volume_position >= 10)
     {
-        spr_->drawBitmap(center_h - icon_width / 2 - 30, footer_position + image_offset, volume_30_4, icon_width, icon_height, TFT_BLACK, off_lamp_color);
+        IconStore::getInstance().drawIcon(spr_, center_h - icon_width / 2 - 30, footer_position + image_offset, &volume_30_4, TFT_BLACK, off_lamp_color);
     }
     else if (current_volume_position >= 5)
     {
-        spr_->drawBitmap(center_h - icon_width / 2 - 30, footer_position + image_offset, volume_30_3, icon_width, icon_height, TFT_BLACK, off_lamp_color);
+        IconStore::getInstance().drawIcon(spr_, center_h - icon_width / 2 - 30, footer_position + image_offset, &volume_30_3, TFT_BLACK, off_lamp_color);
     }
     else if (current_volume_position > 0)
     {
-        spr_->drawBitmap(center_h - icon_width / 2 - 30, footer_position + image_offset, volume_30_2, icon_width, icon_height, TFT_BLACK, off_lamp_color);
+        IconStore::getInstance().drawIcon(spr_, center_h - icon_width / 2 - 30, footer_position + image_offset, &volume_30_2, TFT_BLACK, off_lamp_color);
     }
     else
     {
-        spr_->drawBitmap(center_h - icon_width / 2 - 30, footer_position + image_offset, volume_30_1, icon_width, icon_height, DISABLED_COLOR, off_lamp_color);
+        IconStore::getInstance().drawIcon(spr_, center_h - icon_width / 2 - 30, footer_position + image_offset, &volume_30_1, DISABLED_COLOR, off_lamp_color);
     }
 
     spr_->setTextColor(TFT_BLACK);
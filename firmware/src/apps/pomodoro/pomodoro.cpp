@@ -25,8 +25,8 @@ PomodoroApp::PomodoroApp(TFT_eSprite *spr_) : App(spr_), state(PomodoroState::ID
         45,
     };
 
-    big_icon = stopwatch_80;
-    small_icon = stopwatch_40;
+    big_icon = &stopwatch_80;
+    small_icon = &stopwatch_40;
     // friendly_name = "Pomodoro";
     sprintf(friendly_name, "%s", "Pomodoro");
 }
@@ -31,8 +31,8 @@ SettingsApp::SettingsApp(TFT_eSprite *spr_) : App(spr_)
     num_positions = motor_config.max_position - motor_config.min_position;
 
     // set icons for menu
-    big_icon = settings_80;
-    small_icon = settings_40;
+    big_icon = &settings_80;
+    small_icon = &settings_40;
     // friendly_name = "Settings";
 
     startup_ms = millis();
@@ -203,7 +203,7 @@ TFT_eSprite *SettingsApp::render()
             wifi_icon_color = DISABLED_COLOR;
         }
 
-        spr_->drawBitmap(20, 75, wifi_40, wifi_icon_size, wifi_icon_size, wifi_icon_color, TFT_BLACK);
+        IconStore::getInstance().drawIcon(spr_, 20, 75, &wifi_40, wifi_icon_color, TFT_BLACK);
 
         int16_t signal_strength = connectivity_state.signal_strength;
         std::string signal_strength_text = "";
@@ -431,12 +431,12 @@ TFT_eSprite *SettingsApp::render()
 
     //     if (current_position == 2)
     //     {
-    //         spr_->drawBitmap(center_h - icon_width / 2, center_v - icon_height / 2, omnitrix_char_1, icon_width, icon_height, TFT_BLACK, ben_10_green);
+    //         IconStore::getInstance().drawIcon(spr_, center_h - icon_width / 2, center_v - icon_height / 2, &omnitrix_char_1, TFT_BLACK, ben_10_green);
     //     }
     //     else if (current_position == 3)
     //     {
     //         icon_width = 85;
-    //         spr_->drawBitmap(center_h - icon_width / 2, center_v - icon_height / 2, omnitrix_char_2, icon_width, icon_height, TFT_BLACK, ben_10_green);
+    //         IconStore::getInstance().drawIcon(spr_, center_h - icon_width / 2, center_v - icon_height / 2, &omnitrix_char_2, TFT_BLACK, ben_10_green);
     //     }
 
     //     spr_->fillTriangle(0, 0, center_h + triangle_offset_h, 0, 0, center_v + triangle_offset_v, TFT_BLACK);
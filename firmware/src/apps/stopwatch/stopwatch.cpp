@@ -26,8 +26,8 @@ StopwatchApp::StopwatchApp(TFT_eSprite *spr_, char *entitiy_id) : App(spr_)
         45,
     };
 
-    big_icon = stopwatch_80;
-    small_icon = stopwatch_40;
+    big_icon = &stopwatch_80;
+    small_icon = &stopwatch_40;
     // friendly_name = "Stopwatch";
 }
 
@@ -2,6 +2,9 @@
 #include "display_task.h"
 #include "semaphore_guard.h"
 #include "util.h"
+#include "gfx/glyph_cache.h"
+#include "gfx/icon_store.h"
+#include "gfx/sprite_arena.h"
 
 #include "cJSON.h"
 
@@ -59,6 +62,8 @@ void DisplayTask::run()
     }
     spr_.setTextColor(0xFFFF, TFT_BLACK);
 
+    SpriteArena::getInstance().begin(&tft_);
+
     // Only initialize Demo apps in simplified version
     demo_apps = DemoApps(&spr_);
 
@@ -67,6 +72,14 @@ void DisplayTask::run()
     spr_.setTextDatum(CC_DATUM);
     spr_.setTextColor(TFT_WHITE);
 
+#if SK_GFX_BENCHMARK
+    GlyphCache::getInstance().benchmark(&spr_, &Pixel62mr11pt7b, "25C", 200);
+    GlyphCache::getInstance().benchmark(&spr_, &NDS1210pt7b, "Living room", 200);
+    GlyphCache::getInstance().benchmark(&spr_, &NDS125_small, "16", 200);
+    IconStore::getInstance().benchmark(&spr_, &hvac_80, 200);
+    IconStore::getInstance().benchmark(&spr_, &hvac_40, 200);
+#endif
+
     unsigned long last_rendering_ms = millis();
     unsigned long last_fps_check = millis();
 
@@ -99,6 +112,14 @@ void DisplayTask::run()
             fps_counter++;
             if (last_fps_check + 1000 < millis())
             {
+#if SK_GFX_BENCHMARK
+                GlyphCacheStats glyph_stats = GlyphCache::getInstance().getStats();
+                LOGD("FPS: %d, glyph cache: %d glyphs, %d bytes, %d hits, %d misses, %d evictions", fps_counter, glyph_stats.glyphs, glyph_stats.bytes_used, glyph_stats.hits, glyph_stats.misses, glyph_stats.evictions);
+                IconStoreStats icon_stats = IconStore::getInstance().getStats();
+                LOGD("Icon store: %d icons, %d bytes, %d hits, %d misses, %d evictions, %dus decoding", icon_stats.icons, icon_stats.bytes_used, icon_stats.hits, icon_stats.misses, icon_stats.evictions, icon_stats.decode_us);
+                SpriteArenaStats arena_stats = SpriteArena::getInstance().getStats();
+                LOGD("Sprite arena: %d bytes (peak %d), %d allocations, %d reuses, %d handovers", arena_stats.bytes_allocated, arena_stats.peak_bytes, arena_stats.allocations, arena_stats.reuses, arena_stats.handovers);
+#endif
                 fps_counter = 0;
                 last_fps_check = millis();
             }
@@ -49,7 +49,7 @@ private:
 
     // Only Demo mode is used in simplified version
     DemoApps demo_apps;
-    ErrorHandlingFlow error_handling_flow = ErrorHandlingFlow(&spr_, TFT_eSprite(&tft_));
+    ErrorHandlingFlow error_handling_flow = ErrorHandlingFlow(&spr_);
 
     QueueHandle_t app_state_queue_;
 
@@ -1,33 +1,27 @@
 #include "error_handling_flow.h"
 // TODO Add reset ui flow/"hints".
 
-ErrorHandlingFlow::ErrorHandlingFlow(TFT_eSprite *spr_, TFT_eSprite qrcode_spr_) : spr_(spr_), qrcode_spr_(qrcode_spr_)
+ErrorHandlingFlow::ErrorHandlingFlow(TFT_eSprite *spr_) : spr_(spr_)
 {
 }
 
 void ErrorHandlingFlow::setQRCode(char *qr_data)
 {
-    QRCode qrcode;
-    uint8_t qrcodeVersion = 6;
-    int moduleSize = 2;
-
-    uint8_t qrcodeData[qrcode_getBufferSize(qrcodeVersion)];
-    qrcode_initText(&qrcode, qrcodeData, qrcodeVersion, 0, qr_data);
-
-    int qrCodeWidthHeight = qrcode.size * moduleSize;
-    qrcode_spr_.createSprite(qrCodeWidthHeight, qrCodeWidthHeight);
-    qrcode_spr_.fillSprite(TFT_BLACK);
+    snprintf(qr_data_, sizeof(qr_data_), "%s", qr_data);
+    qrcode_dirty_ = true;
+}
 
-    for (uint8_t y = 0; y < qrcode.size; y++)
+TFT_eSprite *ErrorHandlingFlow::getQRCodeSprite()
+{
+    // The QR layer is shared with the other flow, redraw when it was taken over
+    bool contents_valid = false;
+    TFT_eSprite *qrcode_spr = SpriteArena::getInstance().acquire(SPRITE_LAYER_QRCODE, qrcode_lease_, QRCODE_SPRITE_SIZE, QRCODE_SPRITE_SIZE, &contents_valid);
+    if (qrcode_spr != nullptr && (!contents_valid || qrcode_dirty_))
     {
-        for (uint8_t x = 0; x < qrcode.size; x++)
-        {
-            if (qrcode_getModule(&qrcode, x, y))
-            {
-                qrcode_spr_.fillRect(x * moduleSize, y * moduleSize, moduleSize, moduleSize, TFT_WHITE);
-            }
-        }
+        drawQRCode(qrcode_spr, qr_data_);
+        qrcode_dirty_ = false;
     }
+    return qrcode_spr;
 }
 
 void ErrorHandlingFlow::handleEvent(WiFiEvent event)
@@ -261,8 +255,12 @@ TFT_eSprite *ErrorHandlingFlow::renderRetryLimitReached()
     spr_->setTextSize(1);
     spr_->setTextColor(accent_text_color);
 
-    uint8_t qrsize = qrcode_spr_.width();
-    qrcode_spr_.pushToSprite(spr_, center - qrsize / 2, center - qrsize / 2 - 6, TFT_BLACK);
+    TFT_eSprite *qrcode_spr = getQRCodeSprite();
+    if (qrcode_spr != nullptr)
+    {
+        uint8_t qrsize = qrcode_spr->width();
+        qrcode_spr->pushToSprite(spr_, center - qrsize / 2, center - qrsize / 2 - 6, TFT_BLACK);
+    }
 
     spr_->setFreeFont(&NDS125_small);
     spr_->drawString("Retry limit reached", center, center - screen_name_label_h * 3.4, 1);
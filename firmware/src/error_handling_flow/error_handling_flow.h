@@ -4,7 +4,8 @@
 #include "apps/app.h"
 
 #include "util.h"
-#include "qrcode.h"
+#include "gfx/qrcode_sprite.h"
+#include "gfx/sprite_arena.h"
 #include "navigation/navigation.h"
 #include "notify/motor_notifier/motor_notifier.h"
 #include "notify/wifi_notifier/wifi_notifier.h"
@@ -15,7 +16,7 @@
 class ErrorHandlingFlow
 {
 public:
-    ErrorHandlingFlow(TFT_eSprite *spr_, TFT_eSprite qrcode_spr_);
+    ErrorHandlingFlow(TFT_eSprite *spr_);
 
     void setQRCode(char *qr_data);
 
@@ -32,7 +33,10 @@ public:
 
 private:
     TFT_eSprite *spr_ = NULL;
-    TFT_eSprite qrcode_spr_;
+    char qr_data_[128] = "";
+    bool qrcode_dirty_ = false;
+    SpriteLease qrcode_lease_;
+    TFT_eSprite *getQRCodeSprite();
 
     char buf_[64];
 
@@ -74,6 +74,16 @@ struct DiscoMessage
     char spotlights_color[8]; // To hold color value like "#ff0000"
 };
 
+struct MusicBeat
+{
+    float bpm;
+    // Autocorrelation peak of the tempo estimate, 0..1
+    float confidence;
+    // How far the onset at this beat stood out, 0..1
+    float strength;
+    uint32_t beat_count;
+};
+
 struct WiFiError
 {
     uint8_t retry_count;
@@ -115,6 +125,7 @@ union WiFiEventBody
     MQTTConfiguration mqtt_connecting;
     MQTTStateUpdate mqtt_state_update;
     DiscoMessage disco_message;
+    MusicBeat music_beat;
     Error error;
     uint8_t calibration_step;
     uint8_t clap_count;
@@ -167,7 +178,9 @@ enum EventType
     
     SK_DOUBLE_CLAP_DETECTED,
     
-    SK_DISCO_MESSAGE
+    SK_DISCO_MESSAGE,
+
+    SK_MUSIC_BEAT
 };
 
 typedef unsigned long SentAt;
@@ -0,0 +1,114 @@
+#include "filters.h"
+
+#if SK_FILTER_BENCHMARK
+
+#include <memory>
+#include <vector>
+
+// The moving average this library replaced: shifts the window on every sample and sums it again in double
+class ShiftingMovingAverage
+{
+public:
+    ShiftingMovingAverage(int length) : window_(length, 0.0f) {}
+
+    float addSample(float value)
+    {
+        for (int i = window_.size() - 1; i > 0; i--)
+        {
+            window_[i] = window_[i - 1];
+        }
+        window_[0] = value;
+
+        double sum = 0.0;
+        for (float sample : window_)
+        {
+            sum += sample;
+        }
+        return sum / window_.size();
+    }
+
+private:
+    std::vector<float> window_;
+};
+
+// Strain-like input: a slow press with noise and the occasional spike
+static float benchmarkInput(uint32_t i)
+{
+    float noise = (float)((i * 1103515245u + 12345u) >> 16 & 0x3FF) / 1024.0f - 0.5f;
+    float spike = i % 97 == 0 ? 50.0f : 0.0f;
+    return 1000.0f * sinf(i * 0.01f) + 20.0f * noise + spike;
+}
+
+template <typename F>
+static float benchmarkUs(F &&add_sample, uint32_t samples)
+{
+    // The sink keeps the compiler from dropping the filter work
+    volatile float sink = 0;
+    unsigned long started_at = micros();
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        sink = add_sample(benchmarkInput(i));
+    }
+    (void)sink;
+    return (float)(micros() - started_at) / samples;
+}
+
+void benchmarkFilters(uint32_t samples)
+{
+    // Off the stack, the sensors task runs this with a small one
+    std::unique_ptr<ShiftingMovingAverage> shifting10(new ShiftingMovingAverage(10));
+    std::unique_ptr<ShiftingMovingAverage> shifting64(new ShiftingMovingAverage(64));
+    std::unique_ptr<MovingAverage<10>> average10(new MovingAverage<10>());
+    std::unique_ptr<MovingAverage<64>> average64(new MovingAverage<64>());
+    std::unique_ptr<MedianFilter<5>> median5(new MedianFilter<5>());
+    std::unique_ptr<MedianFilter<15>> median15(new MedianFilter<15>());
+    Ewma ewma(Ewma::alphaFor(2, 120));
+    Biquad biquad(BiquadCoefficients::lowPass(5, 120));
+    OneEuroFilter one_euro(1, 0.05f);
+
+    float baseline_us = benchmarkUs([](float x)
+                                    { return x; },
+                                    samples);
+
+    struct Result
+    {
+        const char *name;
+        float us;
+    } results[] = {
+        {"shifting average, 10", benchmarkUs([&](float x)
+                                             { return shifting10->addSample(x); },
+                                             samples)},
+        {"shifting average, 64", benchmarkUs([&](float x)
+                                             { return shifting64->addSample(x); },
+                                             samples)},
+        {"MovingAverage<10>", benchmarkUs([&](float x)
+                                          { return average10->addSample(x); },
+                                          samples)},
+        {"MovingAverage<64>", benchmarkUs([&](float x)
+                                          { return average64->addSample(x); },
+                                          samples)},
+        {"MedianFilter<5>", benchmarkUs([&](float x)
+                                        { return median5->addSample(x); },
+                                        samples)},
+        {"MedianFilter<15>", benchmarkUs([&](float x)
+                                         { return median15->addSample(x); },
+                                         samples)},
+        {"Ewma", benchmarkUs([&](float x)
+                             { return ewma.addSample(x); },
+                             samples)},
+        {"Biquad", benchmarkUs([&](float x)
+                               { return biquad.addSample(x); },
+                               samples)},
+        {"OneEuroFilter", benchmarkUs([&](float x)
+                                      { return one_euro.addSample(x, 1 / 120.0f); },
+                                      samples)},
+    };
+
+    // Cost of the filter alone, the input generator is measured separately and subtracted
+    for (const Result &result : results)
+    {
+        LOGI("Filter %s: %.3fus per sample", result.name, max(0.0f, result.us - baseline_us));
+    }
+}
+
+#endif
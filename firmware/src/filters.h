@@ -0,0 +1,261 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "logging.h"
+
+#include <algorithm>
+
+// Streaming filters for the sensor readings. Every filter keeps its state
+// inline, sized at compile time, and costs a constant amount per sample.
+// The median is the exception, its cost grows with the (small) window.
+
+// Mean of the last N samples.
+//
+// The window starts filled with zeros, so the output ramps up over the first
+// N samples. The running sum is Kahan compensated: each add and subtract
+// carries its rounding error into the next one, so the sum does not drift
+// however long the filter runs and every sample costs the same.
+template <uint8_t N>
+class MovingAverage
+{
+    static_assert(N > 0, "MovingAverage needs a window of at least one sample");
+
+public:
+    float addSample(float value)
+    {
+        accumulate(value);
+        accumulate(-window_[head_]);
+        window_[head_] = value;
+        head_ = head_ + 1 == N ? 0 : head_ + 1;
+        value_ = sum_ / N;
+        return value_;
+    }
+
+    float getValue() { return value_; }
+
+    void reset()
+    {
+        memset(window_, 0, sizeof(window_));
+        head_ = 0;
+        sum_ = 0;
+        compensation_ = 0;
+        value_ = 0;
+    }
+
+private:
+    float window_[N] = {};
+    uint8_t head_ = 0;
+    float sum_ = 0;
+    // Low order bits lost by the last addition to sum_
+    float compensation_ = 0;
+    float value_ = 0;
+
+    void accumulate(float value)
+    {
+        float y = value - compensation_;
+        float t = sum_ + y;
+        compensation_ = (t - sum_) - y;
+        sum_ = t;
+    }
+};
+
+// Exponentially weighted moving average, alpha is the weight of the newest
+// sample. The first sample after a reset is taken as is.
+class Ewma
+{
+public:
+    Ewma(float alpha) : alpha_(alpha) {}
+
+    float addSample(float value)
+    {
+        value_ = primed_ ? value_ + alpha_ * (value - value_) : value;
+        primed_ = true;
+        return value_;
+    }
+
+    float getValue() { return value_; }
+
+    void reset() { primed_ = false; }
+
+    // For inputs without a fixed rate, recompute alpha from alphaFor() as samples arrive
+    void setAlpha(float alpha) { alpha_ = alpha; }
+
+    // Alpha of a first order low-pass with the given cutoff
+    static float alphaFor(float cutoff_hz, float sample_rate_hz)
+    {
+        float tau = 1 / (2 * PI * cutoff_hz);
+        return 1 / (1 + tau * sample_rate_hz);
+    }
+
+private:
+    float alpha_;
+    float value_ = 0;
+    bool primed_ = false;
+};
+
+// Median of the last N samples, rejects spikes shorter than half the window.
+//
+// The window is kept sorted next to the ring: the oldest value is taken out and
+// the new one inserted in place, about N compares and moves per sample.
+// Until the window is full the median is taken over the samples seen so far.
+template <uint8_t N>
+class MedianFilter
+{
+    static_assert(N % 2 == 1, "MedianFilter needs an odd window");
+
+public:
+    float addSample(float value)
+    {
+        if (count_ == N)
+        {
+            // Drop the oldest sample from the sorted copy
+            uint8_t i = std::lower_bound(sorted_, sorted_ + N, ring_[head_]) - sorted_;
+            memmove(sorted_ + i, sorted_ + i + 1, (N - 1 - i) * sizeof(float));
+            count_--;
+        }
+        ring_[head_] = value;
+        head_ = head_ + 1 == N ? 0 : head_ + 1;
+
+        uint8_t i = std::upper_bound(sorted_, sorted_ + count_, value) - sorted_;
+        memmove(sorted_ + i + 1, sorted_ + i, (count_ - i) * sizeof(float));
+        sorted_[i] = value;
+        count_++;
+
+        value_ = sorted_[count_ / 2];
+        return value_;
+    }
+
+    float getValue() { return value_; }
+
+    void reset()
+    {
+        head_ = 0;
+        count_ = 0;
+        value_ = 0;
+    }
+
+private:
+    float ring_[N] = {};
+    float sorted_[N] = {};
+    uint8_t head_ = 0;
+    uint8_t count_ = 0;
+    float value_ = 0;
+};
+
+// Normalized second order section coefficients, a0 is 1
+struct BiquadCoefficients
+{
+    float b0, b1, b2;
+    float a1, a2;
+
+    // RBJ audio EQ cookbook designs, q = 0.7071 is Butterworth
+    static BiquadCoefficients lowPass(float cutoff_hz, float sample_rate_hz, float q = 0.7071f)
+    {
+        float w0 = 2 * PI * cutoff_hz / sample_rate_hz;
+        float alpha = sinf(w0) / (2 * q);
+        float cosw0 = cosf(w0);
+        float a0 = 1 + alpha;
+        return {(1 - cosw0) / 2 / a0, (1 - cosw0) / a0, (1 - cosw0) / 2 / a0, -2 * cosw0 / a0, (1 - alpha) / a0};
+    }
+
+    static BiquadCoefficients highPass(float cutoff_hz, float sample_rate_hz, float q = 0.7071f)
+    {
+        float w0 = 2 * PI * cutoff_hz / sample_rate_hz;
+        float alpha = sinf(w0) / (2 * q);
+        float cosw0 = cosf(w0);
+        float a0 = 1 + alpha;
+        return {(1 + cosw0) / 2 / a0, -(1 + cosw0) / a0, (1 + cosw0) / 2 / a0, -2 * cosw0 / a0, (1 - alpha) / a0};
+    }
+};
+
+// Second order IIR section in transposed direct form II, two state variables
+// and five multiplies per sample.
+class Biquad
+{
+public:
+    Biquad(const BiquadCoefficients &coefficients) : c_(coefficients) {}
+
+    float addSample(float value)
+    {
+        float y = c_.b0 * value + z1_;
+        z1_ = c_.b1 * value - c_.a1 * y + z2_;
+        z2_ = c_.b2 * value - c_.a2 * y;
+        value_ = y;
+        return y;
+    }
+
+    float getValue() { return value_; }
+
+    // Starts from the steady state for a constant input, avoids the step response after a reset
+    void reset(float value = 0)
+    {
+        float dc_gain = (c_.b0 + c_.b1 + c_.b2) / (1 + c_.a1 + c_.a2);
+        value_ = value * dc_gain;
+        z2_ = c_.b2 * value - c_.a2 * value_;
+        z1_ = value_ - c_.b0 * value;
+    }
+
+private:
+    BiquadCoefficients c_;
+    float z1_ = 0;
+    float z2_ = 0;
+    float value_ = 0;
+};
+
+// One euro filter (Casiez et al. 2012): a low-pass whose cutoff rises with the
+// speed of the signal, so it smooths jitter at rest without lagging behind
+// fast changes. min_cutoff sets the smoothing at rest, beta how quickly the
+// cutoff opens up with speed. Samples carry their own time step, so an
+// irregular rate is fine.
+class OneEuroFilter
+{
+public:
+    OneEuroFilter(float min_cutoff_hz, float beta, float derivative_cutoff_hz = 1)
+        : min_cutoff_hz_(min_cutoff_hz), beta_(beta), derivative_cutoff_hz_(derivative_cutoff_hz) {}
+
+    float addSample(float value, float dt_s)
+    {
+        if (!primed_ || dt_s <= 0)
+        {
+            value_ = primed_ ? value_ : value;
+            primed_ = true;
+            return value_;
+        }
+
+        float derivative = (value - value_) / dt_s;
+        derivative_ += alpha(derivative_cutoff_hz_, dt_s) * (derivative - derivative_);
+
+        float cutoff_hz = min_cutoff_hz_ + beta_ * fabsf(derivative_);
+        value_ += alpha(cutoff_hz, dt_s) * (value - value_);
+        return value_;
+    }
+
+    float getValue() { return value_; }
+
+    void reset()
+    {
+        primed_ = false;
+        derivative_ = 0;
+    }
+
+private:
+    float min_cutoff_hz_;
+    float beta_;
+    float derivative_cutoff_hz_;
+    float value_ = 0;
+    float derivative_ = 0;
+    bool primed_ = false;
+
+    static float alpha(float cutoff_hz, float dt_s)
+    {
+        float tau = 1 / (2 * PI * cutoff_hz);
+        return 1 / (1 + tau / dt_s);
+    }
+};
+
+#if SK_FILTER_BENCHMARK
+// Logs the cost per sample of every filter next to the shifting moving average
+// these filters replaced. test/test_filters checks what they compute.
+void benchmarkFilters(uint32_t samples);
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Arduino.h>
+#include "esp_heap_caps.h"
+
+// Caches in gfx/ keep their buffers in PSRAM, internal RAM is reserved for the
+// framebuffer and task stacks. Buffers are released with free().
+inline void *gfxAlloc(size_t size)
+{
+    void *ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (ptr == nullptr)
+    {
+        // No PSRAM (or it is exhausted), fall back to internal RAM
+        ptr = malloc(size);
+    }
+    return ptr;
+}
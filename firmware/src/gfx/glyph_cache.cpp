@@ -0,0 +1,389 @@
+#include "glyph_cache.h"
+#include "gfx_alloc.h"
+#include "../logging.h"
+
+#include <vector>
+
+int16_t GlyphCache::drawString(TFT_eSprite *spr, const GFXfont *font, const char *string, int32_t x, int32_t y, uint16_t color)
+{
+    if (font == nullptr || string == nullptr)
+    {
+        return 0;
+    }
+
+    if (spr->getColorDepth() != 16 || spr->getPointer() == nullptr)
+    {
+        // Cached glyphs are written straight into a 16-bit framebuffer, anything else goes the slow way
+        spr->setFreeFont(font);
+        spr->setTextColor(color);
+        return spr->drawString(string, x, y, 1);
+    }
+
+    const FontMetrics &metrics = getFontMetrics(font);
+
+    // Datum handling mirrors TFT_eSPI::drawString() for free fonts
+    int32_t cwidth = textWidth(font, string);
+    int32_t cheight = metrics.glyph_ab;
+    int32_t baseline = metrics.glyph_ab;
+    y += cheight;
+
+    uint8_t datum = spr->getTextDatum();
+    if (datum == BL_DATUM || datum == BC_DATUM || datum == BR_DATUM)
+    {
+        cheight += metrics.glyph_bb;
+    }
+
+    switch (datum)
+    {
+    case TC_DATUM:
+        x -= cwidth / 2;
+        break;
+    case TR_DATUM:
+        x -= cwidth;
+        break;
+    case ML_DATUM:
+        y -= cheight / 2;
+        break;
+    case MC_DATUM:
+        x -= cwidth / 2;
+        y -= cheight / 2;
+        break;
+    case MR_DATUM:
+        x -= cwidth;
+        y -= cheight / 2;
+        break;
+    case BL_DATUM:
+        y -= cheight;
+        break;
+    case BC_DATUM:
+        x -= cwidth / 2;
+        y -= cheight;
+        break;
+    case BR_DATUM:
+        x -= cwidth;
+        y -= cheight;
+        break;
+    case L_BASELINE:
+        y -= baseline;
+        break;
+    case C_BASELINE:
+        x -= cwidth / 2;
+        y -= baseline;
+        break;
+    case R_BASELINE:
+        x -= cwidth;
+        y -= baseline;
+        break;
+    default:
+        break;
+    }
+
+    // 16-bit sprites keep pixels byte swapped
+    uint16_t swapped_color = (color >> 8) | (color << 8);
+
+    int16_t sum_x = 0;
+    uint16_t len = strlen(string);
+    uint16_t n = 0;
+    while (n < len)
+    {
+        uint16_t code = decodeUTF8((const uint8_t *)string, &n, len - n);
+        const CachedGlyph *glyph = getGlyph(font, code);
+        if (glyph == nullptr)
+        {
+            continue;
+        }
+        blit(spr, glyph, x + sum_x, y, swapped_color);
+        sum_x += glyph->x_advance;
+    }
+
+    return sum_x;
+}
+
+int16_t GlyphCache::textWidth(const GFXfont *font, const char *string)
+{
+    int16_t width = 0;
+    uint16_t len = strlen(string);
+    uint16_t n = 0;
+    while (n < len)
+    {
+        uint16_t code = decodeUTF8((const uint8_t *)string, &n, len - n);
+        if (code < font->first || code > font->last)
+        {
+            continue;
+        }
+        const GFXglyph *glyph = &font->glyph[code - font->first];
+
+        // Same rule as TFT_eSPI: the last character counts its ink, not its advance
+        if (n < len)
+        {
+            width += glyph->xAdvance;
+        }
+        else
+        {
+            width += glyph->xOffset + glyph->width;
+        }
+    }
+    return width;
+}
+
+void GlyphCache::clear()
+{
+    for (auto &entry : entries_)
+    {
+        free(entry.second.glyph.spans);
+    }
+    entries_.clear();
+    lru_.clear();
+    stats_.bytes_used = 0;
+}
+
+GlyphCacheStats GlyphCache::getStats()
+{
+    stats_.glyphs = entries_.size();
+    return stats_;
+}
+
+void GlyphCache::benchmark(TFT_eSprite *spr, const GFXfont *font, const char *string, uint16_t iterations)
+{
+    int32_t center_h = spr->width() / 2;
+    int32_t center_v = spr->height() / 2;
+
+    unsigned long started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        spr->setFreeFont(font);
+        spr->setTextColor(TFT_WHITE);
+        spr->drawString(string, center_h, center_v, 1);
+    }
+    unsigned long tft_us = micros() - started_at;
+
+    // Warm up so the first-use rasterization is not part of the measurement
+    drawString(spr, font, string, center_h, center_v, TFT_WHITE);
+
+    started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        drawString(spr, font, string, center_h, center_v, TFT_WHITE);
+    }
+    unsigned long cached_us = micros() - started_at;
+
+    float tft_per_string = (float)tft_us / iterations;
+    float cached_per_string = (float)cached_us / iterations;
+
+    LOGI("drawString '%s' x%d: TFT_eSPI %.1fus (%.0f/s), glyph cache %.1fus (%.0f/s), %.1fx",
+         string,
+         iterations,
+         tft_per_string,
+         1000000.0f / tft_per_string,
+         cached_per_string,
+         1000000.0f / cached_per_string,
+         tft_per_string / cached_per_string);
+}
+
+const GlyphCache::FontMetrics &GlyphCache::getFontMetrics(const GFXfont *font)
+{
+    auto it = font_metrics_.find(font);
+    if (it != font_metrics_.end())
+    {
+        return it->second;
+    }
+
+    // Same scan TFT_eSPI::setFreeFont() does to find the extent above and below the baseline
+    FontMetrics metrics = {0, 0};
+    uint16_t num_chars = font->last - font->first;
+    for (uint16_t c = 0; c < num_chars; c++)
+    {
+        const GFXglyph *glyph = &font->glyph[c];
+        int8_t ab = -glyph->yOffset;
+        if (ab > metrics.glyph_ab)
+        {
+            metrics.glyph_ab = ab;
+        }
+        int8_t bb = glyph->height - ab;
+        if (bb > metrics.glyph_bb)
+        {
+            metrics.glyph_bb = bb;
+        }
+    }
+
+    return font_metrics_.insert(std::make_pair(font, metrics)).first->second;
+}
+
+const CachedGlyph *GlyphCache::getGlyph(const GFXfont *font, uint16_t code)
+{
+    if (code < font->first || code > font->last)
+    {
+        return nullptr;
+    }
+
+    GlyphKey key = std::make_pair(font, code);
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        stats_.hits++;
+        lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+        return &it->second.glyph;
+    }
+
+    stats_.misses++;
+
+    CachedGlyph glyph;
+    if (!rasterize(font, code, &glyph))
+    {
+        return nullptr;
+    }
+
+    while (!lru_.empty() && (entries_.size() >= GLYPH_CACHE_MAX_GLYPHS || stats_.bytes_used + glyph.size_bytes > GLYPH_CACHE_MAX_BYTES))
+    {
+        evict();
+    }
+
+    lru_.push_front(key);
+    CacheEntry entry = {glyph, lru_.begin()};
+    stats_.bytes_used += glyph.size_bytes;
+
+    return &entries_.insert(std::make_pair(key, entry)).first->second.glyph;
+}
+
+bool GlyphCache::rasterize(const GFXfont *font, uint16_t code, CachedGlyph *out)
+{
+    const GFXglyph *glyph = &font->glyph[code - font->first];
+    const uint8_t *bitmap = font->bitmap;
+
+    std::vector<GlyphSpan> spans;
+
+    // GFX bitmaps are a continuous MSB-first bit stream, rows are not byte aligned
+    uint32_t bo = glyph->bitmapOffset;
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    for (uint8_t yy = 0; yy < glyph->height; yy++)
+    {
+        int16_t run_start = -1;
+        for (uint8_t xx = 0; xx < glyph->width; xx++)
+        {
+            if (!(bit++ & 7))
+            {
+                bits = bitmap[bo++];
+            }
+            bool set = bits & 0x80;
+            bits <<= 1;
+
+            if (set && run_start < 0)
+            {
+                run_start = xx;
+            }
+            else if (!set && run_start >= 0)
+            {
+                spans.push_back(GlyphSpan{yy, (uint8_t)run_start, (uint8_t)(xx - run_start)});
+                run_start = -1;
+            }
+        }
+        if (run_start >= 0)
+        {
+            spans.push_back(GlyphSpan{yy, (uint8_t)run_start, (uint8_t)(glyph->width - run_start)});
+        }
+    }
+
+    out->x_offset = glyph->xOffset;
+    out->y_offset = glyph->yOffset;
+    out->x_advance = glyph->xAdvance;
+    out->span_count = spans.size();
+    out->size_bytes = sizeof(CachedGlyph) + spans.size() * sizeof(GlyphSpan);
+    out->spans = nullptr;
+
+    if (!spans.empty())
+    {
+        out->spans = (GlyphSpan *)gfxAlloc(spans.size() * sizeof(GlyphSpan));
+        if (out->spans == nullptr)
+        {
+            LOGE("Failed to allocate glyph 0x%02X", code);
+            return false;
+        }
+        memcpy(out->spans, spans.data(), spans.size() * sizeof(GlyphSpan));
+    }
+
+    return true;
+}
+
+void GlyphCache::evict()
+{
+    GlyphKey key = lru_.back();
+    lru_.pop_back();
+
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        stats_.bytes_used -= it->second.glyph.size_bytes;
+        free(it->second.glyph.spans);
+        entries_.erase(it);
+        stats_.evictions++;
+    }
+}
+
+void GlyphCache::blit(TFT_eSprite *spr, const CachedGlyph *glyph, int32_t x, int32_t y, uint16_t swapped_color)
+{
+    uint16_t *framebuffer = (uint16_t *)spr->getPointer();
+    int32_t width = spr->width();
+    int32_t height = spr->height();
+
+    int32_t origin_x = x + glyph->x_offset;
+    int32_t origin_y = y + glyph->y_offset;
+
+    for (uint16_t i = 0; i < glyph->span_count; i++)
+    {
+        const GlyphSpan &span = glyph->spans[i];
+
+        int32_t py = origin_y + span.row;
+        if (py < 0 || py >= height)
+        {
+            continue;
+        }
+
+        int32_t px = origin_x + span.x;
+        int32_t len = span.len;
+        if (px < 0)
+        {
+            len += px;
+            px = 0;
+        }
+        if (px + len > width)
+        {
+            len = width - px;
+        }
+        if (len <= 0)
+        {
+            continue;
+        }
+
+        uint16_t *pixel = framebuffer + py * width + px;
+        while (len--)
+        {
+            *pixel++ = swapped_color;
+        }
+    }
+}
+
+uint16_t GlyphCache::decodeUTF8(const uint8_t *buf, uint16_t *index, uint16_t remaining)
+{
+    uint16_t c = buf[(*index)++];
+
+    if ((c & 0x80) == 0x00)
+    {
+        return c;
+    }
+
+    if ((c & 0xE0) == 0xC0 && remaining > 1)
+    {
+        return ((c & 0x1F) << 6) | (buf[(*index)++] & 0x3F);
+    }
+
+    if ((c & 0xF0) == 0xE0 && remaining > 2)
+    {
+        c = ((c & 0x0F) << 12) | ((buf[(*index)] & 0x3F) << 6);
+        (*index)++;
+        c = c | (buf[(*index)++] & 0x3F);
+        return c;
+    }
+
+    return c;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include <list>
+#include <map>
+#include <utility>
+
+// Upper bounds for the glyph cache. Entries live in PSRAM, the bound mostly keeps
+// the LRU list short so lookups stay cheap.
+const uint16_t GLYPH_CACHE_MAX_GLYPHS = 384;
+const uint32_t GLYPH_CACHE_MAX_BYTES = 96 * 1024;
+
+// One horizontal run of set pixels inside a glyph, relative to the glyph box.
+struct GlyphSpan
+{
+    uint8_t row;
+    uint8_t x;
+    uint8_t len;
+};
+
+// Pre-rasterized glyph. Pixels are stored as row spans (a run-length 1-bpp block),
+// so one entry can be blitted in any colour with a handful of 16-bit fills.
+struct CachedGlyph
+{
+    int8_t x_offset;
+    int8_t y_offset;
+    uint8_t x_advance;
+    uint16_t span_count;
+    uint32_t size_bytes;
+    GlyphSpan *spans;
+};
+
+struct GlyphCacheStats
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t bytes_used;
+    uint16_t glyphs;
+};
+
+// Replacement for TFT_eSprite::drawString() with GFX free fonts. Glyphs are
+// rasterized once into span lists kept in PSRAM and then written straight into
+// the 16-bit sprite framebuffer. Output matches TFT_eSPI pixel for pixel for
+// transparent text (text size 1), which is how every app draws its labels.
+//
+// Only the display task renders, so the cache is not guarded by a mutex.
+class GlyphCache
+{
+public:
+    static GlyphCache &getInstance()
+    {
+        static GlyphCache instance;
+        return instance;
+    }
+
+    // Draws string using the sprite's current text datum. Returns drawn width in pixels.
+    int16_t drawString(TFT_eSprite *spr, const GFXfont *font, const char *string, int32_t x, int32_t y, uint16_t color);
+    int16_t textWidth(const GFXfont *font, const char *string);
+
+    void clear();
+    GlyphCacheStats getStats();
+
+    // Times TFT_eSPI drawString against the cached path and logs the results.
+    void benchmark(TFT_eSprite *spr, const GFXfont *font, const char *string, uint16_t iterations);
+
+private:
+    GlyphCache(){};
+    ~GlyphCache() { clear(); };
+
+    struct FontMetrics
+    {
+        int8_t glyph_ab;
+        int8_t glyph_bb;
+    };
+
+    typedef std::pair<const GFXfont *, uint16_t> GlyphKey;
+    typedef std::list<GlyphKey> LruList;
+
+    struct CacheEntry
+    {
+        CachedGlyph glyph;
+        LruList::iterator lru_position;
+    };
+
+    std::map<GlyphKey, CacheEntry> entries_;
+    std::map<const GFXfont *, FontMetrics> font_metrics_;
+    LruList lru_;
+
+    GlyphCacheStats stats_ = {};
+
+    const FontMetrics &getFontMetrics(const GFXfont *font);
+    const CachedGlyph *getGlyph(const GFXfont *font, uint16_t code);
+    bool rasterize(const GFXfont *font, uint16_t code, CachedGlyph *out);
+    void evict();
+    void blit(TFT_eSprite *spr, const CachedGlyph *glyph, int32_t x, int32_t y, uint16_t swapped_color);
+
+    static uint16_t decodeUTF8(const uint8_t *buf, uint16_t *index, uint16_t remaining);
+};
@@ -0,0 +1,599 @@
+// Generated by firmware/icons/pack_icons.py from firmware/icons/icons.h, do not edit.
+
+#include "icon_pack.h"
+
+static const uint8_t icon_pack_data[] = {
+    0x84, 0xe0, 0x15, 0xe0, 0x16, 0xe0, 0x06, 0xd7, 0xd8, 0xb4, 0x14, 0xb4, 0x24, 0xa3, 0x34, 0x94,
+    0x43, 0x94, 0x44, 0x8c, 0x7e, 0x00, 0x6e, 0x00, 0x54, 0x74, 0x54, 0x84, 0x44, 0x84, 0x34, 0xa4,
+    0x24, 0xa4, 0x23, 0xb4, 0x10, 0xed, 0xb2, 0xe4, 0xf4, 0xe4, 0xd6, 0xe4, 0xc6, 0xe4, 0xc6, 0xe4,
+    0xd4, 0x63, 0xe4, 0xe5, 0xc1, 0xe2, 0x94, 0xe0, 0x46, 0xa5, 0xe2, 0x65, 0xe0, 0x46, 0x96, 0xe2,
+    0x66, 0x54, 0x95, 0x96, 0xe2, 0x66, 0x46, 0x93, 0xb5, 0xe2, 0x65, 0x56, 0xe0, 0x22, 0x54, 0xe2,
+    0x83, 0x66, 0xe0, 0x14, 0xe3, 0xa4, 0x43, 0x86, 0xe4, 0x05, 0x76, 0xe4, 0x06, 0x66, 0x84, 0xe2,
+    0x41, 0xe0, 0x16, 0x74, 0x95, 0xe2, 0x15, 0xd5, 0xe0, 0x66, 0xe1, 0x84, 0x46, 0xe0, 0x03, 0xe0,
+    0x76, 0xe1, 0x76, 0x36, 0x44, 0xe1, 0x15, 0xe1, 0x76, 0x45, 0x45, 0xb3, 0x74, 0x62, 0xe1, 0x96,
+    0x44, 0x47, 0x95, 0x56, 0xe1, 0x75, 0x54, 0xe0, 0x05, 0x97, 0x46, 0xe1, 0x75, 0xe0, 0x95, 0x96,
+    0x56, 0xe1, 0x67, 0xe0, 0xa1, 0xc5, 0x64, 0x73, 0x65, 0xe0, 0x35, 0xe1, 0x13, 0x53, 0xe0, 0x35,
+    0x55, 0xe0, 0x35, 0xe1, 0x05, 0xe0, 0xa6, 0x37, 0xe1, 0x04, 0x63, 0x76, 0xe0, 0xa6, 0x45, 0xe1,
+    0x06, 0x45, 0x66, 0xe0, 0xa5, 0x55, 0xe1, 0x06, 0x46, 0x65, 0xe0, 0x04, 0x73, 0xe1, 0x33, 0x56,
+    0x46, 0x73, 0x53, 0x66, 0xe1, 0xb5, 0x54, 0x55, 0xe0, 0x15, 0x56, 0xe1, 0xb6, 0xe0, 0x03, 0xe0,
+    0x16, 0x56, 0xe1, 0xb6, 0xe0, 0xa1, 0x76, 0x64, 0x54, 0x74, 0xe0, 0x85, 0xe0, 0x94, 0x75, 0x72,
+    0x56, 0x56, 0xe0, 0x83, 0xe0, 0x96, 0x73, 0xe0, 0x16, 0x56, 0xe1, 0xa3, 0x56, 0xe0, 0xb6, 0x56,
+    0x52, 0x74, 0xc3, 0x65, 0x46, 0xe0, 0xc4, 0x65, 0x45, 0x65, 0xa5, 0x56, 0x44, 0xe0, 0xe2, 0x83,
+    0x56, 0x46, 0xa6, 0x46, 0xe0, 0x54, 0xe1, 0x16, 0x46, 0xa6, 0x45, 0xe0, 0x56, 0x53, 0xe0, 0x85,
+    0x65, 0xa5, 0x63, 0xd2, 0x56, 0x45, 0xa2, 0xa4, 0x72, 0xd4, 0xe0, 0x65, 0x46, 0x36, 0x85, 0xe0,
+    0xd4, 0xe0, 0x72, 0x56, 0x45, 0x36, 0x86, 0xe0, 0xb6, 0xe0, 0x45, 0x46, 0x52, 0x65, 0x86, 0xe0,
+    0xb6, 0x81, 0x96, 0x36, 0xe0, 0x03, 0x96, 0x51, 0xe0, 0x56, 0x74, 0x76, 0x44, 0xe0, 0xe4, 0x45,
+    0xe0, 0x44, 0x76, 0x66, 0xe0, 0xf3, 0xc5, 0xe0, 0xf6, 0x74, 0xe0, 0xf5, 0xa7, 0xe0, 0xe6, 0xe1,
+    0x03, 0x76, 0xa5, 0xe0, 0x03, 0xd4, 0xe0, 0x83, 0x55, 0x66, 0xa5, 0xd5, 0xe1, 0x75, 0x37, 0x55,
+    0xe0, 0xe6, 0xe0, 0x55, 0xd6, 0x26, 0x73, 0xe0, 0xf6, 0x54, 0xa5, 0x62, 0x56, 0x35, 0xe0, 0x33,
+    0xe0, 0x65, 0x55, 0x87, 0x45, 0x35, 0x53, 0xe0, 0x35, 0xe0, 0x63, 0x56, 0x95, 0x46, 0x43, 0xe0,
+    0xb7, 0xe0, 0xd6, 0x95, 0x46, 0xe1, 0x26, 0xe0, 0xf5, 0xe0, 0x55, 0xe0, 0xc3, 0x45, 0xe2, 0x74,
+    0xe0, 0x34, 0x55, 0x43, 0xe1, 0x93, 0xe0, 0x82, 0x86, 0x37, 0xe0, 0xa4, 0xe0, 0x25, 0xe0, 0x55,
+    0x76, 0x36, 0xa3, 0xb6, 0x53, 0x66, 0x54, 0xa6, 0x66, 0x45, 0x95, 0xa6, 0x45, 0x56, 0x46, 0x96,
+    0x74, 0x63, 0x97, 0x96, 0x36, 0x65, 0x46, 0x95, 0x92, 0xe0, 0x57, 0xa4, 0x46, 0x73, 0x56, 0xa4,
+    0xe1, 0x15, 0xc2, 0x65, 0xe0, 0x15, 0xe1, 0x92, 0x63, 0xe0, 0x83, 0xe0, 0x41, 0xe1, 0xa4, 0xe2,
+    0xd4, 0xa4, 0xe0, 0x06, 0xe1, 0x93, 0xe0, 0x25, 0x86, 0x63, 0x46, 0xe1, 0x85, 0xe0, 0x06, 0x86,
+    0x55, 0x36, 0xe1, 0x02, 0x66, 0x54, 0x46, 0x86, 0x46, 0x44, 0xe1, 0x04, 0x56, 0x55, 0x45, 0x94,
+    0x56, 0xe1, 0x76, 0x45, 0x56, 0x52, 0xe0, 0x75, 0xe1, 0x76, 0x53, 0x66, 0xd1, 0xe0, 0x13, 0xe1,
+    0x86, 0xe0, 0x15, 0xb5, 0xe0, 0xb2, 0xe0, 0xe4, 0xe0, 0x41, 0xd6, 0xe0, 0x85, 0xe3, 0x16, 0xe0,
+    0x86, 0xe1, 0x84, 0xe0, 0x65, 0x52, 0x82, 0x66, 0xe1, 0x85, 0x94, 0x74, 0x44, 0x55, 0x56, 0xe1,
+    0x76, 0x86, 0xd6, 0x46, 0x54, 0xe1, 0x13, 0x46, 0x86, 0xd6, 0x46, 0xe1, 0x95, 0x45, 0x86, 0xd6,
+    0x45, 0xe1, 0xa6, 0xe0, 0x34, 0xe0, 0x14, 0x64, 0xe1, 0xa6, 0xe0, 0x42, 0x43, 0xe3, 0x15, 0xc1,
+    0xb5, 0xe3, 0x13, 0xb5, 0x96, 0xe3, 0xe5, 0x96, 0x54, 0xe3, 0x47, 0x85, 0x55, 0xe3, 0x55, 0xa3,
+    0x66, 0xe3, 0x45, 0xe0, 0x56, 0xe4, 0xc5, 0xe4, 0xf2, 0xed, 0x60, 0x92, 0xe0, 0x33, 0xe0, 0x17,
+    0xb1, 0x26, 0x12, 0x61, 0x12, 0x24, 0x22, 0x11, 0x35, 0x23, 0x35, 0x25, 0x23, 0x25, 0x4e, 0x02,
+    0x3e, 0x03, 0x87, 0xd7, 0x8e, 0x03, 0x4e, 0x02, 0x35, 0x23, 0x25, 0x35, 0x23, 0x35, 0x31, 0x12,
+    0x24, 0x22, 0x11, 0x61, 0x26, 0x12, 0xa7, 0xe0, 0x13, 0xe0, 0x42, 0x90, 0x72, 0xe0, 0x34, 0xe0,
+    0x16, 0x13, 0x9b, 0x8d, 0x7e, 0x00, 0x5e, 0x01, 0x5e, 0x02, 0x36, 0x29, 0x35, 0x39, 0x35, 0x42,
+    0x25, 0x24, 0x95, 0x24, 0x94, 0x35, 0x84, 0x44, 0x75, 0x45, 0x55, 0x6e, 0x00, 0x7c, 0x9a, 0xc6,
+    0x70, 0xb5, 0xe0, 0x16, 0xe0, 0x15, 0xe0, 0x43, 0xe0, 0x32, 0x3e, 0x03, 0x3e, 0x02, 0x5d, 0xe0,
+    0xce, 0x05, 0x1e, 0x05, 0xe0, 0x43, 0x16, 0xac, 0x8d, 0x45, 0x83, 0x45, 0x83, 0xe0, 0x15, 0xe0,
+    0x05, 0xe0, 0x14, 0xc0, 0xe9, 0xf3, 0xe2, 0x06, 0xe1, 0xd8, 0xe1, 0xba, 0xe1, 0x9c, 0xe1, 0x7e,
+    0x00, 0xe1, 0x5e, 0x02, 0xe1, 0x3e, 0x04, 0xe1, 0x1e, 0x06, 0xe0, 0xfe, 0x08, 0xe0, 0xde, 0x0a,
+    0xe0, 0xb9, 0x1e, 0x02, 0xe0, 0x99, 0x26, 0x1a, 0xe0, 0x79, 0x36, 0x2a, 0xe0, 0x59, 0x46, 0x3a,
+    0xe0, 0x39, 0x56, 0x4a, 0xe0, 0x19, 0x66, 0x5a, 0xd9, 0x76, 0x69, 0xd8, 0x86, 0x79, 0xc7, 0x96,
+    0x88, 0xc6, 0xa6, 0x96, 0xe0, 0x04, 0xb6, 0xa4, 0xe1, 0x06, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6,
+    0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6,
+    0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6,
+    0xe1, 0xe5, 0xe2, 0x03, 0xea, 0x00, 0xe9, 0xf3, 0xe2, 0x05, 0xe1, 0xf6, 0xe1, 0xe6, 0xe1, 0xe6,
+    0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6,
+    0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xe6,
+    0xe1, 0xe6, 0xe0, 0xf4, 0xb6, 0xb3, 0xe0, 0x06, 0xa6, 0xa5, 0xd7, 0x96, 0x96, 0xd8, 0x86, 0x87,
+    0xd9, 0x76, 0x78, 0xe0, 0x09, 0x66, 0x68, 0xe0, 0x29, 0x56, 0x58, 0xe0, 0x49, 0x46, 0x48, 0xe0,
+    0x69, 0x36, 0x38, 0xe0, 0x89, 0x26, 0x28, 0xe0, 0xa9, 0x16, 0x18, 0xe0, 0xce, 0x09, 0xe0, 0xee,
+    0x07, 0xe1, 0x0e, 0x05, 0xe1, 0x2e, 0x03, 0xe1, 0x4e, 0x01, 0xe1, 0x6d, 0xe1, 0x8b, 0xe1, 0xa9,
+    0xe1, 0xc7, 0xe1, 0xe5, 0xe2, 0x03, 0xea, 0x00, 0xf0, 0x33, 0x13, 0xe0, 0x32, 0xe0, 0x37, 0xe1,
+    0x42, 0x11, 0xe0, 0x14, 0xe0, 0x03, 0x12, 0x15, 0xe1, 0x16, 0xb6, 0xce, 0x02, 0xe0, 0xe2, 0x15,
+    0x94, 0x12, 0xb4, 0x13, 0x12, 0x12, 0x13, 0xe0, 0xd5, 0x14, 0x5a, 0x9e, 0x03, 0x12, 0xe0, 0xc3,
+    0x17, 0x34, 0x12, 0x13, 0x83, 0x13, 0x12, 0x13, 0x17, 0xe0, 0xb1, 0x15, 0x14, 0x13, 0x16, 0x11,
+    0x76, 0x16, 0x14, 0x14, 0xe0, 0xb5, 0x13, 0x1a, 0x14, 0x63, 0x16, 0x1b, 0x12, 0xe0, 0xa3, 0x1a,
+    0x13, 0x16, 0x66, 0x13, 0x62, 0x16, 0xe0, 0x92, 0x15, 0x13, 0x14, 0x15, 0x12, 0x62, 0x15, 0x94,
+    0x14, 0xe0, 0x86, 0x18, 0x15, 0x15, 0x45, 0x13, 0xa5, 0x12, 0xe0, 0x84, 0x15, 0x12, 0x1b, 0x11,
+    0x42, 0x15, 0xb2, 0x15, 0xe0, 0x45, 0x16, 0x19, 0x14, 0x13, 0x46, 0x11, 0x43, 0x55, 0x11, 0xd6,
+    0x17, 0x15, 0x12, 0x15, 0x16, 0x43, 0x14, 0x44, 0x43, 0x13, 0xa7, 0x14, 0x12, 0x15, 0x97, 0x11,
+    0x48, 0x44, 0x47, 0xa5, 0x1d, 0xd1, 0x11, 0x13, 0x41, 0x12, 0x12, 0x52, 0x11, 0x45, 0x12, 0x92,
+    0x16, 0x12, 0x14, 0xe0, 0x26, 0x48, 0x44, 0x42, 0x14, 0xb6, 0x16, 0x12, 0x81, 0x83, 0x11, 0x44,
+    0x13, 0x43, 0x55, 0x11, 0xc2, 0x16, 0x14, 0x67, 0x64, 0x42, 0x14, 0x54, 0x43, 0x14, 0xb7, 0x15,
+    0x56, 0x14, 0x53, 0x48, 0x42, 0x11, 0x47, 0xd2, 0x17, 0x11, 0x44, 0x17, 0x52, 0x54, 0x13, 0x44,
+    0x45, 0x11, 0xe0, 0x03, 0x13, 0x12, 0x52, 0x16, 0x13, 0x52, 0x42, 0x13, 0x11, 0x43, 0x52, 0x14,
+    0xe0, 0x14, 0x14, 0x47, 0x17, 0x42, 0x48, 0x44, 0x47, 0xe0, 0x19, 0x42, 0x12, 0x15, 0x13, 0x42,
+    0x43, 0x14, 0x42, 0x11, 0x44, 0x12, 0xe0, 0x22, 0x13, 0x11, 0x49, 0x13, 0x11, 0x42, 0x45, 0x12,
+    0x44, 0x47, 0x11, 0x31, 0x31, 0x77, 0x47, 0x17, 0x42, 0x41, 0x16, 0x43, 0x52, 0x12, 0x11, 0xe0,
+    0x24, 0x13, 0x42, 0x11, 0x16, 0x13, 0x42, 0x44, 0x13, 0x44, 0x48, 0xe0, 0x07, 0x11, 0x48, 0x15,
+    0x52, 0x46, 0x11, 0x42, 0x11, 0x44, 0x12, 0xe0, 0x03, 0x12, 0x13, 0x45, 0x16, 0x12, 0x42, 0x42,
+    0x15, 0x44, 0x47, 0xe0, 0x0a, 0x51, 0x15, 0x15, 0x43, 0x45, 0x12, 0x43, 0x52, 0x14, 0xd4, 0x14,
+    0x12, 0x54, 0x13, 0x12, 0x51, 0x11, 0x43, 0x14, 0x44, 0x45, 0x11, 0xc3, 0x14, 0x14, 0x69, 0x63,
+    0x48, 0x42, 0x11, 0x48, 0xae, 0x01, 0x73, 0x12, 0x63, 0x51, 0x13, 0x12, 0x44, 0x43, 0x13, 0xb2,
+    0x13, 0x12, 0x12, 0x13, 0xe0, 0x34, 0x58, 0x43, 0x55, 0x11, 0xa5, 0x1c, 0xe0, 0x14, 0x63, 0x12,
+    0x11, 0x44, 0x43, 0x14, 0x93, 0x15, 0x14, 0x15, 0xb4, 0x11, 0x59, 0x42, 0x11, 0x49, 0x96, 0x14,
+    0x14, 0x14, 0x78, 0x43, 0x12, 0x12, 0x54, 0x42, 0x12, 0x13, 0xc1, 0x1e, 0x00, 0x1a, 0x11, 0x12,
+    0x59, 0x53, 0x66, 0x12, 0xe0, 0x43, 0x12, 0x1e, 0x04, 0x43, 0x13, 0x11, 0x64, 0x54, 0x14, 0xe0,
+    0x5a, 0x12, 0x12, 0x15, 0x11, 0x45, 0x13, 0x62, 0x11, 0x68, 0xe0, 0x52, 0x12, 0x12, 0x19, 0x11,
+    0x13, 0x41, 0x16, 0x58, 0x54, 0x13, 0xe0, 0x5b, 0x13, 0x16, 0x54, 0x12, 0x57, 0x11, 0x52, 0x15,
+    0xe0, 0x53, 0x12, 0x12, 0x1c, 0x48, 0x44, 0x11, 0x14, 0x46, 0x11, 0xe0, 0x5d, 0x13, 0x12, 0x11,
+    0x42, 0x13, 0x11, 0x42, 0x18, 0x44, 0x13, 0xe0, 0x52, 0x14, 0x13, 0x13, 0x16, 0x44, 0x13, 0x48,
+    0x13, 0x41, 0x15, 0xe0, 0x55, 0x15, 0x35, 0x12, 0x42, 0x15, 0x43, 0x12, 0x14, 0x46, 0x11, 0xe0,
+    0x53, 0x15, 0x76, 0x48, 0x4b, 0x41, 0x12, 0x13, 0xe0, 0x51, 0x15, 0xa3, 0x12, 0x43, 0x12, 0x61,
+    0x12, 0x12, 0x12, 0x48, 0xe0, 0x65, 0xd4, 0x32, 0x16, 0x49, 0x56, 0x11, 0xe0, 0x63, 0xe0, 0x23,
+    0x45, 0x12, 0x54, 0x12, 0x53, 0x11, 0x13, 0xe0, 0x72, 0xe0, 0x31, 0x53, 0x15, 0x72, 0x71, 0x16,
+    0xe2, 0x27, 0xe0, 0x29, 0xe2, 0x24, 0x15, 0xc5, 0x12, 0x11, 0xe2, 0x22, 0x18, 0x94, 0x16, 0xe2,
+    0x45, 0x12, 0x14, 0x3b, 0x11, 0xe2, 0x62, 0x1e, 0x01, 0x11, 0x12, 0x14, 0xe2, 0x75, 0x12, 0x16,
+    0x1a, 0xe2, 0x83, 0x16, 0x12, 0x17, 0x12, 0xe2, 0xc6, 0x19, 0x15, 0xe2, 0xd3, 0x15, 0x13, 0x15,
+    0xe3, 0x15, 0x19, 0xe3, 0x57, 0x13, 0xe3, 0xd1, 0xf0, 0x24, 0x30, 0xe9, 0xb1, 0xe0, 0x52, 0xe0,
+    0x33, 0x63, 0x76, 0xe0, 0x14, 0x44, 0x54, 0x24, 0xdc, 0x52, 0x62, 0xd2, 0x24, 0x32, 0x32, 0x82,
+    0xb2, 0x42, 0x42, 0x32, 0x31, 0x42, 0xb2, 0xa2, 0x32, 0x32, 0x32, 0x67, 0xa3, 0x22, 0x32, 0x32,
+    0x56, 0x55, 0x41, 0x22, 0x32, 0x32, 0x62, 0x68, 0x62, 0x32, 0x32, 0x72, 0x43, 0x43, 0x52, 0x32,
+    0x32, 0x73, 0x32, 0x62, 0x52, 0x32, 0x32, 0x82, 0x32, 0x62, 0x52, 0x32, 0x32, 0x83, 0x22, 0x72,
+    0x42, 0x32, 0x32, 0x82, 0x32, 0x62, 0x52, 0x32, 0x32, 0x72, 0x42, 0x62, 0x52, 0x32, 0x32, 0x63,
+    0x53, 0x23, 0x62, 0x32, 0x32, 0x62, 0x77, 0x53, 0x32, 0x33, 0x48, 0x34, 0x63, 0x42, 0x43, 0x65,
+    0xd2, 0x52, 0x52, 0x92, 0xc3, 0x36, 0x32, 0xa2, 0x32, 0x62, 0x33, 0x23, 0x32, 0x92, 0x16, 0x42,
+    0x32, 0x42, 0x32, 0x95, 0x23, 0x32, 0x32, 0x42, 0x32, 0x94, 0x42, 0x32, 0x32, 0x42, 0x32, 0x92,
+    0xb2, 0x46, 0x42, 0xe0, 0x92, 0x44, 0x42, 0xe0, 0xa2, 0xb3, 0xe0, 0xb2, 0xa2, 0xe0, 0xd3, 0x63,
+    0xe0, 0xfa, 0xe1, 0x26, 0xe9, 0x90, 0xe6, 0xde, 0x14, 0x5e, 0x17, 0x2e, 0x18, 0x23, 0xe1, 0x32,
+    0x23, 0xe1, 0x32, 0x2e, 0x18, 0x3e, 0x16, 0xe6, 0xe2, 0xe1, 0x22, 0x42, 0xe1, 0x23, 0x2e, 0x18,
+    0x2e, 0x18, 0xe6, 0xe2, 0xe1, 0x02, 0x53, 0xe1, 0x03, 0x43, 0xe1, 0x12, 0x42, 0xe1, 0x22, 0x33,
+    0xe1, 0x23, 0x2e, 0x18, 0x3e, 0x16, 0xe4, 0x72, 0xe1, 0x02, 0x62, 0xe1, 0x03, 0x43, 0xe1, 0x03,
+    0x42, 0xe1, 0x22, 0x42, 0xe1, 0x23, 0x2e, 0x18, 0x2e, 0x18, 0xe9, 0x30, 0xf0, 0x23, 0x71, 0x21,
+    0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+    0x21, 0x21, 0x21, 0x21, 0x21, 0xae, 0x3a, 0x83, 0x1e, 0x33, 0x13, 0x67, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x52, 0x12, 0x1e, 0x33, 0x13,
+    0x5e, 0x36, 0x14, 0x11, 0x53, 0x14, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x15, 0x13, 0x56, 0x1e, 0x2f, 0x15, 0x73,
+    0x15, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x12, 0x12, 0x12, 0x19, 0x95, 0x1e, 0x2b, 0x12, 0x12, 0xf0, 0x19, 0xbe, 0x37, 0xbe, 0x37, 0xa5,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x14,
+    0xa3, 0x1e, 0x32, 0x12, 0x97, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x17, 0x83, 0x12, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x14, 0x14, 0x8a,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x1a, 0x13, 0x74, 0x13, 0x14, 0x16, 0x13, 0x14, 0x16, 0x13,
+    0x14, 0x16, 0x13, 0x14, 0x13, 0x17, 0x63, 0x1d, 0x1e, 0x01, 0x1e, 0x01, 0x1e, 0x04, 0x12, 0x12,
+    0x67, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x12,
+    0x18, 0x55, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x12, 0x11, 0x52, 0x16, 0x17, 0x17,
+    0x17, 0x17, 0x17, 0x17, 0x16, 0x13, 0x16, 0x56, 0x14, 0x13, 0x14, 0x16, 0x13, 0x14, 0x16, 0x13,
+    0x14, 0x16, 0x1c, 0x11, 0x82, 0x18, 0x19, 0x15, 0x19, 0x15, 0x19, 0x15, 0x13, 0x12, 0x14, 0xf0,
+    0x14, 0xa4, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0xc2, 0x1e, 0x34, 0xb6, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x12, 0xa5, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0xa3,
+    0x15, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x12, 0x12, 0x97, 0x13, 0x13, 0x14, 0x16, 0x13,
+    0x14, 0x16, 0x13, 0x14, 0x16, 0x13, 0x17, 0x83, 0x12, 0x1e, 0x03, 0x1e, 0x01, 0x1e, 0x01, 0x1b,
+    0x14, 0x7a, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x14, 0x11, 0x63, 0x15, 0x17, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x1c, 0x61, 0x14, 0x16, 0x1b,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x12, 0x12, 0x5b, 0x13, 0x13, 0x13, 0x14, 0x16, 0x13, 0x14,
+    0x16, 0x13, 0x14, 0x16, 0x17, 0x54, 0x12, 0x11, 0x1e, 0x07, 0x15, 0x19, 0x15, 0x19, 0x17, 0x13,
+    0x5d, 0x13, 0x13, 0x13, 0x13, 0x13, 0x17, 0x13, 0x13, 0x17, 0x13, 0x13, 0x13, 0x13, 0x11, 0x62,
+    0x12, 0x14, 0x17, 0x17, 0x18, 0x16, 0x18, 0x16, 0x17, 0x16, 0x81, 0x11, 0x11, 0x11, 0x12, 0x11,
+    0x21, 0x12, 0x11, 0x21, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x21, 0x12, 0x11, 0x11, 0x11, 0x12,
+    0x21, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0xf0, 0x14, 0xae, 0x37, 0xbe, 0x37, 0xa4, 0x13,
+    0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x11,
+    0xa1, 0x1e, 0x37, 0x95, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x13, 0x13, 0x13, 0x14, 0x94, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x13, 0x82, 0x15,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x18, 0x76, 0x13, 0x13, 0x14, 0x16, 0x13, 0x14, 0x16,
+    0x13, 0x14, 0x16, 0x13, 0x14, 0x12, 0x12, 0x62, 0x12, 0x1e, 0x03, 0x1e, 0x01, 0x1e, 0x01, 0x1e,
+    0x04, 0x69, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+    0x12, 0x13, 0x12, 0x53, 0x13, 0x17, 0x13, 0x17, 0x17, 0x17, 0x17, 0x17, 0x1a, 0x14, 0x5b, 0x1b,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x12, 0x17, 0x62, 0x12, 0x13, 0x13, 0x13, 0x13, 0x14, 0x16, 0x13,
+    0x14, 0x16, 0x13, 0x14, 0x1a, 0x15, 0x66, 0x1e, 0x07, 0x15, 0x19, 0x15, 0x19, 0x12, 0x12, 0x14,
+    0x11, 0xf0, 0x23, 0x30, 0xe1, 0x5a, 0xe3, 0x4e, 0x04, 0xe2, 0xee, 0x08, 0xe2, 0xae, 0x0c, 0xe2,
+    0x6e, 0x10, 0xe2, 0x2e, 0x14, 0xe1, 0xfe, 0x16, 0xe1, 0xde, 0x18, 0xe1, 0xbe, 0x1a, 0xe1, 0x9e,
+    0x1c, 0xe1, 0x7e, 0x04, 0x5e, 0x07, 0xe1, 0x6e, 0x01, 0x9e, 0x06, 0xe1, 0x5e, 0x00, 0xbe, 0x07,
+    0xe1, 0x3d, 0xde, 0x08, 0xe1, 0x2c, 0xde, 0x09, 0xe1, 0x1c, 0x9e, 0x0f, 0xe1, 0x0b, 0x8e, 0x11,
+    0xe0, 0xfc, 0x6e, 0x14, 0xe0, 0xeb, 0x6e, 0x15, 0xe0, 0xea, 0x6e, 0x16, 0xe0, 0xdb, 0x6e, 0x17,
+    0xe0, 0xcb, 0x5e, 0x18, 0xe0, 0xca, 0x6e, 0x18, 0xe0, 0xca, 0x5e, 0x19, 0xe0, 0xca, 0x5e, 0x19,
+    0xe0, 0xca, 0x5e, 0x19, 0xe0, 0xca, 0x5e, 0x19, 0xe0, 0xca, 0x4e, 0x1a, 0xe0, 0xca, 0x4e, 0x1a,
+    0xe0, 0xcb, 0x2e, 0x1b, 0xe0, 0xce, 0x28, 0xe0, 0xce, 0x28, 0xe0, 0xce, 0x28, 0xe0, 0xce, 0x28,
+    0xe0, 0xce, 0x28, 0xe0, 0xde, 0x26, 0xe0, 0xee, 0x26, 0xe0, 0xee, 0x26, 0xe0, 0xfe, 0x24, 0xe1,
+    0x0e, 0x24, 0xe1, 0x1e, 0x22, 0xe1, 0x2e, 0x22, 0xe1, 0x3e, 0x20, 0xe1, 0x5e, 0x1e, 0xe1, 0x6e,
+    0x1e, 0xe1, 0x7e, 0x1c, 0xe1, 0x9e, 0x1a, 0xe1, 0xbe, 0x18, 0xe1, 0xce, 0x18, 0xe1, 0xde, 0x16,
+    0xe1, 0xfe, 0x14, 0xe2, 0x0e, 0x14, 0xe2, 0x1e, 0x12, 0xe2, 0x3e, 0x10, 0xe2, 0x4e, 0x10, 0xe2,
+    0x5e, 0x0e, 0xe2, 0x6e, 0x0e, 0xe2, 0x7e, 0x0c, 0xe2, 0x8e, 0x0c, 0xe2, 0x8e, 0x0c, 0xf0, 0x1c,
+    0x6e, 0x0c, 0xe2, 0x8e, 0x0c, 0xe2, 0x8e, 0x0c, 0xe2, 0x9e, 0x0a, 0xe2, 0xae, 0x0a, 0xe2, 0xae,
+    0x0a, 0xe2, 0xae, 0x0a, 0xe2, 0xbe, 0x08, 0xe2, 0xce, 0x08, 0xe2, 0xde, 0x06, 0xe2, 0xee, 0x06,
+    0xe2, 0xfe, 0x04, 0xe3, 0x2e, 0x01, 0xe3, 0x4c, 0xe3, 0x88, 0xe1, 0x60, 0xe1, 0x4c, 0xe3, 0x2e,
+    0x06, 0xe2, 0xce, 0x0a, 0xe2, 0x8e, 0x0e, 0xe2, 0x4e, 0x12, 0xe2, 0x1e, 0x14, 0xe1, 0xfe, 0x16,
+    0xe1, 0xde, 0x18, 0xe1, 0xbe, 0x01, 0xae, 0x01, 0xe1, 0x9d, 0xe0, 0x2d, 0xe1, 0x7c, 0xe0, 0x6c,
+    0xe1, 0x5b, 0xe0, 0xab, 0xe1, 0x4a, 0xe0, 0xca, 0xe1, 0x3a, 0xe0, 0xea, 0xe1, 0x29, 0xe1, 0x09,
+    0xe1, 0x19, 0xc6, 0xe0, 0x09, 0xe1, 0x09, 0xa9, 0xd9, 0xe0, 0xf9, 0x9b, 0xe0, 0x09, 0xe0, 0xe8,
+    0x9c, 0xe0, 0x18, 0xe0, 0xe8, 0x8c, 0xe0, 0x28, 0xe0, 0xd8, 0x89, 0xe0, 0x78, 0xe0, 0xc8, 0x87,
+    0xe0, 0x98, 0xe0, 0xc8, 0x77, 0xe0, 0xa8, 0xe0, 0xc8, 0x76, 0xe0, 0xb8, 0xe0, 0xb8, 0x85, 0xe0,
+    0xd8, 0xe0, 0xa8, 0x76, 0xe0, 0xd8, 0xe0, 0xa8, 0x76, 0xe0, 0xd8, 0xe0, 0xa8, 0x76, 0xe0, 0xd8,
+    0xe0, 0xa8, 0x76, 0xe0, 0xd8, 0xe0, 0xa8, 0x84, 0xe0, 0xe8, 0xe0, 0xa8, 0xe1, 0xa7, 0xe0, 0xc8,
+    0xe1, 0x88, 0xe0, 0xc8, 0xe1, 0x88, 0xe0, 0xc8, 0xe1, 0x88, 0xe0, 0xc8, 0xe1, 0x88, 0xe0, 0xd8,
+    0xe1, 0x68, 0xe0, 0xe8, 0xe1, 0x68, 0xe0, 0xe9, 0xe1, 0x49, 0xe0, 0xf9, 0xe1, 0x29, 0xe1, 0x09,
+    0xe1, 0x29, 0xe1, 0x19, 0xe1, 0x09, 0xe1, 0x2a, 0xe0, 0xea, 0xe1, 0x39, 0xe0, 0xe9, 0xe1, 0x4a,
+    0xe0, 0xca, 0xe1, 0x5a, 0xe0, 0xaa, 0xe1, 0x7a, 0xe0, 0x8a, 0xe1, 0x99, 0xe0, 0x89, 0xe1, 0xaa,
+    0xe0, 0x6a, 0xe1, 0xba, 0xe0, 0x4a, 0xe1, 0xd9, 0xe0, 0x49, 0xe1, 0xea, 0xe0, 0x2a, 0xe1, 0xf9,
+    0xe0, 0x29, 0xe2, 0x19, 0xe0, 0x09, 0xe2, 0x29, 0xe0, 0x09, 0xe2, 0x39, 0xc9, 0xe2, 0x49, 0xc9,
+    0xe2, 0x58, 0xc8, 0xe2, 0x68, 0xc8, 0xe2, 0x69, 0xa9, 0xe2, 0x78, 0xa8, 0xf0, 0x1c, 0x6e, 0x0c,
+    0xe2, 0x8e, 0x0c, 0xe2, 0x8e, 0x0c, 0xe2, 0x8e, 0x0c, 0xe2, 0x8e, 0x0c, 0xe2, 0x9e, 0x0a, 0xe2,
+    0xae, 0x0a, 0xe2, 0xae, 0x0a, 0xe2, 0xbe, 0x08, 0xe2, 0xce, 0x08, 0xe2, 0xde, 0x06, 0xe2, 0xfe,
+    0x04, 0xe3, 0x1e, 0x02, 0xe3, 0x4c, 0xe3, 0x88, 0xe1, 0x60, 0xe0, 0x28, 0xe1, 0x0c, 0xe0, 0xce,
+    0x02, 0xe0, 0x9e, 0x04, 0xe0, 0x76, 0x86, 0xe0, 0x56, 0xa6, 0xe0, 0x35, 0xe0, 0x05, 0xe0, 0x24,
+    0x72, 0x74, 0xe0, 0x15, 0x45, 0x75, 0xe0, 0x04, 0x46, 0x84, 0xe0, 0x04, 0x43, 0xb4, 0xd4, 0x43,
+    0xd4, 0xc4, 0x43, 0xd4, 0xc4, 0x42, 0xe0, 0x04, 0xc4, 0x42, 0xe0, 0x04, 0xc4, 0xe0, 0x64, 0xc4,
+    0xe0, 0x55, 0xd4, 0xe0, 0x44, 0xe0, 0x04, 0xe0, 0x44, 0xe0, 0x05, 0xe0, 0x25, 0xe0, 0x15, 0xe0,
+    0x05, 0xe0, 0x34, 0xe0, 0x04, 0xe0, 0x45, 0xc5, 0xe0, 0x55, 0xa5, 0xe0, 0x74, 0xa4, 0xe0, 0x85,
+    0x85, 0xe0, 0x94, 0x84, 0xe0, 0xb4, 0x64, 0xe0, 0xc4, 0x64, 0xe0, 0xc4, 0x64, 0xe5, 0xdc, 0xe0,
+    0xec, 0xe0, 0xec, 0xe0, 0xec, 0xe0, 0xec, 0xe0, 0xfa, 0xe1, 0x18, 0xe1, 0x36, 0xe0, 0x30, 0xf0,
+    0x1b, 0x0e, 0x02, 0xe2, 0xee, 0x09, 0xe2, 0x9e, 0x0e, 0xe2, 0x4e, 0x12, 0xe2, 0x0e, 0x16, 0xe1,
+    0xce, 0x19, 0xe1, 0xae, 0x1c, 0xe1, 0x7e, 0x1e, 0xe1, 0x5e, 0x20, 0xe1, 0x2e, 0x23, 0xe1, 0x0e,
+    0x25, 0xe0, 0xfe, 0x26, 0xe0, 0xde, 0x28, 0xe0, 0xbe, 0x2a, 0xe0, 0x9e, 0x2b, 0xe0, 0x9e, 0x2c,
+    0xe0, 0x7e, 0x2e, 0xe0, 0x5e, 0x2f, 0xe0, 0x5e, 0x01, 0xe0, 0x8e, 0x0b, 0xe0, 0x3b, 0xe1, 0x2e,
+    0x06, 0xe0, 0x39, 0xe1, 0x7e, 0x04, 0xe0, 0x19, 0xe1, 0xce, 0x00, 0xe0, 0x19, 0xe1, 0xec, 0xe0,
+    0x19, 0xe2, 0x0b, 0xda, 0xe0, 0x24, 0xe0, 0xe9, 0xdb, 0x7e, 0x08, 0xe0, 0x58, 0xdd, 0x1e, 0x11,
+    0xe0, 0x09, 0xce, 0x22, 0xb9, 0xbe, 0x26, 0x89, 0xbe, 0x28, 0x69, 0xbe, 0x05, 0xe0, 0x6e, 0x03,
+    0x3a, 0xbe, 0x01, 0xe0, 0xee, 0x0c, 0xbe, 0x00, 0xe1, 0x2e, 0x0a, 0xad, 0xe1, 0x6e, 0x07, 0xad,
+    0xe1, 0x8e, 0x05, 0xad, 0xd6, 0xe0, 0x7e, 0x03, 0xae, 0x00, 0x5e, 0x06, 0xe0, 0x2e, 0x01, 0xae,
+    0x1d, 0xce, 0x00, 0xbe, 0x20, 0x9e, 0x00, 0xbe, 0x22, 0x7e, 0x00, 0xce, 0x23, 0x5e, 0x00, 0xce,
+    0x08, 0xde, 0x02, 0x1e, 0x02, 0xce, 0x02, 0xe0, 0xae, 0x0e, 0xce, 0x00, 0xe0, 0xfe, 0x0a, 0xe0,
+    0x0d, 0xe1, 0x1e, 0x08, 0xe0, 0x0d, 0xe1, 0x3e, 0x06, 0xe0, 0x0d, 0x5e, 0x04, 0xce, 0x03, 0xe0,
+    0x2e, 0x18, 0xae, 0x02, 0xe0, 0x2e, 0x1b, 0x7e, 0x02, 0xe0, 0x2e, 0x1d, 0x5e, 0x01, 0xe0, 0x4e,
+    0x1e, 0x2e, 0x02, 0xe0, 0x5e, 0x2e, 0xe0, 0x6e, 0x2d, 0xe0, 0x8e, 0x2c, 0xe0, 0x8e, 0x2b, 0xe0,
+    0xae, 0x29, 0xe0, 0xce, 0x28, 0xe0, 0xde, 0x26, 0xe0, 0xfe, 0x24, 0xe1, 0x1e, 0x22, 0xe1, 0x3e,
+    0x20, 0xe1, 0x5e, 0x1e, 0xe1, 0x7e, 0x1b, 0xe1, 0xbe, 0x18, 0xe1, 0xde, 0x15, 0xe2, 0x1e, 0x11,
+    0xe2, 0x6e, 0x0c, 0xe2, 0xae, 0x07, 0xe3, 0x1d, 0xf0, 0x20, 0x20, 0xe7, 0x9a, 0xe0, 0xde, 0x01,
+    0xe0, 0xae, 0x04, 0xe0, 0x6e, 0x08, 0xe0, 0x3e, 0x0a, 0xe0, 0x1e, 0x0c, 0xde, 0x0e, 0xbe, 0x0f,
+    0xbe, 0x10, 0x97, 0xdb, 0x94, 0xe0, 0x68, 0x75, 0xe0, 0x86, 0x75, 0x67, 0xb5, 0x6e, 0x09, 0x74,
+    0x6e, 0x0c, 0x44, 0x68, 0xce, 0x00, 0x66, 0xe0, 0x3b, 0x66, 0xe0, 0x68, 0x67, 0x1c, 0x77, 0x6e,
+    0x09, 0x47, 0x6e, 0x0b, 0x27, 0x67, 0xe0, 0x0d, 0x67, 0xe0, 0x2a, 0x86, 0x1b, 0x68, 0x8e, 0x07,
+    0x38, 0x9e, 0x10, 0xae, 0x10, 0xbe, 0x0e, 0xde, 0x0c, 0xe0, 0x1e, 0x0a, 0xe0, 0x3e, 0x08, 0xe0,
+    0x5e, 0x06, 0xe0, 0x8e, 0x02, 0xe0, 0xcc, 0xe1, 0x24, 0xe5, 0x40, 0xe2, 0xb6, 0xe1, 0x38, 0xe1,
+    0x14, 0x33, 0xe1, 0x03, 0x52, 0xe1, 0x02, 0x62, 0xe1, 0x02, 0x63, 0xe0, 0xe3, 0x73, 0xe0, 0x46,
+    0x14, 0x8b, 0x9b, 0xba, 0x83, 0x33, 0xe0, 0x03, 0x42, 0x73, 0xe0, 0xe3, 0x62, 0xe1, 0x02, 0x53,
+    0xe1, 0x03, 0x52, 0xc7, 0xb3, 0x53, 0x9a, 0x93, 0x73, 0x83, 0x44, 0x73, 0x93, 0x63, 0x63, 0x63,
+    0xb2, 0x62, 0x82, 0x62, 0xc2, 0x62, 0x83, 0x52, 0xc2, 0x62, 0x83, 0x52, 0xc2, 0x62, 0x82, 0x62,
+    0xb3, 0x63, 0x63, 0x63, 0x93, 0x83, 0x44, 0x73, 0x73, 0x9a, 0x93, 0x62, 0xc7, 0xb3, 0x52, 0xe1,
+    0x03, 0x52, 0xe1, 0x02, 0x63, 0xe0, 0xe3, 0x73, 0x33, 0xe0, 0x03, 0x42, 0x8b, 0xba, 0x9b, 0x8b,
+    0xc1, 0x63, 0x73, 0xe0, 0xe2, 0x63, 0xe0, 0xf2, 0x62, 0xe1, 0x03, 0x52, 0xe1, 0x04, 0x33, 0xe1,
+    0x18, 0xe1, 0x36, 0xe2, 0xb0, 0xf0, 0x11, 0x3b, 0xe3, 0x5e, 0x01, 0xe3, 0x2e, 0x03, 0xe3, 0x18,
+    0x18, 0xe3, 0x06, 0x16, 0x14, 0xe3, 0x0e, 0x05, 0xe2, 0xf4, 0x16, 0x14, 0x12, 0xe2, 0xf8, 0x1a,
+    0xe2, 0xee, 0x01, 0x14, 0xe2, 0xe3, 0x14, 0x1c, 0xe2, 0xdc, 0x15, 0x12, 0xe2, 0xc7, 0x1e, 0x01,
+    0xe1, 0xb3, 0xbd, 0x14, 0x17, 0xc3, 0xe0, 0xa7, 0x76, 0x1e, 0x08, 0x68, 0xe0, 0x8e, 0x0b, 0x16,
+    0x14, 0x1e, 0x07, 0xe0, 0x6e, 0x07, 0x1e, 0x05, 0x1e, 0x04, 0xe0, 0x65, 0x1d, 0x19, 0x16, 0x1e,
+    0x01, 0x14, 0x13, 0xe0, 0x44, 0x15, 0x16, 0x17, 0x18, 0x16, 0x14, 0x14, 0x1b, 0xe0, 0x3e, 0x00,
+    0x1e, 0x00, 0x1e, 0x0c, 0x16, 0xe0, 0x29, 0x1e, 0x00, 0x19, 0x15, 0x14, 0x14, 0x1a, 0x13, 0xe0,
+    0x08, 0x15, 0x16, 0x17, 0x19, 0x1e, 0x02, 0x19, 0xe0, 0x04, 0x1d, 0x1e, 0x00, 0x1e, 0x01, 0x14,
+    0x15, 0x16, 0xde, 0x0a, 0x1c, 0x15, 0x1e, 0x09, 0xcb, 0x14, 0x16, 0x15, 0xa9, 0x14, 0x16, 0x14,
+    0x13, 0xb5, 0x12, 0x15, 0x16, 0x16, 0xde, 0x03, 0x1a, 0xbe, 0x05, 0x16, 0xe0, 0x33, 0x14, 0x14,
+    0x17, 0x14, 0xb3, 0x19, 0x1b, 0xe0, 0x5e, 0x0a, 0xd8, 0x1e, 0x00, 0xe0, 0x74, 0x1b, 0x16, 0xe0,
+    0x04, 0x19, 0x15, 0xb1, 0xc7, 0x15, 0x16, 0xe0, 0x39, 0x17, 0x12, 0x71, 0x21, 0x11, 0x21, 0x7b,
+    0x16, 0x11, 0xe0, 0x4e, 0x04, 0x81, 0x41, 0x21, 0x84, 0x1c, 0xe0, 0x83, 0x16, 0x14, 0x71, 0x22,
+    0x31, 0x21, 0x78, 0x16, 0xe0, 0xa8, 0x16, 0x71, 0x42, 0x21, 0x21, 0x7c, 0x12, 0xe0, 0xa5, 0x16,
+    0x11, 0x51, 0x22, 0x41, 0x41, 0x73, 0x16, 0x13, 0xe0, 0xbe, 0x00, 0x61, 0x41, 0x31, 0x11, 0x21,
+    0x67, 0x16, 0xe0, 0xb3, 0x16, 0x13, 0x61, 0x21, 0x22, 0x31, 0x21, 0x6e, 0x00, 0xe0, 0xb8, 0x15,
+    0x51, 0x31, 0x41, 0x31, 0x84, 0x19, 0xe0, 0xb6, 0x16, 0x81, 0x22, 0x32, 0x32, 0x59, 0x14, 0xe0,
+    0xbe, 0x00, 0x41, 0x21, 0x42, 0x41, 0x83, 0x18, 0x11, 0xe0, 0xb3, 0x17, 0x12, 0x61, 0x21, 0x61,
+    0x21, 0x77, 0x16, 0xe0, 0xaa, 0x14, 0x61, 0x21, 0x11, 0x21, 0x21, 0x21, 0x6b, 0x12, 0xe0, 0xa7,
+    0x17, 0x71, 0x31, 0x21, 0x21, 0x21, 0x56, 0x19, 0xe0, 0x85, 0x1b, 0x71, 0x31, 0x21, 0x31, 0x63,
+    0x16, 0x16, 0xe0, 0x6e, 0x00, 0x13, 0x71, 0x11, 0x21, 0x21, 0x8e, 0x05, 0xe0, 0x45, 0x16, 0x17,
+    0x91, 0x21, 0x21, 0x79, 0x15, 0x14, 0xe0, 0x1b, 0x1b, 0x91, 0xb7, 0x16, 0x17, 0xde, 0x06, 0x14,
+    0xe0, 0x55, 0x1e, 0x04, 0xc6, 0x14, 0x15, 0x18, 0xe0, 0x3e, 0x00, 0x15, 0x15, 0xb9, 0x1e, 0x03,
+    0xe0, 0x16, 0x15, 0x1e, 0x00, 0xb3, 0x1a, 0x17, 0x16, 0xbc, 0x17, 0x15, 0x12, 0xb8, 0x1a, 0x1d,
+    0x2b, 0x1e, 0x07, 0xd5, 0x1a, 0x17, 0x1e, 0x0a, 0x15, 0x16, 0x14, 0xdb, 0x1e, 0x11, 0x1e, 0x01,
+    0x16, 0xe0, 0x12, 0x1b, 0x14, 0x16, 0x1d, 0x15, 0x14, 0x1d, 0xe0, 0x17, 0x1e, 0x01, 0x16, 0x14,
+    0x12, 0x1e, 0x03, 0x16, 0xe0, 0x4a, 0x16, 0x1e, 0x0c, 0x18, 0x15, 0x13, 0xe0, 0x44, 0x19, 0x1b,
+    0x14, 0x19, 0x15, 0x1d, 0xe0, 0x5c, 0x16, 0x13, 0x1e, 0x00, 0x1c, 0x19, 0xe0, 0x66, 0x1e, 0x07,
+    0x14, 0x1e, 0x06, 0x14, 0xe0, 0x88, 0x5e, 0x0f, 0x11, 0x58, 0xe0, 0xa2, 0x11, 0xa4, 0x13, 0x16,
+    0x14, 0x12, 0x13, 0xa4, 0xe1, 0xba, 0x1c, 0xe2, 0xb8, 0x17, 0x15, 0xe2, 0xd3, 0x1e, 0x03, 0xe2,
+    0xdb, 0x16, 0x11, 0xe2, 0xf5, 0x18, 0x14, 0xe2, 0xfc, 0x16, 0xe2, 0xf3, 0x14, 0x1a, 0xe2, 0xfe,
+    0x02, 0x12, 0xe3, 0x05, 0x17, 0x13, 0xe3, 0x19, 0x17, 0xe3, 0x14, 0x1c, 0xe3, 0x3a, 0x12, 0xf0,
+    0x16, 0x10, 0xe2, 0x3e, 0x09, 0xe0, 0x2e, 0x0b, 0xe0, 0x0e, 0x0d, 0xde, 0x0e, 0xb4, 0xa2, 0x94,
+    0xb4, 0xe0, 0x74, 0xb4, 0xe0, 0x74, 0xb4, 0x69, 0x64, 0xb4, 0x4d, 0x44, 0xb4, 0x4d, 0x44, 0xb4,
+    0x4e, 0x00, 0x34, 0xb4, 0x43, 0x74, 0x34, 0xb4, 0x43, 0x74, 0x34, 0xb4, 0x43, 0x74, 0x34, 0xb4,
+    0x43, 0x74, 0x34, 0xb4, 0x43, 0x74, 0x34, 0xb4, 0x43, 0x74, 0x34, 0xb4, 0x43, 0x74, 0x34, 0xb4,
+    0x43, 0x74, 0x34, 0xb4, 0x4e, 0x00, 0x34, 0xb4, 0x4e, 0x00, 0x34, 0xb4, 0x4e, 0x00, 0x34, 0xb4,
+    0x4e, 0x00, 0x34, 0xb4, 0x4e, 0x00, 0x34, 0xb4, 0x4e, 0x00, 0x34, 0xb4, 0x4e, 0x00, 0x34, 0xb4,
+    0x4e, 0x00, 0x34, 0xb4, 0x4e, 0x00, 0x34, 0xb4, 0x4d, 0x44, 0xb4, 0x4d, 0x44, 0xb4, 0x69, 0x64,
+    0xb4, 0xe0, 0x74, 0xb4, 0xe0, 0x74, 0xb4, 0xa2, 0x94, 0xce, 0x0e, 0xce, 0x0d, 0xe0, 0x0e, 0x0b,
+    0xe0, 0x2e, 0x09, 0xe2, 0x20, 0xea, 0x6e, 0x1b, 0xe1, 0x6e, 0x21, 0xe1, 0x1e, 0x24, 0xe0, 0xfb,
+    0x15, 0x15, 0x15, 0x15, 0x15, 0x1a, 0xe0, 0xd9, 0x16, 0x15, 0x15, 0x15, 0x15, 0x15, 0x17, 0xe0,
+    0xc6, 0x1e, 0x04, 0x4e, 0x06, 0x15, 0xe0, 0xa4, 0x1a, 0x15, 0x14, 0x58, 0x15, 0x1a, 0xe0, 0xac,
+    0x1d, 0x54, 0x1d, 0x13, 0x12, 0xe0, 0xa9, 0x18, 0x17, 0x4c, 0x1d, 0xe0, 0xa4, 0x1e, 0x04, 0x13,
+    0x25, 0x14, 0x17, 0x19, 0xe0, 0x97, 0x16, 0x16, 0x1e, 0x09, 0x15, 0x15, 0xe0, 0x93, 0x17, 0x16,
+    0x1d, 0x14, 0x1e, 0x04, 0xe0, 0xae, 0x0b, 0x14, 0x1a, 0x1c, 0x12, 0xe0, 0x99, 0x16, 0x16, 0x1c,
+    0x18, 0x13, 0x17, 0xe0, 0x95, 0x17, 0x16, 0x11, 0xd8, 0x19, 0x13, 0xe0, 0x93, 0x1e, 0x01, 0xe0,
+    0x5a, 0x18, 0xe0, 0x98, 0x18, 0xe0, 0x83, 0x19, 0x14, 0xe0, 0x9b, 0x13, 0x11, 0xe0, 0x9e, 0x02,
+    0xe0, 0xa5, 0x1a, 0xe0, 0xb5, 0x14, 0x15, 0xe0, 0x93, 0x1a, 0x8d, 0x68, 0x17, 0xe0, 0x99, 0x15,
+    0x5e, 0x02, 0x63, 0x18, 0x12, 0xe0, 0x97, 0x15, 0x6e, 0x04, 0x5e, 0x01, 0xe0, 0x95, 0x18, 0x5e,
+    0x04, 0x69, 0x14, 0xe0, 0x93, 0x17, 0x12, 0x55, 0x13, 0x12, 0x12, 0x13, 0x54, 0x12, 0x15, 0xe0,
+    0xae, 0x00, 0x53, 0x1e, 0x01, 0x4e, 0x01, 0xe0, 0x99, 0x14, 0x58, 0x1a, 0x5c, 0x11, 0xe0, 0x95,
+    0x18, 0x5e, 0x00, 0x14, 0x54, 0x15, 0x13, 0xe0, 0x93, 0x18, 0x11, 0x56, 0x14, 0x16, 0x68, 0x15,
+    0xe0, 0x99, 0x14, 0x54, 0x1e, 0x00, 0x44, 0x1a, 0xe0, 0x97, 0x16, 0x5e, 0x02, 0x12, 0x57, 0x15,
+    0xe0, 0xa5, 0x18, 0x58, 0x14, 0x15, 0x5e, 0x00, 0xe0, 0x93, 0x1a, 0x53, 0x1e, 0x01, 0x55, 0x15,
+    0x12, 0xe0, 0x9a, 0x13, 0x5b, 0x16, 0x5a, 0x14, 0xe0, 0x9e, 0x00, 0x56, 0x18, 0x13, 0x53, 0x1a,
+    0xe0, 0x95, 0x13, 0x14, 0x5a, 0x18, 0x5d, 0xe0, 0xa3, 0x1a, 0x53, 0x1e, 0x01, 0x56, 0x17, 0xe0,
+    0x9c, 0x11, 0x57, 0x15, 0x13, 0x11, 0x4b, 0x13, 0xe0, 0x97, 0x16, 0x5e, 0x05, 0x54, 0x19, 0xe0,
+    0x95, 0x15, 0x12, 0xe0, 0xf8, 0x14, 0xe0, 0xa3, 0x1a, 0xe0, 0xfe, 0x00, 0xe0, 0x99, 0x14, 0xe0,
+    0xe5, 0x16, 0x12, 0xe0, 0x9e, 0x00, 0xe0, 0xf8, 0x15, 0xe0, 0x95, 0x16, 0x11, 0xe0, 0xf6, 0x17,
+    0xe0, 0x93, 0x15, 0x14, 0xe0, 0xf4, 0x18, 0xe0, 0xae, 0x00, 0xe0, 0xeb, 0x13, 0xe0, 0x97, 0x16,
+    0xe0, 0xfe, 0x00, 0xe0, 0x95, 0x15, 0x12, 0xe0, 0xf6, 0x16, 0xe0, 0xa3, 0x1a, 0xe0, 0xf3, 0x16,
+    0x13, 0xe0, 0x9e, 0x00, 0xe0, 0xee, 0x01, 0xe0, 0x98, 0x15, 0xe0, 0xf8, 0x14, 0xe0, 0xa5, 0x16,
+    0x11, 0xe0, 0xf5, 0x18, 0xe0, 0x93, 0x1a, 0xe0, 0xfb, 0x12, 0xe0, 0x9a, 0x13, 0xe0, 0xe4, 0x1a,
+    0xe0, 0x97, 0x16, 0xe0, 0xe8, 0x16, 0xe0, 0x95, 0x18, 0xe0, 0xe3, 0x18, 0x12, 0xe0, 0x93, 0x18,
+    0x12, 0xe0, 0xda, 0x14, 0xe0, 0x99, 0x15, 0xe0, 0xd6, 0x18, 0xe0, 0x9e, 0x01, 0xe0, 0xce, 0x01,
+    0xe0, 0xa5, 0x1a, 0xe0, 0xa4, 0x16, 0x15, 0xe0, 0x93, 0x15, 0x13, 0x13, 0xe0, 0x89, 0x16, 0x11,
+    0xe0, 0x9e, 0x05, 0xe0, 0x58, 0x1a, 0xe0, 0x97, 0x14, 0x18, 0xe0, 0x17, 0x19, 0x13, 0xe0, 0x95,
+    0x1e, 0x15, 0x18, 0x16, 0xe0, 0x93, 0x17, 0x14, 0x1e, 0x19, 0xe0, 0xa9, 0x1a, 0x1e, 0x05, 0x16,
+    0x19, 0xe0, 0x9e, 0x01, 0x1a, 0x15, 0x14, 0x17, 0x16, 0x14, 0xe0, 0x95, 0x17, 0x15, 0x14, 0x13,
+    0x1e, 0x00, 0x16, 0x15, 0xe0, 0xa3, 0x17, 0x1e, 0x00, 0x45, 0x1e, 0x07, 0xe0, 0x98, 0x19, 0x14,
+    0x12, 0x58, 0x18, 0x15, 0x11, 0xe0, 0xae, 0x02, 0x19, 0x5c, 0x1c, 0xe0, 0xb4, 0x18, 0x17, 0x13,
+    0x44, 0x16, 0x15, 0x14, 0x13, 0xe0, 0xb2, 0x16, 0x1e, 0x0c, 0x1e, 0x03, 0xe0, 0xd6, 0x1a, 0x1e,
+    0x0b, 0x14, 0x13, 0xe0, 0xfd, 0x17, 0x17, 0x17, 0x1c, 0xe1, 0x18, 0x19, 0x16, 0x15, 0x1c, 0x13,
+    0xe1, 0x5e, 0x06, 0x1b, 0x13, 0x16, 0xea, 0x40, 0xe2, 0xd2, 0xe1, 0x74, 0xe1, 0x64, 0xe1, 0x64,
+    0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64, 0xe1, 0x64,
+    0xe1, 0x2c, 0xe0, 0xce, 0x02, 0xe0, 0x8e, 0x06, 0xe0, 0x48, 0x87, 0xe0, 0x26, 0xd6, 0xe0, 0x06,
+    0xe0, 0x26, 0xb5, 0xe0, 0x64, 0xb4, 0xe0, 0x84, 0x94, 0xe0, 0xa4, 0x74, 0xe0, 0xb4, 0x74, 0xe0,
+    0xc4, 0x63, 0xe0, 0xd4, 0x54, 0xe0, 0xe4, 0x44, 0xe0, 0xe4, 0x43, 0xe1, 0x03, 0x4e, 0x16, 0x3e,
+    0x17, 0x4e, 0x16, 0xe7, 0xb9, 0xe1, 0x28, 0xe1, 0x27, 0xe1, 0x54, 0xe5, 0x40, 0xeb, 0x84, 0xe3,
+    0xc8, 0xe3, 0xa8, 0xe3, 0x9a, 0xe3, 0x85, 0x14, 0xe3, 0x89, 0xe3, 0x93, 0x16, 0xe3, 0x87, 0x12,
+    0xe3, 0x8a, 0xe3, 0x85, 0x14, 0xe3, 0x83, 0x16, 0xe3, 0x88, 0x11, 0xe3, 0x8a, 0xe3, 0x85, 0x14,
+    0xe3, 0x83, 0x16, 0xe3, 0x89, 0xe3, 0x97, 0x12, 0xe3, 0x85, 0x14, 0xe3, 0x83, 0x16, 0xe3, 0x8a,
+    0xe3, 0x89, 0xe3, 0x95, 0x14, 0xe3, 0x83, 0x16, 0xe3, 0x8a, 0xe3, 0x78, 0x13, 0xe3, 0x1b, 0x1a,
+    0xe2, 0x9b, 0x1e, 0x02, 0xe2, 0x4e, 0x06, 0x1b, 0xe2, 0x0c, 0x17, 0x1e, 0x01, 0xe1, 0xc9, 0x12,
+    0x16, 0x17, 0x12, 0x19, 0xe1, 0x89, 0x19, 0x1e, 0x01, 0x17, 0xe1, 0x6e, 0x0e, 0x1e, 0x03, 0xe1,
+    0x37, 0x1a, 0x16, 0x1a, 0x13, 0x17, 0xe1, 0x16, 0x17, 0x1e, 0x04, 0x1e, 0x02, 0xe0, 0xfc, 0x15,
+    0x14, 0x16, 0x1e, 0x00, 0x16, 0xe0, 0xd6, 0x1e, 0x07, 0x19, 0x14, 0x1a, 0xe0, 0xbc, 0x16, 0x14,
+    0x1b, 0x15, 0x17, 0x15, 0xe0, 0x97, 0x19, 0x1b, 0x15, 0x1e, 0x08, 0xe0, 0x7c, 0x1b, 0x19, 0x1d,
+    0x16, 0x14, 0xe0, 0x57, 0x19, 0x1b, 0x1c, 0x1a, 0x18, 0xe0, 0x36, 0x15, 0x19, 0x1b, 0x16, 0x15,
+    0x1e, 0x01, 0xe0, 0x3e, 0x02, 0x19, 0x1c, 0x1b, 0x17, 0x14, 0xe0, 0x15, 0x1e, 0x02, 0x1a, 0x1c,
+    0x19, 0x19, 0xe0, 0x0a, 0x14, 0x14, 0x19, 0x16, 0x1c, 0x1e, 0x01, 0xd5, 0x1e, 0x06, 0x1e, 0x03,
+    0x1a, 0x14, 0x12, 0x14, 0xc9, 0x14, 0x14, 0x1a, 0x15, 0x14, 0x17, 0x1e, 0x04, 0xb5, 0x1e, 0x0f,
+    0x1c, 0x1a, 0x1a, 0xad, 0x14, 0x15, 0x14, 0x1a, 0x1c, 0x1b, 0x14, 0x99, 0x1d, 0x1a, 0x1a, 0x1c,
+    0x14, 0x18, 0x84, 0x18, 0x14, 0x19, 0x1a, 0x19, 0x1e, 0x05, 0x12, 0x8e, 0x12, 0x14, 0x19, 0x15,
+    0x12, 0x14, 0x1a, 0x78, 0x13, 0x14, 0x14, 0x14, 0x1e, 0x01, 0x1e, 0x08, 0x12, 0x14, 0x6e, 0x11,
+    0x1e, 0x01, 0x14, 0x17, 0x1d, 0x64, 0x16, 0x14, 0x14, 0x13, 0x19, 0x15, 0x1e, 0x02, 0x1e, 0x01,
+    0x59, 0x1e, 0x06, 0x19, 0x15, 0x15, 0x14, 0x16, 0x14, 0x13, 0x12, 0x44, 0x1a, 0x14, 0x1e, 0x00,
+    0x1e, 0x00, 0x1e, 0x0b, 0x48, 0x1e, 0x01, 0x13, 0x14, 0x1b, 0x1a, 0x1a, 0x14, 0x13, 0x4c, 0x15,
+    0x1e, 0x05, 0x14, 0x1a, 0x16, 0x1e, 0x00, 0x43, 0x1e, 0x05, 0x17, 0x1e, 0x02, 0x1e, 0x02, 0x14,
+    0x15, 0x46, 0x14, 0x14, 0x14, 0x16, 0x1c, 0x1a, 0x16, 0x1e, 0x02, 0x58, 0x1e, 0x02, 0x18, 0x1e,
+    0x07, 0x15, 0x14, 0x14, 0x11, 0x7c, 0x14, 0x1d, 0x15, 0x14, 0x14, 0x15, 0x1e, 0x04, 0xf0, 0x1b,
+    0x2e, 0x06, 0xe2, 0xfe, 0x04, 0xe3, 0x0e, 0x04, 0xe3, 0x06, 0x15, 0x15, 0xe3, 0x13, 0x15, 0x15,
+    0xe3, 0x3e, 0x02, 0xe3, 0x36, 0x15, 0x11, 0xe3, 0x5c, 0xe3, 0x86, 0x11, 0xe3, 0xd2, 0xe6, 0x90,
+    0xe1, 0x41, 0xe0, 0xd3, 0xc3, 0xe0, 0xb5, 0xb4, 0xe0, 0x96, 0xc4, 0xe0, 0x77, 0xd4, 0xe0, 0x58,
+    0x82, 0x44, 0xe0, 0x2a, 0x74, 0x43, 0xe0, 0x1b, 0x75, 0x34, 0xdc, 0x84, 0x43, 0x6e, 0x05, 0x94,
+    0x34, 0x4e, 0x06, 0x42, 0x43, 0x43, 0x3e, 0x07, 0x34, 0x43, 0x33, 0x3e, 0x07, 0x43, 0x43, 0x33,
+    0x3e, 0x07, 0x53, 0x33, 0x33, 0x3e, 0x07, 0x53, 0x33, 0x42, 0x3e, 0x07, 0x53, 0x33, 0x42, 0x3e,
+    0x07, 0x53, 0x33, 0x42, 0x3e, 0x07, 0x43, 0x43, 0x33, 0x3e, 0x07, 0x34, 0x43, 0x33, 0x4e, 0x06,
+    0x42, 0x43, 0x43, 0x5e, 0x05, 0x94, 0x43, 0xcc, 0x93, 0x43, 0xe0, 0x0b, 0x84, 0x43, 0xe0, 0x1a,
+    0x74, 0x43, 0xe0, 0x39, 0x82, 0x44, 0xe0, 0x57, 0xd4, 0xe0, 0x76, 0xc4, 0xe0, 0x95, 0xb5, 0xe0,
+    0xa3, 0xc4, 0xe1, 0xb1, 0x90, 0xe3, 0x03, 0xe1, 0xa5, 0xe1, 0x86, 0xe1, 0x77, 0xe1, 0x68, 0x82,
+    0xe0, 0xaa, 0x74, 0xe0, 0x8b, 0x75, 0xe0, 0x6c, 0x84, 0xde, 0x05, 0x94, 0xbe, 0x06, 0x42, 0x43,
+    0xae, 0x07, 0x34, 0x43, 0x9e, 0x07, 0x43, 0x43, 0x9e, 0x07, 0x53, 0x33, 0x9e, 0x07, 0x53, 0x33,
+    0x9e, 0x07, 0x53, 0x33, 0x9e, 0x07, 0x53, 0x33, 0x9e, 0x07, 0x43, 0x43, 0x9e, 0x07, 0x34, 0x43,
+    0xae, 0x06, 0x42, 0x43, 0xce, 0x05, 0x94, 0xe0, 0x5c, 0x93, 0xe0, 0x7b, 0x84, 0xe0, 0x8a, 0x74,
+    0xe0, 0xa9, 0x82, 0xe0, 0xd7, 0xe1, 0x86, 0xe1, 0x95, 0xe1, 0xa3, 0xe3, 0x50, 0xe3, 0x03, 0xe1,
+    0xa5, 0xe1, 0x86, 0xe1, 0x77, 0xe1, 0x68, 0xe1, 0x4a, 0xe1, 0x3b, 0xe1, 0x2c, 0xe0, 0xbe, 0x05,
+    0xe0, 0xae, 0x06, 0x42, 0xe0, 0x3e, 0x07, 0x34, 0xe0, 0x2e, 0x07, 0x43, 0xe0, 0x2e, 0x07, 0x53,
+    0xe0, 0x1e, 0x07, 0x53, 0xe0, 0x1e, 0x07, 0x53, 0xe0, 0x1e, 0x07, 0x53, 0xe0, 0x1e, 0x07, 0x43,
+    0xe0, 0x2e, 0x07, 0x34, 0xe0, 0x3e, 0x06, 0x42, 0xe0, 0x5e, 0x05, 0xe1, 0x2c, 0xe1, 0x3b, 0xe1,
+    0x4a, 0xe1, 0x59, 0xe1, 0x77, 0xe1, 0x86, 0xe1, 0x95, 0xe1, 0xa3, 0xe3, 0x50, 0xe3, 0x03, 0xe1,
+    0xa5, 0xe1, 0x86, 0xe1, 0x77, 0xe1, 0x68, 0xe1, 0x4a, 0xe1, 0x3b, 0xe1, 0x2c, 0xe0, 0xbe, 0x05,
+    0x42, 0x63, 0x9e, 0x06, 0x34, 0x53, 0x8e, 0x07, 0x44, 0x24, 0x9e, 0x07, 0x54, 0x13, 0xae, 0x07,
+    0x66, 0xbe, 0x07, 0x74, 0xce, 0x07, 0x75, 0xbe, 0x07, 0x58, 0xae, 0x07, 0x44, 0x24, 0x9e, 0x07,
+    0x43, 0x44, 0x9e, 0x06, 0x33, 0x63, 0xae, 0x05, 0x41, 0x81, 0xe0, 0x4c, 0xe1, 0x3b, 0xe1, 0x4a,
+    0xe1, 0x59, 0xe1, 0x77, 0xe1, 0x86, 0xe1, 0x95, 0xe1, 0xa3, 0xe3, 0x50, 0xef, 0x28, 0xe0, 0xfe,
+    0x00, 0xe0, 0xbe, 0x02, 0xe0, 0x8e, 0x06, 0xe0, 0x5e, 0x08, 0xde, 0x12, 0x6e, 0x09, 0x85, 0x3e,
+    0x07, 0xe0, 0x03, 0x2e, 0x06, 0xe0, 0x22, 0x14, 0x22, 0x22, 0x22, 0x23, 0x37, 0x32, 0x25, 0x31,
+    0x32, 0x22, 0x23, 0x29, 0x13, 0x26, 0x21, 0x31, 0x37, 0x23, 0xc6, 0xa2, 0x23, 0x23, 0x81, 0x36,
+    0x93, 0x23, 0x27, 0x33, 0x26, 0x93, 0x23, 0x27, 0x33, 0x27, 0x83, 0x23, 0x26, 0x43, 0x27, 0x31,
+    0x34, 0x23, 0x23, 0x73, 0x27, 0x31, 0x34, 0x23, 0x23, 0x73, 0x28, 0x22, 0x24, 0x23, 0x32, 0x82,
+    0x22, 0x1e, 0x05, 0xe0, 0x32, 0x2e, 0x05, 0xe0, 0x23, 0x3e, 0x02, 0xe0, 0x15, 0x6e, 0x12, 0xde,
+    0x08, 0xe0, 0x5e, 0x06, 0xe0, 0x8e, 0x02, 0xe0, 0xbe, 0x00, 0xe0, 0xf8, 0xef, 0x20, 0xf0, 0x39,
+    0x61, 0x11, 0xe3, 0x61, 0x1e, 0x03, 0x11, 0xe2, 0xae, 0x0e, 0xe2, 0x3e, 0x15, 0xe1, 0xbe, 0x1b,
+    0xe1, 0x7e, 0x20, 0xe1, 0x2e, 0x24, 0xe0, 0xee, 0x28, 0xe0, 0xae, 0x2c, 0xe0, 0x7e, 0x2e, 0xe0,
+    0x4e, 0x32, 0xe0, 0x1e, 0x34, 0xce, 0x38, 0x9e, 0x3a, 0x7e, 0x0f, 0xe0, 0x11, 0x1e, 0x0e, 0x5e,
+    0x0c, 0xe0, 0xae, 0x0c, 0x3e, 0x0a, 0xe1, 0x0e, 0x0a, 0x1e, 0x08, 0xe1, 0x6e, 0x08, 0x1e, 0x05,
+    0xe1, 0xae, 0x05, 0x3e, 0x02, 0xe1, 0xee, 0x02, 0x5e, 0x00, 0xe2, 0x0e, 0x00, 0x7b, 0xe0, 0x51,
+    0x18, 0x11, 0xe0, 0x5b, 0x99, 0xe0, 0x2e, 0x06, 0xe0, 0x29, 0xb7, 0xe0, 0x0e, 0x0c, 0xe0, 0x07,
+    0xd4, 0xe0, 0x0e, 0x10, 0xe0, 0x04, 0xe0, 0x12, 0xde, 0x14, 0xd2, 0xe0, 0xfe, 0x18, 0xe1, 0xae,
+    0x1c, 0xe1, 0x7e, 0x1e, 0xe1, 0x5e, 0x20, 0xe1, 0x3e, 0x22, 0xe1, 0x1e, 0x24, 0xe1, 0x0e, 0x24,
+    0xe1, 0x1e, 0x22, 0xe1, 0x3e, 0x05, 0x11, 0x51, 0x1e, 0x04, 0xe1, 0x5e, 0x01, 0xe0, 0x1e, 0x00,
+    0xe1, 0x7b, 0xe0, 0x6b, 0xe1, 0x98, 0xe0, 0xa8, 0xe1, 0xb6, 0xe0, 0xc6, 0xe1, 0xd3, 0xe1, 0x03,
+    0xe1, 0xf1, 0xe1, 0x21, 0xe7, 0xf1, 0x11, 0xe3, 0xca, 0xe3, 0x6e, 0x00, 0xe3, 0x2e, 0x04, 0xe2,
+    0xfe, 0x06, 0xe2, 0xee, 0x06, 0xe2, 0xfe, 0x04, 0xe3, 0x1e, 0x02, 0xe3, 0x3e, 0x00, 0xe3, 0x5c,
+    0xe3, 0x7a, 0xe3, 0x98, 0xe3, 0xb6, 0xe3, 0xd4, 0xe3, 0xf2, 0xf0, 0x3e, 0x70, 0xf0, 0x35, 0x92,
+    0xe3, 0xa3, 0xe3, 0x94, 0xe3, 0x95, 0xe3, 0x86, 0x31, 0xe3, 0x28, 0x22, 0xe3, 0x18, 0x14, 0xe3,
+    0x1c, 0xe3, 0x1c, 0xe3, 0x1d, 0xe2, 0xee, 0x03, 0xe2, 0xce, 0x03, 0xe2, 0xce, 0x03, 0xe2, 0xce,
+    0x03, 0xe2, 0xce, 0x04, 0xe2, 0xbe, 0x05, 0xe2, 0x9e, 0x06, 0xe2, 0x9e, 0x06, 0xe2, 0x9e, 0x06,
+    0xe2, 0x9e, 0x07, 0xe2, 0x9e, 0x05, 0xe2, 0xae, 0x05, 0xe2, 0xae, 0x04, 0xe2, 0xbe, 0x04, 0xe2,
+    0xbe, 0x04, 0xe2, 0xbe, 0x04, 0xe2, 0xbe, 0x04, 0xe2, 0xae, 0x06, 0xe2, 0x9e, 0x06, 0xe2, 0x8e,
+    0x09, 0xe2, 0x4e, 0x0e, 0xe1, 0xfe, 0x12, 0xe1, 0xbe, 0x17, 0xe1, 0x6e, 0x19, 0xe1, 0x5e, 0x1b,
+    0xe1, 0x3e, 0x1c, 0xe1, 0x3e, 0x1d, 0xe1, 0x1e, 0x1e, 0xe1, 0x1e, 0x1e, 0xe1, 0x1e, 0x1f, 0xe1,
+    0x0e, 0x1f, 0xe1, 0x0e, 0x1f, 0xe0, 0xfe, 0x20, 0xe0, 0xfe, 0x20, 0xe0, 0xfe, 0x20, 0xe0, 0xee,
+    0x21, 0xe0, 0xee, 0x21, 0xe0, 0xee, 0x22, 0xe0, 0xda, 0x1e, 0x0c, 0x1a, 0xe0, 0xd9, 0x3e, 0x0a,
+    0x2a, 0xe0, 0xd9, 0x3e, 0x0a, 0x2a, 0xe0, 0xd9, 0x3e, 0x0a, 0x2b, 0xe0, 0xba, 0x4e, 0x09, 0x3a,
+    0xe0, 0xba, 0x4e, 0x09, 0x3a, 0xe0, 0xab, 0x4e, 0x08, 0x5a, 0xe0, 0x8b, 0x5e, 0x08, 0x5b, 0xe0,
+    0x6c, 0x5e, 0x08, 0x5b, 0xe0, 0x6c, 0x5e, 0x08, 0x5c, 0xe0, 0x4d, 0x5e, 0x08, 0x5c, 0xe0, 0x3e,
+    0x00, 0x5e, 0x08, 0x5d, 0xe0, 0x2e, 0x00, 0x5e, 0x08, 0x5d, 0xe0, 0x2e, 0x00, 0x5e, 0x08, 0x5e,
+    0x00, 0xe0, 0x0e, 0x01, 0x5e, 0x08, 0x5e, 0x00, 0xe0, 0x0e, 0x00, 0x6e, 0x08, 0x5e, 0x01, 0xde,
+    0x00, 0x6e, 0x08, 0x5e, 0x01, 0xde, 0x00, 0x6e, 0x08, 0x6e, 0x00, 0xde, 0x00, 0x6e, 0x08, 0x6e,
+    0x00, 0xde, 0x00, 0x6e, 0x08, 0x6e, 0x01, 0xce, 0x00, 0x6e, 0x08, 0x6e, 0x01, 0xce, 0x00, 0x6e,
+    0x08, 0x6e, 0x01, 0xce, 0x00, 0x6e, 0x08, 0x6e, 0x01, 0xce, 0x00, 0x6e, 0x08, 0x6e, 0x01, 0xce,
+    0x00, 0x6e, 0x08, 0x6e, 0x01, 0xce, 0x00, 0x6e, 0x09, 0x5e, 0x01, 0xce, 0x00, 0x6e, 0x09, 0x5e,
+    0x01, 0xce, 0x00, 0x6e, 0x09, 0x5e, 0x01, 0xce, 0x00, 0x5e, 0x0b, 0x4e, 0x01, 0xce, 0x01, 0x4e,
+    0x0b, 0x4e, 0x01, 0xce, 0x01, 0x4e, 0x0b, 0x4e, 0x01, 0xce, 0x01, 0x4e, 0x0c, 0x3e, 0x01, 0xce,
+    0x01, 0x4e, 0x0c, 0x2e, 0x02, 0xce, 0x02, 0x3e, 0x0c, 0x2e, 0x02, 0xce, 0x02, 0x3e, 0x1e, 0xde,
+    0x02, 0x2e, 0x1d, 0xe0, 0x0e, 0x02, 0x1d, 0x1e, 0x10, 0xe0, 0x0e, 0x10, 0x2e, 0x0f, 0xe0, 0x0e,
+    0x0f, 0x3e, 0x0f, 0xe0, 0x0e, 0x0f, 0x3e, 0x0f, 0xe0, 0x0a, 0x1e, 0x04, 0x4e, 0x02, 0x2a, 0xe0,
+    0x19, 0x2e, 0x03, 0x4e, 0x01, 0x48, 0xe0, 0x29, 0x3e, 0x01, 0x5e, 0x00, 0x49, 0xe0, 0x29, 0x3e,
+    0x01, 0x5e, 0x00, 0x49, 0xe0, 0x29, 0x4e, 0x00, 0x6c, 0x59, 0xe0, 0x2a, 0x5c, 0x6c, 0x49, 0xe0,
+    0x3a, 0x6a, 0x7c, 0x49, 0xe0, 0x4a, 0x5a, 0x7c, 0x3a, 0xe0, 0x4b, 0x4a, 0x8b, 0x2b, 0xe0, 0x4c,
+    0x2b, 0x8b, 0x1c, 0xe0, 0x5b, 0x2a, 0x9e, 0x09, 0xe0, 0x6c, 0x1a, 0xae, 0x07, 0xe0, 0x8b, 0x1a,
+    0xae, 0x06, 0xe0, 0xa4, 0x79, 0xbb, 0x52, 0xe0, 0xd1, 0x99, 0xbb, 0xe1, 0xe9, 0xbb, 0xe1, 0xda,
+    0xca, 0xe1, 0xd9, 0xdb, 0xe1, 0xc9, 0xdb, 0xe1, 0xba, 0xe0, 0x0a, 0xe1, 0xb9, 0xe0, 0x1a, 0xe1,
+    0xb9, 0xe0, 0x1a, 0xe1, 0xb9, 0xe0, 0x1a, 0xe1, 0xaa, 0xe0, 0x1a, 0xe1, 0xa9, 0xe0, 0x2a, 0xe1,
+    0xa9, 0xe0, 0x29, 0xe1, 0xb9, 0xe0, 0x38, 0xe1, 0xb9, 0xe0, 0x38, 0xe1, 0xc7, 0xe0, 0x48, 0xe1,
+    0xc7, 0xe0, 0x57, 0xe1, 0xc7, 0xe0, 0x57, 0xe1, 0xc7, 0xe0, 0x57, 0xe1, 0xc7, 0xe0, 0x57, 0xe1,
+    0xc7, 0xe0, 0x57, 0xe1, 0xd6, 0xe0, 0x57, 0xe1, 0xd6, 0xe0, 0x66, 0xe1, 0xd6, 0xe0, 0x66, 0xe1,
+    0xd6, 0xe0, 0x66, 0xe1, 0xd5, 0xe0, 0x76, 0xe1, 0xd5, 0xe0, 0x76, 0xe1, 0xd5, 0xe0, 0x76, 0xe1,
+    0xe4, 0xe0, 0x85, 0xe1, 0xe5, 0xe0, 0x75, 0xe1, 0xe5, 0xe0, 0x65, 0xe1, 0xe6, 0xe0, 0x66, 0xe1,
+    0xd6, 0xe0, 0x66, 0xe1, 0xd6, 0xe0, 0x67, 0xe1, 0xb7, 0xe0, 0x68, 0xe1, 0x98, 0xe0, 0x68, 0xe1,
+    0x88, 0xe0, 0x89, 0xe1, 0x59, 0xe0, 0x8a, 0xe1, 0x3a, 0xe0, 0x8b, 0xe1, 0x0b, 0xe0, 0xab, 0xe0,
+    0xfb, 0xe0, 0xac, 0xe0, 0xdc, 0xe0, 0xad, 0xe0, 0xcc, 0xe0, 0xbc, 0xe0, 0xcc, 0xe0, 0xbc, 0xe0,
+    0xcc, 0xe0, 0xbc, 0xe0, 0xcb, 0xe0, 0xe9, 0xe0, 0xe8, 0xe1, 0x22, 0xf0, 0x47, 0x70, 0xf0, 0x8c,
+    0xb4, 0xe4, 0x27, 0xe3, 0xf9, 0xe3, 0xda, 0xe3, 0xda, 0xe3, 0xdb, 0xe3, 0xbc, 0xe3, 0x9e, 0x01,
+    0xe3, 0x5e, 0x07, 0xe2, 0xee, 0x0e, 0xe2, 0x7e, 0x15, 0xe2, 0x1e, 0x1a, 0xe1, 0xce, 0x20, 0xe1,
+    0x8e, 0x24, 0xe1, 0x4e, 0x26, 0xe1, 0x2e, 0x29, 0xe1, 0x0e, 0x2a, 0xe0, 0xee, 0x2c, 0xe0, 0xde,
+    0x2d, 0xe0, 0xce, 0x2d, 0xe0, 0xbe, 0x2f, 0xe0, 0xae, 0x2f, 0xe0, 0xae, 0x2f, 0xe0, 0x9e, 0x30,
+    0xe0, 0x9e, 0x30, 0xe0, 0x9e, 0x30, 0xe0, 0x8e, 0x31, 0xe0, 0x8e, 0x31, 0xe0, 0x7e, 0x33, 0xe0,
+    0x21, 0x3e, 0x33, 0xe0, 0x2e, 0x38, 0x21, 0xce, 0x38, 0x13, 0xbe, 0x3c, 0xbe, 0x3c, 0xae, 0x3d,
+    0x7e, 0x40, 0x7e, 0x43, 0x5e, 0x42, 0x5e, 0x42, 0x6e, 0x40, 0x7e, 0x40, 0x7e, 0x40, 0x6e, 0x01,
+    0x1e, 0x21, 0x1e, 0x00, 0x7e, 0x01, 0x1e, 0x21, 0x1e, 0x00, 0x8d, 0x2e, 0x21, 0x2e, 0x00, 0x7d,
+    0x1e, 0x22, 0x2e, 0x00, 0x7c, 0x2e, 0x22, 0x3d, 0x8e, 0x24, 0x1b, 0x2c, 0x9e, 0x0a, 0x1e, 0x0b,
+    0x2e, 0x0a, 0x9e, 0x09, 0x2e, 0x0b, 0x2e, 0x09, 0xb8, 0x2b, 0x3e, 0x0b, 0x3e, 0x08, 0xb8, 0x1c,
+    0x2e, 0x0c, 0x3b, 0x29, 0xbe, 0x07, 0x2e, 0x0c, 0x4a, 0x28, 0xde, 0x06, 0x2e, 0x0c, 0x4e, 0x06,
+    0xd7, 0x1b, 0x3e, 0x0c, 0x3e, 0x07, 0xd7, 0x1b, 0x3e, 0x0c, 0x3e, 0x06, 0xe0, 0x07, 0x2a, 0x3e,
+    0x0c, 0x4e, 0x05, 0xe0, 0x07, 0x2a, 0x3e, 0x0c, 0x4a, 0x27, 0xe0, 0x16, 0x29, 0x4e, 0x0d, 0x3a,
+    0x27, 0xe0, 0x16, 0x38, 0x4e, 0x0d, 0x39, 0x36, 0xe0, 0x27, 0x28, 0x3e, 0x0e, 0x48, 0x27, 0xe0,
+    0x27, 0x28, 0x3e, 0x0e, 0x48, 0x27, 0xe0, 0x36, 0x27, 0x4e, 0x0e, 0x47, 0x36, 0xe0, 0x47, 0x26,
+    0x4e, 0x0e, 0x47, 0x36, 0xe0, 0x39, 0x16, 0x4e, 0x0e, 0x46, 0x37, 0xe0, 0x3e, 0x02, 0x4e, 0x0e,
+    0x46, 0x28, 0xe0, 0x3e, 0x02, 0x4e, 0x0e, 0x46, 0x28, 0xe0, 0x39, 0x16, 0x4e, 0x00, 0x1d, 0x46,
+    0x19, 0xe0, 0x2a, 0x17, 0x3e, 0x00, 0x1d, 0x46, 0x19, 0xe0, 0x2a, 0x26, 0x3e, 0x00, 0x1e, 0x00,
+    0x26, 0x29, 0xe0, 0x2a, 0x18, 0x2e, 0x00, 0x2d, 0x17, 0x29, 0xe0, 0x27, 0x12, 0x18, 0x2d, 0x3e,
+    0x07, 0x2a, 0xe0, 0x26, 0x49, 0x1d, 0x3e, 0x07, 0x29, 0xe0, 0x45, 0x49, 0x1d, 0x3e, 0x07, 0x56,
+    0xe0, 0x54, 0x49, 0x1d, 0x3e, 0x07, 0x56, 0xe0, 0x63, 0x49, 0x1d, 0x3e, 0x07, 0x55, 0xe0, 0xe9,
+    0x2c, 0x4e, 0x06, 0x54, 0xe0, 0xf9, 0x2b, 0x5e, 0x06, 0x61, 0xe1, 0x15, 0x22, 0x2b, 0x5a, 0x22,
+    0x15, 0xe1, 0x86, 0x5b, 0x5a, 0x55, 0xe1, 0x95, 0x5b, 0x5a, 0x45, 0xe1, 0xb4, 0x5b, 0x5a, 0x45,
+    0xe1, 0xc3, 0x4c, 0x5b, 0x43, 0xe2, 0x4c, 0x5b, 0xe2, 0xbc, 0x5b, 0xe2, 0xad, 0x5c, 0xe2, 0x9d,
+    0x4d, 0xe2, 0x9d, 0x4d, 0xe2, 0x9d, 0x4d, 0xe2, 0x9d, 0x4d, 0xe2, 0x9d, 0x4d, 0xe2, 0xac, 0x4c,
+    0xe2, 0xbc, 0x5b, 0xe2, 0xbc, 0x5b, 0xe2, 0xca, 0x6b, 0xe2, 0xca, 0x6a, 0xe2, 0xda, 0x6a, 0xe2,
+    0xda, 0x79, 0xe2, 0xe9, 0x79, 0xe2, 0xe9, 0x78, 0xe2, 0xf9, 0x78, 0xe3, 0x08, 0x78, 0xe3, 0x08,
+    0x69, 0xe3, 0x08, 0x69, 0xe2, 0xfa, 0x4a, 0xe2, 0xfa, 0x4b, 0xe2, 0xdb, 0x4c, 0xe2, 0xad, 0x4d,
+    0xe2, 0x8e, 0x00, 0x5d, 0xe2, 0x6e, 0x00, 0x6e, 0x00, 0xe2, 0x4e, 0x01, 0x7e, 0x00, 0xe2, 0x2e,
+    0x02, 0x7e, 0x01, 0xe2, 0x1e, 0x02, 0x7e, 0x01, 0xe2, 0x1e, 0x02, 0x7e, 0x01, 0xe2, 0x17, 0x18,
+    0x78, 0x16, 0xe2, 0x24, 0x37, 0x88, 0x25, 0xe2, 0x22, 0x65, 0xa6, 0x44, 0xe2, 0xa3, 0xe0, 0x03,
+    0x71, 0xf0, 0xa0, 0xf0, 0xea, 0x43, 0xe1, 0x65, 0xe1, 0x47, 0xe1, 0x29, 0xe1, 0x0b, 0xe0, 0xed,
+    0xe0, 0xce, 0x01, 0xe0, 0xa8, 0x18, 0xe0, 0x88, 0x47, 0xe0, 0x68, 0x67, 0xe0, 0x49, 0x68, 0xe0,
+    0x2b, 0x4a, 0xe0, 0x0d, 0x2c, 0xce, 0x00, 0x2d, 0xbe, 0x00, 0x2e, 0x00, 0x9e, 0x01, 0x2e, 0x01,
+    0x8e, 0x01, 0x25, 0x46, 0x8e, 0x01, 0x24, 0x56, 0x8e, 0x01, 0x24, 0x65, 0x8e, 0x01, 0x24, 0x56,
+    0x87, 0x26, 0x23, 0x57, 0x86, 0x45, 0x22, 0x3a, 0x85, 0x64, 0x21, 0x3b, 0x85, 0x64, 0x5c, 0x86,
+    0x54, 0x4d, 0x87, 0x11, 0x33, 0x3e, 0x00, 0x8a, 0x32, 0x2e, 0x01, 0x8b, 0x31, 0x2e, 0x01, 0x8c,
+    0x5e, 0x01, 0x8d, 0x4e, 0x01, 0x9d, 0x3e, 0x00, 0xeb, 0xf0, 0xf0, 0x2f, 0x55, 0xe3, 0xc7, 0xe3,
+    0xa9, 0xe3, 0x8b, 0xe3, 0x6d, 0xe3, 0x4e, 0x01, 0xe3, 0x2e, 0x03, 0xe3, 0x0e, 0x05, 0xe2, 0xee,
+    0x07, 0xe2, 0xce, 0x09, 0xe2, 0xae, 0x0b, 0xe2, 0x8e, 0x0d, 0xe2, 0x6e, 0x0f, 0xe2, 0x4e, 0x11,
+    0xe2, 0x2e, 0x13, 0xe2, 0x0e, 0x01, 0x5e, 0x01, 0xe1, 0xee, 0x01, 0x8e, 0x00, 0xe1, 0xce, 0x01,
+    0x9e, 0x01, 0xe1, 0xae, 0x02, 0xae, 0x01, 0xe1, 0x8e, 0x02, 0xbe, 0x02, 0xe1, 0x6e, 0x03, 0xbe,
+    0x03, 0xe1, 0x4e, 0x04, 0xbe, 0x04, 0xe1, 0x2e, 0x06, 0xae, 0x05, 0xe1, 0x0e, 0x07, 0x9e, 0x07,
+    0xe0, 0xee, 0x09, 0x7e, 0x09, 0xe0, 0xce, 0x0b, 0x5e, 0x0b, 0xe0, 0xae, 0x0c, 0x5e, 0x0c, 0xe0,
+    0x8e, 0x0d, 0x5e, 0x0d, 0xe0, 0x6e, 0x0e, 0x5e, 0x0e, 0xe0, 0x5e, 0x0e, 0x5e, 0x0f, 0xe0, 0x4e,
+    0x0e, 0x5e, 0x0f, 0xe0, 0x3e, 0x0f, 0x5c, 0x3e, 0x00, 0xe0, 0x3e, 0x0f, 0x5a, 0x7d, 0xe0, 0x2e,
+    0x0f, 0x59, 0x9c, 0xe0, 0x2e, 0x0f, 0x59, 0xab, 0xe0, 0x2e, 0x0f, 0x58, 0xbb, 0xe0, 0x2e, 0x0f,
+    0x58, 0xbb, 0xe0, 0x2e, 0x0f, 0x58, 0xbb, 0xe0, 0x2e, 0x0f, 0x58, 0xbb, 0xe0, 0x2e, 0x0f, 0x57,
+    0xbc, 0xe0, 0x2e, 0x01, 0x2c, 0x56, 0xcc, 0xe0, 0x2d, 0x6a, 0x55, 0xbe, 0x00, 0xe0, 0x2c, 0x89,
+    0x54, 0x7e, 0x05, 0xe0, 0x2b, 0xa8, 0x53, 0x7e, 0x06, 0xe0, 0x2b, 0xa8, 0x52, 0x7e, 0x07, 0xe0,
+    0x2a, 0xb8, 0x51, 0x7e, 0x08, 0xe0, 0x2b, 0xa8, 0xce, 0x09, 0xe0, 0x2b, 0xa8, 0xbe, 0x0a, 0xe0,
+    0x2b, 0xb7, 0xae, 0x0b, 0xe0, 0x2c, 0xb6, 0x9e, 0x0c, 0xe0, 0x2d, 0xb5, 0x8e, 0x0d, 0xe0, 0x2e,
+    0x04, 0x74, 0x7e, 0x0e, 0xe0, 0x2e, 0x05, 0x73, 0x6e, 0x0f, 0xe0, 0x2e, 0x06, 0x72, 0x5e, 0x10,
+    0xe0, 0x2e, 0x07, 0x71, 0x5e, 0x10, 0xe0, 0x2e, 0x08, 0x71, 0x4e, 0x10, 0xe0, 0x2e, 0x09, 0xbe,
+    0x10, 0xe0, 0x2e, 0x0a, 0xae, 0x10, 0xe0, 0x2e, 0x0b, 0x9e, 0x10, 0xe0, 0x2e, 0x0c, 0x8e, 0x0f,
+    0xe0, 0x4e, 0x0c, 0x7e, 0x0f, 0xe0, 0x5e, 0x0c, 0x6e, 0x0d, 0xf0, 0x2d, 0xb0, 0xe3, 0xe1, 0xe2,
+    0x31, 0xe2, 0x32, 0xe2, 0x22, 0xe2, 0x23, 0xe2, 0x13, 0xe2, 0x14, 0xe2, 0x04, 0xe2, 0x05, 0xe1,
+    0xf5, 0xe1, 0xf6, 0xe1, 0xe6, 0xe1, 0xe7, 0xe1, 0xd7, 0xe1, 0xd8, 0xe1, 0xc8, 0xe1, 0xc9, 0xe1,
+    0xb9, 0xe0, 0xbe, 0x0c, 0xe0, 0xae, 0x0d, 0xe0, 0xae, 0x0c, 0xe0, 0xae, 0x0d, 0xe0, 0xae, 0x0c,
+    0xe0, 0xae, 0x0d, 0xe0, 0xae, 0x0c, 0xe0, 0xae, 0x0d, 0xe0, 0xae, 0x0c, 0xe0, 0xae, 0x0d, 0xe0,
+    0xae, 0x0c, 0xe0, 0xab, 0xe1, 0xaa, 0xe1, 0xaa, 0xe1, 0xb9, 0xe1, 0xc8, 0xe1, 0xc8, 0xe1, 0xd7,
+    0xe1, 0xd7, 0xe1, 0xe6, 0xe1, 0xe6, 0xe1, 0xf5, 0xe1, 0xf5, 0xe2, 0x04, 0xe2, 0x04, 0xe2, 0x13,
+    0xe2, 0x13, 0xe2, 0x22, 0xe2, 0x22, 0xe2, 0x31, 0xe3, 0xc0, 0xf0, 0x20, 0x8d, 0xe3, 0x5d, 0xe3,
+    0x5d, 0xe1, 0x4e, 0x33, 0xe0, 0x1e, 0x33, 0xe0, 0x1e, 0x33, 0xe0, 0x1e, 0x33, 0xe2, 0x2d, 0xe3,
+    0x5d, 0xe3, 0x5d, 0xe3, 0x5c, 0xe3, 0x7b, 0xe3, 0x7a, 0xe3, 0x99, 0xe3, 0xa7, 0xe3, 0xb6, 0xe3,
+    0xd5, 0xed, 0xd4, 0xe3, 0xe4, 0xe3, 0xe4, 0xe3, 0xd5, 0xe3, 0xb6, 0xe2, 0x8e, 0x0c, 0xe2, 0x8e,
+    0x0b, 0xe2, 0x9e, 0x0a, 0xe2, 0xae, 0x08, 0xec, 0xce, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16,
+    0xe1, 0xee, 0x16, 0xf0, 0x11, 0xce, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16,
+    0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1,
+    0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee,
+    0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16, 0xe1, 0xee, 0x16,
+    0xe1, 0xee, 0x16, 0xeb, 0x0e, 0x33, 0xe0, 0x1e, 0x33, 0xe0, 0x1e, 0x33, 0xe0, 0x1e, 0x33, 0xe0,
+    0x1e, 0x33, 0xf0, 0x2d, 0x80, 0xe7, 0xe6, 0xe1, 0x46, 0xe0, 0x3e, 0x13, 0x7e, 0x13, 0xe0, 0xa6,
+    0xe1, 0x46, 0xe1, 0x55, 0xe1, 0x54, 0xe1, 0x73, 0xe3, 0xf2, 0xe1, 0x82, 0xe0, 0xdd, 0xe0, 0xcd,
+    0xe5, 0xde, 0x05, 0xe0, 0x8e, 0x04, 0xe2, 0xfe, 0x05, 0xe0, 0x7e, 0x05, 0xe0, 0x7e, 0x05, 0xe0,
+    0x7e, 0x05, 0xe0, 0x7e, 0x05, 0xe0, 0x7e, 0x05, 0xe0, 0x7e, 0x05, 0xe0, 0x7e, 0x05, 0xe0, 0x7e,
+    0x05, 0xe0, 0x7e, 0x05, 0xe0, 0x7e, 0x05, 0xe2, 0x8e, 0x13, 0x7e, 0x13, 0xe9, 0x60, 0xe1, 0x5a,
+    0xe3, 0x7c, 0xe3, 0x6c, 0xe3, 0x6c, 0xe3, 0x6c, 0xe3, 0x6c, 0xe3, 0x7a, 0xe3, 0xa6, 0xe3, 0xc6,
+    0xe3, 0x9c, 0xe3, 0x1e, 0x08, 0xe2, 0xae, 0x0c, 0xe2, 0x5e, 0x12, 0xe2, 0x0e, 0x15, 0x93, 0xe1,
+    0x2c, 0xe0, 0x0c, 0x74, 0xe0, 0xfa, 0xe0, 0x8a, 0x55, 0xe0, 0xd9, 0xc7, 0x79, 0x46, 0xe0, 0xb8,
+    0xe0, 0x0a, 0x68, 0x28, 0xe0, 0x97, 0xe0, 0x2c, 0x6e, 0x01, 0xe0, 0x97, 0xe0, 0x3e, 0x00, 0x5d,
+    0xe0, 0x97, 0xe0, 0x4e, 0x02, 0x4a, 0xe0, 0xa6, 0xe0, 0x6e, 0x03, 0x57, 0xe0, 0xa6, 0xe0, 0x7e,
+    0x04, 0x56, 0xe0, 0x96, 0xe0, 0x8e, 0x06, 0x46, 0xe0, 0x86, 0xe0, 0x8e, 0x07, 0x36, 0xe0, 0x76,
+    0xe0, 0x9e, 0x07, 0x46, 0xe0, 0x56, 0xe0, 0xae, 0x08, 0x46, 0xe0, 0x45, 0xe0, 0xbe, 0x09, 0x45,
+    0xe0, 0x36, 0xe0, 0xbe, 0x0a, 0x36, 0xe0, 0x25, 0xe0, 0xce, 0x0a, 0x45, 0xe0, 0x16, 0xe0, 0xce,
+    0x0b, 0x36, 0xe0, 0x05, 0xe0, 0xde, 0x0b, 0x45, 0xe0, 0x05, 0xe0, 0xde, 0x0c, 0x35, 0xd5, 0xe0,
+    0xee, 0x0c, 0x45, 0xc5, 0xe0, 0xee, 0x0d, 0x35, 0xc4, 0xe0, 0xfe, 0x0d, 0x35, 0xb5, 0xe1, 0x2e,
+    0x0a, 0x45, 0xa5, 0xe1, 0x4e, 0x09, 0x35, 0xa5, 0xe0, 0xd5, 0x3e, 0x08, 0x35, 0xa5, 0xe0, 0xb8,
+    0x3e, 0x07, 0x35, 0xa4, 0xe0, 0xba, 0xe0, 0x54, 0x44, 0xa4, 0xe0, 0xba, 0xe0, 0x72, 0x44, 0xa4,
+    0xe0, 0xbe, 0x0f, 0x22, 0x44, 0x95, 0xe0, 0xbe, 0x0f, 0x22, 0x45, 0x85, 0xe0, 0xbe, 0x0f, 0x85,
+    0x85, 0xe0, 0xba, 0xe0, 0xd5, 0x94, 0xe0, 0xba, 0xe0, 0xd4, 0xa4, 0xe0, 0xc8, 0xe0, 0xe4, 0xa4,
+    0xe0, 0xd6, 0xe0, 0xf4, 0xa5, 0xe2, 0xe5, 0xa5, 0xe2, 0xe5, 0xa5, 0xe2, 0xe5, 0xa5, 0xe2, 0xe5,
+    0xb5, 0xe2, 0xc5, 0xc5, 0xe2, 0xc5, 0xc5, 0xe2, 0xc5, 0xd5, 0xe2, 0xa5, 0xe0, 0x05, 0xe2, 0xa5,
+    0xe0, 0x06, 0xe2, 0x86, 0xe0, 0x15, 0xe2, 0x85, 0xe0, 0x26, 0xe2, 0x66, 0xe0, 0x35, 0xe2, 0x65,
+    0xe0, 0x46, 0xe2, 0x46, 0xe0, 0x56, 0xe2, 0x26, 0xe0, 0x76, 0xe2, 0x06, 0xe0, 0x87, 0xe1, 0xe7,
+    0xe0, 0x97, 0xe1, 0xd6, 0xe0, 0xb7, 0xe1, 0xa7, 0xe0, 0xd7, 0xe1, 0x87, 0xe0, 0xf7, 0xe1, 0x67,
+    0xe1, 0x18, 0xe1, 0x28, 0xe1, 0x38, 0xe1, 0x08, 0xe1, 0x59, 0xe0, 0xc9, 0xe1, 0x8a, 0xe0, 0x6a,
+    0xe1, 0xbc, 0xe0, 0x0c, 0xe1, 0xee, 0x14, 0xe2, 0x2e, 0x10, 0xe2, 0x6e, 0x0c, 0xe2, 0xbe, 0x06,
+    0xe3, 0x2c, 0xe1, 0x40, 0xe0, 0x36, 0xe1, 0x46, 0xe1, 0x46, 0xe1, 0x54, 0xe1, 0x64, 0xe1, 0x2c,
+    0xe0, 0xce, 0x02, 0x51, 0xe0, 0x25, 0xa5, 0x32, 0xe0, 0x04, 0x65, 0x34, 0x23, 0xc3, 0x87, 0x37,
+    0xb3, 0x99, 0x24, 0xc3, 0xaa, 0x23, 0xb3, 0xbb, 0x23, 0xa2, 0xcc, 0x22, 0x93, 0xcd, 0x13, 0x82,
+    0xdd, 0x22, 0x73, 0xde, 0x00, 0x13, 0x62, 0xe0, 0x0e, 0x00, 0x22, 0x62, 0xe0, 0x2c, 0x22, 0x53,
+    0xd3, 0x2a, 0x23, 0x43, 0xc5, 0xa2, 0x13, 0x43, 0xce, 0x01, 0x11, 0x13, 0x43, 0xce, 0x00, 0x43,
+    0x43, 0xc5, 0xd3, 0x43, 0xe0, 0x01, 0xe0, 0x13, 0x52, 0xe1, 0x02, 0x62, 0xe1, 0x02, 0x63, 0xe0,
+    0xe3, 0x63, 0xe0, 0xe3, 0x72, 0xe0, 0xe2, 0x83, 0xe0, 0xc3, 0x93, 0xe0, 0xa3, 0xb3, 0xe0, 0x84,
+    0xb4, 0xe0, 0x64, 0xd4, 0xe0, 0x44, 0xe0, 0x14, 0xe0, 0x24, 0xe0, 0x35, 0xc5, 0xe0, 0x67, 0x47,
+    0xe0, 0xae, 0x00, 0xe0, 0xf8, 0xe0, 0x20, 0x11, 0xe0, 0xc1, 0xe1, 0x91, 0xe1, 0x91, 0xe1, 0x91,
+    0xe1, 0x91, 0xe1, 0x66, 0xe0, 0xfe, 0x01, 0xe0, 0xa2, 0x42, 0x11, 0x12, 0x32, 0xe0, 0x63, 0x51,
+    0x21, 0x21, 0x51, 0xe0, 0x51, 0x61, 0x31, 0x31, 0x51, 0xe0, 0x31, 0x61, 0x41, 0x41, 0x51, 0xe0,
+    0x13, 0x41, 0x51, 0x51, 0x42, 0xe0, 0x01, 0x21, 0x22, 0x51, 0x55, 0x21, 0xc1, 0x46, 0x31, 0x35,
+    0x51, 0xb1, 0x52, 0x37, 0x41, 0x51, 0xa1, 0x61, 0x71, 0x71, 0x61, 0x91, 0x51, 0x81, 0x72, 0x51,
+    0x91, 0x51, 0x81, 0x81, 0x51, 0x92, 0x41, 0x81, 0x81, 0x42, 0x81, 0x12, 0x31, 0x81, 0x81, 0x33,
+    0x81, 0x34, 0x81, 0x84, 0x21, 0x81, 0x67, 0x21, 0x27, 0x51, 0x82, 0x51, 0x66, 0x51, 0x51, 0x91,
+    0x51, 0x81, 0x81, 0x51, 0x92, 0x41, 0x81, 0x81, 0x51, 0x91, 0x51, 0x81, 0x81, 0x41, 0xa2, 0x51,
+    0x71, 0x72, 0x41, 0xb3, 0x31, 0x71, 0x71, 0x33, 0xc1, 0x14, 0x71, 0x74, 0x11, 0xd1, 0x46, 0x21,
+    0x26, 0x41, 0xe0, 0x01, 0x41, 0x45, 0x51, 0x31, 0xe0, 0x21, 0x31, 0x61, 0x61, 0x22, 0xe0, 0x41,
+    0x21, 0x61, 0x52, 0x12, 0xe0, 0x61, 0x21, 0x51, 0x41, 0x22, 0xe0, 0x84, 0x41, 0x34, 0xe0, 0xdc,
+    0xe1, 0x07, 0xe7, 0x20, 0xe1, 0xa2, 0xe4, 0x02, 0xe4, 0x02, 0xe4, 0x02, 0xe4, 0x02, 0xe4, 0x02,
+    0xe4, 0x02, 0xe4, 0x02, 0xe4, 0x02, 0xe4, 0x02, 0xe3, 0xbc, 0xe3, 0x2e, 0x06, 0xe2, 0xb9, 0x32,
+    0x39, 0xe2, 0x64, 0x23, 0x52, 0x53, 0x24, 0xe2, 0x24, 0x33, 0x62, 0x63, 0x34, 0xe1, 0xf3, 0x43,
+    0x72, 0x73, 0x43, 0xe1, 0xd3, 0x43, 0x82, 0x83, 0x43, 0xe1, 0xa3, 0x62, 0x92, 0x92, 0x63, 0xe1,
+    0x73, 0x62, 0xa2, 0xa2, 0x63, 0xe1, 0x53, 0x62, 0xb2, 0xb2, 0x63, 0xe1, 0x33, 0x72, 0xb2, 0xb2,
+    0x73, 0xe1, 0x13, 0x72, 0xc2, 0xc2, 0x73, 0xe1, 0x02, 0x82, 0xc2, 0xc2, 0x82, 0xe0, 0xf3, 0x72,
+    0xd2, 0xd2, 0x73, 0xe0, 0xd7, 0x42, 0xd2, 0xd2, 0x56, 0xe0, 0xc2, 0x38, 0xd2, 0xd8, 0x32, 0xe0,
+    0xb2, 0x6c, 0x72, 0x7c, 0x62, 0xe0, 0x92, 0xae, 0x14, 0xa2, 0xe0, 0x82, 0xa2, 0xe0, 0x02, 0xe0,
+    0x02, 0xa2, 0xe0, 0x81, 0xb1, 0xe0, 0x12, 0xe0, 0x11, 0xb1, 0xe0, 0x72, 0xa2, 0xe0, 0x12, 0xe0,
+    0x12, 0xa2, 0xe0, 0x62, 0xa2, 0xe0, 0x12, 0xe0, 0x12, 0xa2, 0xe0, 0x61, 0xb2, 0xe0, 0x12, 0xe0,
+    0x12, 0xb1, 0xe0, 0x52, 0xb2, 0xe0, 0x12, 0xe0, 0x12, 0xb2, 0xe0, 0x42, 0xb2, 0xe0, 0x12, 0xe0,
+    0x12, 0xb2, 0xe0, 0x41, 0xc1, 0xe0, 0x22, 0xe0, 0x21, 0xc1, 0xe0, 0x33, 0xb1, 0xe0, 0x22, 0xe0,
+    0x21, 0xb3, 0xe0, 0x24, 0xa1, 0xe0, 0x22, 0xe0, 0x21, 0xa4, 0xe0, 0x25, 0x91, 0xe0, 0x22, 0xe0,
+    0x21, 0x95, 0xe0, 0x22, 0x14, 0x62, 0xe0, 0x22, 0xe0, 0x22, 0x64, 0x12, 0xe0, 0x22, 0x34, 0x42,
+    0xe0, 0x22, 0xe0, 0x22, 0x44, 0x32, 0xe0, 0x22, 0x55, 0x12, 0xe0, 0x22, 0xe0, 0x22, 0x15, 0x52,
+    0xe0, 0x22, 0x78, 0xe0, 0x02, 0xe0, 0x08, 0x72, 0xe0, 0x22, 0xbe, 0x00, 0x42, 0x4e, 0x00, 0xb2,
+    0xe0, 0x22, 0xb2, 0x4e, 0x0c, 0x42, 0xb2, 0xe0, 0x22, 0xc1, 0xe0, 0x22, 0xe0, 0x21, 0xc2, 0xe0,
+    0x22, 0xc1, 0xe0, 0x22, 0xe0, 0x21, 0xc2, 0xe0, 0x31, 0xc1, 0xe0, 0x22, 0xe0, 0x21, 0xc1, 0xe0,
+    0x41, 0xc1, 0xe0, 0x22, 0xe0, 0x21, 0xc1, 0xe0, 0x42, 0xb2, 0xe0, 0x12, 0xe0, 0x12, 0xb2, 0xe0,
+    0x42, 0xb2, 0xe0, 0x12, 0xe0, 0x12, 0xb2, 0xe0, 0x51, 0xb2, 0xe0, 0x12, 0xe0, 0x12, 0xb1, 0xe0,
+    0x62, 0xa2, 0xe0, 0x12, 0xe0, 0x12, 0xa2, 0xe0, 0x62, 0xa2, 0xe0, 0x12, 0xe0, 0x12, 0xa2, 0xe0,
+    0x73, 0x91, 0xe0, 0x12, 0xe0, 0x11, 0x93, 0xe0, 0x85, 0x72, 0xe0, 0x02, 0xe0, 0x02, 0x75, 0xe0,
+    0x97, 0x42, 0xe0, 0x02, 0xe0, 0x02, 0x47, 0xe0, 0xa2, 0x38, 0xe0, 0x02, 0xe0, 0x08, 0x32, 0xe0,
+    0xb2, 0x57, 0xc2, 0xc7, 0x52, 0xe0, 0xc2, 0x9e, 0x03, 0x1e, 0x00, 0x92, 0xe0, 0xd2, 0x82, 0x3e,
+    0x08, 0x32, 0x82, 0xe0, 0xf2, 0x82, 0xc2, 0xc2, 0x82, 0xe1, 0x12, 0x72, 0xc2, 0xc2, 0x72, 0xe1,
+    0x32, 0x72, 0xb2, 0xb2, 0x72, 0xe1, 0x52, 0x62, 0xb2, 0xb2, 0x62, 0xe1, 0x72, 0x62, 0xa2, 0xa2,
+    0x62, 0xe1, 0x92, 0x62, 0x92, 0x92, 0x62, 0xe1, 0xb3, 0x52, 0x82, 0x82, 0x53, 0xe1, 0xd4, 0x33,
+    0x72, 0x73, 0x34, 0xe2, 0x04, 0x32, 0x62, 0x62, 0x34, 0xe2, 0x44, 0x14, 0x42, 0x44, 0x14, 0xe2,
+    0x89, 0x22, 0x29, 0xe2, 0xde, 0x04, 0xe3, 0x58, 0xf0, 0x20, 0x30,
+};
+
+const PackedIcon letter_A = {20, 20, icon_pack_data + 0, 37};
+const PackedIcon seedlabs_logo = {96, 96, icon_pack_data + 37, 566};
+const PackedIcon snowflake = {20, 20, icon_pack_data + 603, 49};
+const PackedIcon fire = {20, 20, icon_pack_data + 652, 37};
+const PackedIcon wind = {20, 20, icon_pack_data + 689, 35};
+const PackedIcon arrow_up_50 = {50, 50, icon_pack_data + 724, 114};
+const PackedIcon arrow_down_50 = {50, 50, icon_pack_data + 838, 114};
+const PackedIcon hvac_80 = {80, 80, icon_pack_data + 952, 595};
+const PackedIcon hvac_40 = {40, 40, icon_pack_data + 1547, 155};
+const PackedIcon shades_40 = {40, 40, icon_pack_data + 1702, 70};
+const PackedIcon shades_80 = {80, 80, icon_pack_data + 1772, 632};
+const PackedIcon lamp_solid = {80, 80, icon_pack_data + 2404, 248};
+const PackedIcon lamp_regular = {80, 80, icon_pack_data + 2652, 286};
+const PackedIcon lamp_regular_40 = {40, 40, icon_pack_data + 2938, 117};
+const PackedIcon spotify_80 = {80, 80, icon_pack_data + 3055, 268};
+const PackedIcon spotify_40 = {40, 40, icon_pack_data + 3323, 96};
+const PackedIcon settings_40 = {40, 40, icon_pack_data + 3419, 122};
+const PackedIcon settings_80 = {80, 80, icon_pack_data + 3541, 509};
+const PackedIcon light_switch_40 = {40, 40, icon_pack_data + 4050, 131};
+const PackedIcon light_switch_80 = {80, 80, icon_pack_data + 4181, 547};
+const PackedIcon light_top_40 = {40, 40, icon_pack_data + 4728, 85};
+const PackedIcon light_top_80 = {80, 80, icon_pack_data + 4813, 387};
+const PackedIcon volume_30_4 = {44, 30, icon_pack_data + 5200, 117};
+const PackedIcon volume_30_3 = {44, 30, icon_pack_data + 5317, 88};
+const PackedIcon volume_30_2 = {44, 30, icon_pack_data + 5405, 80};
+const PackedIcon volume_30_1 = {44, 30, icon_pack_data + 5485, 79};
+const PackedIcon wifi_40 = {40, 40, icon_pack_data + 5564, 114};
+const PackedIcon wifi_conn_80 = {80, 80, icon_pack_data + 5678, 207};
+const PackedIcon omnitrix_char_1 = {75, 174, icon_pack_data + 5885, 625};
+const PackedIcon omnitrix_char_2 = {85, 174, icon_pack_data + 6510, 502};
+const PackedIcon home_assistant_40 = {40, 40, icon_pack_data + 7012, 102};
+const PackedIcon home_assistant_80 = {80, 80, icon_pack_data + 7114, 291};
+const PackedIcon lightning_50 = {50, 50, icon_pack_data + 7405, 109};
+const PackedIcon printer_80 = {80, 80, icon_pack_data + 7514, 155};
+const PackedIcon printer_40 = {40, 40, icon_pack_data + 7669, 73};
+const PackedIcon stopwatch_80 = {80, 80, icon_pack_data + 7742, 342};
+const PackedIcon stopwatch_40 = {40, 40, icon_pack_data + 8084, 131};
+const PackedIcon discoball_40 = {40, 40, icon_pack_data + 8215, 173};
+const PackedIcon discoball_80 = {80, 80, icon_pack_data + 8388, 455};
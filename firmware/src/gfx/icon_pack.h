@@ -0,0 +1,48 @@
+#pragma once
+
+// Generated by firmware/icons/pack_icons.py from firmware/icons/icons.h, do not edit.
+
+#include "packed_icon.h"
+
+const uint32_t ICON_PACK_RAW_BYTES = 19616;
+const uint32_t ICON_PACK_PACKED_BYTES = 8843;
+
+extern const PackedIcon letter_A;
+extern const PackedIcon seedlabs_logo;
+extern const PackedIcon snowflake;
+extern const PackedIcon fire;
+extern const PackedIcon wind;
+extern const PackedIcon arrow_up_50;
+extern const PackedIcon arrow_down_50;
+extern const PackedIcon hvac_80;
+extern const PackedIcon hvac_40;
+extern const PackedIcon shades_40;
+extern const PackedIcon shades_80;
+extern const PackedIcon lamp_solid;
+extern const PackedIcon lamp_regular;
+extern const PackedIcon lamp_regular_40;
+extern const PackedIcon spotify_80;
+extern const PackedIcon spotify_40;
+extern const PackedIcon settings_40;
+extern const PackedIcon settings_80;
+extern const PackedIcon light_switch_40;
+extern const PackedIcon light_switch_80;
+extern const PackedIcon light_top_40;
+extern const PackedIcon light_top_80;
+extern const PackedIcon volume_30_4;
+extern const PackedIcon volume_30_3;
+extern const PackedIcon volume_30_2;
+extern const PackedIcon volume_30_1;
+extern const PackedIcon wifi_40;
+extern const PackedIcon wifi_conn_80;
+extern const PackedIcon omnitrix_char_1;
+extern const PackedIcon omnitrix_char_2;
+extern const PackedIcon home_assistant_40;
+extern const PackedIcon home_assistant_80;
+extern const PackedIcon lightning_50;
+extern const PackedIcon printer_80;
+extern const PackedIcon printer_40;
+extern const PackedIcon stopwatch_80;
+extern const PackedIcon stopwatch_40;
+extern const PackedIcon discoball_40;
+extern const PackedIcon discoball_80;
@@ -0,0 +1,304 @@
+#include "icon_store.h"
+#include "gfx_alloc.h"
+#include "../logging.h"
+
+// Walks the nibble encoded run lengths of a packed icon
+class RunReader
+{
+public:
+    RunReader(const PackedIcon *icon) : data_(icon->data), nibbles_(icon->size * 2){};
+
+    bool next(uint32_t *length)
+    {
+        if (position_ >= nibbles_)
+        {
+            return false;
+        }
+
+        uint8_t code = nibble();
+        if (code < 0xE)
+        {
+            *length = code;
+        }
+        else if (code == 0xE)
+        {
+            *length = 14 + ((nibble() << 4) | nibble());
+        }
+        else
+        {
+            *length = (nibble() << 12) | (nibble() << 8) | (nibble() << 4) | nibble();
+        }
+        return true;
+    }
+
+private:
+    const uint8_t *data_;
+    uint32_t nibbles_;
+    uint32_t position_ = 0;
+
+    uint8_t nibble()
+    {
+        if (position_ >= nibbles_)
+        {
+            return 0;
+        }
+        uint8_t byte = pgm_read_byte(data_ + (position_ >> 1));
+        return (position_++ & 1) ? (byte & 0x0F) : (byte >> 4);
+    }
+};
+
+void IconStore::drawIcon(TFT_eSprite *spr, int32_t x, int32_t y, const PackedIcon *icon, uint16_t fg_color, uint16_t bg_color)
+{
+    if (icon == nullptr)
+    {
+        return;
+    }
+
+    if (spr->getColorDepth() != 16 || spr->getPointer() == nullptr)
+    {
+        drawRuns(spr, x, y, icon, fg_color, bg_color);
+        return;
+    }
+
+    const DecodedIcon *decoded = getDecoded(icon, fg_color, bg_color);
+    if (decoded == nullptr)
+    {
+        // Out of memory, still draw the icon
+        drawRuns(spr, x, y, icon, fg_color, bg_color);
+        return;
+    }
+
+    blit(spr, x, y, decoded);
+}
+
+void IconStore::clear()
+{
+    for (auto &decoded : decoded_)
+    {
+        free(decoded.pixels);
+    }
+    decoded_.clear();
+    stats_.bytes_used = 0;
+}
+
+IconStoreStats IconStore::getStats()
+{
+    stats_.icons = decoded_.size();
+    return stats_;
+}
+
+void IconStore::benchmark(TFT_eSprite *spr, const PackedIcon *icon, uint16_t iterations)
+{
+    LOGI("Icon pack: %d bytes raw, %d bytes packed (%d%% saved)",
+         ICON_PACK_RAW_BYTES,
+         ICON_PACK_PACKED_BYTES,
+         100 - ICON_PACK_PACKED_BYTES * 100 / ICON_PACK_RAW_BYTES);
+
+    uint16_t *pixels = (uint16_t *)gfxAlloc(iconBytes(icon));
+    if (pixels == nullptr)
+    {
+        LOGE("Failed to allocate icon benchmark buffer");
+        return;
+    }
+
+    unsigned long started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        decode(icon, TFT_WHITE, TFT_BLACK, pixels);
+    }
+    unsigned long decode_us = micros() - started_at;
+    free(pixels);
+
+    // Uncached path, one drawFastHLine per run
+    started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        drawRuns(spr, 0, 0, icon, TFT_WHITE, TFT_BLACK);
+    }
+    unsigned long runs_us = micros() - started_at;
+
+    drawIcon(spr, 0, 0, icon, TFT_WHITE, TFT_BLACK);
+
+    started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        drawIcon(spr, 0, 0, icon, TFT_WHITE, TFT_BLACK);
+    }
+    unsigned long cached_us = micros() - started_at;
+
+    LOGI("Icon %dx%d x%d: decode %.1fus, uncached draw %.1fus, cached draw %.1fus",
+         icon->width,
+         icon->height,
+         iterations,
+         (float)decode_us / iterations,
+         (float)runs_us / iterations,
+         (float)cached_us / iterations);
+}
+
+const IconStore::DecodedIcon *IconStore::getDecoded(const PackedIcon *icon, uint16_t fg_color, uint16_t bg_color)
+{
+    for (auto it = decoded_.begin(); it != decoded_.end(); it++)
+    {
+        if (it->icon == icon && it->fg_color == fg_color && it->bg_color == bg_color)
+        {
+            stats_.hits++;
+            decoded_.splice(decoded_.begin(), decoded_, it);
+            return &decoded_.front();
+        }
+    }
+
+    stats_.misses++;
+
+    uint32_t size = iconBytes(icon);
+    while (!decoded_.empty() && stats_.bytes_used + size > ICON_STORE_MAX_BYTES)
+    {
+        stats_.bytes_used -= iconBytes(decoded_.back().icon);
+        free(decoded_.back().pixels);
+        decoded_.pop_back();
+        stats_.evictions++;
+    }
+
+    uint16_t *pixels = (uint16_t *)gfxAlloc(size);
+    if (pixels == nullptr)
+    {
+        LOGE("Failed to allocate %dx%d icon", icon->width, icon->height);
+        return nullptr;
+    }
+
+    unsigned long started_at = micros();
+    if (!decode(icon, fg_color, bg_color, pixels))
+    {
+        LOGW("Corrupt packed icon %dx%d", icon->width, icon->height);
+    }
+    stats_.decode_us += micros() - started_at;
+
+    decoded_.push_front(DecodedIcon{icon, fg_color, bg_color, pixels});
+    stats_.bytes_used += size;
+
+    return &decoded_.front();
+}
+
+bool IconStore::decode(const PackedIcon *icon, uint16_t fg_color, uint16_t bg_color, uint16_t *pixels)
+{
+    // 16-bit sprites keep pixels byte swapped
+    uint16_t colors[2] = {(uint16_t)((bg_color >> 8) | (bg_color << 8)), (uint16_t)((fg_color >> 8) | (fg_color << 8))};
+
+    uint32_t remaining = icon->width * icon->height;
+    uint8_t current = 0;
+    uint32_t length;
+
+    RunReader reader(icon);
+    while (remaining > 0 && reader.next(&length))
+    {
+        if (length > remaining)
+        {
+            length = remaining;
+        }
+        remaining -= length;
+
+        uint16_t color = colors[current];
+        while (length--)
+        {
+            *pixels++ = color;
+        }
+        current ^= 1;
+    }
+
+    if (remaining == 0)
+    {
+        return true;
+    }
+
+    // Keep the buffer defined even if the stream ended early
+    while (remaining--)
+    {
+        *pixels++ = colors[0];
+    }
+    return false;
+}
+
+void IconStore::drawRuns(TFT_eSprite *spr, int32_t x, int32_t y, const PackedIcon *icon, uint16_t fg_color, uint16_t bg_color)
+{
+    uint16_t colors[2] = {bg_color, fg_color};
+
+    uint32_t column = 0;
+    uint32_t row = 0;
+    uint8_t current = 0;
+    uint32_t length;
+
+    RunReader reader(icon);
+    while (row < icon->height && reader.next(&length))
+    {
+        // Runs can wrap across rows
+        while (length > 0 && row < icon->height)
+        {
+            uint32_t segment = min(length, (uint32_t)(icon->width - column));
+            if (segment > 0)
+            {
+                spr->drawFastHLine(x + column, y + row, segment, colors[current]);
+            }
+            length -= segment;
+            column += segment;
+            if (column >= icon->width)
+            {
+                column = 0;
+                row++;
+            }
+        }
+        current ^= 1;
+    }
+}
+
+void IconStore::blit(TFT_eSprite *spr, int32_t x, int32_t y, const DecodedIcon *decoded)
+{
+    uint16_t *framebuffer = (uint16_t *)spr->getPointer();
+    int32_t width = spr->width();
+    int32_t height = spr->height();
+
+    int32_t icon_width = decoded->icon->width;
+    int32_t icon_height = decoded->icon->height;
+
+    // Clip to the sprite
+    int32_t src_x = 0;
+    int32_t src_y = 0;
+    int32_t copy_width = icon_width;
+    int32_t copy_height = icon_height;
+    if (x < 0)
+    {
+        src_x = -x;
+        copy_width += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        src_y = -y;
+        copy_height += y;
+        y = 0;
+    }
+    if (x + copy_width > width)
+    {
+        copy_width = width - x;
+    }
+    if (y + copy_height > height)
+    {
+        copy_height = height - y;
+    }
+    if (copy_width <= 0 || copy_height <= 0)
+    {
+        return;
+    }
+
+    const uint16_t *src = decoded->pixels + src_y * icon_width + src_x;
+    uint16_t *dst = framebuffer + y * width + x;
+    for (int32_t row = 0; row < copy_height; row++)
+    {
+        memcpy(dst, src, copy_width * sizeof(uint16_t));
+        src += icon_width;
+        dst += width;
+    }
+}
+
+uint32_t IconStore::iconBytes(const PackedIcon *icon)
+{
+    return icon->width * icon->height * sizeof(uint16_t);
+}
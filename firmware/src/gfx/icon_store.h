@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include <list>
+
+#include "icon_pack.h"
+
+// Decoded icons are kept as ready-to-blit 16-bit images. A menu screen needs one
+// 80px and two 40px icons (~26KB), the budget leaves room for a few screens.
+const uint32_t ICON_STORE_MAX_BYTES = 96 * 1024;
+
+struct IconStoreStats
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t bytes_used;
+    uint16_t icons;
+    uint32_t decode_us; // total time spent decoding misses
+};
+
+// Draws packed icons. Replaces TFT_eSprite::drawBitmap(x, y, bitmap, w, h, fg, bg),
+// which writes every pixel through drawPixel. An icon is decoded once per colour
+// pair into a byte-swapped RGB565 image held in PSRAM and then copied row by row
+// into the sprite framebuffer.
+//
+// Only the display task renders, so the store is not guarded by a mutex.
+class IconStore
+{
+public:
+    static IconStore &getInstance()
+    {
+        static IconStore instance;
+        return instance;
+    }
+
+    void drawIcon(TFT_eSprite *spr, int32_t x, int32_t y, const PackedIcon *icon, uint16_t fg_color, uint16_t bg_color);
+
+    void clear();
+    IconStoreStats getStats();
+
+    // Logs flash used by the pack and times a cold decode against a cached draw.
+    void benchmark(TFT_eSprite *spr, const PackedIcon *icon, uint16_t iterations);
+
+private:
+    IconStore(){};
+    ~IconStore() { clear(); };
+
+    struct DecodedIcon
+    {
+        const PackedIcon *icon;
+        uint16_t fg_color;
+        uint16_t bg_color;
+        uint16_t *pixels;
+    };
+
+    // Most recently used first. Only a handful of icons fit the budget, a list is enough.
+    std::list<DecodedIcon> decoded_;
+
+    IconStoreStats stats_ = {};
+
+    const DecodedIcon *getDecoded(const PackedIcon *icon, uint16_t fg_color, uint16_t bg_color);
+    bool decode(const PackedIcon *icon, uint16_t fg_color, uint16_t bg_color, uint16_t *pixels);
+    void drawRuns(TFT_eSprite *spr, int32_t x, int32_t y, const PackedIcon *icon, uint16_t fg_color, uint16_t bg_color);
+    void blit(TFT_eSprite *spr, int32_t x, int32_t y, const DecodedIcon *decoded);
+
+    static uint32_t iconBytes(const PackedIcon *icon);
+};
@@ -0,0 +1,260 @@
+#include "indexed_layer.h"
+
+IndexedLayer::IndexedLayer(TFT_eSPI *tft, uint8_t bits_per_pixel) : spr_(tft), bits_per_pixel_(bits_per_pixel == 8 ? 8 : 4)
+{
+}
+
+IndexedLayer::~IndexedLayer()
+{
+    deleteLayer();
+}
+
+bool IndexedLayer::create(int16_t width, int16_t height)
+{
+    if (bits_per_pixel_ == 4)
+    {
+        // Keeps every row starting on a byte boundary
+        width = (width + 1) & ~1;
+    }
+
+    if (spr_.created())
+    {
+        if (spr_.width() == width && spr_.height() == height)
+        {
+            spr_.fillSprite(ink(0));
+            runs_valid_ = false;
+            return true;
+        }
+        spr_.deleteSprite();
+    }
+
+    spr_.setColorDepth(bits_per_pixel_);
+    if (spr_.createSprite(width, height) == nullptr)
+    {
+        return false;
+    }
+    spr_.fillSprite(ink(0));
+    runs_valid_ = false;
+    return true;
+}
+
+void IndexedLayer::deleteLayer()
+{
+    if (spr_.created())
+    {
+        spr_.deleteSprite();
+    }
+    runs_.clear();
+    runs_.shrink_to_fit();
+    runs_valid_ = false;
+}
+
+bool IndexedLayer::created()
+{
+    return spr_.created();
+}
+
+int16_t IndexedLayer::width()
+{
+    return spr_.width();
+}
+
+int16_t IndexedLayer::height()
+{
+    return spr_.height();
+}
+
+uint32_t IndexedLayer::sizeBytes()
+{
+    return (uint32_t)spr_.width() * spr_.height() * bits_per_pixel_ / 8;
+}
+
+void IndexedLayer::setTransparentIndex(int16_t index)
+{
+    transparent_index_ = index;
+    runs_valid_ = false;
+}
+
+void IndexedLayer::setPaletteColor(uint8_t index, uint16_t color)
+{
+    palette_[index] = (color >> 8) | (color << 8);
+}
+
+uint16_t IndexedLayer::ink(uint8_t index)
+{
+    if (bits_per_pixel_ == 4)
+    {
+        // 4-bpp sprites store the low nibble of the colour as is
+        return index & 0x0F;
+    }
+
+    // 8-bpp sprites store colours as RGB332, pick the RGB565 value that packs to index
+    return ((index & 0xE0) << 8) | ((index & 0x1C) << 6) | ((index & 0x03) << 3);
+}
+
+TFT_eSprite *IndexedLayer::sprite()
+{
+    runs_valid_ = false;
+    return &spr_;
+}
+
+void IndexedLayer::compose(TFT_eSprite *dst, int32_t x, int32_t y)
+{
+    if (!spr_.created())
+    {
+        return;
+    }
+
+    uint16_t *framebuffer = (uint16_t *)dst->getPointer();
+    const uint8_t *pixels = (const uint8_t *)spr_.getPointer();
+    if (dst->getColorDepth() != 16 || framebuffer == nullptr || pixels == nullptr)
+    {
+        return;
+    }
+
+    int32_t dst_width = dst->width();
+    int32_t dst_height = dst->height();
+
+    if (transparent_index_ != INDEXED_LAYER_OPAQUE)
+    {
+        if (!runs_valid_)
+        {
+            buildRuns();
+        }
+        composeRuns(framebuffer, dst_width, dst_height, x, y);
+        return;
+    }
+
+    int32_t layer_width = spr_.width();
+    int32_t layer_height = spr_.height();
+    int32_t stride = layer_width * bits_per_pixel_ / 8;
+
+    // Clip to the destination
+    int32_t src_x = 0;
+    int32_t src_y = 0;
+    int32_t copy_width = layer_width;
+    int32_t copy_height = layer_height;
+    if (x < 0)
+    {
+        src_x = -x;
+        copy_width += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        src_y = -y;
+        copy_height += y;
+        y = 0;
+    }
+    if (x + copy_width > dst_width)
+    {
+        copy_width = dst_width - x;
+    }
+    if (y + copy_height > dst_height)
+    {
+        copy_height = dst_height - y;
+    }
+    if (copy_width <= 0 || copy_height <= 0)
+    {
+        return;
+    }
+
+    for (int32_t row = 0; row < copy_height; row++)
+    {
+        composeRow(framebuffer + (y + row) * dst_width + x, pixels + (src_y + row) * stride, src_x, copy_width);
+    }
+}
+
+uint8_t IndexedLayer::pixelIndex(const uint8_t *row, int32_t x)
+{
+    if (bits_per_pixel_ == 8)
+    {
+        return row[x];
+    }
+    // 4-bpp, even pixels are in the high nibble
+    uint8_t byte = row[x >> 1];
+    return (x & 1) ? (byte & 0x0F) : (byte >> 4);
+}
+
+void IndexedLayer::buildRuns()
+{
+    runs_.clear();
+
+    const uint8_t *pixels = (const uint8_t *)spr_.getPointer();
+    int32_t layer_width = spr_.width();
+    int32_t layer_height = spr_.height();
+    int32_t stride = layer_width * bits_per_pixel_ / 8;
+
+    for (int32_t row = 0; row < layer_height; row++)
+    {
+        const uint8_t *src = pixels + row * stride;
+        int32_t run_start = -1;
+        for (int32_t x = 0; x <= layer_width; x++)
+        {
+            bool visible = x < layer_width && pixelIndex(src, x) != transparent_index_;
+            if (visible && run_start < 0)
+            {
+                run_start = x;
+            }
+            else if (!visible && run_start >= 0)
+            {
+                runs_.push_back(Run{(uint16_t)row, (uint16_t)run_start, (uint16_t)(x - run_start)});
+                run_start = -1;
+            }
+        }
+    }
+    runs_valid_ = true;
+}
+
+void IndexedLayer::composeRuns(uint16_t *framebuffer, int32_t dst_width, int32_t dst_height, int32_t x, int32_t y)
+{
+    const uint8_t *pixels = (const uint8_t *)spr_.getPointer();
+    int32_t stride = spr_.width() * bits_per_pixel_ / 8;
+
+    for (const Run &run : runs_)
+    {
+        int32_t py = y + run.row;
+        if (py < 0 || py >= dst_height)
+        {
+            continue;
+        }
+
+        int32_t src_x = run.x;
+        int32_t px = x + run.x;
+        int32_t len = run.len;
+        if (px < 0)
+        {
+            src_x -= px;
+            len += px;
+            px = 0;
+        }
+        if (px + len > dst_width)
+        {
+            len = dst_width - px;
+        }
+        if (len <= 0)
+        {
+            continue;
+        }
+
+        composeRow(framebuffer + py * dst_width + px, pixels + run.row * stride, src_x, len);
+    }
+}
+
+void IndexedLayer::composeRow(uint16_t *dst, const uint8_t *src, int32_t src_x, int32_t count)
+{
+    if (bits_per_pixel_ == 8)
+    {
+        src += src_x;
+        while (count--)
+        {
+            *dst++ = palette_[*src++];
+        }
+        return;
+    }
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        *dst++ = palette_[pixelIndex(src, src_x + i)];
+    }
+}
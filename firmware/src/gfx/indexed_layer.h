@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include <vector>
+
+const int16_t INDEXED_LAYER_OPAQUE = -1;
+
+// Palette-indexed layer for static UI chrome (dial ticks, icon rows, backgrounds).
+// Pixels are stored as 4-bpp (16 colours) or 8-bpp (256 colours) palette indices
+// and expanded to RGB565 only when the layer is composed into the 16-bit frame
+// sprite, so a layer takes 1/4 or 1/2 of the RAM of a 16-bit sprite.
+//
+// Drawing goes through the TFT_eSPI primitives of sprite(), passing ink(index)
+// as the colour. A layer is redrawn only when what it shows changes and composed
+// every frame. Layers with a transparent index are indexed into runs of visible
+// pixels on the first compose after drawing, so sparse chrome (a ring of ticks)
+// costs only its visible pixels per frame.
+class IndexedLayer
+{
+public:
+    IndexedLayer(TFT_eSPI *tft, uint8_t bits_per_pixel = 4);
+    ~IndexedLayer();
+
+    IndexedLayer(IndexedLayer const &) = delete;
+    IndexedLayer &operator=(IndexedLayer const &) = delete;
+
+    // Width is rounded up to even for 4-bpp layers. Contents start at index 0.
+    bool create(int16_t width, int16_t height);
+    void deleteLayer();
+    bool created();
+
+    int16_t width();
+    int16_t height();
+    uint32_t sizeBytes();
+
+    // Index pixels are skipped when composing, or INDEXED_LAYER_OPAQUE
+    void setTransparentIndex(int16_t index);
+    void setPaletteColor(uint8_t index, uint16_t color);
+
+    // Colour value that makes the sprite primitives store this palette index
+    uint16_t ink(uint8_t index);
+
+    // For drawing, invalidates the visible runs
+    TFT_eSprite *sprite();
+
+    // Expands the layer through the palette into a 16-bit sprite at x, y
+    void compose(TFT_eSprite *dst, int32_t x, int32_t y);
+
+private:
+    TFT_eSprite spr_;
+    uint8_t bits_per_pixel_;
+    int16_t transparent_index_ = INDEXED_LAYER_OPAQUE;
+
+    // Byte swapped, the way 16-bit sprites store pixels
+    uint16_t palette_[256] = {};
+
+    struct Run
+    {
+        uint16_t row;
+        uint16_t x;
+        uint16_t len;
+    };
+    std::vector<Run> runs_;
+    bool runs_valid_ = false;
+
+    uint8_t pixelIndex(const uint8_t *row, int32_t x);
+    void buildRuns();
+    void composeRuns(uint16_t *framebuffer, int32_t dst_width, int32_t dst_height, int32_t x, int32_t y);
+    void composeRow(uint16_t *dst, const uint8_t *src, int32_t src_x, int32_t count);
+};
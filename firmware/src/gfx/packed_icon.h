@@ -0,0 +1,13 @@
+#pragma once
+
+#include <Arduino.h>
+
+// 1-bpp icon packed by firmware/icons/pack_icons.py. data points at a nibble
+// encoded run-length stream, see the packer for the format.
+struct PackedIcon
+{
+    uint16_t width;
+    uint16_t height;
+    const uint8_t *data;
+    uint16_t size;
+};
@@ -0,0 +1,23 @@
+#include "qrcode_sprite.h"
+#include "qrcode.h"
+
+void drawQRCode(TFT_eSprite *spr, const char *qr_data)
+{
+    QRCode qrcode;
+
+    uint8_t qrcodeData[qrcode_getBufferSize(QRCODE_SPRITE_VERSION)];
+    qrcode_initText(&qrcode, qrcodeData, QRCODE_SPRITE_VERSION, 0, qr_data);
+
+    spr->fillSprite(TFT_BLACK);
+
+    for (uint8_t y = 0; y < qrcode.size; y++)
+    {
+        for (uint8_t x = 0; x < qrcode.size; x++)
+        {
+            if (qrcode_getModule(&qrcode, x, y))
+            {
+                spr->fillRect(x * QRCODE_SPRITE_MODULE_SIZE, y * QRCODE_SPRITE_MODULE_SIZE, QRCODE_SPRITE_MODULE_SIZE, QRCODE_SPRITE_MODULE_SIZE, TFT_WHITE);
+            }
+        }
+    }
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <TFT_eSPI.h>
+
+const uint8_t QRCODE_SPRITE_VERSION = 6;
+const uint8_t QRCODE_SPRITE_MODULE_SIZE = 2;
+// A version N QR code is 4 * N + 17 modules wide
+const int16_t QRCODE_SPRITE_SIZE = (4 * QRCODE_SPRITE_VERSION + 17) * QRCODE_SPRITE_MODULE_SIZE;
+
+// Draws qr_data as white modules on black into a QRCODE_SPRITE_SIZE square sprite
+void drawQRCode(TFT_eSprite *spr, const char *qr_data);
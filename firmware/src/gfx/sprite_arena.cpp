@@ -0,0 +1,139 @@
+#include "sprite_arena.h"
+#include "../logging.h"
+#include "../semaphore_guard.h"
+
+SpriteLease::SpriteLease() : token_(SpriteArena::getInstance().newToken())
+{
+}
+
+SpriteLease::~SpriteLease()
+{
+    SpriteArena::getInstance().release(*this);
+}
+
+SpriteArena::SpriteArena()
+{
+    mutex_ = xSemaphoreCreateMutex();
+    assert(mutex_ != NULL);
+}
+
+void SpriteArena::begin(TFT_eSPI *tft)
+{
+    SemaphoreGuard lock(mutex_);
+    tft_ = tft;
+}
+
+TFT_eSprite *SpriteArena::acquire(SpriteLayer layer_id, const SpriteLease &lease, int16_t width, int16_t height, bool *contents_valid, uint8_t color_depth)
+{
+    SemaphoreGuard lock(mutex_);
+    *contents_valid = false;
+    uint32_t owner = lease.token();
+
+    if (layer_id >= SPRITE_LAYER_COUNT)
+    {
+        return nullptr;
+    }
+
+    if (tft_ == nullptr)
+    {
+        LOGE("Sprite arena used before begin()");
+        return nullptr;
+    }
+
+    Layer &layer = layers_[layer_id];
+
+    bool fits = layer.sprite != nullptr && layer.sprite->created() && layer.sprite->width() == width && layer.sprite->height() == height && layer.sprite->getColorDepth() == color_depth;
+    if (fits)
+    {
+        if (layer.owner == owner)
+        {
+            *contents_valid = true;
+            return layer.sprite;
+        }
+
+        if (layer.owner != 0)
+        {
+            stats_.handovers++;
+        }
+        stats_.reuses++;
+        layer.owner = owner;
+        return layer.sprite;
+    }
+
+    if (layer.owner != 0 && layer.owner != owner)
+    {
+        stats_.handovers++;
+    }
+    freeLayer(layer);
+
+    if (layer.sprite == nullptr)
+    {
+        layer.sprite = new TFT_eSprite(tft_);
+    }
+    layer.sprite->setColorDepth(color_depth);
+    if (layer.sprite->createSprite(width, height) == nullptr)
+    {
+        LOGE("Failed to allocate %dx%d sprite for layer %d", width, height, layer_id);
+        layer.owner = 0;
+        return nullptr;
+    }
+
+    layer.owner = owner;
+    layer.size_bytes = (uint32_t)width * height * color_depth / 8;
+
+    stats_.allocations++;
+    stats_.bytes_allocated += layer.size_bytes;
+    stats_.peak_bytes = max(stats_.peak_bytes, stats_.bytes_allocated);
+
+    LOGD("Sprite arena: layer %d %dx%d, %d bytes in use", layer_id, width, height, stats_.bytes_allocated);
+
+    return layer.sprite;
+}
+
+void SpriteArena::release(const SpriteLease &lease)
+{
+    SemaphoreGuard lock(mutex_);
+    for (auto &layer : layers_)
+    {
+        if (layer.owner == lease.token())
+        {
+            layer.owner = 0;
+        }
+    }
+}
+
+void SpriteArena::trim()
+{
+    SemaphoreGuard lock(mutex_);
+    for (auto &layer : layers_)
+    {
+        if (layer.owner == 0)
+        {
+            freeLayer(layer);
+        }
+    }
+}
+
+SpriteArenaStats SpriteArena::getStats()
+{
+    SemaphoreGuard lock(mutex_);
+    return stats_;
+}
+
+uint32_t SpriteArena::newToken()
+{
+    SemaphoreGuard lock(mutex_);
+    // 0 marks a free layer
+    return ++last_token_;
+}
+
+void SpriteArena::freeLayer(Layer &layer)
+{
+    if (layer.sprite != nullptr && layer.sprite->created())
+    {
+        layer.sprite->deleteSprite();
+        stats_.bytes_allocated -= layer.size_bytes;
+    }
+    layer.size_bytes = 0;
+    layer.owner = 0;
+}
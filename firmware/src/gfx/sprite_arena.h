@@ -0,0 +1,92 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Off-screen layers shared by apps and flows. Each layer has one backing sprite
+// that is handed to whoever acquires it last, so memory stays flat no matter how
+// many apps are loaded.
+enum SpriteLayer : uint8_t
+{
+    SPRITE_LAYER_BACKGROUND = 0, // full screen, belongs to the active app
+    SPRITE_LAYER_QRCODE,         // QR codes of the onboarding and error flows
+    SPRITE_LAYER_COUNT,
+};
+
+struct SpriteArenaStats
+{
+    uint32_t bytes_allocated;
+    uint32_t peak_bytes;
+    uint32_t allocations;
+    uint32_t reuses;
+    uint32_t handovers; // layer taken over by another owner, its contents were lost
+};
+
+// Identifies the holder of arena layers. Tokens come from a counter and are
+// never reused, unlike the address of an app that was freed, and whatever the
+// holder leased is released when it is destroyed.
+class SpriteLease
+{
+public:
+    SpriteLease();
+    ~SpriteLease();
+
+    SpriteLease(SpriteLease const &) = delete;
+    SpriteLease &operator=(SpriteLease const &) = delete;
+
+    uint32_t token() const { return token_; }
+
+private:
+    uint32_t token_;
+};
+
+// Layers are leased: acquire() returns the layer's sprite and tells the caller
+// whether the contents it drew last time are still there. When another owner
+// acquired the layer in between (or the size changed) the caller must redraw.
+//
+// Sprite memory comes from TFT_eSPI, which places sprites in PSRAM when present.
+class SpriteArena
+{
+public:
+    static SpriteArena &getInstance()
+    {
+        static SpriteArena instance;
+        return instance;
+    }
+
+    // Parent display for the layer sprites, call before the first acquire()
+    void begin(TFT_eSPI *tft);
+
+    TFT_eSprite *acquire(SpriteLayer layer, const SpriteLease &lease, int16_t width, int16_t height, bool *contents_valid, uint8_t color_depth = 16);
+
+    // Drops every layer held by lease. Memory stays allocated for the next owner.
+    void release(const SpriteLease &lease);
+
+    // Frees layers nobody holds
+    void trim();
+
+    SpriteArenaStats getStats();
+
+private:
+    friend class SpriteLease;
+
+    SpriteArena();
+
+    struct Layer
+    {
+        TFT_eSprite *sprite;
+        // SpriteLease token of the holder, 0 while nobody holds the layer
+        uint32_t owner;
+        uint32_t size_bytes;
+    };
+
+    SemaphoreHandle_t mutex_;
+    TFT_eSPI *tft_ = nullptr;
+    uint32_t last_token_ = 0;
+    Layer layers_[SPRITE_LAYER_COUNT] = {};
+
+    SpriteArenaStats stats_ = {};
+
+    uint32_t newToken();
+    void freeLayer(Layer &layer);
+};
@@ -9,3 +9,4 @@ typedef std::function<void(void)> MotorCalibrationCallback;
 typedef std::function<void(float)> StrainCalibrationCallback;
 typedef std::function<void(float)> FactoryStrainCalibrationCallback;
 typedef std::function<void(void)> WeightMeasurementCallback;
+typedef std::function<void(PB_LedEffectProgram &)> LedEffectProgramCallback;
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <atomic>
+
+// Failed read attempts before a reader gives the writer a chance to finish
+const uint8_t LATEST_VALUE_SPIN_RETRIES = 4;
+const uint8_t LATEST_VALUE_YIELD_RETRIES = 8;
+
+// Newest value of something with the time it was captured, single writer.
+//
+// Readers only care about the newest value, so instead of a queue per
+// consumer there is a single slot guarded by a sequence counter (seqlock).
+// The sequence is odd while a publish is in progress and readers retry if it
+// changed during their copy. Publishing never blocks or takes a mutex, so a
+// slow reader only ever skips values and never stalls the writer.
+template <typename T>
+class LatestValue
+{
+public:
+    void publish(const T &value, uint32_t captured_us)
+    {
+        uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        value_ = value;
+        captured_us_ = captured_us;
+
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    // False if nothing was published yet. sequence changes with every publish.
+    bool read(T *value, uint32_t *captured_us = nullptr, uint32_t *sequence = nullptr)
+    {
+        uint32_t before, after;
+        uint32_t captured;
+        uint8_t retries = 0;
+        do
+        {
+            if (retries > LATEST_VALUE_YIELD_RETRIES)
+            {
+                // taskYIELD() only hands over to tasks of the same priority, a lower priority writer preempted
+                // mid publish needs the reader to block
+                vTaskDelay(1);
+            }
+            else if (retries > LATEST_VALUE_SPIN_RETRIES)
+            {
+                taskYIELD();
+            }
+            retries++;
+
+            before = sequence_.load(std::memory_order_acquire);
+            if (before & 1)
+            {
+                // The writer is mid copy, which only takes a few hundred cycles unless it was preempted
+                continue;
+            }
+            *value = value_;
+            captured = captured_us_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence_.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+
+        if (captured_us != nullptr)
+        {
+            *captured_us = captured;
+        }
+        if (sequence != nullptr)
+        {
+            *sequence = before / 2;
+        }
+        return before != 0;
+    }
+
+private:
+    std::atomic<uint32_t> sequence_{0};
+    T value_ = {};
+    uint32_t captured_us_ = 0;
+};
@@ -0,0 +1,188 @@
+#if SK_LEDS
+
+#include "led_compositor.h"
+#include "../logging.h"
+
+LedCompositor::LedCompositor(uint16_t num_leds, float gamma) : num_leds_(num_leds)
+{
+    for (uint8_t i = 0; i < LED_LAYER_COUNT; i++)
+    {
+        layers_[i].pixels.assign(num_leds, CRGB(0, 0, 0));
+        layers_[i].alpha.assign(num_leds, 0);
+        layers_[i].opacity = 255;
+        layers_[i].mode = LED_BLEND_NORMAL;
+        layers_[i].enabled = false;
+    }
+
+    // Base is what the effects draw, it always covers the whole ring
+    layers_[LED_LAYER_BASE].alpha.assign(num_leds, 255);
+    layers_[LED_LAYER_BASE].enabled = true;
+
+    scratch_.assign(num_leds, CRGB(0, 0, 0));
+
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        gamma_[i] = (uint8_t)(powf(i / 255.0f, gamma) * 255.0f + 0.5f);
+    }
+}
+
+void LedCompositor::setOpacity(LedLayerId layer, uint8_t opacity)
+{
+    if (layers_[layer].opacity != opacity)
+    {
+        layers_[layer].opacity = opacity;
+        dirty_ = true;
+    }
+}
+
+void LedCompositor::setBlendMode(LedLayerId layer, LedBlendMode mode)
+{
+    if (layers_[layer].mode != mode)
+    {
+        layers_[layer].mode = mode;
+        dirty_ = true;
+    }
+}
+
+void LedCompositor::setEnabled(LedLayerId layer, bool enabled)
+{
+    if (layer == LED_LAYER_BASE)
+    {
+        return;
+    }
+    if (layers_[layer].enabled != enabled)
+    {
+        layers_[layer].enabled = enabled;
+        dirty_ = true;
+    }
+}
+
+void LedCompositor::clear(LedLayerId layer)
+{
+    LedLayer &l = layers_[layer];
+    memset(l.pixels.data(), 0, num_leds_ * sizeof(CRGB));
+    if (layer != LED_LAYER_BASE)
+    {
+        memset(l.alpha.data(), 0, num_leds_);
+    }
+    dirty_ = true;
+}
+
+uint8_t LedCompositor::blendChannel(uint8_t dst, uint8_t src, LedBlendMode mode)
+{
+    switch (mode)
+    {
+    case LED_BLEND_ADD:
+        return qadd8(dst, src);
+    case LED_BLEND_MULTIPLY:
+        return (dst * (src + 1)) >> 8;
+    case LED_BLEND_SCREEN:
+        return 255 - (((255 - dst) * (256 - src)) >> 8);
+    case LED_BLEND_LIGHTEN:
+        return dst > src ? dst : src;
+    case LED_BLEND_NORMAL:
+    default:
+        return src;
+    }
+}
+
+void LedCompositor::blendLayer(CRGB *acc, const LedLayer &layer)
+{
+    const CRGB *src = layer.pixels.data();
+    const uint8_t *alpha = layer.alpha.data();
+    for (uint16_t i = 0; i < num_leds_; i++)
+    {
+        if (alpha[i] == 0)
+        {
+            continue;
+        }
+
+        // Coverage times opacity, then 0..255 widened to a 0..256 weight so 255 is exact
+        uint8_t a = (alpha[i] * (layer.opacity + 1)) >> 8;
+        uint16_t w = a + (a >> 7);
+
+        for (uint8_t c = 0; c < 3; c++)
+        {
+            uint8_t dst = acc[i].raw[c];
+            uint8_t blended = blendChannel(dst, src[i].raw[c], layer.mode);
+            acc[i].raw[c] = (dst * (256 - w) + blended * w) >> 8;
+        }
+    }
+}
+
+void LedCompositor::compose(CRGB *out)
+{
+    CRGB *acc = scratch_.data();
+
+    // The base blends against black like the layers above it. Opaque and normal,
+    // which is how the LED task runs it, that is a plain copy.
+    const LedLayer &base = layers_[LED_LAYER_BASE];
+    if (base.opacity == 255 && base.mode == LED_BLEND_NORMAL)
+    {
+        memcpy(acc, base.pixels.data(), num_leds_ * sizeof(CRGB));
+    }
+    else
+    {
+        memset(acc, 0, num_leds_ * sizeof(CRGB));
+        blendLayer(acc, base);
+    }
+
+    for (uint8_t l = LED_LAYER_BASE + 1; l < LED_LAYER_COUNT; l++)
+    {
+        const LedLayer &layer = layers_[l];
+        if (!layer.enabled || layer.opacity == 0)
+        {
+            continue;
+        }
+        blendLayer(acc, layer);
+    }
+
+    for (uint16_t i = 0; i < num_leds_; i++)
+    {
+        out[i].r = gamma_[acc[i].r];
+        out[i].g = gamma_[acc[i].g];
+        out[i].b = gamma_[acc[i].b];
+    }
+
+    dirty_ = false;
+}
+
+void LedCompositor::benchmark(uint16_t iterations)
+{
+    const uint16_t sizes[] = {24, 64, 128, 256};
+
+    for (uint16_t num_leds : sizes)
+    {
+        LedCompositor compositor(num_leds);
+        std::vector<CRGB> out(num_leds);
+
+        // Worst case, every layer enabled and partially covering every pixel
+        for (uint8_t l = 0; l < LED_LAYER_COUNT; l++)
+        {
+            LedLayerId id = (LedLayerId)l;
+            compositor.setEnabled(id, true);
+            compositor.setOpacity(id, 200);
+            for (uint16_t i = 0; i < num_leds; i++)
+            {
+                compositor.pixels(id)[i] = CRGB(random(256), random(256), random(256));
+                if (id != LED_LAYER_BASE)
+                {
+                    compositor.alpha(id)[i] = 1 + random(255);
+                }
+            }
+        }
+        compositor.setBlendMode(LED_LAYER_ARC, LED_BLEND_SCREEN);
+        compositor.setBlendMode(LED_LAYER_FLASH, LED_BLEND_ADD);
+
+        unsigned long started_at = micros();
+        for (uint16_t i = 0; i < iterations; i++)
+        {
+            compositor.compose(out.data());
+        }
+        unsigned long elapsed_us = micros() - started_at;
+
+        LOGI("LED compositor, %d LEDs, %d layers: %.1fus per frame", num_leds, LED_LAYER_COUNT, (float)elapsed_us / iterations);
+    }
+}
+
+#endif
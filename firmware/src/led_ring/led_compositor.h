@@ -0,0 +1,84 @@
+#pragma once
+
+#if SK_LEDS
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#include <vector>
+
+const float LED_GAMMA = 2.2;
+
+enum LedLayerId
+{
+    LED_LAYER_BASE = 0,  // ambient effect, always enabled and blended against black
+    LED_LAYER_ARC = 1,   // knob position indicator
+    LED_LAYER_FLASH = 2, // short notification flashes
+    LED_LAYER_COUNT,
+};
+
+enum LedBlendMode
+{
+    LED_BLEND_NORMAL = 0,
+    LED_BLEND_ADD,
+    LED_BLEND_MULTIPLY,
+    LED_BLEND_SCREEN,
+    LED_BLEND_LIGHTEN,
+};
+
+struct LedLayer
+{
+    std::vector<CRGB> pixels;
+    // Per pixel coverage, 0 leaves the layers below untouched
+    std::vector<uint8_t> alpha;
+    uint8_t opacity;
+    LedBlendMode mode;
+    bool enabled;
+};
+
+// Stacks the LED layers bottom to top into the output buffer. Every blend is
+// 8-bit fixed point, coverage and layer opacity are combined per pixel and the
+// result goes through a gamma LUT built once in the constructor.
+//
+// Only the LED task renders, so the compositor is not guarded by a mutex.
+class LedCompositor
+{
+public:
+    LedCompositor(uint16_t num_leds, float gamma = LED_GAMMA);
+
+    uint16_t size() { return num_leds_; }
+
+    CRGB *pixels(LedLayerId layer) { return layers_[layer].pixels.data(); }
+    uint8_t *alpha(LedLayerId layer) { return layers_[layer].alpha.data(); }
+
+    void setOpacity(LedLayerId layer, uint8_t opacity);
+    void setBlendMode(LedLayerId layer, LedBlendMode mode);
+    void setEnabled(LedLayerId layer, bool enabled);
+    bool enabled(LedLayerId layer) { return layers_[layer].enabled; }
+
+    // Clears colour and coverage of a layer
+    void clear(LedLayerId layer);
+
+    // Call after drawing into a layer, compose() is skipped while nothing changed
+    void markDirty() { dirty_ = true; }
+    bool dirty() { return dirty_; }
+
+    // Writes the gamma corrected stack into out, num_leds pixels
+    void compose(CRGB *out);
+
+    // Times compose() for growing ring sizes and logs the per-frame cost
+    static void benchmark(uint16_t iterations);
+
+private:
+    uint16_t num_leds_;
+    LedLayer layers_[LED_LAYER_COUNT];
+    uint8_t gamma_[256];
+    bool dirty_ = true;
+
+    std::vector<CRGB> scratch_;
+
+    void blendLayer(CRGB *acc, const LedLayer &layer);
+    static uint8_t blendChannel(uint8_t dst, uint8_t src, LedBlendMode mode);
+};
+
+#endif
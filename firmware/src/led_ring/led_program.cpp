@@ -0,0 +1,246 @@
+#if SK_LEDS
+
+#include "led_program.h"
+#include "../logging.h"
+
+#include <algorithm>
+
+uint8_t LedProgram::opLength(uint8_t op)
+{
+    // Opcode byte included, indexed by LedProgramOp
+    static const uint8_t lengths[LED_OP_COUNT] = {1, 1, 2, 4, 6, 5, 2, 2, 7, 1};
+    return op < LED_OP_COUNT ? lengths[op] : 0;
+}
+
+bool LedProgram::validate(const uint8_t *data, size_t size)
+{
+    if (data == nullptr || size <= LED_PROGRAM_HEADER_SIZE || size > LED_PROGRAM_MAX_SIZE)
+    {
+        return false;
+    }
+    if (data[0] != 'L' || data[1] != 'P' || data[2] != LED_PROGRAM_VERSION)
+    {
+        return false;
+    }
+
+    uint8_t last_op = LED_OP_COUNT;
+    size_t pc = LED_PROGRAM_HEADER_SIZE;
+    while (pc < size)
+    {
+        uint8_t length = opLength(data[pc]);
+        if (length == 0 || pc + length > size)
+        {
+            return false;
+        }
+        last_op = data[pc];
+        pc += length;
+    }
+
+    // The interpreter never runs past the last instruction
+    return last_op == LED_OP_END || last_op == LED_OP_LOOP;
+}
+
+bool LedProgram::load(const uint8_t *data, size_t size, uint16_t num_leds)
+{
+    if (!validate(data, size) || num_leds == 0)
+    {
+        return false;
+    }
+
+    code_.assign(data, data + size);
+    num_leds_ = num_leds;
+    fade_from_.assign(num_leds, CRGB(0, 0, 0));
+    restart();
+    return true;
+}
+
+void LedProgram::unload()
+{
+    code_.clear();
+    fade_from_.clear();
+    restart();
+}
+
+void LedProgram::restart()
+{
+    pc_ = LED_PROGRAM_HEADER_SIZE;
+    finished_ = false;
+    wait_remaining_ = 0;
+    fade_frames_ = 0;
+    fade_step_ = 0;
+}
+
+void LedProgram::rotate(CRGB *pixels, int8_t steps)
+{
+    int16_t shift = steps % (int16_t)num_leds_;
+    if (shift < 0)
+    {
+        shift += num_leds_;
+    }
+    if (shift == 0)
+    {
+        return;
+    }
+    // Positive steps move pixel i to i + steps
+    std::rotate(pixels, pixels + num_leds_ - shift, pixels + num_leds_);
+}
+
+void LedProgram::fadeStep(CRGB *pixels)
+{
+    fade_step_++;
+    fract8 amount = (fade_step_ * 255) / fade_frames_;
+    for (uint16_t i = 0; i < num_leds_; i++)
+    {
+        pixels[i] = blend(fade_from_[i], fade_to_, amount);
+    }
+}
+
+bool LedProgram::renderFrame(CRGB *pixels, uint32_t main_color)
+{
+    if (code_.empty() || finished_)
+    {
+        return false;
+    }
+
+    if (fade_step_ < fade_frames_)
+    {
+        fadeStep(pixels);
+        return true;
+    }
+
+    if (wait_remaining_ > 0)
+    {
+        wait_remaining_--;
+        return false;
+    }
+
+    bool changed = false;
+    for (uint8_t ops = 0; ops < LED_PROGRAM_MAX_OPS_PER_FRAME; ops++)
+    {
+        const uint8_t *ins = &code_[pc_];
+        pc_ += opLength(ins[0]);
+
+        switch (ins[0])
+        {
+        case LED_OP_END:
+            finished_ = true;
+            return changed;
+        case LED_OP_LOOP:
+            pc_ = LED_PROGRAM_HEADER_SIZE;
+            break;
+        case LED_OP_WAIT:
+            // This frame is the first one of the wait
+            wait_remaining_ = ins[1] > 0 ? ins[1] - 1 : 0;
+            return changed;
+        case LED_OP_FILL:
+            for (uint16_t i = 0; i < num_leds_; i++)
+            {
+                pixels[i].setRGB(ins[1], ins[2], ins[3]);
+            }
+            changed = true;
+            break;
+        case LED_OP_SET:
+            for (uint16_t k = 0; k < ins[2]; k++)
+            {
+                pixels[(ins[1] + k) % num_leds_].setRGB(ins[3], ins[4], ins[5]);
+            }
+            changed = true;
+            break;
+        case LED_OP_FADE:
+            memcpy(fade_from_.data(), pixels, num_leds_ * sizeof(CRGB));
+            fade_to_ = CRGB(ins[2], ins[3], ins[4]);
+            fade_frames_ = std::max<uint8_t>(1, ins[1]);
+            fade_step_ = 0;
+            fadeStep(pixels);
+            return true;
+        case LED_OP_ROTATE:
+            rotate(pixels, (int8_t)ins[1]);
+            changed = true;
+            break;
+        case LED_OP_DIM:
+            for (uint16_t i = 0; i < num_leds_; i++)
+            {
+                pixels[i].nscale8(ins[1]);
+            }
+            changed = true;
+            break;
+        case LED_OP_GRADIENT:
+        {
+            CRGB from(ins[1], ins[2], ins[3]);
+            CRGB to(ins[4], ins[5], ins[6]);
+            for (uint16_t i = 0; i < num_leds_; i++)
+            {
+                pixels[i] = blend(from, to, (i * 255) / std::max<uint16_t>(1, num_leds_ - 1));
+            }
+            changed = true;
+            break;
+        }
+        case LED_OP_FILL_MAIN:
+            for (uint16_t i = 0; i < num_leds_; i++)
+            {
+                pixels[i].setColorCode(main_color);
+            }
+            changed = true;
+            break;
+        default:
+            // validate() rejects unknown opcodes
+            finished_ = true;
+            return changed;
+        }
+    }
+
+    // Out of budget, the program continues next frame
+    return changed;
+}
+
+void LedProgram::benchmark(uint16_t num_leds, uint16_t iterations)
+{
+    // Breathing main colour chasing around the ring
+    const uint8_t typical[] = {
+        'L', 'P', LED_PROGRAM_VERSION, 0,
+        LED_OP_FILL_MAIN,
+        LED_OP_SET, 0, 3, 255, 255, 255,
+        LED_OP_FADE, 20, 0, 0, 0,
+        LED_OP_ROTATE, 1,
+        LED_OP_WAIT, 2,
+        LED_OP_LOOP};
+
+    // Never yields, every frame burns the whole instruction budget on gradients
+    std::vector<uint8_t> worst = {'L', 'P', LED_PROGRAM_VERSION, 0};
+    for (uint8_t i = 0; i < LED_PROGRAM_MAX_OPS_PER_FRAME; i++)
+    {
+        const uint8_t gradient[] = {LED_OP_GRADIENT, i, 0, 255, 255, 0, i};
+        worst.insert(worst.end(), gradient, gradient + sizeof(gradient));
+    }
+    worst.push_back(LED_OP_LOOP);
+
+    std::vector<CRGB> pixels(num_leds);
+
+    const uint8_t *programs[] = {typical, worst.data()};
+    const size_t sizes[] = {sizeof(typical), worst.size()};
+    const char *names[] = {"typical", "worst case"};
+
+    for (uint8_t p = 0; p < 2; p++)
+    {
+        LedProgram program;
+        if (!program.load(programs[p], sizes[p], num_leds))
+        {
+            LOGE("LED program benchmark: %s program is invalid", names[p]);
+            continue;
+        }
+
+        unsigned long max_us = 0;
+        unsigned long started_at = micros();
+        for (uint16_t i = 0; i < iterations; i++)
+        {
+            unsigned long frame_started_at = micros();
+            program.renderFrame(pixels.data(), 0x008080);
+            max_us = std::max(max_us, micros() - frame_started_at);
+        }
+        unsigned long elapsed_us = micros() - started_at;
+
+        LOGI("LED program %s, %d LEDs, %u bytes: %.1fus per frame, max %luus", names[p], num_leds, (uint32_t)sizes[p], (float)elapsed_us / iterations, max_us);
+    }
+}
+
+#endif
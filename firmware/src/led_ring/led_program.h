@@ -0,0 +1,90 @@
+#pragma once
+
+#if SK_LEDS
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#include <vector>
+
+// Data-driven LED effects.
+//
+// A program is a 4 byte header followed by instructions, each an opcode byte
+// and its fixed-size arguments:
+//
+//   'L' 'P' LED_PROGRAM_VERSION flags(0)
+//
+//   END                       stop, the last frame stays on the ring
+//   LOOP                      jump back to the first instruction
+//   WAIT frames               show the current pixels for frames
+//   FILL r g b                every pixel to r g b
+//   SET start count r g b     count pixels from start (wrapping) to r g b
+//   FADE frames r g b         keyframe, every pixel moves to r g b over frames
+//   ROTATE steps              rotate the ring by steps (signed)
+//   DIM scale                 scale every pixel by scale / 256
+//   GRADIENT r g b r g b      gradient around the ring
+//   FILL_MAIN                 every pixel to the effect's main colour
+//
+// A program must end with END or LOOP. Instructions run until one of them
+// waits for the next frame (WAIT, FADE) or LED_PROGRAM_MAX_OPS_PER_FRAME have
+// run, so the per-frame cost is bounded whatever was uploaded.
+const uint16_t LED_PROGRAM_MAX_SIZE = 256;
+const uint8_t LED_PROGRAM_HEADER_SIZE = 4;
+const uint8_t LED_PROGRAM_VERSION = 1;
+const uint8_t LED_PROGRAM_MAX_OPS_PER_FRAME = 32;
+
+enum LedProgramOp
+{
+    LED_OP_END = 0x00,
+    LED_OP_LOOP = 0x01,
+    LED_OP_WAIT = 0x02,
+    LED_OP_FILL = 0x03,
+    LED_OP_SET = 0x04,
+    LED_OP_FADE = 0x05,
+    LED_OP_ROTATE = 0x06,
+    LED_OP_DIM = 0x07,
+    LED_OP_GRADIENT = 0x08,
+    LED_OP_FILL_MAIN = 0x09,
+    LED_OP_COUNT,
+};
+
+class LedProgram
+{
+public:
+    // Checks the header and that every instruction is complete and known
+    static bool validate(const uint8_t *data, size_t size);
+
+    // Copies a validated program and restarts it
+    bool load(const uint8_t *data, size_t size, uint16_t num_leds);
+    void unload();
+    bool loaded() { return !code_.empty(); }
+    bool finished() { return finished_; }
+
+    void restart();
+
+    // Advances the program by one frame, returns true if pixels changed
+    bool renderFrame(CRGB *pixels, uint32_t main_color);
+
+    // Times renderFrame() for a typical and a worst-case program and logs the results
+    static void benchmark(uint16_t num_leds, uint16_t iterations);
+
+private:
+    std::vector<uint8_t> code_;
+    uint16_t num_leds_ = 0;
+
+    uint16_t pc_ = LED_PROGRAM_HEADER_SIZE;
+    bool finished_ = false;
+    uint8_t wait_remaining_ = 0;
+
+    // Running FADE keyframe
+    std::vector<CRGB> fade_from_;
+    CRGB fade_to_;
+    uint8_t fade_frames_ = 0;
+    uint8_t fade_step_ = 0;
+
+    static uint8_t opLength(uint8_t op);
+    void rotate(CRGB *pixels, int8_t steps);
+    void fadeStep(CRGB *pixels);
+};
+
+#endif
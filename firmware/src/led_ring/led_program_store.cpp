@@ -0,0 +1,159 @@
+#if SK_LEDS
+
+#include "led_program_store.h"
+#include "../configuration.h"
+#include "../semaphore_guard.h"
+
+LedProgramStore::LedProgramStore()
+{
+    mutex_ = xSemaphoreCreateMutex();
+    assert(mutex_ != NULL);
+}
+
+void LedProgramStore::path(uint8_t slot, char *buf, size_t size)
+{
+    snprintf(buf, size, "/led_program_%d.bin", slot);
+}
+
+bool LedProgramStore::store(uint8_t slot, const uint8_t *data, size_t size, bool persist, bool play)
+{
+    if (slot >= LED_PROGRAM_SLOTS)
+    {
+        LOGW("LED program slot %d out of range", slot);
+        return false;
+    }
+    if (size == 0 && play)
+    {
+        SemaphoreGuard lock(mutex_);
+        play_slot_ = programs_[slot].empty() ? -1 : slot;
+        LOGI("Playing LED program slot %d", play_slot_);
+        return play_slot_ >= 0;
+    }
+    if (!LedProgram::validate(data, size))
+    {
+        LOGW("Rejected invalid LED program for slot %d (%d bytes)", slot, size);
+        return false;
+    }
+
+    TaskHandle_t listener = nullptr;
+    {
+        SemaphoreGuard lock(mutex_);
+        programs_[slot].assign(data, data + size);
+        generation_++;
+        if (play)
+        {
+            play_slot_ = slot;
+        }
+        listener = listener_;
+    }
+    LOGI("Stored LED program in slot %d (%d bytes)", slot, size);
+
+    if (listener != nullptr)
+    {
+        xTaskNotifyGive(listener);
+    }
+
+    if (persist)
+    {
+        return saveToDisk(slot, data, size);
+    }
+    return true;
+}
+
+bool LedProgramStore::copy(uint8_t slot, std::vector<uint8_t> &out)
+{
+    if (slot >= LED_PROGRAM_SLOTS)
+    {
+        return false;
+    }
+    SemaphoreGuard lock(mutex_);
+    out = programs_[slot];
+    return !out.empty();
+}
+
+int8_t LedProgramStore::playSlot()
+{
+    SemaphoreGuard lock(mutex_);
+    return play_slot_;
+}
+
+uint32_t LedProgramStore::generation()
+{
+    SemaphoreGuard lock(mutex_);
+    return generation_;
+}
+
+void LedProgramStore::setListener(TaskHandle_t task)
+{
+    SemaphoreGuard lock(mutex_);
+    listener_ = task;
+}
+
+void LedProgramStore::loadFromDisk()
+{
+    FatGuard fatGuard;
+    if (!fatGuard.mounted_)
+    {
+        return;
+    }
+
+    uint8_t buffer[LED_PROGRAM_MAX_SIZE];
+    char file_path[32];
+    for (uint8_t slot = 0; slot < LED_PROGRAM_SLOTS; slot++)
+    {
+        path(slot, file_path, sizeof(file_path));
+        if (!FFat.exists(file_path))
+        {
+            continue;
+        }
+
+        File f = FFat.open(file_path);
+        if (!f)
+        {
+            LOGE("Failed to read LED program %d", slot);
+            continue;
+        }
+        size_t size = f.read(buffer, sizeof(buffer));
+        f.close();
+
+        if (!LedProgram::validate(buffer, size))
+        {
+            LOGW("Ignoring invalid LED program %d on disk", slot);
+            continue;
+        }
+
+        SemaphoreGuard lock(mutex_);
+        programs_[slot].assign(buffer, buffer + size);
+        generation_++;
+    }
+}
+
+bool LedProgramStore::saveToDisk(uint8_t slot, const uint8_t *data, size_t size)
+{
+    FatGuard fatGuard;
+    if (!fatGuard.mounted_)
+    {
+        return false;
+    }
+
+    char file_path[32];
+    path(slot, file_path, sizeof(file_path));
+
+    File f = FFat.open(file_path, FILE_WRITE);
+    if (!f)
+    {
+        LOGE("Failed to write LED program %d", slot);
+        return false;
+    }
+    size_t written = f.write(data, size);
+    f.close();
+
+    if (written != size)
+    {
+        LOGE("Failed to write all of LED program %d", slot);
+        return false;
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,58 @@
+#pragma once
+
+#if SK_LEDS
+
+#include <Arduino.h>
+
+#include <vector>
+
+#include "led_program.h"
+
+// Effect ids LED_EFFECT_PROGRAM .. LED_EFFECT_PROGRAM + LED_PROGRAM_SLOTS - 1 play the slots
+const uint8_t LED_PROGRAM_SLOTS = 4;
+
+// Uploaded LED programs, shared between the tasks that receive them (MQTT,
+// serial) and the LED task that plays them. Persisted programs are kept in
+// FFat as /led_program_<slot>.bin and loaded when the LED task starts.
+class LedProgramStore
+{
+public:
+    static LedProgramStore &getInstance()
+    {
+        static LedProgramStore instance;
+        return instance;
+    }
+
+    // Validates and stores a program, optionally writing it to flash. play selects the slot for
+    // playback; with an empty program only the selection changes, to the slot if it holds a
+    // program and back to the built-in effects otherwise.
+    bool store(uint8_t slot, const uint8_t *data, size_t size, bool persist, bool play);
+
+    // Slot RootTask plays while the knob is in use, -1 for the built-in effects. Not persisted.
+    int8_t playSlot();
+
+    // Copies the program of a slot, false if the slot is empty
+    bool copy(uint8_t slot, std::vector<uint8_t> &out);
+
+    // Bumped on every store(), the LED task reloads a playing program when it changes
+    uint32_t generation();
+
+    // Task notified on every store()
+    void setListener(TaskHandle_t task);
+
+    void loadFromDisk();
+
+private:
+    LedProgramStore();
+
+    SemaphoreHandle_t mutex_;
+    std::vector<uint8_t> programs_[LED_PROGRAM_SLOTS];
+    uint32_t generation_ = 0;
+    int8_t play_slot_ = -1;
+    TaskHandle_t listener_ = nullptr;
+
+    bool saveToDisk(uint8_t slot, const uint8_t *data, size_t size);
+    static void path(uint8_t slot, char *buf, size_t size);
+};
+
+#endif
@@ -11,315 +11,670 @@ uint8_t FULL_BRIGHTNESS = 127;
 #include "../semaphore_guard.h"
 #include "../util.h"
 
-LedRingTask::LedRingTask(const uint8_t task_core) : Task{"Led_Ring", 2048 * 2, 1, task_core}
+LedRingTask::LedRingTask(const uint8_t task_core) : Task{"Led_Ring", 2048 * 2, 1, task_core}, compositor_(NUM_LEDS)
 {
-    render_effect_queue_ = xQueueCreate(10, sizeof(EffectSettings));
-
     mutex_ = xSemaphoreCreateMutex();
 
     assert(mutex_ != NULL);
-    
+
+    knob_state_queue_ = xQueueCreate(1, sizeof(KnobHotState));
+    assert(knob_state_queue_ != NULL);
+
+    // The arc brightens the effect below it instead of replacing it
+    compositor_.setBlendMode(LED_LAYER_ARC, LED_BLEND_SCREEN);
+    compositor_.setBlendMode(LED_LAYER_FLASH, LED_BLEND_ADD);
+
     // Initialize effect_settings with a default ID that will go to the default case (all LEDs off)
-    effect_settings.effect_id = 255; // Using 255 as it's unlikely to be used as an actual effect ID
+    effect_settings.effect_id = LED_EFFECT_OFF;
+    published_settings_.effect_id = LED_EFFECT_OFF;
+
+    effect_statuses[0] = EffectStatus{0, 0};
+
+    // The trail dims by 29/30 per LED behind the head
+    int value = 255;
+    for (uint8_t j = 0; j < NUM_LEDS; j++)
+    {
+        if (j > 1)
+        {
+            value = value / 30 * 29;
+        }
+        trail_values_[j] = value;
+    }
+
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        float fraction = std::min<float>(1, (float)i / FULL_BRIGHTNESS);
+        fade_levels_[i] = (uint8_t)(powf(fraction, 1 / LED_GAMMA) * 255.0f + 0.5f);
+    }
+    lighthouse_level_ = (uint8_t)(powf(FULL_BRIGHTNESS / 255.0f, 1 / LED_GAMMA) * 255.0f + 0.5f);
 }
 
 LedRingTask::~LedRingTask()
 {
-    vQueueDelete(render_effect_queue_);
-
+    vQueueDelete(knob_state_queue_);
     vSemaphoreDelete(mutex_);
 }
 
-void LedRingTask::renderEffectSnake()
+bool LedRingTask::renderEffectSnake()
 {
-    const uint32_t frame_ms = 1000;
+    const uint32_t step_frames = 1000 / LED_FRAME_MS;
 
-    if (millis() - effect_statuses[0].last_updated_ms > frame_ms)
+    if (effect_frame_ % step_frames != 0)
     {
-        uint8_t active_led_id = (effect_statuses[0].percent * NUM_LEDS) / 100;
+        return false;
+    }
 
-        for (uint8_t i = 0; i < NUM_LEDS; i++)
-        {
+    uint8_t active_led_id = (effect_statuses[0].percent * NUM_LEDS) / 100;
 
-            if (i == active_led_id)
-            {
-                leds[i].setRGB(255, 0, 0);
-            }
-            else
-            {
-                leds[i].setRGB(0, 0, 0); // Turn completely off instead of dim
-            }
+    for (uint8_t i = 0; i < NUM_LEDS; i++)
+    {
+        if (i == active_led_id)
+        {
+            frame_[i].setRGB(255, 0, 0);
         }
-        effect_statuses[0].percent++;
-        if (effect_statuses[0].percent > 100)
+        else
         {
-            effect_statuses[0].percent = 0;
+            frame_[i].setRGB(0, 0, 0); // Turn completely off instead of dim
         }
-        effect_statuses[0].last_updated_ms = millis();
-        FastLED.show();
     }
+    effect_statuses[0].percent++;
+    if (effect_statuses[0].percent > 100)
+    {
+        effect_statuses[0].percent = 0;
+    }
+    effect_statuses[0].last_updated_ms = millis();
+    return true;
 }
 
-void LedRingTask::renderTrailEffect()
+void LedRingTask::drawTrail(CRGB *pixels, uint8_t head, uint8_t hue)
 {
-    static uint8_t hue = 0; // Static variable to keep track of the hue
-    FastLED.setBrightness(255);
-    FastLED.clear();
-    while (1)
+    for (uint8_t j = 0; j < NUM_LEDS; j++)
     {
-        for (int i = 0; i < NUM_LEDS; i++)
-        {
-            // Set the current LED to full color with changing hue
-            leds[i] = CHSV(hue, 255, 255); // Use CHSV for hue cycling
-
-            // Create the trail effect with dimming colors
-            for (int j = 1; j < NUM_LEDS; j++)
-            { // Adjusted to potentially cover the whole ring
-                int value = 255;
-                // Adjust the dimming calculation to accommodate circular logic
-                for (int k = 1; k < j; k++)
-                {
-                    value = floor(value / 30 * 29); // Dimming the brightness for the trail effect
-                }
-                if (value < 0)
-                    value = 0;
-
-                // Calculate the index for the circular array
-                int index = (i - j + NUM_LEDS) % NUM_LEDS;
-
-                // Set the color of the trail LEDs with circular wrapping
-                leds[index] = CHSV(hue, 255, value);
-            }
+        // Calculate the index for the circular array
+        uint8_t index = (head + NUM_LEDS - j) % NUM_LEDS;
+        pixels[index] = CHSV(hue, 255, trail_values_[j]);
+    }
+}
 
-            FastLED.show();
-        }
-        hue += 10; // Increment hue after completing the cycle for all LEDs
+bool LedRingTask::renderTrailEffect()
+{
+    // One LED step per frame, the hue moves on after each revolution
+    uint8_t head = effect_frame_ % NUM_LEDS;
+    if (head == 0 && effect_frame_ > 0)
+    {
+        trail_hue_ += 10;
     }
+    drawTrail(frame_, head, trail_hue_);
+    return true;
 }
 
-void LedRingTask::renderEffectLightHouse()
+bool LedRingTask::renderEffectLightHouse()
 {
-    const uint32_t frame_ms = 100;
+    const uint8_t step = std::max<uint32_t>(1, FULL_BRIGHTNESS * LED_FRAME_MS / LED_FADE_MS);
 
-    bool exitCriteriaMet = false;
-    while (exitCriteriaMet == false)
+    bool changed = effect_frame_ == 0;
+    for (uint8_t i = 0; i < NUM_LEDS; i++)
     {
-        exitCriteriaMet = true;
-        for (uint8_t i = 0; i < NUM_LEDS; i++)
+        // First LED rises to full brightness as the beacon, all others fade out
+        uint8_t target = i == 0 ? FULL_BRIGHTNESS : 0;
+        if (ledsBrightness[i] < target)
         {
-            if (i == 0)
-            {
-                if (ledsBrightness[0] < FULL_BRIGHTNESS)
-                {
-                    leds[0].setRGB(0, ledsBrightness[0], ledsBrightness[0]);
-                    ledsBrightness[0]++;
-                    exitCriteriaMet = false;
-                }
-            }
-            else
-            {
-                if (ledsBrightness[i] > 0)
-                {
-
-                    ledsBrightness[i]--;
-                    leds[i].setRGB(0, ledsBrightness[i], ledsBrightness[i]);
-                    exitCriteriaMet = false;
-                }
-            }
+            ledsBrightness[i] = std::min<int>(target, ledsBrightness[i] + step);
+            changed = true;
         }
+        else if (ledsBrightness[i] > target)
+        {
+            ledsBrightness[i] = std::max<int>(target, ledsBrightness[i] - step);
+            changed = true;
+        }
+        uint8_t level = (fade_levels_[ledsBrightness[i]] * lighthouse_level_) / 255;
+        frame_[i].setRGB(0, level, level);
+    }
 
-        FastLED.show();
+    effect_idle_ = !changed;
+    return changed;
+}
+
+bool LedRingTask::renderEffectStaticColor()
+{
+    for (uint8_t i = 0; i < NUM_LEDS; i++)
+    {
+        frame_[i].setColorCode(effect_settings.effect_main_color);
+        ledsBrightness[i] = FULL_BRIGHTNESS;
     }
+
+    effect_idle_ = true;
+    return effect_frame_ == 0;
 }
 
-void LedRingTask::renderEffectStaticColor()
+bool LedRingTask::renderFadeInEffect()
 {
-    const uint32_t frame_ms = 1000;
+    const uint8_t step = std::max<uint32_t>(1, FULL_BRIGHTNESS * LED_FRAME_MS / LED_FADE_MS);
 
-    if (millis() - effect_statuses[1].last_updated_ms > frame_ms)
-    {
-        // uint8_t active_led_id = (effect_statuses[0].percent * NUM_LEDS) / 100;
+    uint32_t colorCode = effect_settings.effect_main_color; // Use the existing color code
+    // Extract RGB components from colorCode
+    uint8_t r = (colorCode >> 16) & 0xFF;
+    uint8_t g = (colorCode >> 8) & 0xFF;
+    uint8_t b = colorCode & 0xFF;
 
-        for (uint8_t i = 0; i < NUM_LEDS; i++)
+    // Nothing moves once every LED is at full brightness
+    bool changed = effect_frame_ == 0;
+    for (uint8_t i = 0; i < NUM_LEDS; i++)
+    {
+        if (ledsBrightness[i] < FULL_BRIGHTNESS)
         {
-            leds[i].setColorCode(effect_settings.effect_main_color);
-            ledsBrightness[i] = FULL_BRIGHTNESS;
+            ledsBrightness[i] = std::min<int>(FULL_BRIGHTNESS, ledsBrightness[i] + step);
+            changed = true;
         }
-
-        effect_statuses[1].last_updated_ms = millis();
-        FastLED.show();
+        uint8_t level = fade_levels_[ledsBrightness[i]];
+        frame_[i].setRGB((r * level) / 255, (g * level) / 255, (b * level) / 255);
     }
+
+    effect_idle_ = !changed;
+    return changed;
 }
 
-void LedRingTask::renderFadeInEffect()
+bool LedRingTask::renderFadeOutEffect()
 {
+    const uint8_t step = std::max<uint32_t>(1, FULL_BRIGHTNESS * LED_FRAME_MS / LED_FADE_MS);
+
     uint32_t colorCode = effect_settings.effect_main_color; // Use the existing color code
     // Extract RGB components from colorCode
     uint8_t r = (colorCode >> 16) & 0xFF;
     uint8_t g = (colorCode >> 8) & 0xFF;
     uint8_t b = colorCode & 0xFF;
 
-    bool exitCriteriaMet = false;    // this is true when all the leds are at full brightness.
-    while (exitCriteriaMet == false) // Increase brightness until it reaches full level
+    // Nothing moves once every LED is off
+    bool changed = effect_frame_ == 0;
+    for (uint8_t i = 0; i < NUM_LEDS; i++)
     {
-        exitCriteriaMet = true;
-        // Scale RGB values by current brightness level to achieve the fade-in effect
+        if (ledsBrightness[i] > 0)
+        {
+            ledsBrightness[i] = std::max<int>(0, ledsBrightness[i] - step);
+            changed = true;
+        }
+        uint8_t level = fade_levels_[ledsBrightness[i]];
+        frame_[i].setRGB((r * level) / 255, (g * level) / 255, (b * level) / 255);
+    }
+
+    effect_idle_ = !changed;
+    return changed;
+}
+
+bool LedRingTask::renderEffectProgram()
+{
+    LedProgramStore &store = LedProgramStore::getInstance();
+
+    bool changed = false;
+    uint32_t generation = store.generation();
+    if (effect_frame_ == 0 || generation != program_generation_)
+    {
+        // (Re)start from a dark ring whenever the effect starts or a program was uploaded
+        program_generation_ = generation;
+        std::vector<uint8_t> code;
+        uint8_t slot = effect_settings.effect_id - LED_EFFECT_PROGRAM;
+        if (!store.copy(slot, code) || !program_.load(code.data(), code.size(), NUM_LEDS))
+        {
+            program_.unload();
+        }
         for (uint8_t i = 0; i < NUM_LEDS; i++)
         {
-            // Set the color of each LED in the array with the current brightness level
-            if (ledsBrightness[i] < FULL_BRIGHTNESS)
-            {
-                exitCriteriaMet = false;
-                leds[i].setRGB((r * ledsBrightness[i]) / FULL_BRIGHTNESS,
-                               (g * ledsBrightness[i]) / FULL_BRIGHTNESS,
-                               (b * ledsBrightness[i]) / FULL_BRIGHTNESS);
-                ledsBrightness[i]++;
-            }
+            frame_[i] = CRGB(0, 0, 0);
         }
+        changed = true;
+    }
 
-        // Show the LEDs with the updated brightness level
-        FastLED.show();
+    changed |= program_.renderFrame(frame_, effect_settings.effect_main_color);
+
+    // Finished or empty programs hold their last frame
+    effect_idle_ = !program_.loaded() || program_.finished();
+    return changed;
+}
+
+bool LedRingTask::renderAudioEffect()
+{
+    uint32_t sequence = 0;
+    AudioBands bands;
+    bool new_bands = AudioBandsChannel::getInstance().read(&bands, nullptr, &sequence) && sequence != audio_sequence_;
+    if (new_bands)
+    {
+        audio_sequence_ = sequence;
+        audio_bands_ = bands;
+        audio_updated_ = true;
+    }
+
+    if (effect_frame_ == 0)
+    {
+        // Flash covers the whole ring, its opacity follows the beat
+        CRGB *flash = compositor_.pixels(LED_LAYER_FLASH);
+        uint8_t *flash_alpha = compositor_.alpha(LED_LAYER_FLASH);
+        for (uint8_t i = 0; i < NUM_LEDS; i++)
+        {
+            flash[i].setColorCode(effect_settings.effect_accent_color);
+            flash_alpha[i] = 255;
+        }
+        // Beats from before the effect started don't flash
+        audio_beat_count_ = audio_bands_.beat_count;
+        beat_flash_ = 0;
+    }
+    else if (audio_bands_.beat_count != audio_beat_count_)
+    {
+        audio_beat_count_ = audio_bands_.beat_count;
+        beat_flash_ = 128 + audio_bands_.beat_strength * 127;
+    }
+    else if (beat_flash_ > 0)
+    {
+        beat_flash_ = scale8(beat_flash_, LED_BEAT_FLASH_DECAY);
+    }
+    compositor_.setOpacity(LED_LAYER_FLASH, beat_flash_);
+    compositor_.setEnabled(LED_LAYER_FLASH, beat_flash_ > 0);
+
+    if (!new_bands && effect_frame_ != 0)
+    {
+        return false;
+    }
 
-        // Increase brightness for the next frame, until it reaches 255 (full brightness)
+    // One meter per band, each a third of the ring with an anti-aliased tip
+    const uint8_t sector = NUM_LEDS / 3;
+    const float levels[3] = {audio_bands_.low, audio_bands_.mid, audio_bands_.high};
+    const uint8_t hues[3] = {0, 96, 160};
+    for (uint8_t band = 0; band < 3; band++)
+    {
+        audio_peaks_[band] = std::max(std::max(levels[band], LED_SPECTRUM_MIN_PEAK), audio_peaks_[band] * LED_SPECTRUM_PEAK_DECAY);
+        int32_t fill_q8 = CLAMP(levels[band] / audio_peaks_[band], 0.0f, 1.0f) * sector * 256;
+        for (uint8_t i = 0; i < sector; i++)
+        {
+            frame_[band * sector + i] = CHSV(hues[band], 255, CLAMP<int32_t>(fill_q8 - i * 256, 0, 255));
+        }
     }
+    for (uint8_t i = sector * 3; i < NUM_LEDS; i++)
+    {
+        frame_[i] = CRGB(0, 0, 0);
+    }
+    return true;
 }
-void LedRingTask::renderFadeOutEffect()
+
+bool LedRingTask::renderEffectOff()
 {
+    effect_idle_ = true;
+    if (effect_frame_ != 0)
+    {
+        return false;
+    }
 
-    uint32_t colorCode = effect_settings.effect_main_color; // Use the existing color code
-    // Extract RGB components from colorCode
-    uint8_t r = (colorCode >> 16) & 0xFF;
-    uint8_t g = (colorCode >> 8) & 0xFF;
-    uint8_t b = colorCode & 0xFF;
+    // Make sure all LEDs stay off
+    for (uint8_t i = 0; i < NUM_LEDS; i++)
+    {
+        frame_[i] = CRGB(0, 0, 0);
+    }
+    return true;
+}
+
+bool LedRingTask::renderKnobArc()
+{
+    if (!effect_settings.effect_knob_arc)
+    {
+        compositor_.setEnabled(LED_LAYER_ARC, false);
+        return false;
+    }
+
+    KnobHotState state;
+    if (xQueuePeek(knob_state_queue_, &state, 0) != pdTRUE)
+    {
+        return false;
+    }
 
-    bool exitCriteriaMet = false;    // This becomes true when all the LEDs are at minimum brightness.
-    while (exitCriteriaMet == false) // Decrease brightness until it reaches zero level
+    bool was_enabled = compositor_.enabled(LED_LAYER_ARC);
+    compositor_.setEnabled(LED_LAYER_ARC, true);
+    if (was_enabled && state.sampled_us == arc_sampled_us_)
     {
-        exitCriteriaMet = true;
-        // Scale RGB values by current brightness level to achieve the fade-out effect
+        return false;
+    }
+    arc_sampled_us_ = state.sampled_us;
+
+    // Positions along the ring in 1/256 of an LED
+    const int32_t ring_q8 = NUM_LEDS * 256;
+    float value = state.current_position + state.sub_position_unit;
+    uint8_t *alpha = compositor_.alpha(LED_LAYER_ARC);
+
+    if (state.max_position > state.min_position)
+    {
+        // Bounded, the arc fills the ring from min to max and the LED at the tip is partially lit
+        float range = state.max_position - state.min_position;
+        int32_t fill_q8 = CLAMP((value - state.min_position) / range, 0.0f, 1.0f) * ring_q8;
         for (uint8_t i = 0; i < NUM_LEDS; i++)
         {
-            // Decrease the color brightness of each LED in the array towards zero
-            if (ledsBrightness[i] > 0)
-            {
-                exitCriteriaMet = false;
-                ledsBrightness[i]--;
-                leds[i].setRGB((r * ledsBrightness[i]) / FULL_BRIGHTNESS,
-                               (g * ledsBrightness[i]) / FULL_BRIGHTNESS,
-                               (b * ledsBrightness[i]) / FULL_BRIGHTNESS);
-            }
+            alpha[i] = CLAMP<int32_t>(fill_q8 - i * 256, 0, 255);
         }
+    }
+    else
+    {
+        // Unbounded, a one LED wide dot follows the shaft angle, split over the two LEDs it straddles
+        float turns = value * state.position_width_radians / (2 * PI);
+        int32_t dot_q8 = fmodf(turns * ring_q8, ring_q8);
+        if (dot_q8 < 0)
+        {
+            dot_q8 += ring_q8;
+        }
+        uint8_t index = dot_q8 >> 8;
+        uint8_t fraction = dot_q8 & 0xFF;
+        memset(alpha, 0, NUM_LEDS);
+        alpha[index] = 255 - fraction;
+        alpha[(index + 1) % NUM_LEDS] = fraction;
+    }
 
-        // Show the LEDs with the updated brightness level
-        FastLED.show();
+    CRGB *pixels = compositor_.pixels(LED_LAYER_ARC);
+    for (uint8_t i = 0; i < NUM_LEDS; i++)
+    {
+        pixels[i].setColorCode(effect_settings.effect_accent_color);
+    }
+    compositor_.markDirty();
+    return true;
+}
+
+bool LedRingTask::takeEffect(EffectSettings *settings)
+{
+    SemaphoreGuard lock(mutex_);
+    if (mailbox_stats_.generation == consumed_generation_)
+    {
+        return false;
+    }
+    mailbox_stats_.coalesced += mailbox_stats_.generation - consumed_generation_ - 1;
+    consumed_generation_ = mailbox_stats_.generation;
+    *settings = published_settings_;
+    return true;
+}
+
+void LedRingTask::startEffect(const EffectSettings &settings)
+{
+    if (settings.effect_id != effect_settings.effect_id)
+    {
+        // Cross-fade from whatever the base layer shows right now, even mid transition
+        memcpy(transition_from_, compositor_.pixels(LED_LAYER_BASE), sizeof(transition_from_));
+        transition_frame_ = 0;
+        effect_frame_ = 0;
+    }
+    else if (settings != effect_settings)
+    {
+        // Same effect with new colours or pixels, render it again from the start
+        effect_frame_ = 0;
+    }
+    effect_settings = settings;
+}
+
+bool LedRingTask::renderFrame()
+{
+    bool changed = false;
+    effect_idle_ = false;
+    knob_moved_ = false;
+    audio_updated_ = false;
+
+    switch (effect_settings.effect_id)
+    {
+    case LED_EFFECT_SNAKE:
+        changed = renderEffectSnake();
+        break;
+    case LED_EFFECT_STATIC_COLOR:
+        changed = renderEffectStaticColor();
+        break;
+    case LED_EFFECT_LIGHTHOUSE:
+        changed = renderEffectLightHouse();
+        break;
+    case LED_EFFECT_TRAIL:
+        changed = renderTrailEffect();
+        break;
+    case LED_EFFECT_FADE_IN:
+        changed = renderFadeInEffect();
+        break;
+    case LED_EFFECT_FADE_OUT:
+        changed = renderFadeOutEffect();
+        break;
+    case LED_EFFECT_AUDIO:
+        changed = renderAudioEffect();
+        break;
+    default:
+        if (effect_settings.effect_id >= LED_EFFECT_PROGRAM && effect_settings.effect_id < LED_EFFECT_PROGRAM + LED_PROGRAM_SLOTS)
+        {
+            changed = renderEffectProgram();
+        }
+        else
+        {
+            changed = renderEffectOff();
+        }
+        break;
+    }
+
+    // Set for every effect so none inherits the brightness of the one before it
+    uint8_t brightness = effect_settings.effect_id == LED_EFFECT_TRAIL ? LED_TRAIL_BRIGHTNESS : LED_BRIGHTNESS;
+    if (FastLED.getBrightness() != brightness)
+    {
+        FastLED.setBrightness(brightness);
+        compositor_.markDirty();
+    }
+
+    CRGB *base = compositor_.pixels(LED_LAYER_BASE);
+    if (transition_frame_ < LED_TRANSITION_FRAMES)
+    {
+        transition_frame_++;
+        fract8 amount = (transition_frame_ * 255) / LED_TRANSITION_FRAMES;
+        for (uint8_t i = 0; i < NUM_LEDS; i++)
+        {
+            base[i] = blend(transition_from_[i], frame_[i], amount);
+        }
+        effect_idle_ = false;
+        compositor_.markDirty();
+    }
+    else if (changed)
+    {
+        memcpy(base, frame_, sizeof(frame_));
+        compositor_.markDirty();
+    }
+
+    if (effect_settings.effect_id != LED_EFFECT_AUDIO)
+    {
+        compositor_.setEnabled(LED_LAYER_FLASH, false);
+    }
+
+    knob_moved_ = renderKnobArc();
+    if (effect_settings.effect_knob_arc)
+    {
+        // The knob can move at any time, keep ticking
+        effect_idle_ = false;
+    }
+
+    if (!compositor_.dirty())
+    {
+        return false;
+    }
+    compositor_.compose(leds);
+    return true;
+}
+
+void LedRingTask::recordFrame(unsigned long frame_us, bool shown)
+{
+    window_.frames++;
+    window_.shows += shown ? 1 : 0;
+    window_busy_us_ += frame_us;
+    if (frame_us > window_.max_frame_us)
+    {
+        window_.max_frame_us = frame_us;
+    }
+    if (frame_us > LED_FRAME_MS * 1000)
+    {
+        window_.overruns++;
+    }
 
-        // The loop continues until all LEDs have been dimmed to zero brightness
+    unsigned long elapsed_us = micros() - window_started_us_;
+    if (elapsed_us < LED_STATS_INTERVAL_MS * 1000)
+    {
+        return;
+    }
+
+    window_.avg_frame_us = window_busy_us_ / window_.frames;
+    for (LedLatencyStats *latency : {&window_.knob, &window_.audio, &window_.audio_analysis})
+    {
+        latency->avg_us = latency->updates > 0 ? latency->total_us / latency->updates : 0;
+    }
+    window_.load_permille = (window_busy_us_ * 1000) / elapsed_us;
+
+    {
+        SemaphoreGuard lock(mutex_);
+        stats_ = window_;
+    }
+
+#if SK_LED_BENCHMARK
+    LOGD("LED frames: %d, shows: %d, avg %dus, max %dus, load %d.%d%%, overruns %d", window_.frames, window_.shows, window_.avg_frame_us, window_.max_frame_us, window_.load_permille / 10, window_.load_permille % 10, window_.overruns);
+    if (window_.knob.updates > 0)
+    {
+        LOGD("LED knob arc: %d updates, latency avg %dus, max %dus", window_.knob.updates, window_.knob.avg_us, window_.knob.max_us);
+    }
+    if (window_.audio.updates > 0)
+    {
+        LOGD("LED audio: %d updates, latency avg %dus (analysis %dus), max %dus", window_.audio.updates, window_.audio.avg_us, window_.audio_analysis.avg_us, window_.audio.max_us);
+    }
+    LedEffectMailboxStats mailbox_stats = getMailboxStats();
+    LOGD("LED effect mailbox: %d requests, %d published, %d coalesced, generation %d", mailbox_stats.requests, mailbox_stats.published, mailbox_stats.coalesced, mailbox_stats.generation);
+#endif
+
+    window_ = {};
+    window_busy_us_ = 0;
+    window_started_us_ = micros();
+}
+
+void LedRingTask::recordLatency(LedLatencyStats &stats, unsigned long latency_us)
+{
+    stats.updates++;
+    stats.total_us += latency_us;
+    if (latency_us > stats.max_us)
+    {
+        stats.max_us = latency_us;
     }
 }
 
+LedRingStats LedRingTask::getStats()
+{
+    SemaphoreGuard lock(mutex_);
+    return stats_;
+}
+
+LedEffectMailboxStats LedRingTask::getMailboxStats()
+{
+    SemaphoreGuard lock(mutex_);
+    return mailbox_stats_;
+}
+
+QueueHandle_t LedRingTask::getKnobStateQueue()
+{
+    return knob_state_queue_;
+}
+
 void LedRingTask::run()
 {
     // Initialize LED brightness array to 0
-    for (int i = 0; i < NUM_LEDS; i++) {
+    for (int i = 0; i < NUM_LEDS; i++)
+    {
         ledsBrightness[i] = 0;
     }
 
+#if SK_LED_BENCHMARK
+    LedCompositor::benchmark(1000);
+    LedProgram::benchmark(NUM_LEDS, 1000);
+#endif
+
     FastLED.addLeds<WS2812B, PIN_LED_DATA, GRB>(leds, NUM_LEDS);
     uint8_t hue = 150; // 150 = teal colour.
-    for (int i = 0; i < NUM_LEDS; i++)
+    for (uint8_t i = 0; i < NUM_LEDS; i++)
     {
-        // Set the current LED to full color with changing hue
-        leds[i] = CHSV(hue, 255, 255); // Use CHSV for hue cycling
-
-        // Create the trail effect with dimming colors
-        for (int j = 1; j < NUM_LEDS; j++)
-        { // Adjusted to potentially cover the whole ring
-            int value = 255;
-            // Adjust the dimming calculation to accommodate circular logic
-            for (int k = 1; k < j; k++)
-            {
-                value = floor(value / 30 * 29); // Dimming the brightness for the trail effect
-            }
-            if (value < 0)
-                value = 0;
-
-            // Calculate the index for the circular array
-            int index = (i - j + NUM_LEDS) % NUM_LEDS;
-
-            // Set the color of the trail LEDs with circular wrapping
-            leds[index] = CHSV(hue, 255, value);
-        }
-
+        drawTrail(leds, i, hue);
         FastLED.show();
     }
-    
+
     // Make sure all LEDs are completely off initially
     FastLED.clear();
-    for (int i = 0; i < NUM_LEDS; i++) {
+    for (int i = 0; i < NUM_LEDS; i++)
+    {
         leds[i] = CRGB(0, 0, 0);
     }
-    FastLED.setBrightness(155);
+    FastLED.setBrightness(LED_BRIGHTNESS);
     FastLED.show();
 
+    {
+        SemaphoreGuard lock(mutex_);
+        task_handle_ = xTaskGetCurrentTaskHandle();
+    }
+
+    // Uploaded programs wake the task like effect changes do
+    LedProgramStore::getInstance().loadFromDisk();
+    LedProgramStore::getInstance().setListener(xTaskGetCurrentTaskHandle());
+
+    window_started_us_ = micros();
+    TickType_t last_wake = xTaskGetTickCount();
+
     while (1)
     {
+        // Clear the wake-up before reading the mailbox, a change published after this wakes the next wait
+        ulTaskNotifyTake(pdTRUE, 0);
 
-        // Attempt to receive an item from the render_effect_queue_ without blocking.
-        // - render_effect_queue_ is the queue handle from which we're trying to receive an item.
-        // - &effect_settings is a pointer to the variable where the received item will be stored.
-        // - 0 specifies that the call should not wait (block) if the queue is empty.
-        // If an item is successfully received (return value is pdTRUE), the code within the if-statement executes.
-        // This is useful for checking the queue and responding to events without delaying program execution.
-        if (xQueueReceive(render_effect_queue_, &effect_settings, 0) == pdTRUE)
+        EffectSettings received;
+        if (takeEffect(&received))
         {
-            // Sync reaction to receiving an effect.
+            startEffect(received);
         }
 
-        // At this point, effect_settings is always the last object received through the queue.
-        // Todo : turn this on, when verbose.
+        unsigned long started_us = micros();
 
-        switch (effect_settings.effect_id)
+        bool changed = renderFrame();
+        if (changed)
         {
-        case 0:
-            // TODO: disabled for a Demo
-            renderEffectSnake();
-            break;
-        case 1:
-            renderEffectStaticColor();
-            break;
-        case 2:
-            renderEffectLightHouse();
-            break;
-        case 3:
-            renderTrailEffect();
-            break;
-        case 4:
-            renderFadeInEffect();
-            break;
-        case 5:
-            renderFadeOutEffect();
-            break;
-
-        default:
-            // Make sure all LEDs stay off in the default case
-            FastLED.clear();
-            for (int i = 0; i < NUM_LEDS; i++) {
-                leds[i] = CRGB(0, 0, 0);
-            }
             FastLED.show();
-            break;
         }
+        if (knob_moved_)
+        {
+            recordLatency(window_.knob, micros() - arc_sampled_us_);
+        }
+        if (changed && audio_updated_)
+        {
+            recordLatency(window_.audio, micros() - audio_bands_.captured_us);
+            recordLatency(window_.audio_analysis, audio_bands_.published_us - audio_bands_.captured_us);
+        }
+        effect_frame_++;
 
-        //
+        recordFrame(micros() - started_us, changed);
 
-        delay(1);
+        if (effect_idle_)
+        {
+            // Nothing animates, sleep until setEffect() publishes a change. The timeout keeps the stats window moving.
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LED_STATS_INTERVAL_MS));
+            last_wake = xTaskGetTickCount();
+        }
+        else
+        {
+            // Fixed timestep, the task sleeps for whatever is left of the frame
+            vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(LED_FRAME_MS));
+        }
     }
 }
 
 void LedRingTask::setEffect(EffectSettings effect_settings)
 {
-    // TODO: make it async and safe with a queue
-    xQueueSend(render_effect_queue_, &effect_settings, 0); // portMAX_DELAY
+    TaskHandle_t task_handle = nullptr;
+    {
+        SemaphoreGuard lock(mutex_);
+        mailbox_stats_.requests++;
+        if (effect_settings == published_settings_)
+        {
+            return;
+        }
+        published_settings_ = effect_settings;
+        mailbox_stats_.published++;
+        mailbox_stats_.generation++;
+        task_handle = task_handle_;
+    }
+
+    if (task_handle != nullptr)
+    {
+        xTaskNotifyGive(task_handle);
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
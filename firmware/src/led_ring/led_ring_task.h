@@ -2,12 +2,51 @@
 
 #if SK_LEDS
 
+#include <FastLED.h>
+
 #include "../logger.h"
 #include "../task.h"
 #include "../app_config.h"
+#include "../motor_foc/motor_task.h"
+#include "../microphone/audio_bands.h"
+#include "led_compositor.h"
+#include "led_program.h"
+#include "led_program_store.h"
 
 const uint8_t total_effects = 1;
 
+// Fixed timestep of the LED task, every effect advances one frame per tick
+const uint32_t LED_FRAME_MS = 16;
+// Cross-fade between the outgoing and incoming effect
+const uint16_t LED_TRANSITION_FRAMES = 250 / LED_FRAME_MS;
+// Time for a fade effect to go from off to full brightness
+const uint32_t LED_FADE_MS = 250;
+// Global FastLED brightness, the trail runs at full brightness and everything else below it
+const uint8_t LED_BRIGHTNESS = 155;
+const uint8_t LED_TRAIL_BRIGHTNESS = 255;
+const uint32_t LED_STATS_INTERVAL_MS = 5000;
+// Beat flashes lose 1/5 of their opacity per frame, about 200ms to fade out
+const uint8_t LED_BEAT_FLASH_DECAY = 204;
+// Spectrum meters are relative to their recent peak, which falls by 1% per analysis
+const float LED_SPECTRUM_PEAK_DECAY = 0.99;
+// Keeps silence from being amplified to full scale
+const float LED_SPECTRUM_MIN_PEAK = 0.02;
+
+enum LedEffectId
+{
+    LED_EFFECT_SNAKE = 0,
+    LED_EFFECT_STATIC_COLOR = 1,
+    LED_EFFECT_LIGHTHOUSE = 2,
+    LED_EFFECT_TRAIL = 3,
+    LED_EFFECT_FADE_IN = 4,
+    LED_EFFECT_FADE_OUT = 5,
+    // Low, mid and high band meters around the ring, accent colour flashes on beats
+    LED_EFFECT_AUDIO = 6,
+    // Plays LedProgramStore slot effect_id - LED_EFFECT_PROGRAM
+    LED_EFFECT_PROGRAM = 16,
+    LED_EFFECT_OFF = 255,
+};
+
 struct EffectStatus
 {
     uint8_t percent;
@@ -22,6 +61,62 @@ struct EffectSettings
     uint8_t effect_accent_pixel;
     uint32_t effect_main_color;
     uint32_t effect_accent_color;
+    // Draws the knob position in the accent colour over the effect
+    bool effect_knob_arc;
+
+    // Field by field, the padding after effect_knob_arc is indeterminate
+    bool operator==(const EffectSettings &other) const
+    {
+        return effect_id == other.effect_id && effect_start_pixel == other.effect_start_pixel &&
+               effect_end_pixel == other.effect_end_pixel && effect_accent_pixel == other.effect_accent_pixel &&
+               effect_main_color == other.effect_main_color && effect_accent_color == other.effect_accent_color &&
+               effect_knob_arc == other.effect_knob_arc;
+    }
+
+    bool operator!=(const EffectSettings &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// Delay from an input sample to the LEDs showing it, within a stats window
+struct LedLatencyStats
+{
+    uint32_t updates;
+    uint32_t avg_us;
+    uint32_t max_us;
+    // Sum of the window, avg_us is filled in when the window closes
+    uint64_t total_us;
+};
+
+struct LedRingStats
+{
+    uint32_t frames;
+    uint32_t shows;
+    uint32_t avg_frame_us;
+    uint32_t max_frame_us;
+    // Share of the frame budget spent rendering and pushing pixels, in 0.1%
+    uint16_t load_permille;
+    // Frames that took longer than LED_FRAME_MS
+    uint32_t overruns;
+    // Shaft angle read to FastLED.show() returning
+    LedLatencyStats knob;
+    // Newest audio sample captured to FastLED.show() returning
+    LedLatencyStats audio;
+    // Part of the audio latency spent in the microphone task's analysis
+    LedLatencyStats audio_analysis;
+};
+
+// Running totals of the effect mailbox between RootTask and the LED task
+struct LedEffectMailboxStats
+{
+    // setEffect() calls
+    uint32_t requests;
+    // Calls that changed the settings and bumped the generation
+    uint32_t published;
+    // Published settings overwritten before the LED task picked them up
+    uint32_t coalesced;
+    uint32_t generation;
 };
 
 class LedRingTask : public Task<LedRingTask>
@@ -31,29 +126,98 @@ class LedRingTask : public Task<LedRingTask>
 public:
     LedRingTask(const uint8_t task_core);
     ~LedRingTask();
+    // Publishes the settings if they differ from the latest ones and wakes the LED task
     void setEffect(EffectSettings effect_settings);
 
+    // Counters of the last completed stats window
+    LedRingStats getStats();
+    LedEffectMailboxStats getMailboxStats();
+
+    // Register with MotorTask::addHotStateListener() to drive the knob arc
+    QueueHandle_t getKnobStateQueue();
+
 protected:
     void
     run();
 
 private:
-    QueueHandle_t render_effect_queue_;
-
     SemaphoreHandle_t mutex_;
 
-    uint32_t effect_timeout_ms;
-    unsigned long effect_expiration_ms;
+    // Latest-value mailbox, guarded by mutex_. Only the newest settings matter
+    // so a change overwrites whatever the LED task has not consumed yet.
+    EffectSettings published_settings_ = {};
+    LedEffectMailboxStats mailbox_stats_ = {};
+    uint32_t consumed_generation_ = 0;
+    TaskHandle_t task_handle_ = nullptr;
+
     EffectSettings effect_settings;
+    // Steady effects set this to sleep until the next change instead of ticking
+    bool effect_idle_ = false;
 
     EffectStatus effect_statuses[total_effects];
 
-    void renderEffectSnake();
-    void renderEffectStaticColor();
-    void renderEffectLightHouse();
-    void renderTrailEffect();
-    void renderFadeInEffect();
-    void renderFadeOutEffect();
+    // Frames since the current effect started
+    uint32_t effect_frame_ = 0;
+
+    // Effects render into frame_, the base layer gets the cross-faded result
+    // and leds[] the composited stack
+    LedCompositor compositor_;
+    CRGB frame_[NUM_LEDS];
+    CRGB transition_from_[NUM_LEDS];
+    uint16_t transition_frame_ = LED_TRANSITION_FRAMES;
+
+    // Brightness of each trail position behind the head
+    uint8_t trail_values_[NUM_LEDS];
+    uint8_t trail_hue_ = 0;
+
+    // Drive level for each ledsBrightness step of the fades and the lighthouse. The
+    // compositor applies gamma, these undo it so the ramps stay linear in light output.
+    uint8_t fade_levels_[256];
+    // Lighthouse beacon level that comes out of the gamma LUT at FULL_BRIGHTNESS
+    uint8_t lighthouse_level_;
+
+    LedProgram program_;
+    uint32_t program_generation_ = 0;
+
+    QueueHandle_t knob_state_queue_;
+    // Sample time of the knob state drawn on the arc layer
+    uint32_t arc_sampled_us_ = 0;
+    bool knob_moved_ = false;
+
+    // Latest AudioBandsChannel sequence rendered
+    uint32_t audio_sequence_ = 0;
+    AudioBands audio_bands_ = {};
+    bool audio_updated_ = false;
+    uint32_t audio_beat_count_ = 0;
+    float audio_peaks_[3] = {};
+    uint8_t beat_flash_ = 0;
+
+    LedRingStats stats_ = {};
+    LedRingStats window_ = {};
+    uint64_t window_busy_us_ = 0;
+    unsigned long window_started_us_ = 0;
+
+    bool takeEffect(EffectSettings *settings);
+    void startEffect(const EffectSettings &settings);
+
+    // Each effect renders a single frame into frame_ and returns true if it changed
+    bool renderEffectSnake();
+    bool renderEffectStaticColor();
+    bool renderEffectLightHouse();
+    bool renderTrailEffect();
+    bool renderFadeInEffect();
+    bool renderFadeOutEffect();
+    bool renderEffectProgram();
+    bool renderAudioEffect();
+    bool renderEffectOff();
+
+    // Redraws the arc layer if the knob moved, returns true if it did
+    bool renderKnobArc();
+
+    bool renderFrame();
+    void drawTrail(CRGB *pixels, uint8_t head, uint8_t hue);
+    void recordFrame(unsigned long frame_us, bool shown);
+    void recordLatency(LedLatencyStats &stats, unsigned long latency_us);
 };
 
 #else
@@ -125,6 +125,9 @@ void setup()
 
 #if SK_LEDS
     led_ring_task_p->begin();
+
+    // The knob arc follows the motor directly, not through RootTask
+    motor_task.addHotStateListener(led_ring_task.getKnobStateQueue());
 #endif
 
     // TODO: remove this. Wait for display task init finishes
@@ -152,7 +155,6 @@ void setup()
     mqtt_task.begin();
 #endif
 
-    sensors_task_p->addStateListener(root_task.getSensorsStateQueue());
     sensors_task_p->begin();
 
 #if SK_MICROPHONE
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "../latest_value.h"
+
+const uint8_t AUDIO_MAX_BANDS = 32;
+
+struct AudioBands
+{
+    // Coarse summary of the bands below
+    float low;
+    float mid;
+    float high;
+    // Incremented on every detected beat, consumers compare it with the last count they saw
+    uint32_t beat_count;
+    // How far the last beat stood out of the average, 0..1
+    float beat_strength;
+    // Tracked tempo, 0 until one was found
+    float bpm;
+    // RMS of the samples since the previous frame, 1 is full scale
+    float rms;
+    // micros() when the newest sample of the analysed frame was captured
+    uint32_t captured_us;
+    // micros() when the analysis finished and the bands were published
+    uint32_t published_us;
+    // Levels of the log/mel bands, lowest first
+    uint8_t num_bands;
+    float bands[AUDIO_MAX_BANDS];
+};
+
+// Latest band energies, from MicrophoneTask to the LED ring and the apps. A
+// seqlock slot like the sensor readings, see LatestValue.
+class AudioBandsChannel : public LatestValue<AudioBands>
+{
+public:
+    static AudioBandsChannel &getInstance()
+    {
+        static AudioBandsChannel instance;
+        return instance;
+    }
+
+    // Single writer only, the capture time comes with the bands
+    void publish(const AudioBands &bands) { LatestValue::publish(bands, bands.captured_us); }
+
+private:
+    AudioBandsChannel() {}
+};
@@ -0,0 +1,126 @@
+#include "audio_feature_stream.h"
+#include "../logging.h"
+#include "../semaphore_guard.h"
+
+AudioFeatureStream::AudioFeatureStream()
+{
+    mutex_ = xSemaphoreCreateMutex();
+    assert(mutex_ != NULL);
+}
+
+void AudioFeatureStream::configure(const PB_AudioFeatureConfig &config, AudioFeatureLink link)
+{
+    if (config.enabled)
+    {
+        enabled_links_ |= 1 << link;
+    }
+    else
+    {
+        enabled_links_ &= ~(1 << link);
+    }
+
+    uint16_t interval_ms = config.frame_interval_ms > 0 ? min(config.frame_interval_ms, AUDIO_FEATURE_MAX_INTERVAL_MS) : AUDIO_FEATURE_DEFAULT_INTERVAL_MS;
+    uint8_t batch_frames = config.batch_frames > 0 ? min(config.batch_frames, AUDIO_FEATURE_MAX_BATCH_FRAMES) : AUDIO_FEATURE_DEFAULT_BATCH_FRAMES;
+    interval_ms_ = interval_ms;
+    batch_frames_ = batch_frames;
+    LOGI("Audio features %s over %s: one frame per %dms, %d frames per batch", config.enabled ? "enabled" : "disabled",
+         link == AUDIO_FEATURE_LINK_MQTT ? "MQTT" : "serial", interval_ms, batch_frames);
+}
+
+uint8_t AudioFeatureStream::encodeLevel(float db, float min_db, float max_db)
+{
+    // Silence gives -inf, which lands on code 0 like everything below min_db
+    if (!(db > min_db))
+    {
+        return 0;
+    }
+    if (db >= max_db)
+    {
+        return 255;
+    }
+    return (db - min_db) * 255 / (max_db - min_db) + 0.5f;
+}
+
+void AudioFeatureStream::addFrame(const AudioBands &bands)
+{
+    uint32_t now = millis();
+    bool beat = bands.beat_count != last_beat_count_;
+    last_beat_count_ = bands.beat_count;
+
+    if (enabled_links_ == 0)
+    {
+        // Nobody listens, skip the encoding; batching starts over once a link enables the stream
+        frame_open_ = false;
+        batch_.frames_count = 0;
+        return;
+    }
+
+    uint8_t num_bands = min<uint8_t>(bands.num_bands, sizeof(frame_.bands.bytes));
+    uint8_t rms = encodeLevel(20 * log10f(bands.rms), AUDIO_FEATURE_RMS_MIN_DB, AUDIO_FEATURE_RMS_MAX_DB);
+
+    // Analysis frames arrive every hop, a link rarely needs all of them
+    if (frame_open_ && (int32_t)(now - frame_due_ms_) < 0 && num_bands == frame_.bands.size)
+    {
+        for (uint8_t i = 0; i < num_bands; i++)
+        {
+            frame_.bands.bytes[i] = max(frame_.bands.bytes[i], encodeLevel(20 * log10f(bands.bands[i]), AUDIO_FEATURE_BAND_MIN_DB, AUDIO_FEATURE_BAND_MAX_DB));
+        }
+        frame_.rms = max(frame_.rms, rms);
+        frame_.beat = frame_.beat || beat;
+        return;
+    }
+
+    uint16_t interval_ms = interval_ms_;
+    if (frame_open_)
+    {
+        closeFrame(bands.bpm);
+    }
+
+    // Frames open on an interval grid so hop jitter averages out, after a stall the grid restarts
+    frame_due_ms_ = frame_open_ && now - frame_due_ms_ < interval_ms ? frame_due_ms_ + interval_ms : now + interval_ms;
+    frame_ms_ = now;
+    frame_open_ = true;
+    frame_.bands.size = num_bands;
+    for (uint8_t i = 0; i < num_bands; i++)
+    {
+        frame_.bands.bytes[i] = encodeLevel(20 * log10f(bands.bands[i]), AUDIO_FEATURE_BAND_MIN_DB, AUDIO_FEATURE_BAND_MAX_DB);
+    }
+    frame_.rms = rms;
+    frame_.beat = beat;
+}
+
+void AudioFeatureStream::closeFrame(float bpm)
+{
+    if (batch_.frames_count == 0)
+    {
+        batch_.start_ms = frame_ms_;
+    }
+    frame_.offset_ms = frame_ms_ - batch_.start_ms;
+    batch_.frames[batch_.frames_count++] = frame_;
+
+    // The batch size may have been lowered while this batch was filling
+    if (batch_.frames_count < batch_frames_)
+    {
+        return;
+    }
+
+    batch_.sequence = ++sequence_;
+    batch_.bpm = bpm;
+    {
+        SemaphoreGuard lock(mutex_);
+        published_ = batch_;
+    }
+    batch_.frames_count = 0;
+}
+
+bool AudioFeatureStream::read(PB_AudioFeatures *batch, uint32_t *sequence)
+{
+    SemaphoreGuard lock(mutex_);
+    if (published_.sequence == *sequence)
+    {
+        return false;
+    }
+    *batch = published_;
+    *sequence = published_.sequence;
+    return true;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <atomic>
+
+#include "audio_bands.h"
+#include "../proto_gen/smartknob.pb.h"
+
+// Levels go out as 8-bit codes spread evenly over a dB range, code 0 is MIN_DB
+// and 255 is MAX_DB. Band levels are in dB of the AudioBands values (a full
+// scale sine reads about +48dB in its band), the frame RMS is in dBFS.
+const float AUDIO_FEATURE_BAND_MIN_DB = -80;
+const float AUDIO_FEATURE_BAND_MAX_DB = 50;
+const float AUDIO_FEATURE_RMS_MIN_DB = -100;
+const float AUDIO_FEATURE_RMS_MAX_DB = 0;
+
+// 20 frames/s in batches of 8, one message every 400ms
+const uint16_t AUDIO_FEATURE_DEFAULT_INTERVAL_MS = 50;
+const uint8_t AUDIO_FEATURE_DEFAULT_BATCH_FRAMES = 8;
+const uint8_t AUDIO_FEATURE_MAX_BATCH_FRAMES = sizeof(PB_AudioFeatures::frames) / sizeof(PB_AudioFeatureFrame);
+const uint16_t AUDIO_FEATURE_MAX_INTERVAL_MS = 1000;
+
+// Links that stream the features, each enables them for itself
+enum AudioFeatureLink
+{
+    AUDIO_FEATURE_LINK_SERIAL,
+    AUDIO_FEATURE_LINK_MQTT,
+};
+
+// Packs the microphone analysis into AudioFeatures batches for the MQTT and
+// serial links, so dashboards get every frame without a JSON message each.
+//
+// MicrophoneTask adds every analysed frame. Frames closer together than the
+// frame interval are merged, keeping the peak levels and any beat. Once
+// batch_frames frames are collected the batch replaces the published one and
+// the links pick it up from their own loops. A link that falls behind skips
+// batches, which shows as a gap in the sequence, instead of queueing them.
+// While no link has the stream enabled, frames are dropped before encoding.
+class AudioFeatureStream
+{
+public:
+    static AudioFeatureStream &getInstance()
+    {
+        static AudioFeatureStream instance;
+        return instance;
+    }
+
+    // Interval and batch size are shared by all links, enabled is up to each link
+    void configure(const PB_AudioFeatureConfig &config, AudioFeatureLink link);
+
+    bool enabled(AudioFeatureLink link) { return enabled_links_ & (1 << link); }
+
+    // Single writer only
+    void addFrame(const AudioBands &bands);
+
+    // Copies the newest batch if it is newer than *sequence and updates *sequence
+    bool read(PB_AudioFeatures *batch, uint32_t *sequence);
+
+    static uint8_t encodeLevel(float db, float min_db, float max_db);
+
+private:
+    AudioFeatureStream();
+
+    SemaphoreHandle_t mutex_;
+    PB_AudioFeatures published_ = PB_AudioFeatures_init_zero;
+
+    // Only touched by the writer
+    PB_AudioFeatures batch_ = PB_AudioFeatures_init_zero;
+    PB_AudioFeatureFrame frame_ = PB_AudioFeatureFrame_init_zero;
+    uint32_t frame_ms_ = 0;
+    uint32_t frame_due_ms_ = 0;
+    bool frame_open_ = false;
+    uint32_t last_beat_count_ = 0;
+    uint32_t sequence_ = 0;
+
+    // Set by the links, read by the writer
+    std::atomic<uint16_t> interval_ms_{AUDIO_FEATURE_DEFAULT_INTERVAL_MS};
+    std::atomic<uint8_t> batch_frames_{AUDIO_FEATURE_DEFAULT_BATCH_FRAMES};
+    // Bit per AudioFeatureLink
+    std::atomic<uint8_t> enabled_links_{0};
+
+    void closeFrame(float bpm);
+};
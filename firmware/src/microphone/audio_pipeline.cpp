@@ -0,0 +1,59 @@
+#include "audio_pipeline.h"
+
+uint8_t AudioPipeline::process(const int32_t *samples, size_t count)
+{
+    uint8_t events = claps_.process(samples, count) ? AUDIO_CLAP : 0;
+
+    // Claps are found at the full rate, everything else works on the decimated stream
+    size_t decimated = decimator_.process(samples, count, decimated_);
+    return events | processDecimated(decimated_, decimated);
+}
+
+uint8_t AudioPipeline::processDecimated(const int32_t *samples, size_t count)
+{
+    // Append to the ring, it wraps at AUDIO_FFT_SAMPLES
+    for (size_t i = 0; i < count; i++)
+    {
+        ring_[ring_write_] = samples[i];
+        ring_write_ = (ring_write_ + 1) % AUDIO_FFT_SAMPLES;
+
+        float sample = samples[i] * FFT_NORMALIZE_24BIT;
+        hop_energy_ += sample * sample;
+    }
+    samples_since_frame_ += count;
+    hop_energy_samples_ += count;
+
+    if (samples_since_frame_ < AUDIO_HOP_SAMPLES)
+    {
+        return 0;
+    }
+
+    // A block larger than a hop (or a stall) brings several hops at once, only the newest frame is worth analysing
+    frames_skipped_ += samples_since_frame_ / AUDIO_HOP_SAMPLES - 1;
+    samples_since_frame_ %= AUDIO_HOP_SAMPLES;
+    frames_++;
+
+    frame_rms_ = sqrtf(hop_energy_ / hop_energy_samples_);
+    hop_energy_ = 0;
+    hop_energy_samples_ = 0;
+
+    // Unroll the ring, the oldest sample sits at the write position
+    size_t tail = AUDIO_FFT_SAMPLES - ring_write_;
+    memcpy(frame_, ring_ + ring_write_, tail * sizeof(int32_t));
+    memcpy(frame_ + tail, ring_, ring_write_ * sizeof(int32_t));
+
+    return analyzeFrame();
+}
+
+uint8_t AudioPipeline::analyzeFrame()
+{
+    // Normalize and window the frame, then transform it
+    fft_.loadWindowed(frame_);
+    fft_.magnitudes(spectrum_);
+
+    bands_.addFrame(spectrum_);
+
+    bool onset = onsets_.addFrame(spectrum_);
+    bool beat = tempo_.addFrame(onsets_.flux(), onset);
+    return AUDIO_FRAME | (beat ? AUDIO_BEAT : 0);
+}
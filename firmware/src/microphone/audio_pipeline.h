@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "band_analyzer.h"
+#include "clap_detector.h"
+#include "decimator.h"
+#include "onset_detector.h"
+#include "real_fft.h"
+#include "real_fft_q15.h"
+#include "tempo_tracker.h"
+
+// SK_MICROPHONE_FIXED_POINT runs window, FFT and magnitudes in Q15 instead of float
+#if SK_MICROPHONE_FIXED_POINT
+typedef RealFftQ15 MicrophoneFft;
+#else
+typedef RealFft MicrophoneFft;
+#endif
+
+// Rate the microphone captures at, claps are found at this rate
+const uint32_t AUDIO_SAMPLE_RATE = 48000;
+// Nothing the analysis uses lies above ~7kHz, so the stream is decimated before it is framed.
+// At 16kHz a 1024 sample frame spans 64ms with 15.6Hz bins, three times finer than at 48kHz.
+const uint8_t AUDIO_DECIMATION = 3;
+const uint32_t AUDIO_ANALYSIS_RATE = AUDIO_SAMPLE_RATE / AUDIO_DECIMATION;
+// Largest block process() takes, in samples at AUDIO_SAMPLE_RATE
+const size_t AUDIO_MAX_BLOCK_SAMPLES = 256;
+
+// FFT frames in samples at AUDIO_ANALYSIS_RATE, they overlap by AUDIO_FFT_SAMPLES - AUDIO_HOP_SAMPLES
+const size_t AUDIO_FFT_SAMPLES = 1024;
+const size_t AUDIO_HOP_SAMPLES = AUDIO_FFT_SAMPLES / 4;
+
+// Band analysis, bins are mapped to bands once from AUDIO_ANALYSIS_RATE and AUDIO_FFT_SAMPLES.
+// With 75% overlap, AUDIO_WELCH_FRAMES = 4 averages the frames of the last 64ms.
+const uint8_t AUDIO_NUM_BANDS = 16;
+const BandScale AUDIO_BAND_SCALE = BAND_SCALE_LOG;
+const float AUDIO_BAND_MIN_HZ = 40;
+const float AUDIO_BAND_MAX_HZ = 7000;
+const uint8_t AUDIO_WELCH_FRAMES = 4;
+
+// What a block brought, bits of the value process() returns
+const uint8_t AUDIO_CLAP = 1 << 0;
+const uint8_t AUDIO_FRAME = 1 << 1;
+const uint8_t AUDIO_BEAT = 1 << 2;
+
+// Everything MicrophoneTask does with a block of samples short of publishing
+// the results: clap detection at the capture rate, decimation, a ring that
+// always holds the newest frame, and once per hop the FFT, bands, onsets
+// and tempo. No FreeRTOS or driver calls, so the native tests stream WAV
+// clips through the same code as the device.
+class AudioPipeline
+{
+public:
+    // Samples at AUDIO_SAMPLE_RATE, at most AUDIO_MAX_BLOCK_SAMPLES. Returns AUDIO_* bits.
+    uint8_t process(const int32_t *samples, size_t count);
+
+    // Samples already at AUDIO_ANALYSIS_RATE, any count; skips the clap detector and decimator.
+    // Returns AUDIO_FRAME and AUDIO_BEAT bits.
+    uint8_t processDecimated(const int32_t *samples, size_t count);
+
+    ClapDetector &claps() { return claps_; }
+    BandAnalyzer &bands() { return bands_; }
+    OnsetDetector &onsets() { return onsets_; }
+    TempoTracker &tempo() { return tempo_; }
+
+    // Newest frame, oldest sample first
+    const int32_t *frame() { return frame_; }
+    // Magnitudes of the newest frame, DC to Nyquist
+    const float *spectrum() { return spectrum_; }
+    // RMS of the samples the newest frame added, 1 is full scale
+    float frameRms() { return frame_rms_; }
+
+    // Frames analysed, and hops that arrived while a frame was still pending. Only the
+    // newest of those is analysed. Both count since construction.
+    uint32_t frames() { return frames_; }
+    uint32_t framesSkipped() { return frames_skipped_; }
+
+private:
+    ClapDetector claps_{AUDIO_SAMPLE_RATE};
+    Decimator<AUDIO_DECIMATION> decimator_;
+    int32_t decimated_[AUDIO_MAX_BLOCK_SAMPLES / AUDIO_DECIMATION + 1];
+
+    // Capture ring, always holds the newest AUDIO_FFT_SAMPLES samples
+    int32_t ring_[AUDIO_FFT_SAMPLES] = {};
+    size_t ring_write_ = 0;
+    size_t samples_since_frame_ = 0;
+    // Energy of the decimated samples since the last frame
+    float hop_energy_ = 0;
+    size_t hop_energy_samples_ = 0;
+
+    MicrophoneFft fft_{AUDIO_FFT_SAMPLES};
+    int32_t frame_[AUDIO_FFT_SAMPLES];
+    float spectrum_[AUDIO_FFT_SAMPLES / 2 + 1];
+    float frame_rms_ = 0;
+
+    BandAnalyzer bands_{{AUDIO_BAND_SCALE, AUDIO_NUM_BANDS, AUDIO_BAND_MIN_HZ, AUDIO_BAND_MAX_HZ, AUDIO_WELCH_FRAMES}, AUDIO_ANALYSIS_RATE, AUDIO_FFT_SAMPLES};
+    OnsetDetector onsets_{AUDIO_ANALYSIS_RATE, AUDIO_FFT_SAMPLES, AUDIO_HOP_SAMPLES};
+    TempoTracker tempo_{AUDIO_ANALYSIS_RATE, AUDIO_HOP_SAMPLES};
+
+    uint32_t frames_ = 0;
+    uint32_t frames_skipped_ = 0;
+
+    uint8_t analyzeFrame();
+};
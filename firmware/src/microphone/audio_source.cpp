@@ -0,0 +1,178 @@
+#include "audio_source.h"
+#include "../configuration.h"
+#include "esp_heap_caps.h"
+
+I2sAudioSource::I2sAudioSource(i2s_port_t port, uint32_t sample_rate, uint8_t dma_buf_count, uint16_t dma_buf_len) : port_(port),
+                                                                                                                 sample_rate_(sample_rate),
+                                                                                                                 dma_buf_count_(dma_buf_count),
+                                                                                                                 dma_buf_len_(dma_buf_len)
+{
+}
+
+I2sAudioSource::~I2sAudioSource()
+{
+    if (installed_)
+    {
+        i2s_driver_uninstall(port_);
+    }
+}
+
+bool I2sAudioSource::begin()
+{
+    // Configure I2S for the INMP441 microphone
+    i2s_config_t i2s_config = {
+        .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX),
+        .sample_rate = sample_rate_,
+        .bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT,
+        .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT, // INMP441 is mono
+        .communication_format = I2S_COMM_FORMAT_STAND_I2S,
+        .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
+        .dma_buf_count = dma_buf_count_,
+        .dma_buf_len = dma_buf_len_,
+        .use_apll = false,
+        .tx_desc_auto_clear = false,
+        .fixed_mclk = 0};
+
+    // Configure I2S pins
+    i2s_pin_config_t pin_config = {
+        .bck_io_num = PIN_MIC_SCK,
+        .ws_io_num = PIN_MIC_WS,
+        .data_out_num = I2S_PIN_NO_CHANGE,
+        .data_in_num = PIN_MIC_SD};
+
+    // The event queue reports DMA overflows
+    esp_err_t result = i2s_driver_install(port_, &i2s_config, 4, &events_);
+    if (result != ESP_OK)
+    {
+        LOGE("Failed to install I2S driver: %d", result);
+        return false;
+    }
+    installed_ = true;
+
+    result = i2s_set_pin(port_, &pin_config);
+    if (result != ESP_OK)
+    {
+        LOGE("Failed to set I2S pins: %d", result);
+        return false;
+    }
+
+    i2s_zero_dma_buffer(port_);
+    LOGI("I2S microphone streaming at %dHz", sample_rate_);
+    return true;
+}
+
+size_t I2sAudioSource::read(int32_t *samples, size_t count, TickType_t timeout)
+{
+    size_t bytes_read = 0;
+    if (i2s_read(port_, samples, count * sizeof(int32_t), &bytes_read, timeout) != ESP_OK)
+    {
+        return 0;
+    }
+
+    // The INMP441 sends 24 bits left aligned in a 32-bit slot
+    size_t samples_read = bytes_read / sizeof(int32_t);
+    for (size_t i = 0; i < samples_read; i++)
+    {
+        samples[i] >>= 8;
+    }
+    return samples_read;
+}
+
+uint32_t I2sAudioSource::overruns()
+{
+    i2s_event_t event;
+    while (events_ != nullptr && xQueueReceive(events_, &event, 0) == pdTRUE)
+    {
+        if (event.type == I2S_EVENT_RX_Q_OVF)
+        {
+            overruns_ += dma_buf_len_;
+        }
+    }
+    return overruns_;
+}
+
+WavAudioSource::WavAudioSource(const char *path, uint32_t sample_rate) : path_(path), sample_rate_(sample_rate)
+{
+}
+
+WavAudioSource::~WavAudioSource()
+{
+    heap_caps_free(file_);
+}
+
+bool WavAudioSource::begin()
+{
+    FatGuard fatGuard;
+    if (!fatGuard.mounted_)
+    {
+        return false;
+    }
+
+    File file = FFat.open(path_);
+    if (!file)
+    {
+        LOGE("Failed to open %s", path_);
+        return false;
+    }
+
+    size_t size = std::min<size_t>(file.size(), WAV_MAX_FILE_BYTES);
+    // Clips are up to megabytes, PSRAM is the place for them; a short one still fits in internal RAM without it
+    file_ = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (file_ == nullptr)
+    {
+        file_ = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (file_ == nullptr || file.read(file_, size) != size)
+    {
+        LOGE("Failed to load %d bytes from %s", size, path_);
+        heap_caps_free(file_);
+        file_ = nullptr;
+        file.close();
+        return false;
+    }
+    file.close();
+
+    if (!parseWav(path_, file_, size, &clip_))
+    {
+        return false;
+    }
+    if (clip_.sample_rate != sample_rate_)
+    {
+        LOGW("%s is %dHz, played as %dHz", path_, clip_.sample_rate, sample_rate_);
+    }
+
+    LOGI("Replaying %s, %d samples, %d bits", path_, clip_.num_samples, clip_.bytes_per_sample * 8);
+    next_block_due_us_ = micros();
+    return true;
+}
+
+size_t WavAudioSource::read(int32_t *samples, size_t count, TickType_t timeout)
+{
+    if (clip_.num_samples == 0)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        samples[i] = clip_.sampleAt(position_);
+        if (++position_ == clip_.num_samples)
+        {
+            position_ = 0;
+        }
+    }
+
+    // Return when the microphone would have delivered the block, never faster than real time
+    next_block_due_us_ += (uint64_t)count * 1000000 / sample_rate_;
+    int32_t wait_us = (int32_t)(next_block_due_us_ - micros());
+    if (wait_us > 1000)
+    {
+        vTaskDelay(pdMS_TO_TICKS(wait_us / 1000));
+    }
+    else if (wait_us < -100000)
+    {
+        // Fell far behind (debugger, long stall), don't try to catch up with a burst
+        next_block_due_us_ = micros();
+    }
+    return count;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Arduino.h>
+#include "driver/i2s.h"
+
+#include "wav_clip.h"
+
+// Where MicrophoneTask gets its samples from. Every source delivers signed
+// 24-bit mono samples, right aligned in an int32_t.
+class AudioSource
+{
+public:
+    virtual ~AudioSource() {}
+
+    virtual bool begin() = 0;
+
+    // Blocks until count samples are available or timeout expires, returns the number of samples read
+    virtual size_t read(int32_t *samples, size_t count, TickType_t timeout) = 0;
+
+    // Samples lost because read() was not called in time
+    virtual uint32_t overruns() = 0;
+};
+
+// INMP441 on the I2S peripheral, DMA fills the driver's buffers in the background
+class I2sAudioSource : public AudioSource
+{
+public:
+    I2sAudioSource(i2s_port_t port, uint32_t sample_rate, uint8_t dma_buf_count, uint16_t dma_buf_len);
+    ~I2sAudioSource();
+
+    bool begin() override;
+    size_t read(int32_t *samples, size_t count, TickType_t timeout) override;
+    uint32_t overruns() override;
+
+private:
+    i2s_port_t port_;
+    uint32_t sample_rate_;
+    uint8_t dma_buf_count_;
+    uint16_t dma_buf_len_;
+
+    bool installed_ = false;
+    QueueHandle_t events_ = nullptr;
+    // Every I2S_EVENT_RX_Q_OVF drops a whole DMA buffer
+    uint32_t overruns_ = 0;
+};
+
+// Largest file WavAudioSource loads, the whole file is kept in PSRAM
+const size_t WAV_MAX_FILE_BYTES = 4 * 1024 * 1024;
+
+// Replays a mono PCM WAV file from FFat in a loop, paced like the microphone
+// so the pipeline sees the same block timing as with I2S. Used to run the
+// audio analysis on known clips.
+class WavAudioSource : public AudioSource
+{
+public:
+    WavAudioSource(const char *path, uint32_t sample_rate);
+    ~WavAudioSource();
+
+    bool begin() override;
+    size_t read(int32_t *samples, size_t count, TickType_t timeout) override;
+    uint32_t overruns() override { return 0; }
+
+    // Number of samples in the clip, valid after begin()
+    size_t length() { return clip_.num_samples; }
+
+private:
+    const char *path_;
+    uint32_t sample_rate_;
+
+    uint8_t *file_ = nullptr;
+    WavClip clip_;
+    size_t position_ = 0;
+
+    // micros() at which the next block would have been complete on real hardware
+    uint32_t next_block_due_us_ = 0;
+};
@@ -0,0 +1,152 @@
+#include "band_analyzer.h"
+#include "../logging.h"
+
+static float hzToMel(float hz)
+{
+    return 2595.0f * log10f(1.0f + hz / 700.0f);
+}
+
+static float melToHz(float mel)
+{
+    return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f);
+}
+
+BandAnalyzer::BandAnalyzer(const BandAnalyzerConfig &config, uint32_t sample_rate, size_t fft_size) : welch_frames_(max<uint8_t>(1, config.welch_frames))
+{
+    size_t num_bins = fft_size / 2 + 1;
+    float bin_hz = (float)sample_rate / fft_size;
+    float max_hz = min(config.max_hz, sample_rate / 2.0f);
+    float min_hz = max(config.min_hz, bin_hz);
+
+    if (config.scale == BAND_SCALE_MEL)
+    {
+        // num_bands triangles need num_bands + 2 points, each triangle spans from its left to its right neighbour's center
+        float min_mel = hzToMel(min_hz);
+        float step = (hzToMel(max_hz) - min_mel) / (config.num_bands + 1);
+        for (uint8_t i = 0; i < config.num_bands; i++)
+        {
+            addBand(melToHz(min_mel + i * step), melToHz(min_mel + (i + 1) * step), melToHz(min_mel + (i + 2) * step), true, bin_hz, num_bins);
+        }
+    }
+    else
+    {
+        float ratio = powf(max_hz / min_hz, 1.0f / config.num_bands);
+        for (uint8_t i = 0; i < config.num_bands; i++)
+        {
+            float low = min_hz * powf(ratio, i);
+            float high = low * ratio;
+            addBand(low, sqrtf(low * high), high, false, bin_hz, num_bins);
+        }
+    }
+
+    history_.assign(welch_frames_ * bands_.size(), 0);
+    levels_.assign(bands_.size(), 0);
+}
+
+void BandAnalyzer::addBand(float low_hz, float center_hz, float high_hz, bool triangular, float bin_hz, size_t num_bins)
+{
+    Band band = {};
+    band.center_hz = center_hz;
+    band.weights = weights_.size();
+
+    size_t first = ceilf(low_hz / bin_hz);
+    size_t last = min<size_t>(num_bins - 1, (size_t)ceilf(high_hz / bin_hz) - 1);
+    if (first > last)
+    {
+        // Narrower than a bin, low bands at coarse resolution: use the bin nearest the center
+        first = last = min<size_t>(num_bins - 1, (size_t)lroundf(center_hz / bin_hz));
+    }
+
+    float total = 0;
+    for (size_t bin = first; bin <= last; bin++)
+    {
+        float hz = bin * bin_hz;
+        float weight = 1;
+        if (triangular)
+        {
+            weight = hz < center_hz ? (hz - low_hz) / (center_hz - low_hz) : (high_hz - hz) / (high_hz - center_hz);
+            weight = max(weight, 0.0f);
+        }
+        weights_.push_back(weight);
+        total += weight;
+    }
+
+    // Normalize so a band reports the mean power of its bins, whatever its width
+    if (total <= 0)
+    {
+        weights_.back() = 1;
+        total = 1;
+    }
+    for (size_t i = band.weights; i < weights_.size(); i++)
+    {
+        weights_[i] /= total;
+    }
+
+    band.first_bin = first;
+    band.num_bins = last - first + 1;
+    bands_.push_back(band);
+}
+
+void BandAnalyzer::addFrame(const float *magnitudes)
+{
+    const uint8_t num_bands = bands_.size();
+    float *powers = &history_[history_index_ * num_bands];
+    const float *weights = weights_.data();
+
+    for (uint8_t b = 0; b < num_bands; b++)
+    {
+        const Band &band = bands_[b];
+        const float *bins = magnitudes + band.first_bin;
+        const float *w = weights + band.weights;
+        float power = 0;
+        for (uint16_t i = 0; i < band.num_bins; i++)
+        {
+            power += w[i] * bins[i] * bins[i];
+        }
+        powers[b] = power;
+    }
+
+    history_index_ = (history_index_ + 1) % welch_frames_;
+    history_count_ = min<uint8_t>(history_count_ + 1, welch_frames_);
+
+    // Summing the short history again each frame avoids the drift of a running sum
+    for (uint8_t b = 0; b < num_bands; b++)
+    {
+        float sum = 0;
+        for (uint8_t f = 0; f < history_count_; f++)
+        {
+            sum += history_[f * num_bands + b];
+        }
+        levels_[b] = sqrtf(sum / history_count_);
+    }
+}
+
+void BandAnalyzer::benchmark(uint32_t sample_rate, size_t fft_size, uint16_t iterations)
+{
+    const BandAnalyzerConfig configs[] = {
+        {BAND_SCALE_LOG, 3, 40, 16000, 4},
+        {BAND_SCALE_LOG, 16, 40, 16000, 4},
+        {BAND_SCALE_MEL, 32, 40, 16000, 4},
+    };
+
+    std::vector<float> magnitudes(fft_size / 2 + 1);
+    for (size_t i = 0; i < magnitudes.size(); i++)
+    {
+        magnitudes[i] = random(1000) / 1000.0f;
+    }
+
+    for (const BandAnalyzerConfig &config : configs)
+    {
+        BandAnalyzer analyzer(config, sample_rate, fft_size);
+
+        unsigned long started_at = micros();
+        for (uint16_t i = 0; i < iterations; i++)
+        {
+            analyzer.addFrame(magnitudes.data());
+        }
+        unsigned long elapsed_us = micros() - started_at;
+
+        LOGI("Band analyzer %s, %d bands, %d bins covered: %.1fus per frame",
+             config.scale == BAND_SCALE_MEL ? "mel" : "log", analyzer.size(), analyzer.weights_.size(), (float)elapsed_us / iterations);
+    }
+}
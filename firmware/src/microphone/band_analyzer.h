@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <vector>
+
+enum BandScale
+{
+    // Geometric band edges, every band spans the same musical interval
+    BAND_SCALE_LOG = 0,
+    // Triangular filters spaced evenly on the mel scale
+    BAND_SCALE_MEL,
+};
+
+struct BandAnalyzerConfig
+{
+    BandScale scale;
+    uint8_t num_bands;
+    float min_hz;
+    float max_hz;
+    // Frames averaged per output (Welch), 1 disables averaging
+    uint8_t welch_frames;
+};
+
+// Folds FFT magnitude frames into a small number of perceptual bands.
+//
+// The bin to band weights are computed once from the sample rate and FFT
+// size; a frame then costs one multiply-add per covered bin. Band power is
+// averaged over the last welch_frames (overlapped) frames, which is Welch's
+// method applied after the filterbank, and reported as RMS magnitude so the
+// levels stay in the units of the FFT magnitudes.
+class BandAnalyzer
+{
+public:
+    BandAnalyzer(const BandAnalyzerConfig &config, uint32_t sample_rate, size_t fft_size);
+
+    uint8_t size() { return bands_.size(); }
+
+    // magnitudes holds fft_size / 2 + 1 bins, DC to Nyquist
+    void addFrame(const float *magnitudes);
+
+    // Averaged level per band, lowest band first
+    const float *levels() { return levels_.data(); }
+    float centerHz(uint8_t band) { return bands_[band].center_hz; }
+
+    // Times addFrame() for a few configurations and logs the per-frame cost
+    static void benchmark(uint32_t sample_rate, size_t fft_size, uint16_t iterations);
+
+private:
+    struct Band
+    {
+        uint16_t first_bin;
+        uint16_t num_bins;
+        // Offset of the band's first weight in weights_
+        uint16_t weights;
+        float center_hz;
+    };
+
+    std::vector<Band> bands_;
+    std::vector<float> weights_;
+
+    uint8_t welch_frames_;
+    // welch_frames_ rows of band powers, oldest overwritten first
+    std::vector<float> history_;
+    uint8_t history_index_ = 0;
+    uint8_t history_count_ = 0;
+
+    std::vector<float> levels_;
+
+    void addBand(float low_hz, float center_hz, float high_hz, bool triangular, float bin_hz, size_t num_bins);
+};
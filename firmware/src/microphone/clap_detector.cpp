@@ -0,0 +1,163 @@
+#include "clap_detector.h"
+#include "../logging.h"
+
+#include <vector>
+
+ClapDetector::ClapDetector(uint32_t sample_rate)
+{
+    max_attack_samples_ = sample_rate * CLAP_MAX_ATTACK_MS / 1000;
+    max_decay_samples_ = sample_rate * CLAP_MAX_DECAY_MS / 1000;
+    cooldown_samples_ = sample_rate * CLAP_COOLDOWN_MS / 1000;
+}
+
+void ClapDetector::reset()
+{
+    bass_ = 0;
+    previous_ = 0;
+    memset(lowpass_, 0, sizeof(lowpass_));
+    envelope_ = 0;
+    high_envelope_ = 0;
+    floor_ = 0;
+    phase_ = PHASE_IDLE;
+    sample_ = 0;
+    has_clap_ = false;
+}
+
+bool ClapDetector::process(const int32_t *samples, size_t count)
+{
+    bool detected = false;
+
+    for (size_t i = 0; i < count; i++, sample_++)
+    {
+        // 24-bit samples minus their bass fit in 25 bits, the first difference in 26, so do the low-passes
+        bass_ += (samples[i] - bass_) >> CLAP_BASS_SHIFT;
+        int32_t input = samples[i] - bass_;
+        int32_t difference = input - previous_;
+        previous_ = input;
+        int32_t band = difference;
+        for (uint8_t pole = 0; pole < CLAP_LOWPASS_POLES; pole++)
+        {
+            lowpass_[pole] += (band - lowpass_[pole]) >> CLAP_LOWPASS_SHIFT;
+            band = lowpass_[pole];
+        }
+        int32_t magnitude = band < 0 ? -band : band;
+        int32_t high = difference - lowpass_[0];
+        int32_t high_magnitude = high < 0 ? -high : high;
+
+        envelope_ += (magnitude - envelope_) >> (magnitude > envelope_ ? CLAP_ATTACK_SHIFT : CLAP_RELEASE_SHIFT);
+        high_envelope_ += (high_magnitude - high_envelope_) >> (high_magnitude > high_envelope_ ? CLAP_ATTACK_SHIFT : CLAP_RELEASE_SHIFT);
+
+        int32_t floor = floor_ >> CLAP_FLOOR_FRACTION_BITS;
+        switch (phase_)
+        {
+        case PHASE_IDLE:
+        {
+            int32_t trigger = max(floor << CLAP_TRIGGER_SHIFT, CLAP_MIN_LEVEL);
+            bool cooled_down = !has_clap_ || sample_ - last_clap_end_ >= cooldown_samples_;
+            if (envelope_ > trigger && cooled_down)
+            {
+                phase_ = PHASE_ATTACK;
+                start_ = sample_;
+                peak_ = envelope_;
+                peak_sample_ = sample_;
+                high_peak_ = high_envelope_;
+                break;
+            }
+            // The floor only learns from the background, never from a transient being judged
+            int32_t target = envelope_ << CLAP_FLOOR_FRACTION_BITS;
+            floor_ += (target - floor_) >> (target > floor_ ? CLAP_FLOOR_RISE_SHIFT : CLAP_FLOOR_FALL_SHIFT);
+            break;
+        }
+        case PHASE_ATTACK:
+        case PHASE_DECAY:
+            high_peak_ = max(high_peak_, high_envelope_);
+            if (envelope_ > peak_)
+            {
+                // Still rising, or a second peak: either way the attack must stay short
+                peak_ = envelope_;
+                peak_sample_ = sample_;
+                phase_ = sample_ - start_ > max_attack_samples_ ? PHASE_REJECTED : PHASE_ATTACK;
+            }
+            else if (envelope_ < peak_ >> CLAP_DECAY_SHIFT)
+            {
+                if ((int64_t)peak_ * CLAP_HIGH_RATIO < high_peak_)
+                {
+                    // Right shape, but treble only
+                    phase_ = PHASE_IDLE;
+                    break;
+                }
+                detected = true;
+                has_clap_ = true;
+                last_clap_start_ = start_;
+                last_clap_end_ = sample_;
+                last_clap_peak_ = peak_;
+                phase_ = PHASE_IDLE;
+            }
+            else if (sample_ - peak_sample_ > max_decay_samples_)
+            {
+                phase_ = PHASE_REJECTED;
+            }
+            else if (phase_ == PHASE_ATTACK && envelope_ < peak_ - (peak_ >> 2))
+            {
+                phase_ = PHASE_DECAY;
+            }
+            break;
+        case PHASE_REJECTED:
+        {
+            // Sustained sound, keep adapting so loud music raises the trigger
+            int32_t target = envelope_ << CLAP_FLOOR_FRACTION_BITS;
+            floor_ += (target - floor_) >> (target > floor_ ? CLAP_FLOOR_RISE_SHIFT : CLAP_FLOOR_FALL_SHIFT);
+            if (envelope_ < floor << 1)
+            {
+                phase_ = PHASE_IDLE;
+            }
+            break;
+        }
+        }
+    }
+
+    return detected;
+}
+
+void ClapDetector::benchmark(uint32_t sample_rate, uint16_t blocks)
+{
+    const size_t block = 256;
+    std::vector<int32_t> samples(block * blocks);
+
+    // Noise at about -50dBFS, a clap (noise burst with 1ms attack and 10ms decay) every half second
+    uint32_t clap_every = sample_rate / 2;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        int32_t noise = (int32_t)(seed >> 8) - (1 << 23);
+        uint32_t t = i % clap_every;
+        float shape = t < sample_rate / 1000 ? (float)t / (sample_rate / 1000) : expf(-(float)(t - sample_rate / 1000) / (sample_rate / 100));
+        samples[i] = noise / 300 + noise * 0.3f * shape;
+    }
+
+    ClapDetector detector(sample_rate);
+    uint32_t cycles = 0;
+    std::vector<uint32_t> clap_samples;
+    std::vector<int32_t> clap_peaks;
+    for (uint16_t b = 0; b < blocks; b++)
+    {
+        uint32_t started_at = ESP.getCycleCount();
+        bool clap = detector.process(samples.data() + b * block, block);
+        cycles += ESP.getCycleCount() - started_at;
+        if (clap)
+        {
+            clap_samples.push_back(detector.lastClapSample());
+            clap_peaks.push_back(detector.lastClapPeak());
+        }
+    }
+
+    LOGI("Clap detector: %.1f cycles per sample, %d of %d synthetic claps found, floor %d",
+         (float)cycles / samples.size(), clap_samples.size(), (samples.size() - 1) / clap_every + 1, detector.noiseFloor());
+    for (size_t i = 0; i < clap_samples.size(); i++)
+    {
+        // Claps start on multiples of clap_every, the offset is the detection latency of the trigger
+        uint32_t offset = clap_samples[i] % clap_every;
+        LOGI("  clap %d at %.1fms (+%.2fms), peak %d", i, clap_samples[i] * 1000.0f / sample_rate, offset * 1000.0f / sample_rate, clap_peaks[i]);
+    }
+}
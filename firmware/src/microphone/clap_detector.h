@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Input minus a one-pole low-pass (~500Hz at 48kHz), so kicks and bass lines barely raise the floor
+const uint8_t CLAP_BASS_SHIFT = 4;
+// Three one-pole low-passes after the first difference, together a band-pass of about 0.8-4kHz
+// peaking at 1.5kHz (at 48kHz). The treble is what the first low-pass removes.
+const uint8_t CLAP_LOWPASS_SHIFT = 2;
+const uint8_t CLAP_LOWPASS_POLES = 3;
+// Envelope time constants as shifts, per sample the envelope moves 1/2^shift of the way to the input.
+// At 48kHz: attack ~0.1ms, release ~2.7ms.
+const uint8_t CLAP_ATTACK_SHIFT = 2;
+const uint8_t CLAP_RELEASE_SHIFT = 7;
+// The noise floor follows the envelope between transients, rising slowly (~340ms) and falling faster (~21ms)
+const uint8_t CLAP_FLOOR_RISE_SHIFT = 14;
+const uint8_t CLAP_FLOOR_FALL_SHIFT = 10;
+// Fractional bits of the floor, so slow updates don't truncate to nothing
+const uint8_t CLAP_FLOOR_FRACTION_BITS = 6;
+// A transient starts 2^CLAP_TRIGGER_SHIFT (18dB) above the floor. CLAP_MIN_LEVEL only matters while
+// the floor is still being learned or the input is silent: it sits about 15dB above the band
+// envelope of -87dBFS microphone self-noise, so the floor does the work in any real room.
+const uint8_t CLAP_TRIGGER_SHIFT = 3;
+const int32_t CLAP_MIN_LEVEL = 1 << 6;
+// Shape of a clap: the envelope peaks within CLAP_MAX_ATTACK_MS of the trigger and then falls
+// below peak / 2^CLAP_DECAY_SHIFT (-12dB) within CLAP_MAX_DECAY_MS. Kicks, speech and
+// sustained notes take longer either way.
+const uint16_t CLAP_MAX_ATTACK_MS = 5;
+const uint16_t CLAP_MAX_DECAY_MS = 60;
+const uint8_t CLAP_DECAY_SHIFT = 2;
+// Minimum time between two detected claps
+const uint16_t CLAP_COOLDOWN_MS = 150;
+// Hi-hats are transients too, but with almost no energy in the band: a clap's band peak must reach
+// at least 1/CLAP_HIGH_RATIO of the treble peak. White noise bursts, the flattest a clap gets,
+// stay above 1/40 and hi-hats below 1/80.
+const int32_t CLAP_HIGH_RATIO = 50;
+
+// Streaming clap detector, integer math only.
+//
+// Works on a band-pass made of a bass cut, the first difference and three
+// one-pole low-passes: it keeps the 1-4kHz body of a clap and drops the
+// bass of music by 30-40dB and hi-hats by 10-15dB. The treble is followed
+// as well, to reject transients that have next to nothing in the band. An asymmetric
+// envelope follower (fast attack, quick release) tracks the band magnitude
+// and a much slower one tracks the noise floor, so the trigger level rises
+// with background music. A transient is only accepted as a clap if its
+// envelope has the shape of one; a few adds and shifts per sample.
+class ClapDetector
+{
+public:
+    ClapDetector(uint32_t sample_rate);
+
+    // Returns true if a clap was accepted in this block
+    bool process(const int32_t *samples, size_t count);
+
+    void reset();
+
+    // Sample index (counted since reset) where the last clap started, and its envelope peak
+    uint32_t lastClapSample() { return last_clap_start_; }
+    int32_t lastClapPeak() { return last_clap_peak_; }
+    // Current noise floor, in envelope units
+    int32_t noiseFloor() { return floor_ >> CLAP_FLOOR_FRACTION_BITS; }
+
+    // Times process() on synthetic claps over noise and logs cycles per sample
+    static void benchmark(uint32_t sample_rate, uint16_t blocks);
+
+private:
+    enum Phase
+    {
+        PHASE_IDLE,
+        PHASE_ATTACK,
+        PHASE_DECAY,
+        // Too slow to be a clap, wait until it dies down
+        PHASE_REJECTED,
+    };
+
+    uint32_t max_attack_samples_;
+    uint32_t max_decay_samples_;
+    uint32_t cooldown_samples_;
+
+    int32_t bass_ = 0;
+    int32_t previous_ = 0;
+    int32_t lowpass_[CLAP_LOWPASS_POLES] = {};
+    int32_t envelope_ = 0;
+    int32_t high_envelope_ = 0;
+    int32_t floor_ = 0;
+
+    Phase phase_ = PHASE_IDLE;
+    uint32_t sample_ = 0;
+    uint32_t start_ = 0;
+    uint32_t peak_sample_ = 0;
+    int32_t peak_ = 0;
+    int32_t high_peak_ = 0;
+
+    uint32_t last_clap_start_ = 0;
+    uint32_t last_clap_end_ = 0;
+    int32_t last_clap_peak_ = 0;
+    bool has_clap_ = false;
+};
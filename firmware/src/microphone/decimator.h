@@ -0,0 +1,214 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "../logging.h"
+
+#include <memory>
+#include <vector>
+
+// Filter length per output sample is DECIMATOR_TAPS_PER_PHASE * factor, so
+// every factor gets the same relative transition width and the same cost per
+// input sample.
+const size_t DECIMATOR_TAPS_PER_PHASE = 32;
+
+// Compile time generation of the anti-aliasing filters. The toolchain builds
+// with gnu++11, so every constexpr function is a single expression and the
+// trigonometry is a Taylor series.
+namespace decimator_design
+{
+    constexpr double PI_D = 3.14159265358979323846;
+
+    constexpr double cosSeries(double x2, double term, int n)
+    {
+        return n > 14 ? term : term + cosSeries(x2, -term * x2 / ((2 * n - 1) * (2 * n)), n + 1);
+    }
+
+    constexpr double wrap(double x)
+    {
+        return x - 2 * PI_D * (long long)(x / (2 * PI_D) + (x >= 0 ? 0.5 : -0.5));
+    }
+
+    constexpr double cosine(double x)
+    {
+        return cosSeries(wrap(x) * wrap(x), 1.0, 1);
+    }
+
+    constexpr double sine(double x)
+    {
+        return cosine(x - PI_D / 2);
+    }
+
+    // Blackman windowed sinc, cutoff in cycles per input sample
+    constexpr double tap(size_t n, size_t taps, double cutoff)
+    {
+        return (n * 2.0 == taps - 1.0 ? 2 * cutoff : sine(2 * PI_D * cutoff * (n - (taps - 1) / 2.0)) / (PI_D * (n - (taps - 1) / 2.0))) *
+               (0.42 - 0.5 * cosine(2 * PI_D * n / (taps - 1)) + 0.08 * cosine(4 * PI_D * n / (taps - 1)));
+    }
+
+    constexpr double tapSum(size_t n, size_t taps, double cutoff)
+    {
+        return n >= taps ? 0 : tap(n, taps, cutoff) + tapSum(n + 1, taps, cutoff);
+    }
+
+    template <size_t... I>
+    struct Indices
+    {
+    };
+
+    template <size_t N, size_t... I>
+    struct MakeIndices : MakeIndices<N - 1, N - 1, I...>
+    {
+    };
+
+    template <size_t... I>
+    struct MakeIndices<0, I...>
+    {
+        typedef Indices<I...> type;
+    };
+
+    // Cutoff at the output Nyquist frequency, normalized to unity gain at DC
+    template <uint8_t FACTOR, size_t TAPS, typename = typename MakeIndices<TAPS>::type>
+    struct Coefficients;
+
+    template <uint8_t FACTOR, size_t TAPS, size_t... I>
+    struct Coefficients<FACTOR, TAPS, Indices<I...>>
+    {
+        static constexpr double SUM = tapSum(0, TAPS, 0.5 / FACTOR);
+        static constexpr float values[TAPS] = {(float)(tap(I, TAPS, 0.5 / FACTOR) / SUM)...};
+    };
+
+    template <uint8_t FACTOR, size_t TAPS, size_t... I>
+    constexpr double Coefficients<FACTOR, TAPS, Indices<I...>>::SUM;
+
+    template <uint8_t FACTOR, size_t TAPS, size_t... I>
+    constexpr float Coefficients<FACTOR, TAPS, Indices<I...>>::values[TAPS];
+}
+
+// Polyphase FIR decimator for the microphone stream.
+//
+// Low-pass filters and keeps every FACTOR-th sample. Only the outputs that
+// are kept are computed, each one is the dot product of the filter with the
+// last TAPS inputs, which is the polyphase structure with its branches
+// summed in one pass: every input sample costs TAPS / FACTOR multiply-adds.
+// The delay line is stored twice in a row, so the dot product never wraps.
+//
+// The Blackman window gives about 74dB of stopband attenuation. The
+// transition band is centered on the output Nyquist frequency, so only its
+// upper part (roughly the top 15% of the output band) can carry aliases.
+// Blocks may have any length, the phase carries over between calls.
+template <uint8_t FACTOR>
+class Decimator
+{
+    static_assert(FACTOR >= 2 && FACTOR <= 4, "Decimator supports 2x, 3x and 4x");
+
+public:
+    static const size_t TAPS = DECIMATOR_TAPS_PER_PHASE * FACTOR;
+
+    // Writes at most count / FACTOR + 1 samples to out, returns how many
+    size_t process(const int32_t *in, size_t count, int32_t *out)
+    {
+        const float *h = decimator_design::Coefficients<FACTOR, TAPS>::values;
+        size_t produced = 0;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            float x = in[i];
+            history_[head_] = x;
+            history_[head_ + TAPS] = x;
+            head_ = head_ + 1 == TAPS ? 0 : head_ + 1;
+
+            if (++phase_ < FACTOR)
+            {
+                continue;
+            }
+            phase_ = 0;
+
+            // history_ + head_ holds the last TAPS samples, oldest first; the filter is symmetric
+            const float *x0 = history_ + head_;
+            float acc = 0;
+            for (size_t k = 0; k < TAPS; k++)
+            {
+                acc += h[k] * x0[k];
+            }
+            out[produced++] = lroundf(acc);
+        }
+        return produced;
+    }
+
+    void reset()
+    {
+        memset(history_, 0, sizeof(history_));
+        head_ = 0;
+        phase_ = 0;
+    }
+
+    // Measures the gain at a few frequencies around the output Nyquist and the cost per input sample, logs the results
+    static void benchmark(uint32_t sample_rate, uint16_t blocks)
+    {
+        const float output_nyquist = sample_rate / 2.0f / FACTOR;
+        // Fractions of the output Nyquist frequency, the first three must pass, the last three must be rejected
+        const float probes[] = {0.1f, 0.4f, 0.7f, 1.3f, 1.6f, 2.5f};
+        const float amplitude = 4000000;
+        const size_t settle = 4 * TAPS;
+        const size_t length = 4096;
+
+        // Off the stack, the microphone task runs this with a small one
+        std::unique_ptr<Decimator<FACTOR>> decimator(new Decimator<FACTOR>());
+        std::vector<int32_t> in(256);
+        std::vector<int32_t> out(256 / FACTOR + 1);
+
+        float worst_passband_db = 0;
+        float worst_stopband_db = -200;
+        for (float probe : probes)
+        {
+            decimator->reset();
+            double power = 0;
+            size_t measured = 0;
+            for (size_t start = 0; start < settle + length; start += 256)
+            {
+                for (size_t i = 0; i < 256; i++)
+                {
+                    in[i] = amplitude * sinf(2 * PI * probe * output_nyquist * (start + i) / sample_rate);
+                }
+                size_t produced = decimator->process(in.data(), 256, out.data());
+                if (start >= settle)
+                {
+                    for (size_t i = 0; i < produced; i++)
+                    {
+                        power += (double)out[i] * out[i];
+                    }
+                    measured += produced;
+                }
+            }
+
+            float gain_db = 10 * log10f(power / measured / (amplitude * amplitude / 2) + 1e-20f);
+            if (probe < 1)
+            {
+                worst_passband_db = min(worst_passband_db, gain_db);
+            }
+            else
+            {
+                worst_stopband_db = max(worst_stopband_db, gain_db);
+            }
+            LOGI("Decimator %dx: %.0fHz %s, gain %.1fdB", FACTOR, probe * output_nyquist, probe < 1 ? "passband" : "stopband", gain_db);
+        }
+
+        decimator->reset();
+        unsigned long started_at = micros();
+        for (uint16_t b = 0; b < blocks; b++)
+        {
+            decimator->process(in.data(), 256, out.data());
+        }
+        unsigned long elapsed_us = micros() - started_at;
+        float us_per_sample = (float)elapsed_us / blocks / 256;
+
+        LOGI("Decimator %dx, %d taps: passband %.2fdB, stopband %.1fdB, %.3fus per input sample, %.1f%% cpu at %dHz",
+             FACTOR, TAPS, worst_passband_db, worst_stopband_db, us_per_sample, us_per_sample * sample_rate / 10000, sample_rate);
+    }
+
+private:
+    float history_[2 * TAPS] = {};
+    size_t head_ = 0;
+    uint8_t phase_ = 0;
+};
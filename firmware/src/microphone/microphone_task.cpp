@@ -1,12 +1,8 @@
 #include "microphone_task.h"
+#include "../configuration.h"
 #include "semaphore_guard.h"
 #include "util.h"
 
-// Define the frequency bin arrays
-const uint16_t MicrophoneTask::LOW_BINS[NUM_LOW_BINS] = {0}; // ~30-90Hz
-const uint16_t MicrophoneTask::MID_BINS[NUM_MID_BINS] = {0};
-const uint16_t MicrophoneTask::HIGH_BINS[NUM_HIGH_BINS] = {0};
-
 MicrophoneTask::MicrophoneTask(const uint8_t task_core) : Task{"Mic", 1024 * 4, 1, task_core} // Higher priority (2) than Sensors (0)
 {
     mutex_ = xSemaphoreCreateMutex();
@@ -24,7 +20,7 @@ MicrophoneTask::~MicrophoneTask()
 
 void MicrophoneTask::run()
 {
-    LOGI("Microphone task started with I2S_NUM_1");
+    LOGI("Microphone task started");
 
     // Initialize microphone state
     microphone_state.clap_detected = false;
@@ -39,407 +35,162 @@ void MicrophoneTask::run()
 
     // Initialize timing
     last_fft_process_ms = millis();
-    last_microphone_check_ms = millis();
-
-    // Try initializing the microphone with error handling
-    bool mic_initialized = false;
-
-    // Configure I2S for the INMP441 microphone
-    i2s_config_t i2s_config = {
-        .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX),
-        .sample_rate = SAMPLE_RATE,
-        .bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT,
-        .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT,
-        .communication_format = I2S_COMM_FORMAT_STAND_I2S,
-        .intr_alloc_flags = ESP_INTR_FLAG_LEVEL3,
-        .dma_buf_count = DMA_BUF_COUNT,
-        .dma_buf_len = DMA_BUF_LEN,
-        .use_apll = false,
-        .tx_desc_auto_clear = false,
-        .fixed_mclk = 0};
-
-    // Configure I2S pins
-    i2s_pin_config_t pin_config = {
-        .bck_io_num = PIN_MIC_SCK,
-        .ws_io_num = PIN_MIC_WS,
-        .data_out_num = I2S_PIN_NO_CHANGE,
-        .data_in_num = PIN_MIC_SD};
-
-    // Install and configure I2S driver
-    LOGI("About to install I2S_NUM_0 driver");
-    esp_err_t result = i2s_driver_install(I2S_PORT, &i2s_config, 0, NULL);
-    if (result != ESP_OK)
-    {
-        LOGE("Failed to install I2S driver: %d", result);
-    }
-    else
+
+#if SK_MICROPHONE_BENCHMARK
+    RealFft::benchmark(AUDIO_FFT_SAMPLES, 100);
+    RealFftQ15::benchmark(AUDIO_FFT_SAMPLES, 100);
+    Decimator<2>::benchmark(AUDIO_SAMPLE_RATE, 1000);
+    Decimator<3>::benchmark(AUDIO_SAMPLE_RATE, 1000);
+    Decimator<4>::benchmark(AUDIO_SAMPLE_RATE, 1000);
+    BandAnalyzer::benchmark(AUDIO_ANALYSIS_RATE, AUDIO_FFT_SAMPLES, 1000);
+    TempoTracker::benchmark(AUDIO_ANALYSIS_RATE, AUDIO_HOP_SAMPLES, 20);
+    ClapDetector::benchmark(AUDIO_SAMPLE_RATE, 400);
+#endif
+
+#if SK_MICROPHONE_SIMULATION
+    runSimulation();
+#endif
+
+#if SK_MICROPHONE_WAV
+    WavAudioSource source(WAV_PATH, AUDIO_SAMPLE_RATE);
+#else
+    I2sAudioSource source(I2S_PORT, AUDIO_SAMPLE_RATE, DMA_BUF_COUNT, DMA_BUF_LEN);
+#endif
+
+    if (!source.begin())
     {
-        LOGI("I2S driver installed successfully");
-
-        // LOGI("About to set I2S pins");
-        // result = i2s_set_pin(I2S_PORT, &pin_config);
-        // if (result != ESP_OK)
-        // {
-        //     LOGE("Failed to set I2S pins: %d", result);
-        //     i2s_driver_uninstall(I2S_PORT);
-        // }
-        // else
-        // {
-        //     mic_initialized = true;
-        //     LOGI("I2S driver fully initialized successfully");
-        // }
+        LOGE("Microphone unavailable, publishing silence");
+        while (1)
+        {
+            publishState(microphone_state);
+            vTaskDelay(pdMS_TO_TICKS(1000));
+        }
     }
 
-    // Main loop
+    stream(source);
+}
+
+void MicrophoneTask::stream(AudioSource &source)
+{
+    window_started_us_ = micros();
+    window_overruns_base_ = source.overruns();
+    window_skipped_base_ = m_pipeline.framesSkipped();
+
     while (1)
     {
-        if (mic_initialized)
+        // Blocks until DMA filled a whole block, the task sleeps in between
+        size_t count = source.read(m_block, READ_BLOCK_SAMPLES, pdMS_TO_TICKS(READ_TIMEOUT_MS));
+        unsigned long started_us = micros();
+        if (count > 0)
         {
-            LOGI("I2S_NUM_0 driver is active");
+            frame_captured_us = started_us;
+            processBlock(m_block, count);
         }
-        else
+
+        // Double claps go out as events, RootTask doesn't act on them
+        if (microphone_state.double_clap_detected)
         {
-            // LOGI("Running without I2S initialized");
+            LOGI("Double clap detected in microphone task!");
+
+            WiFiEvent event;
+            event.type = SK_DOUBLE_CLAP_DETECTED;
+            event.body.clap_count = 2;
+            publishEvent(event);
+
+            microphone_state.double_clap_detected = false;
         }
 
-        // Publish the state every second
-        publishState(microphone_state);
-        vTaskDelay(pdMS_TO_TICKS(1000));
+        recordBlock(source, count, micros() - started_us);
     }
 }
 
-// void MicrophoneTask::run() //simulated, also works
-// {
-//     LOGI("Microphone task started in simulation mode");
-
-//     // Initialize microphone state
-//     microphone_state.clap_detected = false;
-//     microphone_state.double_clap_detected = false;
-//     microphone_state.last_clap_time = 0;
-//     microphone_state.clap_count = 0;
-
-//     // Initialize FFT data
-//     microphone_state.fft_low_band = 0.0f;
-//     microphone_state.fft_mid_band = 0.0f;
-//     microphone_state.fft_high_band = 0.0f;
-
-//     // Initialize timing
-//     last_fft_process_ms = millis();
-//     last_microphone_check_ms = millis();
-
-//     // Initialize FFT arrays without actually using I2S
-//     for (size_t i = 0; i < FFT_SAMPLES; i++)
-//     {
-//         m_realComponent[i] = 0.0f;
-//         m_imagComponent[i] = 0.0f;
-//         m_rawSamples[i] = 0;
-//     }
-
-//     // Initialize magnitudes arrays
-//     for (size_t i = 0; i < NUM_TOTAL_BINS; i++)
-//     {
-//         m_magnitudes[i] = 0.0f;
-//         m_peaks[i] = 0.0f;
-//     }
-
-//     // Generate some simulated data for bands
-//     bool increasing = true;
-//     float level = 0.0f;
-
-//     // Main loop
-//     while (1)
-//     {
-//         // Simulate microphone data
-//         if (increasing)
-//         {
-//             level += 0.01f;
-//             if (level > 0.5f)
-//                 increasing = false;
-//         }
-//         else
-//         {
-//             level -= 0.01f;
-//             if (level < 0.01f)
-//                 increasing = true;
-//         }
-
-//         // Set simulated band levels
-//         microphone_state.fft_low_band = level;
-//         microphone_state.fft_mid_band = level * 0.7f;
-//         microphone_state.fft_high_band = level * 0.3f;
-
-//         // Occasionally simulate a clap (every 10 seconds)
-//         unsigned long now = millis();
-//         if (now % 10000 < 100 && now - last_clap_end_time > 2000)
-//         {
-//             microphone_state.clap_detected = true;
-//             last_clap_end_time = now;
-//             LOGD("Simulated clap detected!");
-
-//             // Simulate double clap occasionally
-//             if (microphone_state.clap_count > 0 && now - microphone_state.last_clap_time < CLAP_TIMEOUT_MS)
-//             {
-//                 microphone_state.clap_count++;
-//                 LOGD("Simulated consecutive clap! Count: %d", microphone_state.clap_count);
-
-//                 if (microphone_state.clap_count >= 2)
-//                 {
-//                     microphone_state.double_clap_detected = true;
-
-//                     // Generate an event for the double clap
-//                     WiFiEvent event;
-//                     event.type = SK_DOUBLE_CLAP_DETECTED;
-//                     event.body.clap_count = 2;
-//                     publishEvent(event);
-
-//                     // Reset counter after detecting pattern
-//                     microphone_state.clap_count = 0;
-//                     microphone_state.double_clap_detected = false;
-//                 }
-//             }
-//             else
-//             {
-//                 microphone_state.clap_count = 1;
-//             }
-
-//             microphone_state.last_clap_time = now;
-//         }
-//         else
-//         {
-//             microphone_state.clap_detected = false;
-//         }
-
-//         // Log data periodically (every second)
-//         static unsigned long last_log_time = 0;
-//         if (millis() - last_log_time > 1000)
-//         {
-//             LOGD("Simulated FFT Bands - Low: %.2f, Mid: %.2f, High: %.2f",
-//                  microphone_state.fft_low_band,
-//                  microphone_state.fft_mid_band,
-//                  microphone_state.fft_high_band);
-//             last_log_time = millis();
-//         }
-
-//         // Publish state every 100ms
-//         publishState(microphone_state);
-//         vTaskDelay(pdMS_TO_TICKS(100));
-//     }
-// }
-
-// void MicrophoneTask::run() // this works
-// {
-//     LOGI("Microphone task started");
-
-//     // Initialize microphone state
-//     microphone_state.clap_detected = false;
-//     microphone_state.double_clap_detected = false;
-//     microphone_state.last_clap_time = 0;
-//     microphone_state.clap_count = 0;
-
-//     // Initialize FFT data
-//     microphone_state.fft_low_band = 0.0f;
-//     microphone_state.fft_mid_band = 0.0f;
-//     microphone_state.fft_high_band = 0.0f;
-
-//     // Initialize timing
-//     last_fft_process_ms = millis();
-//     last_microphone_check_ms = millis();
-
-//     // Do nothing but publish empty/zero state periodically
-//     while (1)
-//     {
-//         // Publish the blank state every second
-//         publishState(microphone_state);
-//         vTaskDelay(pdMS_TO_TICKS(1000));
-//     }
-// }
-// void MicrophoneTask::run()
-// {
-//     // Initialize the microphone
-//     // initMicrophone();
-//     LOGI("INMP441 microphone initialized in separate task");
-
-//     // Initialize microphone state
-//     microphone_state.clap_detected = false;
-//     microphone_state.double_clap_detected = false;
-//     microphone_state.last_clap_time = 0;
-//     microphone_state.clap_count = 0;
-
-//     // Initialize FFT data
-//     microphone_state.fft_low_band = 0.0f;
-//     microphone_state.fft_mid_band = 0.0f;
-//     microphone_state.fft_high_band = 0.0f;
-
-//     // Initialize timing
-//     last_fft_process_ms = millis();
-//     last_microphone_check_ms = millis();
-
-//     // Main task loop
-//     const uint8_t microphone_polling_rate_hz = 40; // Higher rate for detecting claps
-
-//     // while (1)
-//     // {
-//     //     // Process microphone data on regular intervals
-//     //     if (millis() - last_microphone_check_ms > 1000 / microphone_polling_rate_hz)
-//     //     {
-//     //         processMicrophoneData();
-//     //         last_microphone_check_ms = millis();
-//     //     }
-
-//     //     // Check if double clap was detected and publish event
-//     //     if (microphone_state.double_clap_detected)
-//     //     {
-//     //         LOGI("Double clap detected in microphone task!");
-
-//     //         // Generate an event for the double clap
-//     //         WiFiEvent event;
-//     //         event.type = SK_DOUBLE_CLAP_DETECTED;
-//     //         event.body.clap_count = 2;
-//     //         publishEvent(event);
-
-//     //         // Reset the flag after publishing event
-//     //         microphone_state.double_clap_detected = false;
-//     //     }
-
-//     //     delay(5); // Short delay to prevent task from consuming too much CPU
-//     // }
-// }
-
-void MicrophoneTask::initMicrophone()
+void MicrophoneTask::processBlock(int32_t *samples, size_t count)
 {
-    // Configure I2S for the INMP441 microphone
-    i2s_config_t i2s_config = {
-        .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX),
-        .sample_rate = SAMPLE_RATE,
-        .bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT,
-        .channel_format = I2S_CHANNEL_FMT_ONLY_LEFT, // INMP441 is mono
-        .communication_format = I2S_COMM_FORMAT_STAND_I2S,
-        .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-        .dma_buf_count = DMA_BUF_COUNT,
-        .dma_buf_len = DMA_BUF_LEN,
-        .use_apll = false,
-        .tx_desc_auto_clear = false,
-        .fixed_mclk = 0};
-
-    // Configure I2S pins
-    i2s_pin_config_t pin_config = {
-        .bck_io_num = PIN_MIC_SCK,
-        .ws_io_num = PIN_MIC_WS,
-        .data_out_num = I2S_PIN_NO_CHANGE,
-        .data_in_num = PIN_MIC_SD};
-
-    // Install and configure I2S driver
-    esp_err_t result = i2s_driver_install(I2S_PORT, &i2s_config, 0, NULL);
-    if (result != ESP_OK)
-    {
-        LOGE("Failed to install I2S driver: %d", result);
-        return;
-    }
+    uint8_t events = m_pipeline.process(samples, count);
 
-    result = i2s_set_pin(I2S_PORT, &pin_config);
-    if (result != ESP_OK)
+    if (events & AUDIO_CLAP)
     {
-        LOGE("Failed to set I2S pins: %d", result);
-        return;
+        microphone_state.clap_detected = true;
+        LOGD("Clap detected! Peak %d, floor %d", m_pipeline.claps().lastClapPeak(), m_pipeline.claps().noiseFloor());
+        processClap();
     }
 
-    // Initialize FFT arrays
-    for (size_t i = 0; i < FFT_SAMPLES; i++)
+    if (!(events & AUDIO_FRAME))
     {
-        m_realComponent[i] = 0.0f;
-        m_imagComponent[i] = 0.0f;
-        m_rawSamples[i] = 0;
+        return;
     }
+    window_.frames++;
+    frame_rms = m_pipeline.frameRms();
 
-    // Initialize magnitudes arrays
-    for (size_t i = 0; i < NUM_TOTAL_BINS; i++)
+    if (events & AUDIO_BEAT)
     {
-        m_magnitudes[i] = 0.0f;
-        m_peaks[i] = 0.0f;
+        processBeat();
     }
-
-    LOGI("I2S driver and FFT analyzer initialized successfully");
+    processFrame();
 }
 
-void MicrophoneTask::processMicrophoneData()
+void MicrophoneTask::recordBlock(AudioSource &source, size_t count, unsigned long block_us)
 {
-    // Buffer to store audio samples
-    int32_t samples[DMA_BUF_LEN];
-    size_t bytes_read = 0;
-
-    // Read samples from I2S
-    esp_err_t result = i2s_read(I2S_PORT, samples, sizeof(samples), &bytes_read, 0);
-    if (result != ESP_OK)
-    {
-        // Handle error
-        return;
-    }
-
-    // Process samples to detect claps
-    size_t samples_read = bytes_read / sizeof(int32_t);
-    if (detectClap(samples, samples_read))
+    if (count == 0)
     {
-        processClap();
+        window_.read_timeouts++;
     }
-
-    // Add samples to our FFT buffer
-    for (size_t i = 0; i < samples_read && i < FFT_SAMPLES; i++)
+    else
     {
-        // Shift existing samples
-        if (i + samples_read < FFT_SAMPLES)
+        window_.blocks++;
+        window_.samples += count;
+        window_busy_us_ += block_us;
+        if (block_us > window_.max_block_us)
         {
-            m_rawSamples[i] = m_rawSamples[i + samples_read];
-        }
-        else
-        {
-            // Add new samples at the end
-            m_rawSamples[i] = samples[i - (FFT_SAMPLES - samples_read)];
+            window_.max_block_us = block_us;
         }
     }
 
-    // Process FFT periodically
-    if (millis() - last_fft_process_ms > FFT_PERIOD_MS)
+    unsigned long elapsed_us = micros() - window_started_us_;
+    if (elapsed_us < STATS_INTERVAL_MS * 1000)
     {
-        processAudioFFT();
-        last_fft_process_ms = millis();
+        return;
     }
-}
-
-void MicrophoneTask::processAudioFFT()
-{
-    // Get magnitudes from FFT
-    getMagnitudes(m_magnitudes);
 
-    // Calculate band averages
-    float low_band_sum = 0;
-    float mid_band_sum = 0;
-    float high_band_sum = 0;
+    uint32_t overruns = source.overruns();
+    uint32_t skipped = m_pipeline.framesSkipped();
+    window_.overruns = overruns - window_overruns_base_;
+    window_.frames_skipped = skipped - window_skipped_base_;
+    window_.avg_block_us = window_.blocks > 0 ? window_busy_us_ / window_.blocks : 0;
+    window_.cpu_permille = (window_busy_us_ * 1000) / elapsed_us;
 
-    // Process low frequency band
-    for (size_t i = 0; i < NUM_LOW_BINS; i++)
     {
-        low_band_sum += m_magnitudes[i];
+        SemaphoreGuard lock(mutex_);
+        stats_ = window_;
     }
 
-    // Process mid frequency band
-    for (size_t i = 0; i < NUM_MID_BINS; i++)
-    {
-        mid_band_sum += m_magnitudes[NUM_LOW_BINS + i];
-    }
+    LOGD("Mic: %d samples, %d frames (%d skipped), %d overrun, %d timeouts, block avg %dus max %dus, cpu %d.%d%%",
+         window_.samples, window_.frames, window_.frames_skipped, window_.overruns, window_.read_timeouts,
+         window_.avg_block_us, window_.max_block_us, window_.cpu_permille / 10, window_.cpu_permille % 10);
 
-    // Process high frequency band
-    for (size_t i = 0; i < NUM_HIGH_BINS; i++)
-    {
-        high_band_sum += m_magnitudes[NUM_LOW_BINS + NUM_MID_BINS + i];
-    }
+    window_ = {};
+    window_busy_us_ = 0;
+    window_overruns_base_ = overruns;
+    window_skipped_base_ = skipped;
+    window_started_us_ = micros();
+}
 
-    // Calculate averages
-    microphone_state.fft_low_band = NUM_LOW_BINS > 0 ? low_band_sum / NUM_LOW_BINS : 0;
-    microphone_state.fft_mid_band = NUM_MID_BINS > 0 ? mid_band_sum / NUM_MID_BINS : 0;
-    microphone_state.fft_high_band = NUM_HIGH_BINS > 0 ? high_band_sum / NUM_HIGH_BINS : 0;
+MicrophoneStats MicrophoneTask::getStats()
+{
+    SemaphoreGuard lock(mutex_);
+    return stats_;
+}
 
-    // Process peaks for visualization or other features
-    getMaxMagnitudes(m_peaks);
+void MicrophoneTask::processFrame()
+{
+    // The coarse low/mid/high summary is the mean of each third of the bands
+    const float *levels = m_pipeline.bands().levels();
+    uint8_t third = AUDIO_NUM_BANDS / 3;
+    microphone_state.fft_low_band = averageBands(levels, 0, third);
+    microphone_state.fft_mid_band = averageBands(levels, third, AUDIO_NUM_BANDS - third);
+    microphone_state.fft_high_band = averageBands(levels, AUDIO_NUM_BANDS - third, AUDIO_NUM_BANDS);
+
+    publishBands(levels, AUDIO_NUM_BANDS);
 
     // Log data periodically (every second) for debugging
     static unsigned long last_log_time = 0;
@@ -452,104 +203,119 @@ void MicrophoneTask::processAudioFFT()
         last_log_time = millis();
     }
 
-    // Publish updated state with FFT data
-    publishState(microphone_state);
+    // Frames arrive every hop, the state listeners only need a coarse update
+    if (millis() - last_fft_process_ms > FFT_PERIOD_MS)
+    {
+        publishState(microphone_state);
+        last_fft_process_ms = millis();
+    }
 }
 
-void MicrophoneTask::convertSamplesToReal(int32_t *samples, size_t count)
+float MicrophoneTask::averageBands(const float *levels, uint8_t from, uint8_t to)
 {
-    for (size_t idx = 0; idx < count && idx < FFT_SAMPLES; idx++)
+    float sum = 0;
+    for (uint8_t i = from; i < to; i++)
     {
-        // Convert and normalize audio samples
-        m_realComponent[idx] = static_cast<float>(samples[idx]) * NORMALIZE_24BIT;
-        m_imagComponent[idx] = 0.0f;
-
-        // Apply Hamming window function to reduce spectral leakage
-        float multiplier = 0.5f * (1.0f - cos(2.0f * M_PI * idx / (FFT_SAMPLES - 1)));
-        m_realComponent[idx] *= multiplier;
+        sum += levels[i];
     }
+    return to > from ? sum / (to - from) : 0;
 }
 
-void MicrophoneTask::getMagnitudes(float *outMagnitudes)
+void MicrophoneTask::processBeat()
 {
-    // Convert raw samples to real/imaginary components for FFT
-    convertSamplesToReal(m_rawSamples, FFT_SAMPLES);
-
-    // Perform FFT processing
-    m_FFT.compute(m_realComponent, m_imagComponent, FFT_SAMPLES, FFT_FORWARD);
-    m_FFT.complexToMagnitude(m_realComponent, m_imagComponent, FFT_SAMPLES);
-
-    // Extract specific frequency bins
-    size_t lowIdx = 0;
-    size_t midIdx = NUM_LOW_BINS;
-    size_t highIdx = NUM_LOW_BINS + NUM_MID_BINS;
+    beat_count++;
+    beat_strength = m_pipeline.onsets().strength();
+    beat_bpm = m_pipeline.tempo().bpm();
 
-    for (size_t idx = 0; idx < NUM_LOW_BINS; idx++)
-    {
-        outMagnitudes[idx] = m_realComponent[LOW_BINS[idx]];
-    }
-    for (size_t idx = 0; idx < NUM_MID_BINS; idx++)
+    // Until a tempo is found beats are plain onsets, the apps only hear about tracked ones
+    if (beat_bpm > 0)
     {
-        outMagnitudes[midIdx + idx] = m_realComponent[MID_BINS[idx]];
-    }
-    for (size_t idx = 0; idx < NUM_HIGH_BINS; idx++)
-    {
-        outMagnitudes[highIdx + idx] = m_realComponent[HIGH_BINS[idx]];
+        publishBeat(beat_bpm, m_pipeline.tempo().confidence());
     }
 }
 
-void MicrophoneTask::getMaxMagnitudes(float *outPeaks)
+void MicrophoneTask::publishBeat(float bpm, float confidence)
 {
-    // This tracks peak values over time with decay
-    for (size_t i = 0; i < NUM_TOTAL_BINS; i++)
-    {
-        if (m_magnitudes[i] > outPeaks[i])
-        {
-            outPeaks[i] = m_magnitudes[i];
-        }
-        else
-        {
-            // Gradual decay of peaks
-            outPeaks[i] *= 0.95f;
-        }
-    }
+    WiFiEvent event;
+    event.type = SK_MUSIC_BEAT;
+    event.body.music_beat = {
+        .bpm = bpm,
+        .confidence = confidence,
+        .strength = beat_strength,
+        .beat_count = beat_count,
+    };
+    publishEvent(event);
+}
+
+void MicrophoneTask::publishBands(const float *levels, uint8_t num_bands)
+{
+    AudioBands bands = {
+        .low = microphone_state.fft_low_band,
+        .mid = microphone_state.fft_mid_band,
+        .high = microphone_state.fft_high_band,
+        .beat_count = beat_count,
+        .beat_strength = beat_strength,
+        .bpm = beat_bpm,
+        .rms = frame_rms,
+        .captured_us = frame_captured_us,
+    };
+    bands.num_bands = min<uint8_t>(num_bands, AUDIO_MAX_BANDS);
+    memcpy(bands.bands, levels, bands.num_bands * sizeof(float));
+    bands.published_us = micros();
+    AudioBandsChannel::getInstance().publish(bands);
+    AudioFeatureStream::getInstance().addFrame(bands);
 }
 
-bool MicrophoneTask::detectClap(int32_t *samples, size_t samples_len)
+#if SK_MICROPHONE_SIMULATION
+void MicrophoneTask::runSimulation()
 {
-    // Look for high amplitude peak followed by silence
-    bool high_amplitude_detected = false;
-    int32_t peak_amplitude = 0;
+    LOGI("Microphone task running on simulated bands");
 
-    // Find peak amplitude in the buffer
-    for (size_t i = 0; i < samples_len; i++)
+    TickType_t last_wake = xTaskGetTickCount();
+    unsigned long last_phase_ms = 0;
+    while (1)
     {
-        // Convert from 32-bit sample to absolute amplitude
-        int32_t amplitude = abs(samples[i] >> 16); // Shift to get 16-bit value
+        frame_captured_us = micros();
 
-        if (amplitude > peak_amplitude)
+        // Kick decays over 100ms after each beat, mids and highs wobble slowly
+        unsigned long phase_ms = millis() % SIMULATION_BEAT_MS;
+        if (phase_ms < last_phase_ms)
+        {
+            beat_count++;
+            beat_strength = 1;
+            beat_bpm = 60000.0f / SIMULATION_BEAT_MS;
+            publishBeat(beat_bpm, 1);
+        }
+        last_phase_ms = phase_ms;
+        float kick = phase_ms < 100 ? 1.0f - phase_ms / 100.0f : 0;
+        float wobble = 0.5f + 0.5f * sinf(millis() * 0.002f);
+
+        microphone_state.fft_low_band = 0.05f + 0.5f * kick;
+        microphone_state.fft_mid_band = 0.05f + 0.1f * wobble;
+        microphone_state.fft_high_band = 0.02f + 0.05f * (1 - wobble);
+        frame_rms = 0.01f + 0.2f * kick;
+
+        // Every band follows the coarse band of its third
+        float levels[AUDIO_NUM_BANDS];
+        for (uint8_t i = 0; i < AUDIO_NUM_BANDS; i++)
         {
-            peak_amplitude = amplitude;
+            levels[i] = i < AUDIO_NUM_BANDS / 3 ? microphone_state.fft_low_band : i < AUDIO_NUM_BANDS - AUDIO_NUM_BANDS / 3 ? microphone_state.fft_mid_band
+                                                                                                                            : microphone_state.fft_high_band;
         }
 
-        // Check if amplitude exceeds threshold
-        if (amplitude > CLAP_THRESHOLD)
+        publishBands(levels, AUDIO_NUM_BANDS);
+
+        // RootTask only needs the coarse state to pick the LED effect
+        if (millis() - last_fft_process_ms > FFT_PERIOD_MS)
         {
-            high_amplitude_detected = true;
+            publishState(microphone_state);
+            last_fft_process_ms = millis();
         }
-    }
 
-    // Only detect a clap if we've waited for the cooldown period since the last clap
-    if (high_amplitude_detected && millis() - last_clap_end_time > CLAP_COOLDOWN_MS)
-    {
-        microphone_state.clap_detected = true;
-        last_clap_end_time = millis();
-        LOGD("Clap detected! Peak amplitude: %d", peak_amplitude);
-        return true;
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(SIMULATION_HOP_MS));
     }
-
-    return false;
 }
+#endif
 
 void MicrophoneTask::processClap()
 {
@@ -601,7 +367,8 @@ void MicrophoneTask::publishState(const MicrophoneState &state)
 {
     for (auto listener : state_listeners_)
     {
-        xQueueSend(listener, &state, portMAX_DELAY);
+        // Never stall the capture loop on a slow listener, it gets the next update
+        xQueueSend(listener, &state, 0);
     }
 }
 
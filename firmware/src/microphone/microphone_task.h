@@ -3,10 +3,30 @@
 #include "logger.h"
 #include "task.h"
 #include "app_config.h"
+#include "audio_bands.h"
+#include "audio_feature_stream.h"
+#include "audio_pipeline.h"
+#include "audio_source.h"
 #include "driver/i2s.h"
-#include <arduinoFFT.h>
 #include <vector>
 
+// Running totals of the capture pipeline over one stats window
+struct MicrophoneStats
+{
+    uint32_t blocks;
+    uint32_t samples;
+    uint32_t frames;
+    // Hops that arrived while a frame was still pending, only the newest is analysed
+    uint32_t frames_skipped;
+    // Samples the source dropped because the task did not read in time
+    uint32_t overruns;
+    uint32_t read_timeouts;
+    uint32_t avg_block_us;
+    uint32_t max_block_us;
+    // Share of the task's wall time spent processing, in 0.1%
+    uint16_t cpu_permille;
+};
+
 class MicrophoneTask : public Task<MicrophoneTask>
 {
     friend class Task<MicrophoneTask>;
@@ -22,66 +42,77 @@ public:
     void setSharedEventsQueue(QueueHandle_t shared_events_queue);
     void publishEvent(WiFiEvent event);
 
+    // Counters of the last completed stats window
+    MicrophoneStats getStats();
+
 protected:
     void run();
 
 private:
-    // I2S microphone configuration
+    // I2S microphone configuration, the sample rate and analysis are set up in audio_pipeline.h
     static const i2s_port_t I2S_PORT = I2S_NUM_0;
-    static constexpr size_t SAMPLE_RATE = 48000;
     static constexpr size_t SAMPLE_BITS = 32;
-    static constexpr size_t DMA_BUF_LEN = 1024;
+    static constexpr size_t DMA_BUF_LEN = AUDIO_MAX_BLOCK_SAMPLES;
     static constexpr size_t DMA_BUF_COUNT = 8;
 
-    // FFT configuration
-    static constexpr size_t FFT_SAMPLES = 1024;
-    static constexpr size_t FFT_PERIOD_MS = 100; // Process FFT every 100ms
-    static constexpr float NORMALIZE_24BIT = 1.0f / 8388608.0f;
+    // Streaming: blocks are read as they fill
+    static constexpr size_t READ_BLOCK_SAMPLES = DMA_BUF_LEN;
+    static constexpr size_t READ_TIMEOUT_MS = 100;
+    static constexpr size_t STATS_INTERVAL_MS = 5000;
+    static constexpr size_t FFT_PERIOD_MS = 100; // Publish the state to listeners every 100ms
 
-    // Frequency bin definitions
-    static const uint8_t NUM_LOW_BINS = 5;
-    static const uint8_t NUM_MID_BINS = 5;
-    static const uint8_t NUM_HIGH_BINS = 5;
-    static const uint8_t NUM_TOTAL_BINS = NUM_LOW_BINS + NUM_MID_BINS + NUM_HIGH_BINS;
+#if SK_MICROPHONE_WAV
+    // Clip replayed instead of the microphone
+    static constexpr const char *WAV_PATH = "/mic_test.wav";
+#endif
 
-    // Arrays storing which FFT bins to use
-    static const uint16_t LOW_BINS[NUM_LOW_BINS];
-    static const uint16_t MID_BINS[NUM_MID_BINS];
-    static const uint16_t HIGH_BINS[NUM_HIGH_BINS];
-
-    // Clap detection parameters
-    static const int CLAP_THRESHOLD = 30000; // Amplitude threshold for clap detection
+    // Clap sequences, the detector itself is configured in clap_detector.h
     static const int CLAP_TIMEOUT_MS = 1000; // Max time between claps in a sequence
-    static const int CLAP_COOLDOWN_MS = 300; // Minimum time between clap detections
+
+#if SK_MICROPHONE_SIMULATION
+    // Synthetic bands with a kick at 120 BPM, for measuring the audio to light latency without a microphone
+    static const int SIMULATION_HOP_MS = 10;
+    static const int SIMULATION_BEAT_MS = 500;
+    void runSimulation();
+#endif
 
     // Microphone and audio processing methods
-    void initMicrophone();
-    void processMicrophoneData();
-    bool detectClap(int32_t *samples, size_t samples_len);
+    void stream(AudioSource &source);
+    void processBlock(int32_t *samples, size_t count);
     void processClap();
-    void processAudioFFT();
-    void convertSamplesToReal(int32_t *samples, size_t count);
-    void getMagnitudes(float *outMagnitudes);
-    void getMaxMagnitudes(float *outPeaks);
+    void processFrame();
+    float averageBands(const float *levels, uint8_t from, uint8_t to);
+    void processBeat();
+    void publishBeat(float bpm, float confidence);
+    void publishBands(const float *levels, uint8_t num_bands);
+    void recordBlock(AudioSource &source, size_t count, unsigned long block_us);
 
     // Microphone state
     MicrophoneState microphone_state = {};
     QueueHandle_t microphone_state_queue_;
 
-    // FFT components
-    ArduinoFFT<float> m_FFT;
-    float m_realComponent[FFT_SAMPLES];
-    float m_imagComponent[FFT_SAMPLES];
-    int32_t m_rawSamples[FFT_SAMPLES];
+    int32_t m_block[READ_BLOCK_SAMPLES];
+    AudioPipeline m_pipeline;
 
     // Timing variables
-    unsigned long last_microphone_check_ms = 0;
     unsigned long last_fft_process_ms = 0;
-    unsigned long last_clap_end_time = 0;
-
-    // Audio analysis results
-    float m_magnitudes[NUM_TOTAL_BINS];
-    float m_peaks[NUM_TOTAL_BINS];
+    // micros() of the newest sample in the FFT buffer
+    uint32_t frame_captured_us = 0;
+    // RMS of the samples the newest frame added, 1 is full scale
+    float frame_rms = 0;
+
+    // Beat tracking
+    uint32_t beat_count = 0;
+    float beat_strength = 0;
+    float beat_bpm = 0;
+
+    // Pipeline statistics
+    MicrophoneStats stats_ = {};
+    MicrophoneStats window_ = {};
+    uint64_t window_busy_us_ = 0;
+    unsigned long window_started_us_ = 0;
+    uint32_t window_overruns_base_ = 0;
+    uint32_t window_skipped_base_ = 0;
 
     // Listeners and synchronization
     std::vector<QueueHandle_t> state_listeners_;
@@ -90,4 +121,4 @@ private:
 
     // Publish state to listeners
     void publishState(const MicrophoneState &state);
-};
\ No newline at end of file
+};
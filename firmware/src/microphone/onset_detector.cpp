@@ -0,0 +1,58 @@
+#include "onset_detector.h"
+#include "../util.h"
+
+OnsetDetector::OnsetDetector(uint32_t sample_rate, size_t fft_size, size_t hop_size)
+{
+    float bin_hz = (float)sample_rate / fft_size;
+    num_bins_ = min<size_t>(fft_size / 2 + 1, ONSET_MAX_HZ / bin_hz + 1);
+    min_interval_frames_ = max<uint16_t>(1, (uint32_t)ONSET_MIN_INTERVAL_MS * sample_rate / 1000 / hop_size);
+    previous_.assign(num_bins_, 0);
+}
+
+bool OnsetDetector::addFrame(const float *magnitudes)
+{
+    float sum = 0;
+    for (size_t i = 0; i < num_bins_; i++)
+    {
+        float compressed = log1pf(ONSET_COMPRESSION * magnitudes[i]);
+        float rise = compressed - previous_[i];
+        if (rise > 0)
+        {
+            sum += rise;
+        }
+        previous_[i] = compressed;
+    }
+
+    // The first frame rises from nothing
+    float flux = primed_ ? sum / num_bins_ : 0;
+    primed_ = true;
+
+    // The previous frame is an onset if it peaked above the threshold it had
+    bool falling = flux < previous_flux_;
+    bool onset = rising_ && falling && previous_flux_ > previous_threshold_ && frames_since_onset_ >= min_interval_frames_;
+    if (onset)
+    {
+        strength_ = CLAMP(previous_flux_ / previous_threshold_ - 1.0f, 0.0f, 1.0f);
+        frames_since_onset_ = 0;
+    }
+    else if (frames_since_onset_ < UINT16_MAX)
+    {
+        frames_since_onset_++;
+    }
+    rising_ = flux > previous_flux_;
+
+    history_[history_index_] = flux;
+    history_index_ = (history_index_ + 1) % ONSET_MEAN_FRAMES;
+
+    // Summing the short history again each frame avoids the drift of a running sum
+    float history_sum = 0;
+    for (uint8_t f = 0; f < ONSET_MEAN_FRAMES; f++)
+    {
+        history_sum += history_[f];
+    }
+
+    previous_threshold_ = history_sum / ONSET_MEAN_FRAMES * ONSET_THRESHOLD_RATIO + ONSET_THRESHOLD_OFFSET;
+    previous_flux_ = flux;
+    flux_ = flux;
+    return onset;
+}
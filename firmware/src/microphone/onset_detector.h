@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <vector>
+
+// Log compression gain, makes the flux follow relative rather than absolute changes
+const float ONSET_COMPRESSION = 10.0f;
+// Bins above this carry little rhythmic information but plenty of noise
+const float ONSET_MAX_HZ = 8000.0f;
+// Adaptive threshold: ONSET_THRESHOLD_RATIO times the recent mean flux, plus ONSET_THRESHOLD_OFFSET
+const uint8_t ONSET_MEAN_FRAMES = 32;
+const float ONSET_THRESHOLD_RATIO = 1.4f;
+const float ONSET_THRESHOLD_OFFSET = 0.01f;
+const uint16_t ONSET_MIN_INTERVAL_MS = 100;
+
+// Spectral flux onset detector.
+//
+// Every frame the magnitudes are log compressed and the positive differences
+// to the previous frame are summed, so energy appearing in any band (a kick,
+// a snare, a chord change) raises the flux while decays do not. An onset is a
+// local maximum of the flux above a threshold that follows its running mean,
+// reported one frame late, once the peak is known to have been a peak.
+class OnsetDetector
+{
+public:
+    OnsetDetector(uint32_t sample_rate, size_t fft_size, size_t hop_size);
+
+    // magnitudes holds fft_size / 2 + 1 bins, returns true if the previous frame was an onset
+    bool addFrame(const float *magnitudes);
+
+    // Flux of the newest frame, the onset strength envelope the tempo tracker works on
+    float flux() { return flux_; }
+    // How far the last onset stood out of the threshold, 0..1
+    float strength() { return strength_; }
+
+private:
+    size_t num_bins_;
+    uint16_t min_interval_frames_;
+
+    std::vector<float> previous_;
+    bool primed_ = false;
+
+    float flux_ = 0;
+    float previous_flux_ = 0;
+    float previous_threshold_ = 0;
+    bool rising_ = false;
+    float strength_ = 0;
+
+    // Flux of the last ONSET_MEAN_FRAMES frames, the threshold follows their mean
+    float history_[ONSET_MEAN_FRAMES] = {};
+    uint8_t history_index_ = 0;
+
+    uint16_t frames_since_onset_ = UINT16_MAX;
+};
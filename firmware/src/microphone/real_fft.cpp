@@ -0,0 +1,179 @@
+#include "real_fft.h"
+#include "../logging.h"
+
+#include <arduinoFFT.h>
+
+RealFft::RealFft(size_t size) : size_(size), half_(size / 2)
+{
+    assert(size >= 4 && (size & (size - 1)) == 0);
+
+    // Same Hann window the ArduinoFFT path used, symmetric over size points
+    window_.resize(size_);
+    for (size_t i = 0; i < size_; i++)
+    {
+        window_[i] = 0.5f * (1.0f - cosf(2.0f * PI * i / (size_ - 1)));
+    }
+
+    twiddles_.resize(half_);
+    for (size_t k = 0; k < half_ / 2; k++)
+    {
+        twiddles_[2 * k] = cosf(2.0f * PI * k / half_);
+        twiddles_[2 * k + 1] = -sinf(2.0f * PI * k / half_);
+    }
+
+    split_.resize(size_);
+    for (size_t k = 0; k < half_; k++)
+    {
+        split_[2 * k] = cosf(2.0f * PI * k / size_);
+        split_[2 * k + 1] = -sinf(2.0f * PI * k / size_);
+    }
+
+    uint8_t bits = 0;
+    while ((1u << bits) < half_)
+    {
+        bits++;
+    }
+    bit_reverse_.resize(half_);
+    for (size_t i = 0; i < half_; i++)
+    {
+        size_t reversed = 0;
+        for (uint8_t b = 0; b < bits; b++)
+        {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        bit_reverse_[i] = reversed;
+    }
+
+    work_.resize(size_);
+}
+
+void RealFft::loadWindowed(const int32_t *samples)
+{
+    const float scale = FFT_NORMALIZE_24BIT;
+    // Even samples become the real parts, odd ones the imaginary parts, stored in bit reversed order
+    float *work = work_.data();
+    const float *window = window_.data();
+    for (size_t k = 0; k < half_; k++)
+    {
+        size_t j = bit_reverse_[k];
+        work[2 * j] = samples[2 * k] * scale * window[2 * k];
+        work[2 * j + 1] = samples[2 * k + 1] * scale * window[2 * k + 1];
+    }
+}
+
+size_t RealFft::memoryBytes()
+{
+    return (window_.size() + twiddles_.size() + split_.size() + work_.size()) * sizeof(float) + bit_reverse_.size() * sizeof(uint16_t);
+}
+
+void RealFft::complexFft()
+{
+    // Iterative radix-2 decimation in time, input is already bit reversed
+    float *work = work_.data();
+    const float *twiddles = twiddles_.data();
+
+    for (size_t span = 1; span < half_; span <<= 1)
+    {
+        size_t stride = half_ / (span * 2);
+        for (size_t start = 0; start < half_; start += span * 2)
+        {
+            for (size_t k = 0; k < span; k++)
+            {
+                float wr = twiddles[2 * k * stride];
+                float wi = twiddles[2 * k * stride + 1];
+
+                float *a = work + 2 * (start + k);
+                float *b = work + 2 * (start + k + span);
+
+                float tr = b[0] * wr - b[1] * wi;
+                float ti = b[0] * wi + b[1] * wr;
+
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
+
+void RealFft::magnitudes(float *out)
+{
+    complexFft();
+
+    const float *z = work_.data();
+    const float *split = split_.data();
+
+    // DC and Nyquist only depend on Z[0]
+    out[0] = fabsf(z[0] + z[1]);
+    out[half_] = fabsf(z[0] - z[1]);
+
+    for (size_t k = 1; k < half_; k++)
+    {
+        // X[k] = (Z[k] + conj(Z[h-k])) / 2 - i/2 * W^k * (Z[k] - conj(Z[h-k]))
+        const float *zk = z + 2 * k;
+        const float *zm = z + 2 * (half_ - k);
+
+        float even_r = 0.5f * (zk[0] + zm[0]);
+        float even_i = 0.5f * (zk[1] - zm[1]);
+        float odd_r = 0.5f * (zk[1] + zm[1]);
+        float odd_i = -0.5f * (zk[0] - zm[0]);
+
+        float wr = split[2 * k];
+        float wi = split[2 * k + 1];
+
+        float xr = even_r + odd_r * wr - odd_i * wi;
+        float xi = even_i + odd_r * wi + odd_i * wr;
+        out[k] = sqrtf(xr * xr + xi * xi);
+    }
+}
+
+void RealFft::benchmark(size_t size, uint16_t iterations)
+{
+    const float scale = FFT_NORMALIZE_24BIT;
+
+    // Two tones and some noise at roughly speech level
+    std::vector<int32_t> samples(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        samples[i] = 2000000 * sinf(2.0f * PI * 37.3f * i / size) + 500000 * sinf(2.0f * PI * 201.7f * i / size) + random(-20000, 20000);
+    }
+
+    RealFft fft(size);
+    std::vector<float> out(fft.bins());
+
+    unsigned long started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        fft.loadWindowed(samples.data());
+        fft.magnitudes(out.data());
+    }
+    unsigned long real_us = micros() - started_at;
+
+    // Reference, what MicrophoneTask did before: window with cos() per sample, complex FFT on real data
+    ArduinoFFT<float> reference;
+    std::vector<float> re(size), im(size);
+    started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        for (size_t j = 0; j < size; j++)
+        {
+            re[j] = samples[j] * scale * 0.5f * (1.0f - cos(2.0f * M_PI * j / (size - 1)));
+            im[j] = 0;
+        }
+        reference.compute(re.data(), im.data(), size, FFT_FORWARD);
+        reference.complexToMagnitude(re.data(), im.data(), size);
+    }
+    unsigned long reference_us = micros() - started_at;
+
+    float peak = 0;
+    float max_error = 0;
+    for (size_t k = 0; k < fft.bins(); k++)
+    {
+        peak = max(peak, re[k]);
+        max_error = max(max_error, fabsf(out[k] - re[k]));
+    }
+
+    LOGI("Real FFT %d points: %.1fus per frame, ArduinoFFT %.1fus, max error %.2e of peak",
+         size, (float)real_us / iterations, (float)reference_us / iterations, peak > 0 ? max_error / peak : 0);
+}
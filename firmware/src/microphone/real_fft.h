@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <vector>
+
+// Full scale of the signed 24-bit microphone samples
+const float FFT_NORMALIZE_24BIT = 1.0f / 8388608.0f;
+
+// FFT of real input for the microphone path.
+//
+// A real N point transform is computed as an N/2 point complex FFT over the
+// even/odd samples packed as re/im, followed by a split step that separates
+// the two half spectra. Window, twiddle factors and the bit reversal
+// permutation are tables built once in the constructor, so a frame costs
+// no trig calls at all. The complex work buffer is interleaved re, im, the
+// layout the ESP-DSP fc32 kernels expect.
+class RealFft
+{
+public:
+    // size must be a power of two, at least 4
+    RealFft(size_t size);
+
+    size_t size() { return size_; }
+    // Bins produced by magnitudes(), DC to Nyquist
+    size_t bins() { return size_ / 2 + 1; }
+
+    // Normalizes 24-bit samples to [-1, 1) and applies the Hann window into the work buffer
+    void loadWindowed(const int32_t *samples);
+
+    // Transforms the work buffer and writes bins() magnitudes into out
+    void magnitudes(float *out);
+
+    // Bytes of tables and work buffer
+    size_t memoryBytes();
+
+    // Compares against ArduinoFFT on the same windowed frame and times both, logs the results
+    static void benchmark(size_t size, uint16_t iterations);
+
+private:
+    size_t size_;
+    size_t half_;
+
+    std::vector<float> window_;
+    // e^(-2 pi i k / half) for the complex FFT, interleaved, k < half / 2
+    std::vector<float> twiddles_;
+    // e^(-2 pi i k / size) for the split step, interleaved, k < half
+    std::vector<float> split_;
+    std::vector<uint16_t> bit_reverse_;
+
+    // half complex values, interleaved re, im
+    std::vector<float> work_;
+
+    void complexFft();
+};
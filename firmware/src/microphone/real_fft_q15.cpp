@@ -0,0 +1,257 @@
+#include "real_fft_q15.h"
+#include "real_fft.h"
+#include "../logging.h"
+
+static int16_t toQ15(float value)
+{
+    return (int16_t)constrain(lroundf(value * 32767.0f), -32767L, 32767L);
+}
+
+// Q15 product, rounded to nearest
+static inline int32_t mulQ15(int32_t a, int32_t b)
+{
+    return (a * b + (1 << 14)) >> 15;
+}
+
+static uint32_t isqrt32(uint32_t value)
+{
+    uint32_t result = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+static uint32_t isqrt64(uint64_t value)
+{
+    // Drop pairs of low bits until it fits 32 bits, each pair is one bit of the root
+    uint8_t shift = 0;
+    while (value >> 32)
+    {
+        value >>= 2;
+        shift++;
+    }
+    return isqrt32((uint32_t)value) << shift;
+}
+
+RealFftQ15::RealFftQ15(size_t size) : size_(size), half_(size / 2)
+{
+    assert(size >= 4 && (size & (size - 1)) == 0);
+
+    output_scale_ = (float)half_ / 32768.0f;
+
+    window_.resize(size_);
+    for (size_t i = 0; i < size_; i++)
+    {
+        window_[i] = toQ15(0.5f * (1.0f - cosf(2.0f * PI * i / (size_ - 1))));
+    }
+
+    twiddles_.resize(half_);
+    for (size_t k = 0; k < half_ / 2; k++)
+    {
+        twiddles_[2 * k] = toQ15(cosf(2.0f * PI * k / half_));
+        twiddles_[2 * k + 1] = toQ15(-sinf(2.0f * PI * k / half_));
+    }
+
+    split_.resize(size_);
+    for (size_t k = 0; k < half_; k++)
+    {
+        split_[2 * k] = toQ15(cosf(2.0f * PI * k / size_));
+        split_[2 * k + 1] = toQ15(-sinf(2.0f * PI * k / size_));
+    }
+
+    uint8_t bits = 0;
+    while ((1u << bits) < half_)
+    {
+        bits++;
+    }
+    bit_reverse_.resize(half_);
+    for (size_t i = 0; i < half_; i++)
+    {
+        size_t reversed = 0;
+        for (uint8_t b = 0; b < bits; b++)
+        {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        bit_reverse_[i] = reversed;
+    }
+
+    work_.resize(size_);
+}
+
+void RealFftQ15::loadWindowed(const int32_t *samples)
+{
+    // Block floating point: quiet frames are shifted up so they use the whole
+    // 16 bits instead of the few low ones, the gain is undone in the output scale
+    int32_t peak = 0;
+    for (size_t i = 0; i < size_; i++)
+    {
+        peak = max(peak, abs(samples[i]));
+    }
+    // Positive shifts right, negative left: the peak ends up in [2^14, 2^15), full-scale 24-bit input is shifted by 8
+    int8_t shift = peak > 0 ? 17 - __builtin_clz(peak) : 0;
+    shift = constrain(shift, -15, 8);
+    uint8_t right = shift > 0 ? shift : 0;
+    int32_t gain = shift < 0 ? 1 << -shift : 1;
+    // Undoes the per-stage halving, the Q15 scale and the block gain
+    output_scale_ = ldexpf((float)half_ / 32768.0f, shift - 8);
+
+    int16_t *work = work_.data();
+    const int16_t *window = window_.data();
+    for (size_t k = 0; k < half_; k++)
+    {
+        size_t j = bit_reverse_[k];
+        int32_t even = constrain((samples[2 * k] >> right) * gain, -32768, 32767);
+        int32_t odd = constrain((samples[2 * k + 1] >> right) * gain, -32768, 32767);
+        work[2 * j] = mulQ15(even, window[2 * k]);
+        work[2 * j + 1] = mulQ15(odd, window[2 * k + 1]);
+    }
+}
+
+void RealFftQ15::complexFft()
+{
+    int16_t *work = work_.data();
+    const int16_t *twiddles = twiddles_.data();
+
+    for (size_t span = 1; span < half_; span <<= 1)
+    {
+        size_t stride = half_ / (span * 2);
+        for (size_t start = 0; start < half_; start += span * 2)
+        {
+            for (size_t k = 0; k < span; k++)
+            {
+                int32_t wr = twiddles[2 * k * stride];
+                int32_t wi = twiddles[2 * k * stride + 1];
+
+                int16_t *a = work + 2 * (start + k);
+                int16_t *b = work + 2 * (start + k + span);
+
+                int32_t tr = mulQ15(b[0], wr) - mulQ15(b[1], wi);
+                int32_t ti = mulQ15(b[0], wi) + mulQ15(b[1], wr);
+
+                // Halve every stage so the next one can't overflow
+                int32_t ar = a[0];
+                int32_t ai = a[1];
+                b[0] = (ar - tr) >> 1;
+                b[1] = (ai - ti) >> 1;
+                a[0] = (ar + tr) >> 1;
+                a[1] = (ai + ti) >> 1;
+            }
+        }
+    }
+}
+
+void RealFftQ15::magnitudes(uint32_t *out)
+{
+    complexFft();
+
+    const int16_t *z = work_.data();
+    const int16_t *split = split_.data();
+
+    out[0] = abs(z[0] + z[1]);
+    out[half_] = abs(z[0] - z[1]);
+
+    for (size_t k = 1; k < half_; k++)
+    {
+        const int16_t *zk = z + 2 * k;
+        const int16_t *zm = z + 2 * (half_ - k);
+
+        // Kept at twice the value to not lose the halving's low bit
+        int32_t even_r = zk[0] + zm[0];
+        int32_t even_i = zk[1] - zm[1];
+        int32_t odd_r = zk[1] + zm[1];
+        int32_t odd_i = zm[0] - zk[0];
+
+        int32_t wr = split[2 * k];
+        int32_t wi = split[2 * k + 1];
+
+        int64_t xr = even_r + mulQ15(odd_r, wr) - mulQ15(odd_i, wi);
+        int64_t xi = even_i + mulQ15(odd_r, wi) + mulQ15(odd_i, wr);
+        out[k] = (isqrt64(xr * xr + xi * xi) + 1) >> 1;
+    }
+}
+
+void RealFftQ15::magnitudes(float *out)
+{
+    // The float buffer is big enough to stage the integer magnitudes in place
+    static_assert(sizeof(float) == sizeof(uint32_t), "magnitudes are converted in place");
+    uint32_t *raw = reinterpret_cast<uint32_t *>(out);
+    magnitudes(raw);
+    for (size_t k = 0; k <= half_; k++)
+    {
+        out[k] = raw[k] * output_scale_;
+    }
+}
+
+size_t RealFftQ15::memoryBytes()
+{
+    return (window_.size() + twiddles_.size() + split_.size() + work_.size()) * sizeof(int16_t) + bit_reverse_.size() * sizeof(uint16_t);
+}
+
+void RealFftQ15::benchmark(size_t size, uint16_t iterations)
+{
+    // Loud to near the microphone's noise floor, the block exponent should keep the SNR of quiet frames
+    const int32_t amplitudes[] = {4000000, 40000, 4000, 400};
+
+    for (int32_t amplitude : amplitudes)
+    {
+        std::vector<int32_t> samples(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            samples[i] = amplitude * sinf(2.0f * PI * 37.3f * i / size) + amplitude / 4 * sinf(2.0f * PI * 201.7f * i / size) + random(-amplitude / 100, amplitude / 100);
+        }
+
+        RealFft reference(size);
+        RealFftQ15 fft(size);
+        std::vector<float> expected(reference.bins());
+        std::vector<float> out(fft.bins());
+
+        unsigned long started_at = micros();
+        for (uint16_t i = 0; i < iterations; i++)
+        {
+            reference.loadWindowed(samples.data());
+            reference.magnitudes(expected.data());
+        }
+        unsigned long float_us = micros() - started_at;
+
+        started_at = micros();
+        for (uint16_t i = 0; i < iterations; i++)
+        {
+            fft.loadWindowed(samples.data());
+            fft.magnitudes(out.data());
+        }
+        unsigned long fixed_us = micros() - started_at;
+
+        float peak = 0;
+        float max_error = 0;
+        double signal = 0;
+        double noise = 0;
+        for (size_t k = 0; k < fft.bins(); k++)
+        {
+            float error = out[k] - expected[k];
+            peak = max(peak, expected[k]);
+            max_error = max(max_error, fabsf(error));
+            signal += expected[k] * expected[k];
+            noise += error * error;
+        }
+
+        LOGI("Q15 FFT %d points, amplitude %d: %.1fus per frame (float %.1fus), %d bytes (float %d), max error %.2e of peak, SNR %.1fdB",
+             size, amplitude, (float)fixed_us / iterations, (float)float_us / iterations, fft.memoryBytes(), reference.memoryBytes(),
+             peak > 0 ? max_error / peak : 0, noise > 0 ? 10 * log10(signal / noise) : 999.0);
+    }
+}
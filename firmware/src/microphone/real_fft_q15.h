@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <vector>
+
+// Fixed-point twin of RealFft, same algorithm and API.
+//
+// Samples are reduced to Q15 with a per-frame block exponent, so quiet rooms
+// keep their resolution. Window and twiddles are Q15 tables and the
+// work buffer holds interleaved int16 re, im. Every butterfly stage halves
+// its outputs so nothing can overflow; the accumulated 1 / (size / 2) is
+// folded back in when magnitudes are converted to float. Magnitudes come
+// from an integer square root, the FPU is only used for that final scale.
+// Tables and buffers take half the memory of the float version.
+class RealFftQ15
+{
+public:
+    // size must be a power of two, at least 4
+    RealFftQ15(size_t size);
+
+    size_t size() { return size_; }
+    size_t bins() { return size_ / 2 + 1; }
+
+    // Reduces 24-bit samples to Q15 with the largest gain that doesn't clip, applies the Hann window into the work buffer
+    void loadWindowed(const int32_t *samples);
+
+    // Transforms the work buffer and writes bins() magnitudes, in the units of RealFft::magnitudes()
+    void magnitudes(float *out);
+
+    // Same, raw fixed-point magnitudes, scale by outputScale() to compare with RealFft
+    void magnitudes(uint32_t *out);
+    float outputScale() { return output_scale_; }
+
+    // Bytes of tables and work buffer
+    size_t memoryBytes();
+
+    // Compares against RealFft on the same frame and times both, logs error, SNR and memory
+    static void benchmark(size_t size, uint16_t iterations);
+
+private:
+    size_t size_;
+    size_t half_;
+    float output_scale_;
+
+    std::vector<int16_t> window_;
+    std::vector<int16_t> twiddles_;
+    std::vector<int16_t> split_;
+    std::vector<uint16_t> bit_reverse_;
+
+    std::vector<int16_t> work_;
+
+    void complexFft();
+};
@@ -0,0 +1,234 @@
+#include "tempo_tracker.h"
+#include "../logging.h"
+#include "../util.h"
+
+TempoTracker::TempoTracker(uint32_t sample_rate, size_t hop_size) : frame_rate_((float)sample_rate / hop_size)
+{
+    min_lag_ = floorf(frame_rate_ * 60.0f / TEMPO_MAX_BPM);
+    max_lag_ = ceilf(frame_rate_ * 60.0f / TEMPO_MIN_BPM);
+    update_frames_ = max<uint16_t>(1, frame_rate_ * TEMPO_UPDATE_MS / 1000);
+    hold_frames_ = frame_rate_ * TEMPO_HOLD_MS / 1000;
+
+    // The longest lag must still fit a few periods
+    size_t history_frames = max<size_t>(frame_rate_ * TEMPO_HISTORY_MS / 1000, 3 * max_lag_);
+    history_.assign(history_frames, 0);
+    scratch_.assign(history_frames, 0);
+    correlation_.assign(max_lag_ + 2, 0);
+
+    prior_.resize(max_lag_ - min_lag_ + 1);
+    for (uint16_t lag = min_lag_; lag <= max_lag_; lag++)
+    {
+        float octaves = log2f(frame_rate_ * 60.0f / lag / TEMPO_PRIOR_BPM) / TEMPO_PRIOR_OCTAVES;
+        prior_[lag - min_lag_] = expf(-0.5f * octaves * octaves);
+    }
+}
+
+bool TempoTracker::addFrame(float flux, bool onset)
+{
+    history_[history_index_] = flux;
+    history_index_ = (history_index_ + 1) % history_.size();
+    history_count_ = min(history_count_ + 1, history_.size());
+    frame_++;
+    // Bounded below, a long pause must not grow it past float precision either
+    next_beat_in_ = max(next_beat_in_ - 1, -period_frames_ - 1);
+
+    // A reported onset peaked on the previous frame
+    uint32_t onset_frame = frame_ - 1;
+    if (onset)
+    {
+        last_onset_frame_ = onset_frame;
+        has_onset_ = true;
+    }
+
+    if (++frames_since_update_ >= update_frames_ && history_count_ == history_.size())
+    {
+        frames_since_update_ = 0;
+        estimateTempo();
+    }
+
+    bool active = has_onset_ && frame_ - last_onset_frame_ < hold_frames_;
+    if (!active)
+    {
+        return false;
+    }
+
+    if (bpm_ == 0)
+    {
+        // No tempo yet, every onset is a beat
+        if (onset)
+        {
+            last_beat_frame_ = onset_frame;
+        }
+        return onset;
+    }
+
+    if (onset)
+    {
+        float since_beat = (int32_t)(onset_frame - last_beat_frame_);
+        float tolerance = period_frames_ * 0.25f;
+        if (since_beat < tolerance)
+        {
+            // Late onset for the beat already emitted, shift the grid towards it
+            next_beat_in_ += since_beat * TEMPO_PHASE_GAIN;
+        }
+        else if (next_beat_in_ + 1 < tolerance)
+        {
+            // Early onset for the coming beat, fire now and restart the grid from here
+            last_beat_frame_ = onset_frame;
+            next_beat_in_ = period_frames_ - 1;
+            return true;
+        }
+    }
+
+    if (next_beat_in_ <= 0)
+    {
+        last_beat_frame_ = frame_;
+        next_beat_in_ += period_frames_;
+        // After a pause the grid lies in the past, restart it from now
+        if (next_beat_in_ <= 0)
+        {
+            next_beat_in_ = period_frames_;
+        }
+        return true;
+    }
+    return false;
+}
+
+void TempoTracker::estimateTempo()
+{
+    const size_t n = history_.size();
+
+    // Unroll oldest first and remove the mean, so a constant flux does not correlate
+    float mean = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        scratch_[i] = history_[(history_index_ + i) % n];
+        mean += scratch_[i];
+    }
+    mean /= n;
+    float energy = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        scratch_[i] -= mean;
+        energy += scratch_[i] * scratch_[i];
+    }
+    if (energy <= 0)
+    {
+        confidence_ = 0;
+        return;
+    }
+
+    // One lag either side of the range for the interpolation
+    uint16_t first = max<uint16_t>(1, min_lag_ - 1);
+    uint16_t last = max_lag_ + 1;
+    for (uint16_t lag = first; lag <= last; lag++)
+    {
+        float sum = 0;
+        const float *a = scratch_.data();
+        const float *b = scratch_.data() + lag;
+        for (size_t i = 0; i < n - lag; i++)
+        {
+            sum += a[i] * b[i];
+        }
+        // Unbiased, longer lags overlap fewer frames
+        correlation_[lag] = sum / (n - lag);
+    }
+
+    uint16_t best_lag = 0;
+    float best_score = 0;
+    for (uint16_t lag = min_lag_; lag <= max_lag_; lag++)
+    {
+        float score = correlation_[lag] * prior_[lag - min_lag_];
+        if (score > best_score)
+        {
+            best_score = score;
+            best_lag = lag;
+        }
+    }
+
+    float confidence = best_lag > 0 ? correlation_[best_lag] / (energy / n) : 0;
+    if (confidence < TEMPO_MIN_CONFIDENCE)
+    {
+        confidence_ = max(confidence, 0.0f);
+        return;
+    }
+
+    // Parabola through the peak and its neighbours
+    float left = correlation_[best_lag - 1];
+    float center = correlation_[best_lag];
+    float right = correlation_[best_lag + 1];
+    float denominator = left - 2 * center + right;
+    float offset = denominator < 0 ? CLAMP(0.5f * (left - right) / denominator, -0.5f, 0.5f) : 0;
+
+    period_frames_ = best_lag + offset;
+    bpm_ = frame_rate_ * 60.0f / period_frames_;
+    confidence_ = min(confidence, 1.0f);
+
+    // Phase: the offset from the newest frame whose comb of the last beats collects the most onset strength
+    uint16_t best_phase = 0;
+    float best_phase_score = -INFINITY;
+    for (uint16_t phase = 0; phase < best_lag; phase++)
+    {
+        float score = 0;
+        float position = n - 1 - phase;
+        for (uint8_t beat = 0; beat < TEMPO_PHASE_BEATS && position >= 0; beat++, position -= period_frames_)
+        {
+            score += scratch_[(size_t)lroundf(position)];
+        }
+        if (score > best_phase_score)
+        {
+            best_phase_score = score;
+            best_phase = phase;
+        }
+    }
+
+    // scratch_[n - 1] is the current frame, re-anchor the grid on the newest beat of the comb
+    next_beat_in_ = period_frames_ - best_phase;
+    while (next_beat_in_ <= 0)
+    {
+        next_beat_in_ += period_frames_;
+    }
+    // Never closer than half a period to the beat already emitted
+    if (next_beat_in_ + (frame_ - last_beat_frame_) < period_frames_ * 0.5f)
+    {
+        next_beat_in_ += period_frames_;
+    }
+}
+
+void TempoTracker::benchmark(uint32_t sample_rate, size_t hop_size, uint16_t iterations)
+{
+    TempoTracker tracker(sample_rate, hop_size);
+
+    // 120 BPM clicks over a little noise
+    uint16_t period = tracker.frame_rate_ * 0.5f;
+    for (size_t i = 0; i < tracker.history_.size(); i++)
+    {
+        tracker.addFrame(i % period == 0 ? 1.0f : random(100) / 1000.0f, false);
+    }
+
+    unsigned long started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        tracker.estimateTempo();
+    }
+    unsigned long elapsed_us = micros() - started_at;
+
+    LOGI("Tempo tracker, %d frames, lags %d-%d: %.1fus per estimate, %.2fus per frame amortized, %.1f BPM",
+         tracker.history_.size(), tracker.min_lag_, tracker.max_lag_, (float)elapsed_us / iterations,
+         (float)elapsed_us / iterations / tracker.update_frames_, tracker.bpm());
+
+    // The same clicks for a minute with the frame counter passing 2^31, where an absolute
+    // float beat position would have lost whole frames. Every click should still be one beat.
+    TempoTracker uptime(sample_rate, hop_size);
+    uptime.frame_ = 0x80000000u - uptime.history_.size();
+    uint32_t frames = uptime.frame_rate_ * 60;
+    uint32_t beats = 0;
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        beats += uptime.addFrame(i % period == 0 ? 1.0f : random(100) / 1000.0f, i % period == 1);
+    }
+    uint32_t expected = frames / period;
+    bool ok = beats + expected / 10 >= expected && beats <= expected + expected / 10;
+    LOGI("Tempo tracker across frame %u: %d beats, %d expected, %.1f BPM, %s", 0x80000000u, beats, expected, uptime.bpm(),
+         ok ? "ok" : "FAILED");
+}
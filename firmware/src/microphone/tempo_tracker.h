@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <vector>
+
+// Tempo range the tracker reports
+const float TEMPO_MIN_BPM = 60.0f;
+const float TEMPO_MAX_BPM = 200.0f;
+// Prior on the tempo, a log-normal around 120 BPM that resolves double/half tempo ambiguity
+const float TEMPO_PRIOR_BPM = 120.0f;
+const float TEMPO_PRIOR_OCTAVES = 1.0f;
+// Onset envelope kept for the autocorrelation, and how often it is evaluated
+const uint16_t TEMPO_HISTORY_MS = 6000;
+const uint16_t TEMPO_UPDATE_MS = 500;
+// Normalized autocorrelation peak below which the tempo is not trusted
+const float TEMPO_MIN_CONFIDENCE = 0.1f;
+// Beats keep being predicted this long after the last onset, then the tracker goes quiet
+const uint16_t TEMPO_HOLD_MS = 2000;
+// Share of the phase error of a late onset that moves the next predicted beat
+const float TEMPO_PHASE_GAIN = 0.5f;
+// Beats the phase comb spans back from the newest frame. A period off by a fraction of a frame
+// drifts the comb by a frame every few beats, so over the whole history it would miss.
+const uint8_t TEMPO_PHASE_BEATS = 4;
+
+// Autocorrelation tempo tracker with beat prediction.
+//
+// The onset strength envelope (spectral flux) of the last TEMPO_HISTORY_MS is
+// autocorrelated every TEMPO_UPDATE_MS over the lags of TEMPO_MIN_BPM to
+// TEMPO_MAX_BPM, weighted by the tempo prior; the best lag, refined by
+// parabolic interpolation, is the beat period. Beats are then emitted on the
+// predicted grid, so they arrive without detection latency and continue
+// through a missed kick. Onsets close to the grid pull its phase: an early
+// onset fires the beat at once, a late one shifts the next prediction.
+class TempoTracker
+{
+public:
+    TempoTracker(uint32_t sample_rate, size_t hop_size);
+
+    // Call once per frame with the onset detector's output, returns true on a beat
+    bool addFrame(float flux, bool onset);
+
+    // 0 until a tempo was found
+    float bpm() { return bpm_; }
+    // Normalized autocorrelation at the chosen period, 0..1
+    float confidence() { return confidence_; }
+
+    // Frames per second the tracker was set up for
+    float frameRate() { return frame_rate_; }
+
+    // Times the tempo estimation and logs its cost, then checks the beat grid across the frame counter wrap
+    static void benchmark(uint32_t sample_rate, size_t hop_size, uint16_t iterations);
+
+private:
+    float frame_rate_;
+    uint16_t min_lag_;
+    uint16_t max_lag_;
+    uint16_t update_frames_;
+    uint16_t hold_frames_;
+
+    // Onset envelope, mean removed when it is autocorrelated
+    std::vector<float> history_;
+    size_t history_index_ = 0;
+    size_t history_count_ = 0;
+    // Prior weight per lag, index lag - min_lag_
+    std::vector<float> prior_;
+    std::vector<float> correlation_;
+    // Envelope unrolled oldest first
+    std::vector<float> scratch_;
+
+    uint32_t frame_ = 0;
+    uint16_t frames_since_update_ = 0;
+    float bpm_ = 0;
+    float confidence_ = 0;
+    float period_frames_ = 0;
+
+    // Frames from frame_ to the next predicted beat, relative so it keeps its precision at any uptime
+    float next_beat_in_ = 0;
+    uint32_t last_beat_frame_ = 0;
+    uint32_t last_onset_frame_ = 0;
+    bool has_onset_ = false;
+
+    void estimateTempo();
+};
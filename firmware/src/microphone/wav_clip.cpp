@@ -0,0 +1,88 @@
+#include "wav_clip.h"
+#include "../logging.h"
+
+static uint32_t readLe32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t readLe16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+int32_t WavClip::sampleAt(size_t index) const
+{
+    const uint8_t *p = data + index * bytes_per_sample;
+    switch (bytes_per_sample)
+    {
+    case 2:
+        return (int16_t)readLe16(p) * 256;
+    case 3:
+        // Sign extend from the top byte
+        return (int32_t)((p[0] << 8) | (p[1] << 16) | ((uint32_t)p[2] << 24)) >> 8;
+    default:
+        return (int32_t)readLe32(p) >> 8;
+    }
+}
+
+bool parseWav(const char *name, const uint8_t *file, size_t size, WavClip *clip)
+{
+    if (size < 12 || memcmp(file, "RIFF", 4) != 0 || memcmp(file + 8, "WAVE", 4) != 0)
+    {
+        LOGE("%s is not a WAV file", name);
+        return false;
+    }
+
+    // Walk the chunks until the samples, fmt always comes first
+    clip->num_samples = 0;
+    bool format_ok = false;
+    size_t position = 12;
+    while (position + 8 <= size)
+    {
+        const uint8_t *chunk = file + position;
+        uint32_t chunk_size = readLe32(chunk + 4);
+        position += 8;
+
+        if (memcmp(chunk, "fmt ", 4) == 0)
+        {
+            if (chunk_size < 16 || position + 16 > size)
+            {
+                break;
+            }
+            const uint8_t *fmt = file + position;
+            uint16_t audio_format = readLe16(fmt);
+            uint16_t channels = readLe16(fmt + 2);
+            uint16_t bits = readLe16(fmt + 14);
+            if (audio_format != 1 || channels != 1 || (bits != 16 && bits != 24 && bits != 32))
+            {
+                LOGE("%s: only mono 16/24/32-bit PCM is supported", name);
+                return false;
+            }
+            clip->sample_rate = readLe32(fmt + 4);
+            clip->bytes_per_sample = bits / 8;
+            format_ok = true;
+        }
+        else if (memcmp(chunk, "data", 4) == 0 && format_ok)
+        {
+            size_t available = std::min<size_t>(chunk_size, size - position);
+            clip->data = file + position;
+            clip->num_samples = available / clip->bytes_per_sample;
+            break;
+        }
+
+        if (chunk_size >= size - position)
+        {
+            break;
+        }
+        // Chunks are padded to an even size
+        position += chunk_size + (chunk_size & 1);
+    }
+
+    if (clip->num_samples == 0)
+    {
+        LOGE("No samples in %s", name);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Mono PCM samples inside a WAV file held in memory. Parsing is separate from
+// loading, so WavAudioSource on the device and the native tests read clips
+// through the same code.
+struct WavClip
+{
+    uint32_t sample_rate = 0;
+    uint8_t bytes_per_sample = 0;
+    // Points into the file image, nothing is copied
+    const uint8_t *data = nullptr;
+    size_t num_samples = 0;
+
+    // Signed 24-bit, right aligned in an int32_t like the microphone samples
+    int32_t sampleAt(size_t index) const;
+};
+
+// Walks the RIFF chunks of a WAV file image to its fmt and data chunks. Only mono
+// 16/24/32-bit PCM is accepted. A data chunk cut off by the end of the image keeps
+// the samples up to there. name is only used in log messages.
+bool parseWav(const char *name, const uint8_t *file, size_t size, WavClip *clip);
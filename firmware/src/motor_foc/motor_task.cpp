@@ -101,10 +101,12 @@ void MotorTask::run()
     float idle_check_velocity_ewma = 0;
     uint32_t last_idle_start = 0;
     uint32_t last_publish = 0;
+    KnobHotState last_hot_state = {};
 
     while (1)
     {
         motor.loopFOC();
+        uint32_t sampled_us = micros();
 
         // Check queue for pending requests from other tasks
         Command command;
@@ -275,6 +277,21 @@ void MotorTask::run()
 
         latest_sub_position_unit = -angle_to_detent_center / config.position_width_radians;
 
+        // Hot state goes out as soon as the knob moves, consumers don't have to wait for the periodic publish
+        float hot_delta = (current_position - last_hot_state.current_position) + (latest_sub_position_unit - last_hot_state.sub_position_unit);
+        if (fabsf(hot_delta) >= KNOB_HOT_STATE_MIN_DELTA || config.min_position != last_hot_state.min_position || config.max_position != last_hot_state.max_position || config.position_width_radians != last_hot_state.position_width_radians)
+        {
+            last_hot_state = {
+                .current_position = current_position,
+                .sub_position_unit = latest_sub_position_unit,
+                .min_position = config.min_position,
+                .max_position = config.max_position,
+                .position_width_radians = config.position_width_radians,
+                .sampled_us = sampled_us,
+            };
+            publishHotState(last_hot_state);
+        }
+
         float dead_zone_adjustment = CLAMP(
             angle_to_detent_center,
             fmaxf(-config.position_width_radians * DEAD_ZONE_DETENT_PERCENT, -DEAD_ZONE_RAD),
@@ -370,6 +387,19 @@ void MotorTask::addListener(QueueHandle_t queue)
     listeners_.push_back(queue);
 }
 
+void MotorTask::addHotStateListener(QueueHandle_t queue)
+{
+    hot_state_listeners_.push_back(queue);
+}
+
+void MotorTask::publishHotState(const KnobHotState &state)
+{
+    for (auto listener : hot_state_listeners_)
+    {
+        xQueueOverwrite(listener, &state);
+    }
+}
+
 void MotorTask::publish(const PB_SmartKnobState &state)
 {
     for (auto listener : listeners_)
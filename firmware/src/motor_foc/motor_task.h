@@ -22,6 +22,23 @@ struct HapticData
     bool long_press;
 };
 
+// Minimal knob state for consumers that follow the shaft frame by frame
+// (the LED arc). Published from the control loop whenever the knob moves,
+// without waiting for the periodic PB_SmartKnobState publish.
+struct KnobHotState
+{
+    int32_t current_position;
+    float sub_position_unit;
+    int32_t min_position;
+    int32_t max_position;
+    float position_width_radians;
+    // micros() when the shaft angle behind this state was read
+    uint32_t sampled_us;
+};
+
+// Smallest change in position + sub_position_unit worth publishing, filters sensor noise
+const float KNOB_HOT_STATE_MIN_DELTA = 0.01;
+
 struct Command
 {
     CommandType command_type;
@@ -47,6 +64,8 @@ public:
     void runCalibration();
 
     void addListener(QueueHandle_t queue);
+    // Queues of length 1 holding a KnobHotState, overwritten on every movement
+    void addHotStateListener(QueueHandle_t queue);
 
 protected:
     void run();
@@ -55,6 +74,7 @@ private:
     Configuration &configuration_;
     QueueHandle_t queue_;
     std::vector<QueueHandle_t> listeners_;
+    std::vector<QueueHandle_t> hot_state_listeners_;
     char buf_[72];
 
     // BLDC motor & driver instance
@@ -62,6 +82,7 @@ private:
     BLDCDriver6PWM driver = BLDCDriver6PWM(PIN_UH, PIN_UL, PIN_VH, PIN_VL, PIN_WH, PIN_WL);
 
     void publish(const PB_SmartKnobState &state);
+    void publishHotState(const KnobHotState &state);
     void calibrate();
     void checkSensorError();
 };
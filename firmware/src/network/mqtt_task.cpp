@@ -5,6 +5,9 @@ static const char *MQTT_TAG = "MQTT";
 const char *MqttTask::MQTT_LOCK_REQUEST_TOPIC = "smartknob/lock/request";
 const char *MqttTask::MQTT_LOCK_RESPONSE_TOPIC = "smartknob/lock/response";
 const char *MqttTask::MQTT_MANAGER_STATUS_TOPIC = "smartknob/manager/status";
+const char *MqttTask::MQTT_LED_PROGRAM_TOPIC = "smartknob/led/program";
+const char *MqttTask::MQTT_AUDIO_FEATURES_TOPIC = "smartknob/audio/features";
+const char *MqttTask::MQTT_AUDIO_FEATURES_CONFIG_TOPIC = "smartknob/audio/features/config";
 MqttTask::MqttTask(const uint8_t task_core) : Task{"mqtt", 1024 * 8, 1, task_core}
 {
     mutex_app_sync_ = xSemaphoreCreateMutex();
@@ -152,6 +155,8 @@ void MqttTask::run()
                 mqtt_pull = millis();
             }
 
+            publishAudioFeatures();
+
             if (xQueueReceive(entity_state_to_send_queue_, &entity_state_to_process_, 0) == pdTRUE)
             {
 
@@ -361,6 +366,10 @@ bool MqttTask::init()
     // Subscribe to standard topics
     mqtt_client.subscribe("smartknob/disco");
     mqtt_client.subscribe(MQTT_LOCK_REQUEST_TOPIC);
+#if SK_LEDS
+    mqtt_client.subscribe(MQTT_LED_PROGRAM_TOPIC);
+#endif
+    mqtt_client.subscribe(MQTT_AUDIO_FEATURES_CONFIG_TOPIC);
 
     cJSON_free(init_string);
     cJSON_Delete(json);
@@ -477,6 +486,35 @@ void MqttTask::callback(char *topic, byte *payload, unsigned int length)
         return;
     }
 
+#if SK_LEDS
+    if (strcmp(topic, MQTT_LED_PROGRAM_TOPIC) == 0)
+    {
+        // Binary payload: slot, flags (bit 0 persists the program, bit 1 plays the slot), then the program itself.
+        // Without a program the message only selects the slot to play.
+        if (length < 2)
+        {
+            LOGW("Invalid LED program message");
+            return;
+        }
+        LedProgramStore::getInstance().store(payload[0], payload + 2, length - 2, payload[1] & 0x01, payload[1] & 0x02);
+        return;
+    }
+#endif
+
+    if (strcmp(topic, MQTT_AUDIO_FEATURES_CONFIG_TOPIC) == 0)
+    {
+        // Binary payload: an encoded AudioFeatureConfig, same as on the serial link
+        PB_AudioFeatureConfig config = PB_AudioFeatureConfig_init_zero;
+        pb_istream_t stream = pb_istream_from_buffer(payload, length);
+        if (!pb_decode(&stream, PB_AudioFeatureConfig_fields, &config))
+        {
+            LOGW("Invalid audio feature config: %s", PB_GET_ERROR(&stream));
+            return;
+        }
+        AudioFeatureStream::getInstance().configure(config, AUDIO_FEATURE_LINK_MQTT);
+        return;
+    }
+
     if (strcmp(topic, MQTT_LOCK_REQUEST_TOPIC) == 0)
     {
         char *json_str = (char *)malloc(length + 1);
@@ -809,4 +847,24 @@ void MqttTask::publishManagerStatus()
     cJSON_Delete(json);
 }
 
+void MqttTask::publishAudioFeatures()
+{
+    if (!AudioFeatureStream::getInstance().enabled(AUDIO_FEATURE_LINK_MQTT) || !mqtt_client.connected())
+    {
+        return;
+    }
+    if (!AudioFeatureStream::getInstance().read(&audio_features_, &audio_features_sequence_))
+    {
+        return;
+    }
+
+    pb_ostream_t stream = pb_ostream_from_buffer(audio_features_buffer_, sizeof(audio_features_buffer_));
+    if (!pb_encode(&stream, PB_AudioFeatures_fields, &audio_features_))
+    {
+        LOGW("Audio feature encoding failed: %s", PB_GET_ERROR(&stream));
+        return;
+    }
+    mqtt_client.publish(MQTT_AUDIO_FEATURES_TOPIC, audio_features_buffer_, stream.bytes_written);
+}
+
 #endif
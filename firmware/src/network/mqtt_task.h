@@ -13,6 +13,10 @@
 #include "../app_config.h"
 #include "../events/events.h"
 #include "notify/mqtt_notifier/mqtt_notifier.h"
+#include "../led_ring/led_program_store.h"
+#include "../microphone/audio_feature_stream.h"
+#include "pb_decode.h"
+#include "pb_encode.h"
 
 class MqttTask : public Task<MqttTask>
 {
@@ -86,6 +90,14 @@ private:
     static const char *MQTT_LOCK_REQUEST_TOPIC;
     static const char *MQTT_LOCK_RESPONSE_TOPIC;
     static const char *MQTT_MANAGER_STATUS_TOPIC;
+    static const char *MQTT_LED_PROGRAM_TOPIC;
+    static const char *MQTT_AUDIO_FEATURES_TOPIC;
+    static const char *MQTT_AUDIO_FEATURES_CONFIG_TOPIC;
+
+    // Binary AudioFeatures batches, off until a config message enables them
+    uint32_t audio_features_sequence_ = 0;
+    PB_AudioFeatures audio_features_ = PB_AudioFeatures_init_zero;
+    uint8_t audio_features_buffer_[PB_AudioFeatures_size];
 
     void callback(char *topic, byte *payload, unsigned int length);
 
@@ -102,6 +114,7 @@ private:
     void checkLockTimeout();
     void publishLockResponse(const char *client_id, bool success);
     void publishManagerStatus();
+    void publishAudioFeatures();
 
     void lock();
 };
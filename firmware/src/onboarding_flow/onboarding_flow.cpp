@@ -1,7 +1,6 @@
 #include "onboarding_flow.h"
-#include "apps/icons.h"
 
-OnboardingFlow::OnboardingFlow(TFT_eSprite *spr_, TFT_eSprite qrcode_spr_) : spr_(spr_), qrcode_spr_(qrcode_spr_)
+OnboardingFlow::OnboardingFlow(TFT_eSprite *spr_) : spr_(spr_)
 {
     root_level_motor_config = PB_SmartKnobConfig{
         0,
@@ -79,27 +78,21 @@ EntityStateUpdate OnboardingFlow::update(AppState state)
 
 void OnboardingFlow::setQRCode(char *qr_data)
 {
-    QRCode qrcode;
-    uint8_t qrcodeVersion = 6;
-    int moduleSize = 2;
-
-    uint8_t qrcodeData[qrcode_getBufferSize(qrcodeVersion)];
-    qrcode_initText(&qrcode, qrcodeData, qrcodeVersion, 0, qr_data);
-
-    int qrCodeWidthHeight = qrcode.size * moduleSize;
-    qrcode_spr_.createSprite(qrCodeWidthHeight, qrCodeWidthHeight);
-    qrcode_spr_.fillSprite(TFT_BLACK);
+    snprintf(qr_data_, sizeof(qr_data_), "%s", qr_data);
+    qrcode_dirty_ = true;
+}
 
-    for (uint8_t y = 0; y < qrcode.size; y++)
+TFT_eSprite *OnboardingFlow::getQRCodeSprite()
+{
+    // The QR layer is shared with the other flow, redraw when it was taken over
+    bool contents_valid = false;
+    TFT_eSprite *qrcode_spr = SpriteArena::getInstance().acquire(SPRITE_LAYER_QRCODE, qrcode_lease_, QRCODE_SPRITE_SIZE, QRCODE_SPRITE_SIZE, &contents_valid);
+    if (qrcode_spr != nullptr && (!contents_valid || qrcode_dirty_))
     {
-        for (uint8_t x = 0; x < qrcode.size; x++)
-        {
-            if (qrcode_getModule(&qrcode, x, y))
-            {
-                qrcode_spr_.fillRect(x * moduleSize, y * moduleSize, moduleSize, moduleSize, TFT_WHITE);
-            }
-        }
+        drawQRCode(qrcode_spr, qr_data_);
+        qrcode_dirty_ = false;
     }
+    return qrcode_spr;
 }
 
 // TODO: rename to generic event
@@ -276,7 +269,7 @@ TFT_eSprite *OnboardingFlow::renderWelcomePage()
     spr_->setTextColor(default_text_color);
     spr_->drawString(buf_, center_width, center_height - 68, 1);
 
-    spr_->drawBitmap(center_width - icon_size / 2, (center_height - icon_size / 2) - 2, seedlabs_logo, icon_size, icon_size, TFT_WHITE, TFT_BLACK);
+    IconStore::getInstance().drawIcon(spr_, center_width - icon_size / 2, (center_height - icon_size / 2) - 2, &seedlabs_logo, TFT_WHITE, TFT_BLACK);
 
     sprintf(buf_, "ROTATE TO START");
     spr_->setFreeFont(&NDS1210pt7b);
@@ -303,7 +296,7 @@ TFT_eSprite *OnboardingFlow::renderHass1StepPage()
     spr_->setTextColor(default_text_color);
     spr_->drawString(buf_, center_width, center_height - 63, 1);
 
-    spr_->drawBitmap(center_width - icon_size / 2, center_height - icon_size / 2, home_assistant_80, icon_size, icon_size, TFT_WHITE, TFT_BLACK);
+    IconStore::getInstance().drawIcon(spr_, center_width - icon_size / 2, center_height - icon_size / 2, &home_assistant_80, TFT_WHITE, TFT_BLACK);
 
     sprintf(buf_, "PRESS TO CONFIGURE");
     spr_->setFreeFont(&NDS1210pt7b);
@@ -343,8 +336,12 @@ TFT_eSprite *OnboardingFlow::renderHass2StepPage()
     spr_->drawString("SCAN TO CONNECT", center, screen_name_label_h * 3, 1);
     spr_->drawString("TO THE SMART KNOB", center, screen_name_label_h * 4, 1);
 
-    uint8_t qrsize = qrcode_spr_.width();
-    qrcode_spr_.pushToSprite(spr_, center - qrsize / 2, center - qrsize / 2, TFT_BLACK);
+    TFT_eSprite *qrcode_spr = getQRCodeSprite();
+    if (qrcode_spr != nullptr)
+    {
+        uint8_t qrsize = qrcode_spr->width();
+        qrcode_spr->pushToSprite(spr_, center - qrsize / 2, center - qrsize / 2, TFT_BLACK);
+    }
 
     spr_->drawString("OR CONNECT TO", center, TFT_HEIGHT - screen_name_label_h * 4, 1);
     spr_->drawString(wifi_ap_ssid, center, TFT_HEIGHT - screen_name_label_h * 3, 1);
@@ -368,8 +365,12 @@ TFT_eSprite *OnboardingFlow::renderHass3StepPage()
     spr_->drawString("SCAN TO START", center_horizontal, screen_name_label_h * 3, 1);
     spr_->drawString("SETUP", center_horizontal, screen_name_label_h * 4, 1);
 
-    uint8_t qrsize = qrcode_spr_.width();
-    qrcode_spr_.pushToSprite(spr_, center_horizontal - qrsize / 2, center_vertical - qrsize / 2, TFT_BLACK);
+    TFT_eSprite *qrcode_spr = getQRCodeSprite();
+    if (qrcode_spr != nullptr)
+    {
+        uint8_t qrsize = qrcode_spr->width();
+        qrcode_spr->pushToSprite(spr_, center_horizontal - qrsize / 2, center_vertical - qrsize / 2, TFT_BLACK);
+    }
 
     char or_open[40];
     sprintf(or_open, "OR OPEN: %s", ip_data);
@@ -518,7 +519,7 @@ TFT_eSprite *OnboardingFlow::renderWiFi1StepPage()
     spr_->setTextColor(default_text_color);
     spr_->drawString(buf_, center_h, 50, 1);
 
-    spr_->drawBitmap(center_v - icon_size / 2, (center_h - icon_size / 2) - 2, wifi_conn_80, icon_size, icon_size, TFT_WHITE, TFT_BLACK);
+    IconStore::getInstance().drawIcon(spr_, center_v - icon_size / 2, (center_h - icon_size / 2) - 2, &wifi_conn_80, TFT_WHITE, TFT_BLACK);
 
     sprintf(buf_, "PRESS TO CONFIGURE");
     spr_->setFreeFont(&NDS1210pt7b);
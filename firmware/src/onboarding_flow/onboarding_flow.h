@@ -2,7 +2,8 @@
 #include "apps/app.h"
 
 #include "util.h"
-#include "qrcode.h"
+#include "gfx/qrcode_sprite.h"
+#include "gfx/sprite_arena.h"
 #include "navigation/navigation.h"
 #include "notify/motor_notifier/motor_notifier.h"
 #include "notify/wifi_notifier/wifi_notifier.h"
@@ -35,7 +36,7 @@ const uint8_t ONBOARDING_FLOW_PAGE_STEP_HASS_8 = 11;
 class OnboardingFlow
 {
 public:
-    OnboardingFlow(TFT_eSprite *spr_, TFT_eSprite qrcode_spr_);
+    OnboardingFlow(TFT_eSprite *spr_);
     void setQRCode(char *qr_data);
     TFT_eSprite *render();
     EntityStateUpdate updateStateFromKnob(PB_SmartKnobState state);
@@ -80,7 +81,10 @@ private:
 
     // UI
     TFT_eSprite *spr_ = NULL;
-    TFT_eSprite qrcode_spr_;
+    char qr_data_[128] = "";
+    bool qrcode_dirty_ = false;
+    SpriteLease qrcode_lease_;
+    TFT_eSprite *getQRCodeSprite();
 
     uint16_t default_text_color = rgbToUint32(150, 150, 150);
     uint16_t accent_text_color = rgbToUint32(128, 255, 80);
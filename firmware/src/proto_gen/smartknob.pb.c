@@ -48,6 +48,18 @@ PB_BIND(PB_StrainState, PB_StrainState, AUTO)
 PB_BIND(PB_StrainCalibration, PB_StrainCalibration, AUTO)
 
 
+PB_BIND(PB_LedEffectProgram, PB_LedEffectProgram, 2)
+
+
+PB_BIND(PB_AudioFeatureFrame, PB_AudioFeatureFrame, AUTO)
+
+
+PB_BIND(PB_AudioFeatures, PB_AudioFeatures, 2)
+
+
+PB_BIND(PB_AudioFeatureConfig, PB_AudioFeatureConfig, AUTO)
+
+
 
 
 
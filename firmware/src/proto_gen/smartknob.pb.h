@@ -208,6 +208,34 @@ typedef struct _PB_Knob {
     PB_PersistentConfiguration persistent_config;
 } PB_Knob;
 
+typedef PB_BYTES_ARRAY_T(32) PB_AudioFeatureFrame_bands_t;
+/* *
+ One microphone analysis frame. Levels are 8-bit dB codes, code / 255 spans
+ the range between the MIN_DB and MAX_DB constants in
+ firmware/src/microphone/audio_feature_stream.h. */
+typedef struct _PB_AudioFeatureFrame {
+    /* * Milliseconds after the batch start_ms */
+    uint16_t offset_ms;
+    /* * One code per band, lowest band first */
+    PB_AudioFeatureFrame_bands_t bands;
+    /* * Signal level in dBFS */
+    uint8_t rms;
+    /* * A beat or onset fell into this frame */
+    bool beat;
+} PB_AudioFeatureFrame;
+
+/* * Batch of consecutive analysis frames, streamed over MQTT and the serial link */
+typedef struct _PB_AudioFeatures {
+    /* * Incremented per batch, gaps mean the link dropped batches */
+    uint32_t sequence;
+    /* * Device millis() of the first frame */
+    uint32_t start_ms;
+    /* * Tracked tempo at the end of the batch, 0 until one was found */
+    float bpm;
+    pb_size_t frames_count;
+    PB_AudioFeatureFrame frames[8];
+} PB_AudioFeatures;
+
 /* Message FROM the SmartKnob to the host */
 typedef struct _PB_FromSmartKnob {
     uint8_t protocol_version;
@@ -219,6 +247,7 @@ typedef struct _PB_FromSmartKnob {
         PB_SmartKnobState smartknob_state;
         PB_MotorCalibState motor_calib_state;
         PB_StrainCalibState strain_calib_state;
+        PB_AudioFeatures audio_features;
     } payload;
 } PB_FromSmartKnob;
 
@@ -231,6 +260,28 @@ typedef struct _PB_StrainCalibration {
     float calibration_weight;
 } PB_StrainCalibration;
 
+typedef PB_BYTES_ARRAY_T(256) PB_LedEffectProgram_program_t;
+/* * Data-driven LED ring effect, see firmware/src/led_ring/led_program.h for the bytecode format */
+typedef struct _PB_LedEffectProgram {
+    uint8_t slot;
+    PB_LedEffectProgram_program_t program;
+    /* * Keep the program in flash so it survives a reboot */
+    bool persist;
+    /* *
+ Play the slot on the ring while the knob is in use. With an empty program only the selection changes:
+ to the slot if it holds a program, otherwise back to the built-in effects. */
+    bool play;
+} PB_LedEffectProgram;
+
+/* * Rate control for the AudioFeatures stream of the link it arrives on */
+typedef struct _PB_AudioFeatureConfig {
+    bool enabled;
+    /* * Frames closer together than this are merged, 0 selects the default */
+    uint16_t frame_interval_ms;
+    /* * Frames per AudioFeatures message, up to 8, 0 selects the default */
+    uint8_t batch_frames;
+} PB_AudioFeatureConfig;
+
 /* Message TO the Smartknob from the host */
 typedef struct _PB_ToSmartknob {
     uint8_t protocol_version;
@@ -241,6 +292,8 @@ typedef struct _PB_ToSmartknob {
         PB_SmartKnobConfig smartknob_config;
         PB_SmartKnobCommand smartknob_command;
         PB_StrainCalibration strain_calibration;
+        PB_LedEffectProgram led_effect_program;
+        PB_AudioFeatureConfig audio_feature_config;
     } payload;
 } PB_ToSmartknob;
 
@@ -290,6 +343,10 @@ extern "C" {
 #define PB_MotorCalibration_init_default         {0, 0, 0, 0}
 #define PB_StrainState_init_default              {0, 0}
 #define PB_StrainCalibration_init_default        {0}
+#define PB_LedEffectProgram_init_default         {0, {0, {0}}, 0, 0}
+#define PB_AudioFeatureFrame_init_default        {0, {0, {0}}, 0, 0}
+#define PB_AudioFeatures_init_default            {0, 0, 0, 0, {PB_AudioFeatureFrame_init_default, PB_AudioFeatureFrame_init_default, PB_AudioFeatureFrame_init_default, PB_AudioFeatureFrame_init_default, PB_AudioFeatureFrame_init_default, PB_AudioFeatureFrame_init_default, PB_AudioFeatureFrame_init_default, PB_AudioFeatureFrame_init_default}}
+#define PB_AudioFeatureConfig_init_default       {0, 0, 0}
 #define PB_FromSmartKnob_init_zero               {0, 0, {PB_Knob_init_zero}}
 #define PB_ToSmartknob_init_zero                 {0, 0, 0, {PB_RequestState_init_zero}}
 #define PB_Knob_init_zero                        {"", "", false, PB_PersistentConfiguration_init_zero}
@@ -304,6 +361,10 @@ extern "C" {
 #define PB_MotorCalibration_init_zero            {0, 0, 0, 0}
 #define PB_StrainState_init_zero                 {0, 0}
 #define PB_StrainCalibration_init_zero           {0}
+#define PB_LedEffectProgram_init_zero            {0, {0, {0}}, 0, 0}
+#define PB_AudioFeatureFrame_init_zero           {0, {0, {0}}, 0, 0}
+#define PB_AudioFeatures_init_zero               {0, 0, 0, 0, {PB_AudioFeatureFrame_init_zero, PB_AudioFeatureFrame_init_zero, PB_AudioFeatureFrame_init_zero, PB_AudioFeatureFrame_init_zero, PB_AudioFeatureFrame_init_zero, PB_AudioFeatureFrame_init_zero, PB_AudioFeatureFrame_init_zero, PB_AudioFeatureFrame_init_zero}}
+#define PB_AudioFeatureConfig_init_zero          {0, 0, 0}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define PB_MotorCalibState_calibrated_tag        1
@@ -348,15 +409,33 @@ extern "C" {
 #define PB_FromSmartKnob_smartknob_state_tag     6
 #define PB_FromSmartKnob_motor_calib_state_tag   7
 #define PB_FromSmartKnob_strain_calib_state_tag  8
+#define PB_FromSmartKnob_audio_features_tag      9
 #define PB_StrainState_press_weight_tag          1
 #define PB_StrainState_press_value_tag           2
 #define PB_StrainCalibration_calibration_weight_tag 1
+#define PB_LedEffectProgram_slot_tag             1
+#define PB_LedEffectProgram_program_tag          2
+#define PB_LedEffectProgram_persist_tag          3
+#define PB_LedEffectProgram_play_tag             4
+#define PB_AudioFeatureFrame_offset_ms_tag       1
+#define PB_AudioFeatureFrame_bands_tag           2
+#define PB_AudioFeatureFrame_rms_tag             3
+#define PB_AudioFeatureFrame_beat_tag            4
+#define PB_AudioFeatures_sequence_tag            1
+#define PB_AudioFeatures_start_ms_tag            2
+#define PB_AudioFeatures_bpm_tag                 3
+#define PB_AudioFeatures_frames_tag              4
+#define PB_AudioFeatureConfig_enabled_tag        1
+#define PB_AudioFeatureConfig_frame_interval_ms_tag 2
+#define PB_AudioFeatureConfig_batch_frames_tag   3
 #define PB_ToSmartknob_protocol_version_tag      1
 #define PB_ToSmartknob_nonce_tag                 2
 #define PB_ToSmartknob_request_state_tag         3
 #define PB_ToSmartknob_smartknob_config_tag      4
 #define PB_ToSmartknob_smartknob_command_tag     5
 #define PB_ToSmartknob_strain_calibration_tag    6
+#define PB_ToSmartknob_led_effect_program_tag    7
+#define PB_ToSmartknob_audio_feature_config_tag  8
 
 /* Struct field encoding specification for nanopb */
 #define PB_FromSmartKnob_FIELDLIST(X, a) \
@@ -366,7 +445,8 @@ X(a, STATIC,   ONEOF,    MESSAGE,  (payload,ack,payload.ack),   4) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,log,payload.log),   5) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,smartknob_state,payload.smartknob_state),   6) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,motor_calib_state,payload.motor_calib_state),   7) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (payload,strain_calib_state,payload.strain_calib_state),   8)
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,strain_calib_state,payload.strain_calib_state),   8) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,audio_features,payload.audio_features),   9)
 #define PB_FromSmartKnob_CALLBACK NULL
 #define PB_FromSmartKnob_DEFAULT NULL
 #define PB_FromSmartKnob_payload_knob_MSGTYPE PB_Knob
@@ -375,6 +455,7 @@ X(a, STATIC,   ONEOF,    MESSAGE,  (payload,strain_calib_state,payload.strain_ca
 #define PB_FromSmartKnob_payload_smartknob_state_MSGTYPE PB_SmartKnobState
 #define PB_FromSmartKnob_payload_motor_calib_state_MSGTYPE PB_MotorCalibState
 #define PB_FromSmartKnob_payload_strain_calib_state_MSGTYPE PB_StrainCalibState
+#define PB_FromSmartKnob_payload_audio_features_MSGTYPE PB_AudioFeatures
 
 #define PB_ToSmartknob_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, UINT32,   protocol_version,   1) \
@@ -382,12 +463,16 @@ X(a, STATIC,   SINGULAR, UINT32,   nonce,             2) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,request_state,payload.request_state),   3) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (payload,smartknob_config,payload.smartknob_config),   4) \
 X(a, STATIC,   ONEOF,    UENUM,    (payload,smartknob_command,payload.smartknob_command),   5) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (payload,strain_calibration,payload.strain_calibration),   6)
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,strain_calibration,payload.strain_calibration),   6) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,led_effect_program,payload.led_effect_program),   7) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (payload,audio_feature_config,payload.audio_feature_config),   8)
 #define PB_ToSmartknob_CALLBACK NULL
 #define PB_ToSmartknob_DEFAULT NULL
 #define PB_ToSmartknob_payload_request_state_MSGTYPE PB_RequestState
 #define PB_ToSmartknob_payload_smartknob_config_MSGTYPE PB_SmartKnobConfig
 #define PB_ToSmartknob_payload_strain_calibration_MSGTYPE PB_StrainCalibration
+#define PB_ToSmartknob_payload_led_effect_program_MSGTYPE PB_LedEffectProgram
+#define PB_ToSmartknob_payload_audio_feature_config_MSGTYPE PB_AudioFeatureConfig
 
 #define PB_Knob_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, STRING,   mac_address,       1) \
@@ -479,6 +564,38 @@ X(a, STATIC,   SINGULAR, FLOAT,    calibration_weight,   1)
 #define PB_StrainCalibration_CALLBACK NULL
 #define PB_StrainCalibration_DEFAULT NULL
 
+#define PB_LedEffectProgram_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UINT32,   slot,              1) \
+X(a, STATIC,   SINGULAR, BYTES,    program,           2) \
+X(a, STATIC,   SINGULAR, BOOL,     persist,           3) \
+X(a, STATIC,   SINGULAR, BOOL,     play,              4)
+#define PB_LedEffectProgram_CALLBACK NULL
+#define PB_LedEffectProgram_DEFAULT NULL
+
+#define PB_AudioFeatureFrame_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UINT32,   offset_ms,         1) \
+X(a, STATIC,   SINGULAR, BYTES,    bands,             2) \
+X(a, STATIC,   SINGULAR, UINT32,   rms,               3) \
+X(a, STATIC,   SINGULAR, BOOL,     beat,              4)
+#define PB_AudioFeatureFrame_CALLBACK NULL
+#define PB_AudioFeatureFrame_DEFAULT NULL
+
+#define PB_AudioFeatures_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UINT32,   sequence,          1) \
+X(a, STATIC,   SINGULAR, UINT32,   start_ms,          2) \
+X(a, STATIC,   SINGULAR, FLOAT,    bpm,               3) \
+X(a, STATIC,   REPEATED, MESSAGE,  frames,            4)
+#define PB_AudioFeatures_CALLBACK NULL
+#define PB_AudioFeatures_DEFAULT NULL
+#define PB_AudioFeatures_frames_MSGTYPE PB_AudioFeatureFrame
+
+#define PB_AudioFeatureConfig_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, BOOL,     enabled,           1) \
+X(a, STATIC,   SINGULAR, UINT32,   frame_interval_ms,   2) \
+X(a, STATIC,   SINGULAR, UINT32,   batch_frames,      3)
+#define PB_AudioFeatureConfig_CALLBACK NULL
+#define PB_AudioFeatureConfig_DEFAULT NULL
+
 extern const pb_msgdesc_t PB_FromSmartKnob_msg;
 extern const pb_msgdesc_t PB_ToSmartknob_msg;
 extern const pb_msgdesc_t PB_Knob_msg;
@@ -493,6 +610,10 @@ extern const pb_msgdesc_t PB_PersistentConfiguration_msg;
 extern const pb_msgdesc_t PB_MotorCalibration_msg;
 extern const pb_msgdesc_t PB_StrainState_msg;
 extern const pb_msgdesc_t PB_StrainCalibration_msg;
+extern const pb_msgdesc_t PB_LedEffectProgram_msg;
+extern const pb_msgdesc_t PB_AudioFeatureFrame_msg;
+extern const pb_msgdesc_t PB_AudioFeatures_msg;
+extern const pb_msgdesc_t PB_AudioFeatureConfig_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define PB_FromSmartKnob_fields &PB_FromSmartKnob_msg
@@ -509,11 +630,19 @@ extern const pb_msgdesc_t PB_StrainCalibration_msg;
 #define PB_MotorCalibration_fields &PB_MotorCalibration_msg
 #define PB_StrainState_fields &PB_StrainState_msg
 #define PB_StrainCalibration_fields &PB_StrainCalibration_msg
+#define PB_LedEffectProgram_fields &PB_LedEffectProgram_msg
+#define PB_AudioFeatureFrame_fields &PB_AudioFeatureFrame_msg
+#define PB_AudioFeatures_fields &PB_AudioFeatures_msg
+#define PB_AudioFeatureConfig_fields &PB_AudioFeatureConfig_msg
 
 /* Maximum encoded size of messages (where known) */
 #define PB_Ack_size                              6
+#define PB_AudioFeatureConfig_size               9
+#define PB_AudioFeatureFrame_size                43
+#define PB_AudioFeatures_size                    377
 #define PB_FromSmartKnob_size                    399
 #define PB_Knob_size                             134
+#define PB_LedEffectProgram_size                 266
 #define PB_Log_size                              393
 #define PB_MotorCalibState_size                  2
 #define PB_MotorCalibration_size                 15
@@ -525,7 +654,7 @@ extern const pb_msgdesc_t PB_StrainCalibration_msg;
 #define PB_StrainCalibState_size                 11
 #define PB_StrainCalibration_size                5
 #define PB_StrainState_size                      16
-#define PB_ToSmartknob_size                      196
+#define PB_ToSmartknob_size                      278
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -51,7 +51,15 @@ RootTask::RootTask(
                                  [this]()
                                  { motor_task_.runCalibration(); },
                                  [this](float calibration_weight)
-                                 { sensors_task_->factoryStrainCalibrationCallback(calibration_weight); })
+                                 { sensors_task_->factoryStrainCalibrationCallback(calibration_weight); },
+                                 [this](PB_LedEffectProgram &program)
+                                 {
+#if SK_LEDS
+                                     LedProgramStore::getInstance().store(program.slot, program.program.bytes, program.program.size, program.persist, program.play);
+#else
+                                     LOGW("LED programs need SK_LEDS");
+#endif
+                                 })
 
 {
 #if SK_DISPLAY
@@ -73,8 +81,6 @@ RootTask::RootTask(
     connectivity_status_queue_ = xQueueCreate(1, sizeof(ConnectivityState));
     assert(connectivity_status_queue_ != NULL);
 
-    sensors_status_queue_ = xQueueCreate(100, sizeof(SensorsState));
-    assert(sensors_status_queue_ != NULL);
 #if SK_MICROPHONE
     microphone_status_queue_ = xQueueCreate(5, sizeof(MicrophoneState));
     assert(microphone_status_queue_ != NULL);
@@ -223,6 +229,9 @@ void RootTask::run()
                 configuration_->saveWiFiConfiguration(wifi_config);
             }
             break;
+            case SK_MUSIC_BEAT:
+                // Only the apps follow the music, they got it above
+                break;
 #if SK_MQTT
             case SK_RESET_ERROR:
             {
@@ -325,8 +334,31 @@ void RootTask::run()
             }
         }
 #endif
-        if (xQueueReceive(sensors_status_queue_, &latest_sensors_state_, 0) == pdTRUE)
+        SensorsChannel &sensors = SensorsChannel::getInstance();
+        sensors.illumination.read(&latest_sensors_state_.illumination);
+
+        // The button code only changes through edges, one per iteration so updateHardware acts on every transition
+        StrainState strain;
+        if (sensors.strain.read(&strain))
+        {
+            latest_sensors_state_.strain.raw_value = strain.raw_value;
+            latest_sensors_state_.strain.press_value = strain.press_value;
+        }
+        ButtonEdge edge;
+        if (!button_edge_pending_ && sensors.takeButtonEdge(&edge))
         {
+            latest_sensors_state_.strain.virtual_button_code = edge.virtual_button_code;
+            button_edge_captured_us_ = edge.captured_us;
+            button_edge_pending_ = true;
+        }
+
+        uint32_t proximity_sequence;
+        uint32_t proximity_captured_us;
+        if (sensors.proximity.read(&latest_sensors_state_.proximity, &proximity_captured_us, &proximity_sequence) && proximity_sequence != proximity_sequence_)
+        {
+            proximity_sequence_ = proximity_sequence;
+            recordSensorLatency(pipeline_latency_window_.proximity, proximity_captured_us);
+
             app_state.proximiti_state.RangeMilliMeter = latest_sensors_state_.proximity.RangeMilliMeter;
             app_state.proximiti_state.RangeStatus = latest_sensors_state_.proximity.RangeStatus;
 
@@ -345,11 +377,8 @@ void RootTask::run()
 #if SK_MICROPHONE
         if (xQueueReceive(microphone_status_queue_, &latest_microphone_state_, 0) == pdTRUE)
         {
-            // Update app state with microphone FFT data
-            // We could potentially use this data to drive LED effects or other features
-
-            // For example, if we detect high audio activity in a specific frequency band,
-            // we could trigger special effects
+            // The LED ring and the discoball app read the bands themselves through
+            // AudioBandsChannel, here we only decide whether the audio effect should run
 
             // Audio reaction thresholds - may need tuning
             const float LOW_THRESHOLD = 0.1f;
@@ -360,8 +389,8 @@ void RootTask::run()
                 latest_microphone_state_.fft_mid_band > MID_THRESHOLD ||
                 latest_microphone_state_.fft_high_band > HIGH_THRESHOLD)
             {
-
-                // Audio activity detected - could trigger LED effects or other reactions
+                audio_heard_ = true;
+                last_audio_activity_ms_ = millis();
 
                 // For debugging
                 LOGD("Audio activity: Low: %.2f, Mid: %.2f, High: %.2f",
@@ -473,6 +502,12 @@ void RootTask::run()
         os_config_notifier_.loopTick();
 
         updateHardware(&app_state);
+        if (button_edge_pending_)
+        {
+            recordSensorLatency(pipeline_latency_window_.button, button_edge_captured_us_);
+            button_edge_pending_ = false;
+        }
+        updatePipelineLatency();
 
         if (app_state.screen_state.has_been_engaged == true)
         {
@@ -493,6 +528,52 @@ void RootTask::run()
     }
 }
 
+void RootTask::recordSensorLatency(SensorLatencyStats &stats, uint32_t captured_us)
+{
+    uint32_t latency_us = micros() - captured_us;
+    stats.updates++;
+    stats.total_us += latency_us;
+    if (latency_us > stats.max_us)
+    {
+        stats.max_us = latency_us;
+    }
+}
+
+void RootTask::updatePipelineLatency()
+{
+    if (millis() - pipeline_latency_window_started_ms_ < PIPELINE_LATENCY_INTERVAL_MS)
+    {
+        return;
+    }
+
+    for (SensorLatencyStats *latency : {&pipeline_latency_window_.proximity, &pipeline_latency_window_.button})
+    {
+        latency->avg_us = latency->updates > 0 ? latency->total_us / latency->updates : 0;
+    }
+    pipeline_latency_window_.dropped_button_edges = SensorsChannel::getInstance().droppedButtonEdges();
+
+    {
+        SemaphoreGuard lock(mutex_);
+        pipeline_latency_ = pipeline_latency_window_;
+    }
+
+#if SK_SENSORS_BENCHMARK
+    LOGD("Sensors to updateHardware: proximity %d updates, avg %dus, max %dus; button %d edges, avg %dus, max %dus; %d edges dropped",
+         pipeline_latency_window_.proximity.updates, pipeline_latency_window_.proximity.avg_us, pipeline_latency_window_.proximity.max_us,
+         pipeline_latency_window_.button.updates, pipeline_latency_window_.button.avg_us, pipeline_latency_window_.button.max_us,
+         pipeline_latency_window_.dropped_button_edges);
+#endif
+
+    pipeline_latency_window_ = {};
+    pipeline_latency_window_started_ms_ = millis();
+}
+
+SensorPipelineLatency RootTask::getSensorPipelineLatency()
+{
+    SemaphoreGuard lock(mutex_);
+    return pipeline_latency_;
+}
+
 void RootTask::updateHardware(AppState *app_state)
 {
     static bool pressed;
@@ -605,7 +686,7 @@ void RootTask::updateHardware(AppState *app_state)
 
     if (led_ring_task_ != nullptr)
     {
-        EffectSettings effect_settings;
+        EffectSettings effect_settings = {};
         // THERE ARE 3 potential range of the display
         // 1- Engaged
         // 2- Not Engaged and enviroment brightness is high
@@ -617,8 +698,17 @@ void RootTask::updateHardware(AppState *app_state)
 
         if (brightness > app_state->screen_state.MIN_LCD_BRIGHTNESS)
         {
-            // case 1. FADE-IN led
-            effect_settings.effect_id = 4; // FADE-IN
+            // case 1. FADE-IN led, or the audio effect while there is sound around, unless an uploaded program was picked
+            // Elapsed time rather than a deadline, so the check survives millis() wrapping
+            bool audio_active = audio_heard_ && millis() - last_audio_activity_ms_ < AUDIO_ACTIVE_HOLD_MS;
+            effect_settings.effect_id = audio_active ? LED_EFFECT_AUDIO : LED_EFFECT_FADE_IN;
+#if SK_LEDS
+            int8_t program_slot = LedProgramStore::getInstance().playSlot();
+            if (program_slot >= 0)
+            {
+                effect_settings.effect_id = LED_EFFECT_PROGRAM + program_slot;
+            }
+#endif
             effect_settings.effect_start_pixel = 0;
             effect_settings.effect_end_pixel = NUM_LEDS;
             effect_settings.effect_accent_pixel = 0;
@@ -626,6 +716,9 @@ void RootTask::updateHardware(AppState *app_state)
             // TODO: add conversion from HUE to RGB
             // latest_config_.led_hue;
             effect_settings.effect_main_color = (0 << 16) | (128 << 8) | 128;
+            // Knob position on top while the user is engaged, the accent colour also flashes on beats
+            effect_settings.effect_accent_color = (255 << 16) | (255 << 8) | 255;
+            effect_settings.effect_knob_arc = effect_settings.effect_id != LED_EFFECT_AUDIO;
             led_ring_task_->setEffect(effect_settings);
         }
         else if (brightness == app_state->screen_state.MIN_LCD_BRIGHTNESS)
@@ -648,7 +741,6 @@ void RootTask::updateHardware(AppState *app_state)
             effect_settings.effect_main_color = (0 << 16) | (128 << 8) | 128;
             led_ring_task_->setEffect(effect_settings);
         }
-        led_ring_task_->setEffect(effect_settings);
 
         // latest_config_.led_hue
         // led_ring_task_->setEffect(0, 0, 0, NUM_LEDS, 0, (blue << 16) | (green << 8) | red, (blue << 16) | (green << 8) | red);
@@ -705,11 +797,6 @@ QueueHandle_t RootTask::getConnectivityStateQueue()
     return connectivity_status_queue_;
 }
 
-QueueHandle_t RootTask::getSensorsStateQueue()
-{
-    return sensors_status_queue_;
-}
-
 QueueHandle_t RootTask::getMicrophoneStateQueue()
 {
     return microphone_status_queue_;
@@ -27,6 +27,19 @@
 
 void delete_me_TriggerMotorCalibration();
 
+// How long the LED ring keeps the audio effect after the last audio activity
+const uint32_t AUDIO_ACTIVE_HOLD_MS = 3000;
+const uint32_t PIPELINE_LATENCY_INTERVAL_MS = 5000;
+
+// From the capture of a sensor sample to updateHardware() acting on it
+struct SensorPipelineLatency
+{
+    SensorLatencyStats proximity;
+    SensorLatencyStats button;
+    // Button edges lost because RootTask fell behind, since boot
+    uint32_t dropped_button_edges;
+};
+
 class RootTask : public Task<RootTask>
 {
 
@@ -41,10 +54,12 @@ public:
 
     QueueHandle_t getConnectivityStateQueue();
     QueueHandle_t getMqttStateQueue();
-    QueueHandle_t getSensorsStateQueue();
     QueueHandle_t getMicrophoneStateQueue();
     QueueHandle_t getAppSyncQueue();
 
+    // Counters of the last completed stats window
+    SensorPipelineLatency getSensorPipelineLatency();
+
 protected:
     void run();
 
@@ -89,7 +104,20 @@ private:
     ConnectivityState latest_connectivity_state_ = {};
     MqttState latest_mqtt_state_ = {};
     SensorsState latest_sensors_state_ = {};
+    uint32_t proximity_sequence_ = 0;
+    // Edge taken from SensorsChannel that updateHardware() has not seen yet
+    bool button_edge_pending_ = false;
+    uint32_t button_edge_captured_us_ = 0;
+
+    SensorPipelineLatency pipeline_latency_ = {};
+    SensorPipelineLatency pipeline_latency_window_ = {};
+    unsigned long pipeline_latency_window_started_ms_ = 0;
+    void recordSensorLatency(SensorLatencyStats &stats, uint32_t captured_us);
+    void updatePipelineLatency();
     MicrophoneState latest_microphone_state_ = {};
+    // The LED ring shows the audio effect for AUDIO_ACTIVE_HOLD_MS after the last sound
+    bool audio_heard_ = false;
+    unsigned long last_audio_activity_ms_ = 0;
 
     cJSON *apps_ = NULL;
 
@@ -98,7 +126,6 @@ private:
 
     QueueHandle_t connectivity_status_queue_;
     QueueHandle_t mqtt_status_queue_;
-    QueueHandle_t sensors_status_queue_;
     QueueHandle_t microphone_status_queue_;
 
     QueueHandle_t app_sync_queue_;
@@ -0,0 +1,145 @@
+#include "hx711_reader.h"
+
+bool Hx711Reader::begin(uint8_t dout_pin, uint8_t sck_pin)
+{
+    dout_pin_ = dout_pin;
+    sck_pin_ = sck_pin;
+
+    pinMode(sck_pin_, OUTPUT);
+    pinMode(dout_pin_, INPUT_PULLUP);
+
+    powerUp();
+    attachInterruptArg(digitalPinToInterrupt(dout_pin_), onDataReady, this, FALLING);
+    return true;
+}
+
+void IRAM_ATTR Hx711Reader::onDataReady(void *arg)
+{
+    static_cast<Hx711Reader *>(arg)->clockOut();
+}
+
+void IRAM_ATTR Hx711Reader::clockOut()
+{
+    uint32_t value = 0;
+    uint32_t captured_us = micros();
+
+    portENTER_CRITICAL_SAFE(&mux_);
+    // DOUT also falls while the bits are shifted out, those edges find it high again
+    if (!powered_ || digitalRead(dout_pin_) == HIGH)
+    {
+        portEXIT_CRITICAL_SAFE(&mux_);
+        return;
+    }
+    for (uint8_t i = 0; i < 24; i++)
+    {
+        digitalWrite(sck_pin_, HIGH);
+        delayMicroseconds(1);
+        value = (value << 1) | digitalRead(dout_pin_);
+        digitalWrite(sck_pin_, LOW);
+        delayMicroseconds(1);
+    }
+    // The 25th pulse keeps channel A at gain 128 for the next conversion
+    digitalWrite(sck_pin_, HIGH);
+    delayMicroseconds(1);
+    digitalWrite(sck_pin_, LOW);
+
+    // Still inside the critical section, read() may clock out a stalled conversion from task context
+    if (settle_remaining_ > 0)
+    {
+        settle_remaining_--;
+    }
+    else
+    {
+        push((int32_t)(value << 8) >> 8, captured_us);
+    }
+    portEXIT_CRITICAL_SAFE(&mux_);
+}
+
+void IRAM_ATTR Hx711Reader::push(int32_t raw, uint32_t captured_us)
+{
+    last_raw_ = raw;
+    last_us_ = captured_us;
+    // Single writer, a plain store avoids an atomic read-modify-write
+    count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+    uint16_t head = head_.load(std::memory_order_relaxed);
+    if ((uint16_t)(head - tail_.load(std::memory_order_acquire)) >= HX711_RING_SIZE)
+    {
+        overruns_++;
+        return;
+    }
+    ring_[head % HX711_RING_SIZE] = {raw, captured_us};
+    head_.store(head + 1, std::memory_order_release);
+}
+
+bool Hx711Reader::read(StrainSample *sample)
+{
+    uint16_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire))
+    {
+        // If DOUT fell before the interrupt was attached no edge will ever come, clock the conversion out here
+        if (powered_ && digitalRead(dout_pin_) == LOW && micros() - last_us_ > HX711_STALL_US)
+        {
+            clockOut();
+        }
+        return false;
+    }
+
+    *sample = ring_[tail % HX711_RING_SIZE];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool Hx711Reader::waitAverage(uint8_t count, uint32_t timeout_ms, float *average)
+{
+    uint32_t seen = count_.load(std::memory_order_acquire);
+    uint8_t collected = 0;
+    float sum = 0;
+    unsigned long started_ms = millis();
+
+    while (collected < count)
+    {
+        if (millis() - started_ms > timeout_ms)
+        {
+            return false;
+        }
+        uint32_t current = count_.load(std::memory_order_acquire);
+        if (current == seen)
+        {
+            delay(1);
+            continue;
+        }
+        // Conversions that arrived between two polls only count once
+        sum += last_raw_;
+        collected++;
+        seen = current;
+    }
+
+    *average = sum / count;
+    return true;
+}
+
+void Hx711Reader::powerDown()
+{
+    portENTER_CRITICAL(&mux_);
+    powered_ = false;
+    digitalWrite(sck_pin_, LOW);
+    digitalWrite(sck_pin_, HIGH);
+    portEXIT_CRITICAL(&mux_);
+}
+
+void Hx711Reader::powerUp()
+{
+    portENTER_CRITICAL(&mux_);
+    settle_remaining_ = HX711_SETTLE_SAMPLES;
+    powered_ = true;
+    digitalWrite(sck_pin_, LOW);
+    portEXIT_CRITICAL(&mux_);
+}
+
+void Hx711Reader::reset()
+{
+    powerDown();
+    delayMicroseconds(100);
+    powerUp();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <atomic>
+
+// One HX711 conversion, channel A at gain 128
+struct StrainSample
+{
+    // 24-bit two's complement count, sign extended
+    int32_t raw;
+    // micros() when DOUT signalled the conversion
+    uint32_t captured_us;
+};
+
+// Must be a power of two, 32 samples last 400ms at 80 samples/s
+const uint8_t HX711_RING_SIZE = 32;
+// Conversions dropped after power up while the output settles
+const uint8_t HX711_SETTLE_SAMPLES = 4;
+// A conversion that is ready but was not clocked out for this long lost its edge
+const uint32_t HX711_STALL_US = 200000;
+
+// Interrupt-driven HX711 reader.
+//
+// The HX711 pulls DOUT low when a conversion is ready. A falling-edge interrupt
+// clocks the 24 bits out right away and pushes the count, timestamped, into a
+// single-producer single-consumer ring. The sensors task drains the ring at the
+// converter's own rate (10 or 80 samples/s, set by its RATE pin) and never
+// waits for the chip.
+//
+// Clocking out takes about 50us with interrupts masked; SCK must not stay high
+// for 60us or the HX711 powers down.
+class Hx711Reader
+{
+public:
+    bool begin(uint8_t dout_pin, uint8_t sck_pin);
+
+    // Oldest unread sample, false if none is pending. Only one task may read.
+    bool read(StrainSample *sample);
+
+    // Averages the raw counts of the next count conversions without taking them
+    // from the ring, so other tasks can use it during calibration
+    bool waitAverage(uint8_t count, uint32_t timeout_ms, float *average);
+
+    // Holding SCK high powers the HX711 down, conversions resume after powerUp()
+    void powerDown();
+    void powerUp();
+    // Power cycles the HX711, the first conversions afterwards are dropped
+    void reset();
+    bool powered() { return powered_; }
+
+    // Conversions lost because the ring was full
+    uint32_t overruns() { return overruns_; }
+
+private:
+    uint8_t dout_pin_ = 0;
+    uint8_t sck_pin_ = 0;
+    volatile bool powered_ = false;
+    volatile uint8_t settle_remaining_ = HX711_SETTLE_SAMPLES;
+
+    // Only clockOut() moves head_, only read() moves tail_
+    StrainSample ring_[HX711_RING_SIZE];
+    std::atomic<uint16_t> head_{0};
+    std::atomic<uint16_t> tail_{0};
+    volatile uint32_t overruns_ = 0;
+
+    // Newest conversion, for waitAverage()
+    volatile int32_t last_raw_ = 0;
+    volatile uint32_t last_us_ = 0;
+    std::atomic<uint32_t> count_{0};
+
+    portMUX_TYPE mux_ = portMUX_INITIALIZER_UNLOCKED;
+
+    static void IRAM_ATTR onDataReady(void *arg);
+    void IRAM_ATTR clockOut();
+    void IRAM_ATTR push(int32_t raw, uint32_t captured_us);
+};
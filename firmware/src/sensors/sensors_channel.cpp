@@ -0,0 +1,22 @@
+#include "sensors_channel.h"
+
+SensorsChannel::SensorsChannel()
+{
+    button_edges_ = xQueueCreate(SENSORS_BUTTON_EDGE_QUEUE_DEPTH, sizeof(ButtonEdge));
+    assert(button_edges_ != NULL);
+}
+
+bool SensorsChannel::pushButtonEdge(const ButtonEdge &edge)
+{
+    if (xQueueSendToBack(button_edges_, &edge, 0) != pdTRUE)
+    {
+        dropped_edges_++;
+        return false;
+    }
+    return true;
+}
+
+bool SensorsChannel::takeButtonEdge(ButtonEdge *edge)
+{
+    return xQueueReceive(button_edges_, edge, 0) == pdTRUE;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <atomic>
+
+#include "../app_config.h"
+#include "../latest_value.h"
+
+// Button transitions RootTask has not handled yet, a press and its release take at most three
+const uint8_t SENSORS_BUTTON_EDGE_QUEUE_DEPTH = 16;
+
+// A change of the strain virtual button
+struct ButtonEdge
+{
+    uint8_t virtual_button_code;
+    float press_value;
+    // micros() when the conversion that caused the change was captured
+    uint32_t captured_us;
+};
+
+// Sample to consumer latency over one stats window
+struct SensorLatencyStats
+{
+    uint32_t updates;
+    uint64_t total_us;
+    uint32_t avg_us;
+    uint32_t max_us;
+};
+
+// Sensor readings from SensorsTask to RootTask and anyone else interested.
+//
+// Every sensor has its own latest-value slot, so a reader always gets the
+// newest reading of each and never works through a backlog of stale ones.
+// Button transitions are edges that must not be collapsed, they go through
+// a small queue instead.
+class SensorsChannel
+{
+public:
+    static SensorsChannel &getInstance()
+    {
+        static SensorsChannel instance;
+        return instance;
+    }
+
+    LatestValue<ProximityState> proximity;
+    LatestValue<StrainState> strain;
+    LatestValue<IlluminationState> illumination;
+    LatestValue<SystemState> system;
+
+    // Sensors task only, false if the queue was full and the edge was dropped
+    bool pushButtonEdge(const ButtonEdge &edge);
+    // Oldest unhandled edge, false if there is none
+    bool takeButtonEdge(ButtonEdge *edge);
+
+    uint32_t droppedButtonEdges() { return dropped_edges_; }
+
+private:
+    SensorsChannel();
+
+    QueueHandle_t button_edges_;
+    std::atomic<uint32_t> dropped_edges_{0};
+};
@@ -1,6 +1,11 @@
 #include "sensors_task.h"
 #include "semaphore_guard.h"
 #include "util.h"
+#include "filters.h"
+
+#if SK_STRAIN_BENCHMARK
+#include "../configuration.h"
+#endif
 
 // todo: think on thise compilation flags
 
@@ -9,32 +14,27 @@ static const char *TAG = "sensors_task";
 SensorsTask::SensorsTask(const uint8_t task_core, Configuration *configuration) : Task{"Sensors", 1024 * 8, 0, task_core}, configuration_(configuration)
 {
     mutex_ = xSemaphoreCreateMutex();
-
-    sensors_state_queue_ = xQueueCreate(50, sizeof(SensorsState));
-    assert(sensors_state_queue_ != NULL);
     assert(mutex_ != NULL);
 }
 
 SensorsTask::~SensorsTask()
 {
-    vQueueDelete(sensors_state_queue_);
-
     vSemaphoreDelete(mutex_);
 }
 
 void SensorsTask::run()
 {
+#if SK_FILTER_BENCHMARK
+    benchmarkFilters(100000);
+#endif
+
     Wire.begin(PIN_SDA, PIN_SCL);
     // TODO make this configurable
     Wire.setClock(400000);
 
 #if SK_STRAIN
+    // Conversions are clocked out by the DOUT interrupt from here on
     strain.begin(PIN_STRAIN_DO, PIN_STRAIN_SCK);
-    while (!strain.is_ready())
-    {
-        LOGD("Strain sensor not ready, waiting...");
-        delay(100);
-    }
     if (configuration_->get().strain_scale == 0)
     {
         calibration_scale_ = 1.0f;
@@ -44,14 +44,11 @@ void SensorsTask::run()
         calibration_scale_ = configuration_->get().strain_scale;
     }
     LOGD("Strain scale set at boot, %f", calibration_scale_);
-    strain.set_scale(calibration_scale_);
-    delay(100);
-    strain.set_offset(0);
-    strain.tare();
-    delay(100);
+    strain_scale_ = calibration_scale_;
 
     strain_powered = true;
-    raw_initial_value_ = strain.get_units(10);
+    strain_tare_requested_ = true;
+    raw_initial_value_ = 0;
 #endif
 
     if (!vl6180x.begin())
@@ -61,48 +58,36 @@ void SensorsTask::run()
     else
     {
         LOGI("VL6180X initialized successfully");
+        // Range and ambient light run continuously from here on, the loop only collects results
+        proximity_sampler_.begin(&Wire);
     }
 
-    // Initialize moving average filters
-    MovingAverage lux_filter(10);
-    MovingAverage range_filter(10);
+    // Initialize moving average filter
+    MovingAverage<10> lux_filter;
 
-    unsigned long last_proximity_check_ms = 0;
-    unsigned long last_strain_check_ms = 0;
-    unsigned long last_tare_ms = 0;
+    unsigned long last_strain_sample_ms = millis();
     unsigned long last_illumination_check_ms = 0;
 
     unsigned long log_ms_calib = 10000;
     unsigned long log_ms = 0;
     unsigned long log_ms_strain = 0;
 
-    const uint8_t proximity_poling_rate_hz = 20;
-    const uint8_t strain_poling_rate_hz = 120;
     const uint8_t illumination_poling_rate_hz = 1;
 
-    // How far button is pressed, in range [0, 1]
-    float press_value_unit = 0;
-    float strain_reading_raw = 0;
+    // Ambient light comes with every range reading, it is averaged over each illumination period
+    Vl6180xReading proximity_reading;
+    float lux_sum = 0;
+    uint16_t lux_count = 0;
 
     char buf_[128];
 
-    // strain sensor and buttons
-    unsigned long short_pressed_triggered_at_ms = 0;
-    const unsigned long long_press_timeout_ms = 500;
-
-    // strain breaking points
-    const float strain_released = 0.3;
-    const float strain_pressed = 1.0;
-
-    // strain value filtering
-    double strain_filtered;
-    MovingAverage strain_filter(10);
-
     // system temperature
     long last_system_temperature_check = 0;
     float last_system_temperature = 0;
 
-    uint8_t discarded_strain_reading_count = 0;
+#if SK_STRAIN
+    StrainSample strain_sample;
+#endif
 
     while (1)
     {
@@ -111,14 +96,15 @@ void SensorsTask::run()
             temp_sensor_read_celsius(&last_system_temperature);
 
             sensors_state.system.esp32_temperature = last_system_temperature;
+            SensorsChannel::getInstance().system.publish(sensors_state.system, micros());
 
             last_system_temperature_check = millis();
         }
 
-        if (millis() - last_proximity_check_ms > 1000 / proximity_poling_rate_hz)
+        if (proximity_sampler_.poll(&proximity_reading))
         {
-            uint8_t range = vl6180x.readRange();
-            uint8_t status = vl6180x.readRangeStatus();
+            uint8_t range = proximity_reading.range_mm;
+            uint8_t status = proximity_reading.range_status;
 
             if (status == 0)
             { // 0 means no error
@@ -131,15 +117,38 @@ void SensorsTask::run()
                 sensors_state.proximity.RangeStatus = status;
             }
 
-            publishState(sensors_state);
-            last_proximity_check_ms = millis();
+            lux_sum += proximity_reading.lux;
+            lux_count++;
+
+            SensorsChannel::getInstance().proximity.publish(sensors_state.proximity, proximity_reading.captured_us);
         }
 #if SK_STRAIN
-        if (millis() - last_strain_check_ms > 1000 / strain_poling_rate_hz)
+        if (strain_tare_requested_)
+        {
+            strain_tare_requested_ = false;
+            strain_tare_remaining_ = STRAIN_TARE_SAMPLES;
+            strain_tare_sum_ = 0;
+        }
+
+        // Every conversion the interrupt clocked out since the last pass, at the HX711's own rate
+        while (strain.read(&strain_sample))
         {
-            if (strain_powered && strain.wait_ready_timeout(100))
+            last_strain_sample_ms = millis();
+
+            if (strain_tare_remaining_ > 0)
+            {
+                strain_tare_sum_ += strain_sample.raw;
+                if (--strain_tare_remaining_ == 0)
+                {
+                    strain_offset_ = strain_tare_sum_ / STRAIN_TARE_SAMPLES;
+                    // The offset moved, the baseline starts again from the next reading
+                    resetPressDetector(strain_sample.captured_us);
+                }
+                continue;
+            }
+
             {
-                if (calibration_scale_ == 1.0f && strain.get_scale() == 1.0f && factory_strain_calibration_step_ == 0)
+                if (calibration_scale_ == 1.0f && strain_scale_ == 1.0f && factory_strain_calibration_step_ == 0)
                 {
                     if (millis() - log_ms_calib > 10000)
                     {
@@ -157,141 +166,69 @@ void SensorsTask::run()
                 if (do_strain)
                 {
 
-                    strain_reading_raw = strain.get_units(1);
+                    bool changed = press_detector_.addSample(strainUnits(strain_sample.raw), strain_sample.captured_us);
+
+                    sensors_state.strain.raw_value = press_detector_.value();
+                    sensors_state.strain.press_value = press_detector_.pressValue();
+                    sensors_state.strain.virtual_button_code = press_detector_.buttonCode();
+
+                    if (changed && sensors_state.strain.virtual_button_code == VIRTUAL_BUTTON_SHORT_PRESSED)
+                    {
+                        LOGD("Strain sensor short press.");
+                        LOGD("Press value: %f", sensors_state.strain.press_value);
+                        LOGD("Baseline: %f, noise: %f, thresholds %f/%f", press_detector_.baseline(), press_detector_.noise(), press_detector_.pressThreshold(), press_detector_.releaseThreshold());
+                    }
 
-                    if (abs(last_strain_reading_raw_ - strain_reading_raw) > 2000)
+                    SensorsChannel::getInstance().strain.publish(sensors_state.strain, strain_sample.captured_us);
+                    if (changed)
                     {
-                        discarded_strain_reading_count++;
-                        if (discarded_strain_reading_count > 20)
-                        {
-                            LOGV(PB_LogLevel_WARNING, "Resetting strain sensor. 20 consecutive readings discarded.");
-                            strain.power_down();
-                            delay(100);
-                            strain.power_up();
-                            delay(100);
-                            strain.set_offset(0);
-                            strain.tare();
-                            delay(100);
-                            discarded_strain_reading_count = 0;
-                        }
-
-                        LOGW("Discarding strain reading, too big difference from last reading.");
-                        LOGV(PB_LogLevel_WARNING, "Current raw strain reading: %f", strain_reading_raw);
-                        LOGV(PB_LogLevel_WARNING, "Last raw strain reading: %f", last_strain_reading_raw_);
+                        SensorsChannel::getInstance().pushButtonEdge({sensors_state.strain.virtual_button_code, sensors_state.strain.press_value, strain_sample.captured_us});
                     }
-                    else
+#if SK_STRAIN_BENCHMARK
+                    recordStrainSample(strain_sample.captured_us, strainUnits(strain_sample.raw));
+#endif
+
+                    // After the edge of this sample went out, so a release from the reset follows its press
+                    if (press_detector_.consecutiveGlitches() > 20)
                     {
-                        discarded_strain_reading_count = 0;
-                        sensors_state.strain.raw_value = strain_filter.addSample(strain_reading_raw);
-
-                        // LOGD("Strain raw reading: %f", sensors_state.strain.raw_value);
-
-                        // TODO: calibrate and track (long term moving average) idle point (lower)
-                        sensors_state.strain.press_value = lerp(sensors_state.strain.raw_value, 0, PRESS_WEIGHT, 0, 1);
-
-                        if (sensors_state.strain.press_value < strain_released)
-                        {
-                            // released
-                            switch (sensors_state.strain.virtual_button_code)
-                            {
-                            case VIRTUAL_BUTTON_SHORT_PRESSED:
-                                short_pressed_triggered_at_ms = 0;
-                                sensors_state.strain.virtual_button_code = VIRTUAL_BUTTON_SHORT_RELEASED;
-                                break;
-                            case VIRTUAL_BUTTON_LONG_PRESSED:
-                                short_pressed_triggered_at_ms = 0;
-                                sensors_state.strain.virtual_button_code = VIRTUAL_BUTTON_LONG_RELEASED;
-                                break;
-                            default:
-                                short_pressed_triggered_at_ms = 0;
-                                sensors_state.strain.virtual_button_code = VIRTUAL_BUTTON_IDLE;
-                                delay(20);
-                                break;
-                            }
-                        }
-                        else if (strain_released < sensors_state.strain.press_value && sensors_state.strain.press_value < strain_pressed)
-                        {
-                            switch (sensors_state.strain.virtual_button_code)
-                            {
-
-                            case VIRTUAL_BUTTON_SHORT_PRESSED:
-                                if (short_pressed_triggered_at_ms > 0 && millis() - short_pressed_triggered_at_ms > long_press_timeout_ms)
-                                {
-                                    sensors_state.strain.virtual_button_code = VIRTUAL_BUTTON_LONG_PRESSED;
-                                }
-                                break;
-
-                            default:
-                                break;
-                            }
-                        }
-                        else if (sensors_state.strain.press_value > strain_pressed)
-                        {
-
-                            switch (sensors_state.strain.virtual_button_code)
-                            {
-                            case VIRTUAL_BUTTON_IDLE:
-                                LOGD("Strain sensor short press.");
-                                LOGD("Press value: %f", sensors_state.strain.press_value);
-                                LOGD("Raw value: %f", sensors_state.strain.raw_value);
-                                LOGD("Last press value: %f", last_press_value_);
-                                sensors_state.strain.virtual_button_code = VIRTUAL_BUTTON_SHORT_PRESSED;
-                                short_pressed_triggered_at_ms = millis();
-                                break;
-                            case VIRTUAL_BUTTON_SHORT_PRESSED:
-                                if (short_pressed_triggered_at_ms > 0 && millis() - short_pressed_triggered_at_ms > long_press_timeout_ms)
-                                {
-                                    sensors_state.strain.virtual_button_code = VIRTUAL_BUTTON_LONG_PRESSED;
-                                }
-                                break;
-                            default:
-                                break;
-                            }
-                        }
-
-                        publishState(sensors_state);
-
-                        if (sensors_state.strain.virtual_button_code == VIRTUAL_BUTTON_IDLE && millis() - short_pressed_triggered_at_ms > 100 && press_value_unit < strain_released && 0.025 < abs(sensors_state.strain.press_value - last_press_value_) < 0.1 && millis() - last_tare_ms > 10000)
-                        {
-                            // LOGD("Strain sensor tare.");
-                            strain.tare();
-                            last_tare_ms = millis();
-                        }
-
-                        last_strain_reading_raw_ = strain_reading_raw;
-                        last_press_value_ = sensors_state.strain.press_value;
-                        last_strain_check_ms = millis();
+                        LOGV(PB_LogLevel_WARNING, "Resetting strain sensor. 20 consecutive readings discarded.");
+                        strain.reset();
+                        resetPressDetector(strain_sample.captured_us);
+                        strain_tare_requested_ = true;
+                        break;
                     }
                 }
 
                 do_strain = true;
             }
+        }
+
+        if (millis() - last_strain_sample_ms > STRAIN_STALL_MS && millis() - log_ms_strain > 4000)
+        {
+            if (do_strain && strain_powered)
+            {
+                LOGD("Strain sensor not ready, waiting...");
+            }
             else
             {
-                if (do_strain && strain_powered && millis() - log_ms_strain > 4000)
-                {
-                    LOGD("Strain sensor not ready, waiting...");
-                    log_ms_strain = millis();
-                }
-                else if (millis() - log_ms_strain > 4000)
-                {
-                    LOGD("Strain sensor is disabled. (Might be because of factory calib or its powered off because no engagement of knob)");
-                    log_ms_strain = millis();
-                }
+                LOGD("Strain sensor is disabled. (Might be because of factory calib or its powered off because no engagement of knob)");
             }
+            log_ms_strain = millis();
         }
 #endif
 
-        if (millis() - last_illumination_check_ms > 1000 / illumination_poling_rate_hz)
+        if (millis() - last_illumination_check_ms > 1000 / illumination_poling_rate_hz && lux_count > 0)
         {
-            // Read lux with default gain (VL6180X_ALS_GAIN_1)
-            float lux = vl6180x.readLux(VL6180X_ALS_GAIN_1);
+            float lux = lux_sum / lux_count;
+            lux_sum = 0;
+            lux_count = 0;
             float lux_avg = lux_filter.addSample(lux);
             float luminosity_adjustment = min(1.0f, lux_avg / 1000.0f); // Normalize to 0-1 range
 
             sensors_state.illumination.lux = lux;
             sensors_state.illumination.lux_avg = lux_avg;
             sensors_state.illumination.lux_adj = luminosity_adjustment;
+            SensorsChannel::getInstance().illumination.publish(sensors_state.illumination, proximity_reading.captured_us);
 
             last_illumination_check_ms = millis();
         }
@@ -303,15 +240,24 @@ void SensorsTask::run()
                  sensors_state.proximity.RangeStatus,
                  sensors_state.proximity.RangeMilliMeter);
 #if SK_STRAIN
-            LOGD("Strain: reading:        Virtual button code: %d        Strain value: %f        Press value: %f",
+            LOGD("Strain: reading:        Virtual button code: %d        Strain value: %f        Press value: %f        Baseline: %f        Noise: %f",
                  sensors_state.strain.virtual_button_code,
                  sensors_state.strain.raw_value,
-                 press_value_unit);
+                 sensors_state.strain.press_value,
+                 press_detector_.baseline(),
+                 press_detector_.noise());
 #endif
             LOGD("Illumination sensor: millilux: %.2f, avg %.2f, adj %.2f",
                  sensors_state.illumination.lux,
                  sensors_state.illumination.lux_avg,
                  sensors_state.illumination.lux_adj);
+            I2cBusStats i2c = proximity_sampler_.takeStats();
+            if (i2c.window_us > 0)
+            {
+                LOGD("Proximity I2C: %d readings, %d status polls, %d transactions, %d B/s, bus busy %d.%d%%, %d restarts",
+                     i2c.readings, i2c.status_polls, i2c.transactions, (uint32_t)((uint64_t)i2c.bytes * 1000000 / i2c.window_us),
+                     (uint32_t)((uint64_t)i2c.busy_us * 1000 / i2c.window_us) / 10, (uint32_t)((uint64_t)i2c.busy_us * 1000 / i2c.window_us) % 10, i2c.restarts);
+            }
             log_ms = millis();
         }
         delay(1);
@@ -332,16 +278,10 @@ void SensorsTask::factoryStrainCalibrationCallback(float calibration_weight)
 
         strainPowerUp();
 
-        delay(200);
+        strain_scale_ = 1;
+        strainTare();
 
-        strain.set_scale();
-        delay(200);
-
-        strain.set_offset(0);
-        strain.tare();
-        delay(200);
-
-        raw_initial_value_ = strain.get_units(10);
+        raw_initial_value_ = strainAverageUnits(10);
 
         LOGI("Place calibration weight on the knob and press 'Y' again");
 
@@ -353,7 +293,7 @@ void SensorsTask::factoryStrainCalibrationCallback(float calibration_weight)
     float calibration_scale_validation[3];
 
     LOGI("Factory strain calibration step 2, try: %d", factory_strain_calibration_step_);
-    float raw_value = strain.get_units(10);
+    float raw_value = strainAverageUnits(10);
 
     LOGD("Raw value: %0.2f", raw_value);
     LOGD("Raw initial value: %0.2f", raw_initial_value_);
@@ -370,11 +310,8 @@ void SensorsTask::factoryStrainCalibrationCallback(float calibration_weight)
             calibration_scale_ = configuration_->get().strain_scale;
         }
         LOGD("Strain scale set at boot, %f", calibration_scale_);
-        strain.set_scale(calibration_scale_);
-        delay(100);
-        strain.set_offset(0);
-        strain.tare();
-        delay(100);
+        strain_scale_ = calibration_scale_;
+        strainTare();
 
         factory_strain_calibration_step_ = 0;
         return;
@@ -384,15 +321,13 @@ void SensorsTask::factoryStrainCalibrationCallback(float calibration_weight)
 
     for (size_t i = 0; i < 3; i++)
     {
-        strain.set_scale();
-        delay(100);
-        raw_value = strain.get_units(10);
+        strain_scale_ = 1;
+        raw_value = strainAverageUnits(10);
         LOGD("Raw value during calibration: %0.2f", raw_value);
         calibration_scale_ = raw_value / calibration_weight;
 
-        strain.set_scale(calibration_scale_);
-        delay(200);
-        float calibrated_weight = strain.get_units(10);
+        strain_scale_ = calibration_scale_;
+        float calibrated_weight = strainAverageUnits(10);
 
         while (abs(calibrated_weight - calibration_weight) > 0.25)
         {
@@ -400,7 +335,7 @@ void SensorsTask::factoryStrainCalibrationCallback(float calibration_weight)
             {
                 LOGE("Calibrated weight is more than 10g off from the calibration weight. Restart calibration by pressing 'Y' again.");
                 delay(2000);
-                strain.set_scale(1.0f);
+                strain_scale_ = 1.0f;
                 calibration_scale_ = 1.0f;
                 factory_strain_calibration_step_ = 0;
                 return;
@@ -415,16 +350,15 @@ void SensorsTask::factoryStrainCalibrationCallback(float calibration_weight)
                 calibration_scale_ += abs((calibrated_weight - calibration_weight));
             }
 
-            strain.set_scale(calibration_scale_);
-            delay(200);
-            calibrated_weight = strain.get_units(10);
+            strain_scale_ = calibration_scale_;
+            calibrated_weight = strainAverageUnits(10);
             LOGD("Measured weight during calibration: %0.2fg", calibrated_weight); // MAKE VERBOSE LATER
         }
         LOGD("Validation run %d, result: %0.2fg", i + 1, calibrated_weight);
         calibration_scale_validation[i] = calibration_scale_;
     }
 
-    strain.set_scale((calibration_scale_validation[0] + calibration_scale_validation[1] + calibration_scale_validation[2]) / 3.0f);
+    strain_scale_ = (calibration_scale_validation[0] + calibration_scale_validation[1] + calibration_scale_validation[2]) / 3.0f;
 
     configuration_->saveFactoryStrainCalibration((calibration_scale_validation[0] + calibration_scale_validation[1] + calibration_scale_validation[2]) / 3.0f);
 
@@ -433,13 +367,12 @@ void SensorsTask::factoryStrainCalibrationCallback(float calibration_weight)
     for (size_t i = 0; i < 3; i++)
     {
         delay(1000);
-        LOGD("Verify calibrated weight: %0.0fg", strain.get_units(10));
+        LOGD("Verify calibrated weight: %0.0fg", strainAverageUnits(10));
     }
     LOGI("\nRemove calibration weight.\n");
     delay(8000);
     LOGI("Factory strain calibration complete!");
-    strain.set_offset(0);
-    strain.tare();
+    strainTare();
     factory_strain_calibration_step_ = 0;
 }
 
@@ -450,12 +383,11 @@ void SensorsTask::weightMeasurementCallback()
         weight_measurement_step_ = 1;
         LOGI("Weight measurement step 1: Place weight on KNOB and press 'w' again");
         delay(1000);
-        strain.set_offset(0);
-        strain.tare();
+        strainTare();
     }
     else if (weight_measurement_step_ == 1)
     {
-        LOGD("Measured weight: %0.0fg", strain.get_units(10));
+        LOGD("Measured weight: %0.0fg", strainAverageUnits(10));
         weight_measurement_step_ = 0;
     }
 }
@@ -463,7 +395,7 @@ void SensorsTask::weightMeasurementCallback()
 bool SensorsTask::powerDownAllowed()
 {
     // If strain sensor isnt calibrated dont allow power down.
-    if (calibration_scale_ == 1.0f && strain.get_scale() == 1.0f)
+    if (calibration_scale_ == 1.0f && strain_scale_ == 1.0f)
     {
         return false;
     }
@@ -485,51 +417,109 @@ void SensorsTask::strainPowerDown()
         return;
     }
 
-    if (strain.wait_ready_timeout(10)) // Make sure sensor is on before powering down.
+    if (strain_powered)
     {
         LOGD("Strain sensor power down.");
 
         strain_powered = false;
-        strain.power_down();
+        strain.powerDown();
     }
 }
 
 void SensorsTask::strainPowerUp() // Delays caused a perceived delay in the activation of strain.
 {
-    if (!strain.wait_ready_timeout(10)) // Make sure sensor is off before powering up.
+    if (!strain_powered)
     {
         LOGD("Strain sensor power up.");
 
-        strain.power_up();
-        if (strain.wait_ready_timeout(500))
-        {
-            strain.set_offset(0);
-            strain.tare();
-            last_strain_reading_raw_ = strain.get_units(10);
-            strain_powered = true;
-        }
-        else
-        {
-            LOGE("Strain sensor not ready after power up!!!");
-        }
+        // The run loop tares on the first conversions after the settle period instead of waiting for them here
+        strain.powerUp();
+        strain_tare_requested_ = true;
+        strain_powered = true;
     }
 }
-#endif
 
-void SensorsTask::addStateListener(QueueHandle_t queue)
+float SensorsTask::strainAverageUnits(uint8_t count)
 {
-    state_listeners_.push_back(queue);
+    float raw;
+    if (!strain.waitAverage(count, STRAIN_AVERAGE_TIMEOUT_MS, &raw))
+    {
+        LOGE("Strain sensor timed out after %d conversions", count);
+        return 0;
+    }
+    return strainUnits(raw);
 }
 
-void SensorsTask::publishState(const SensorsState &state)
+void SensorsTask::resetPressDetector(uint32_t captured_us)
 {
-    for (auto listener : state_listeners_)
+    // A press cut short still ends in a release, RootTask would otherwise keep the button down
+    uint8_t release_code = press_detector_.reset();
+    if (release_code == VIRTUAL_BUTTON_IDLE)
     {
-        xQueueSend(listener, &state, portMAX_DELAY);
+        return;
+    }
+    sensors_state.strain.press_value = 0;
+    sensors_state.strain.virtual_button_code = release_code;
+    SensorsChannel::getInstance().strain.publish(sensors_state.strain, captured_us);
+    SensorsChannel::getInstance().pushButtonEdge({release_code, 0, captured_us});
+}
 
-        // xQueueOverwrite(listener, &state);
+void SensorsTask::strainTare()
+{
+    float raw;
+    if (!strain.waitAverage(STRAIN_TARE_SAMPLES, STRAIN_AVERAGE_TIMEOUT_MS, &raw))
+    {
+        LOGE("Strain sensor tare timed out");
+        return;
     }
+    strain_offset_ = raw;
 }
+#endif
+
+#if SK_STRAIN && SK_STRAIN_BENCHMARK
+// Live readings saved to STRAIN_RECORD_PATH, 60s at 80 samples/s
+static const size_t STRAIN_RECORD_SAMPLES = 4800;
+static const char *STRAIN_RECORD_PATH = "/strain_record.csv";
+
+void SensorsTask::recordStrainSample(uint32_t captured_us, float grams)
+{
+    if (strain_record_saved_)
+    {
+        return;
+    }
+    if (strain_record_.empty())
+    {
+        strain_record_.reserve(STRAIN_RECORD_SAMPLES);
+        strain_record_started_us_ = captured_us;
+        LOGI("Recording %d strain readings to %s", STRAIN_RECORD_SAMPLES, STRAIN_RECORD_PATH);
+    }
+    strain_record_.push_back(std::make_pair((captured_us - strain_record_started_us_) / 1000, grams));
+    if (strain_record_.size() < STRAIN_RECORD_SAMPLES)
+    {
+        return;
+    }
+
+    strain_record_saved_ = true;
+    FatGuard fatGuard;
+    if (!fatGuard.mounted_)
+    {
+        return;
+    }
+    File file = FFat.open(STRAIN_RECORD_PATH, FILE_WRITE);
+    if (!file)
+    {
+        LOGE("Failed to open %s", STRAIN_RECORD_PATH);
+        return;
+    }
+    for (const std::pair<uint32_t, float> &reading : strain_record_)
+    {
+        file.printf("%u,%.2f\n", reading.first, reading.second);
+    }
+    file.close();
+    LOGI("Saved the strain recording to %s, label its presses in a .txt next to it in firmware/test/fixtures to replay it in the native tests", STRAIN_RECORD_PATH);
+    std::vector<std::pair<uint32_t, float>>().swap(strain_record_);
+}
+#endif
 
 void SensorsTask::setSharedEventsQueue(QueueHandle_t shared_events_queue)
 {
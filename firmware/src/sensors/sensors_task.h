@@ -5,15 +5,25 @@
 #include "app_config.h"
 #include <vector>
 #include <Adafruit_VL6180X.h>
+#include "sensors_channel.h"
+#include "vl6180x_sampler.h"
 
 #if SK_STRAIN
-#include <HX711.h>
+#include "hx711_reader.h"
+#include "strain_press_detector.h"
 #endif
 
 #include "driver/temp_sensor.h"
 
 const uint16_t PROXIMITY_SENSOR_OFFSET_MM = 10;
 
+// Conversions averaged for a tare, 125ms at 80 samples/s
+const uint8_t STRAIN_TARE_SAMPLES = 10;
+// Calibration steps wait this long for their conversions
+const uint32_t STRAIN_AVERAGE_TIMEOUT_MS = 2000;
+// No conversion for this long while powered means the HX711 is not responding
+const uint32_t STRAIN_STALL_MS = 1000;
+
 class SensorsTask : public Task<SensorsTask>
 {
     friend class Task<SensorsTask>; // Allow base Task to invoke protected run()
@@ -22,7 +32,6 @@ public:
     SensorsTask(const uint8_t task_core, Configuration *configuration);
     ~SensorsTask();
 
-    void addStateListener(QueueHandle_t queue);
     void factoryStrainCalibrationCallback(float calibration_weight);
     void weightMeasurementCallback();
 
@@ -39,19 +48,42 @@ protected:
 
 private:
     SensorsState sensors_state = {};
-    QueueHandle_t sensors_state_queue_;
 
     bool do_strain = false;
     bool strain_powered = false;
 
     QueueHandle_t shared_events_queue;
 
-    std::vector<QueueHandle_t> state_listeners_;
-
     SemaphoreHandle_t mutex_;
-    void publishState(const SensorsState &state);
 #if SK_STRAIN
-    HX711 strain;
+    Hx711Reader strain;
+
+    // (raw - offset) / scale, in grams once the factory calibration ran
+    float strain_offset_ = 0;
+    float strain_scale_ = 1.0f;
+
+    // Tares run in the sensors loop over the next STRAIN_TARE_SAMPLES conversions
+    volatile bool strain_tare_requested_ = false;
+    uint8_t strain_tare_remaining_ = 0;
+    float strain_tare_sum_ = 0;
+
+    float strainUnits(float raw) { return (raw - strain_offset_) / strain_scale_; }
+    // Blocking, for the calibration callbacks which run on other tasks
+    float strainAverageUnits(uint8_t count);
+    void strainTare();
+
+    StrainPressDetector press_detector_{PRESS_WEIGHT};
+    // Resets the detector and sends the release of a press it cut short
+    void resetPressDetector(uint32_t captured_us);
+
+#if SK_STRAIN_BENCHMARK
+    // Saves the first STRAIN_RECORD_SAMPLES live readings as a trace for the tests
+    void recordStrainSample(uint32_t captured_us, float grams);
+    // Milliseconds since the first recorded reading and the reading
+    std::vector<std::pair<uint32_t, float>> strain_record_;
+    uint32_t strain_record_started_us_ = 0;
+    bool strain_record_saved_ = false;
+#endif
 #endif
 
     Configuration *configuration_;
@@ -59,12 +91,11 @@ private:
     uint8_t factory_strain_calibration_step_ = 0;
     uint8_t weight_measurement_step_ = 0;
 
-    float last_press_value_ = 0;
-    float last_strain_reading_raw_ = 0;
-
     float raw_initial_value_ = 0;
 
     float calibration_scale_ = 0;
 
+    // Loads the sensor's settings at boot, the sampler takes the measurements
     Adafruit_VL6180X vl6180x;
+    Vl6180xSampler proximity_sampler_;
 };
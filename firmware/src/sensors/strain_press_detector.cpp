@@ -0,0 +1,141 @@
+#include "strain_press_detector.h"
+
+#include "../util.h"
+#include "../virtual_button.h"
+
+bool StrainPressDetector::addSample(float grams, uint32_t captured_us)
+{
+    float filtered = median_.addSample(grams);
+    bool glitch = fabsf(grams - filtered) > STRAIN_GLITCH_GRAMS;
+    if (glitch)
+    {
+        consecutive_glitches_ = consecutive_glitches_ < 255 ? consecutive_glitches_ + 1 : 255;
+    }
+    else
+    {
+        consecutive_glitches_ = 0;
+    }
+
+    // The baseline starts from a full median window, a glitch in the first conversion must not become the rest position
+    if (warmup_ > 0)
+    {
+        warmup_--;
+        last_us_ = captured_us;
+        last_input_ = grams;
+        last_glitch_ = glitch;
+        baseline_ = filtered;
+        smoothed_.reset();
+        smoothed_.addSample(filtered);
+        press_value_ = 0;
+        updateThresholds();
+        return false;
+    }
+
+    // Conversions come at 10 or 80 samples/s depending on the HX711's RATE pin, every constant is in seconds
+    float dt_s = max(0.001f, (captured_us - last_us_) / 1000000.0f);
+    last_us_ = captured_us;
+
+    smoothed_.setAlpha(Ewma::alphaFor(STRAIN_SMOOTHING_HZ, 1 / dt_s));
+    float value = smoothed_.addSample(filtered);
+    press_value_ = (value - baseline_) / press_weight_;
+
+    uint8_t previous_code = button_code_;
+    switch (button_code_)
+    {
+    case VIRTUAL_BUTTON_SHORT_PRESSED:
+        if (press_value_ < release_threshold_)
+        {
+            button_code_ = VIRTUAL_BUTTON_SHORT_RELEASED;
+        }
+        else if (captured_us - pressed_at_us_ >= STRAIN_LONG_PRESS_MS * 1000)
+        {
+            button_code_ = VIRTUAL_BUTTON_LONG_PRESSED;
+        }
+        break;
+    case VIRTUAL_BUTTON_LONG_PRESSED:
+        if (press_value_ < release_threshold_)
+        {
+            button_code_ = VIRTUAL_BUTTON_LONG_RELEASED;
+        }
+        else if (captured_us - pressed_at_us_ >= STRAIN_STUCK_PRESS_MS * 1000)
+        {
+            // Take the stuck reading as the new rest position instead of holding the button forever
+            baseline_ = value;
+            press_value_ = 0;
+            button_code_ = VIRTUAL_BUTTON_LONG_RELEASED;
+        }
+        break;
+    default:
+        // Released codes last one sample, like a press they are edges for the listeners
+        if (press_value_ > press_threshold_)
+        {
+            button_code_ = VIRTUAL_BUTTON_SHORT_PRESSED;
+            pressed_at_us_ = captured_us;
+        }
+        else
+        {
+            button_code_ = VIRTUAL_BUTTON_IDLE;
+        }
+        break;
+    }
+
+    if (button_code_ != VIRTUAL_BUTTON_SHORT_PRESSED && button_code_ != VIRTUAL_BUTTON_LONG_PRESSED)
+    {
+        track(grams, glitch || last_glitch_, dt_s);
+    }
+    last_input_ = grams;
+    last_glitch_ = glitch;
+
+    return button_code_ != previous_code;
+}
+
+void StrainPressDetector::track(float input, bool glitch, float dt_s)
+{
+    bool at_rest = press_value_ < release_threshold_;
+
+    // Between the thresholds could be a light touch or a press about to start, follow it only slowly
+    float tau_s = at_rest ? STRAIN_BASELINE_TAU_S : STRAIN_BASELINE_SLOW_TAU_S;
+    baseline_ += dt_s / (tau_s + dt_s) * (smoothed_.getValue() - baseline_);
+
+    if (at_rest && !glitch)
+    {
+        // Half the mean square of successive differences estimates the variance without following the drift.
+        // Unfiltered readings, the median would hide part of the noise.
+        // Clamped, so the edge of a release does not read as noise
+        float limit = max(STRAIN_NOISE_CLAMP_SIGMAS * sqrtf(2 * noise_variance_), STRAIN_NOISE_CLAMP_LEVEL * fabsf(press_weight_));
+        float difference = CLAMP(input - last_input_, -limit, limit);
+        noise_variance_ += dt_s / (STRAIN_NOISE_TAU_S + dt_s) * (difference * difference / 2 - noise_variance_);
+    }
+
+    updateThresholds();
+}
+
+void StrainPressDetector::updateThresholds()
+{
+    float noise_units = sqrtf(noise_variance_) / fabsf(press_weight_);
+    press_threshold_ = max(STRAIN_PRESS_LEVEL, STRAIN_PRESS_SIGMAS * noise_units);
+    release_threshold_ = max(STRAIN_RELEASE_LEVEL, STRAIN_RELEASE_SIGMAS * noise_units);
+}
+
+uint8_t StrainPressDetector::reset()
+{
+    uint8_t release_code = VIRTUAL_BUTTON_IDLE;
+    if (button_code_ == VIRTUAL_BUTTON_SHORT_PRESSED)
+    {
+        release_code = VIRTUAL_BUTTON_SHORT_RELEASED;
+    }
+    else if (button_code_ == VIRTUAL_BUTTON_LONG_PRESSED)
+    {
+        release_code = VIRTUAL_BUTTON_LONG_RELEASED;
+    }
+
+    median_.reset();
+    smoothed_.reset();
+    warmup_ = STRAIN_WARMUP_SAMPLES;
+    noise_variance_ = 0;
+    press_value_ = 0;
+    button_code_ = VIRTUAL_BUTTON_IDLE;
+    consecutive_glitches_ = 0;
+    updateThresholds();
+    return release_code;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "../filters.h"
+
+// Fixed thresholds in units of the press weight, the noise can only raise them
+const float STRAIN_PRESS_LEVEL = 1.0f;
+const float STRAIN_RELEASE_LEVEL = 0.3f;
+// Thresholds sit at least this many noise deviations above the baseline
+const float STRAIN_PRESS_SIGMAS = 8;
+const float STRAIN_RELEASE_SIGMAS = 4;
+// Held this long past the press threshold turns a short press into a long one
+const uint32_t STRAIN_LONG_PRESS_MS = 500;
+// No press lasts this long, the reading drifted or the knob is leaning on something
+const uint32_t STRAIN_STUCK_PRESS_MS = 15000;
+// The baseline follows the reading while released, slower while it hovers between the thresholds
+const float STRAIN_BASELINE_TAU_S = 2;
+const float STRAIN_BASELINE_SLOW_TAU_S = 20;
+const float STRAIN_NOISE_TAU_S = 5;
+// Reading differences count towards the noise up to this many deviations, or this fraction of the press weight
+const float STRAIN_NOISE_CLAMP_SIGMAS = 4;
+const float STRAIN_NOISE_CLAMP_LEVEL = 0.1f;
+// Smoothing of the press value after the spike filter
+const float STRAIN_SMOOTHING_HZ = 8;
+// Readings this far from the median of their neighbours are glitches, in grams
+const float STRAIN_GLITCH_GRAMS = 2000;
+// Readings that fill the median window before the baseline is taken
+const uint8_t STRAIN_WARMUP_SAMPLES = 3;
+
+// Press detector for the strain gauge under the knob.
+//
+// Readings go through a median of three, which removes single conversion
+// glitches, and a light low-pass. A baseline follows the reading while the
+// knob is released, so slow drift of the load cell never builds up into a
+// press, and the deviation of successive readings tracks the noise. The
+// press and release thresholds are fixed fractions of the press weight or
+// a multiple of the noise above the baseline, whichever is higher, so a
+// noisy sensor gets wider hysteresis instead of chattering.
+//
+// Timing uses the capture time of each conversion rather than when the
+// sensors task got to it.
+class StrainPressDetector
+{
+public:
+    // press_weight is the reading of a full press in calibrated units, its sign is the press direction
+    StrainPressDetector(float press_weight) : press_weight_(press_weight) {}
+
+    // Returns true if the button code changed
+    bool addSample(float grams, uint32_t captured_us);
+
+    // Forgets baseline and noise, the next sample starts a new baseline. Returns the
+    // released code that ends a press cut short by the reset, VIRTUAL_BUTTON_IDLE if none was.
+    uint8_t reset();
+
+    uint8_t buttonCode() { return button_code_; }
+    // Filtered reading, in calibrated units
+    float value() { return smoothed_.getValue(); }
+    // How far the button is pressed above the baseline, 1 is the press weight
+    float pressValue() { return press_value_; }
+    float baseline() { return baseline_; }
+    // Standard deviation of the reading at rest, in calibrated units
+    float noise() { return sqrtf(noise_variance_); }
+    float pressThreshold() { return press_threshold_; }
+    float releaseThreshold() { return release_threshold_; }
+    // captured_us of the sample that started the current or last press
+    uint32_t pressedAtUs() { return pressed_at_us_; }
+    // Glitches in a row, a sensor that keeps producing them needs a reset
+    uint8_t consecutiveGlitches() { return consecutive_glitches_; }
+
+private:
+    float press_weight_;
+
+    MedianFilter<3> median_;
+    Ewma smoothed_{1};
+
+    uint8_t warmup_ = STRAIN_WARMUP_SAMPLES;
+    uint32_t last_us_ = 0;
+    float last_input_ = 0;
+    bool last_glitch_ = false;
+    float baseline_ = 0;
+    float noise_variance_ = 0;
+    float press_value_ = 0;
+    float press_threshold_ = STRAIN_PRESS_LEVEL;
+    float release_threshold_ = STRAIN_RELEASE_LEVEL;
+
+    uint8_t button_code_ = 0;
+    uint32_t pressed_at_us_ = 0;
+    uint8_t consecutive_glitches_ = 0;
+
+    void updateThresholds();
+    void track(float input, bool glitch, float dt_s);
+};
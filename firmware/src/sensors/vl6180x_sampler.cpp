@@ -0,0 +1,194 @@
+#include "vl6180x_sampler.h"
+
+#include "../logging.h"
+
+// Register map from the VL6180X datasheet
+static const uint16_t SYSTEM__INTERRUPT_CONFIG_GPIO = 0x014;
+static const uint16_t SYSTEM__INTERRUPT_CLEAR = 0x015;
+static const uint16_t SYSRANGE__START = 0x018;
+static const uint16_t SYSRANGE__MAX_CONVERGENCE_TIME = 0x01C;
+static const uint16_t SYSALS__START = 0x038;
+static const uint16_t SYSALS__INTERMEASUREMENT_PERIOD = 0x03E;
+static const uint16_t SYSALS__ANALOGUE_GAIN = 0x03F;
+static const uint16_t SYSALS__INTEGRATION_PERIOD = 0x040;
+static const uint16_t RESULT__RANGE_STATUS = 0x04D;
+static const uint16_t RESULT__RANGE_VAL = 0x062;
+static const uint16_t INTERLEAVED_MODE__ENABLE = 0x2A3;
+
+// Both channels raise "new sample ready"
+static const uint8_t INTERRUPT_NEW_SAMPLE_READY = 0x24;
+static const uint8_t INTERRUPT_CLEAR_ALL = 0x07;
+static const uint8_t START_CONTINUOUS = 0x03;
+static const uint8_t STOP = 0x01;
+// Gain 1.01, the lowest; a lit room stays far from saturation
+static const uint8_t ALS_GAIN_1 = 0x46;
+static const float ALS_GAIN_1_VALUE = 1.01f;
+// Lux per count at gain 1 and 100ms integration
+static const float ALS_LUX_PER_COUNT = 0.32f;
+
+bool Vl6180xSampler::begin(TwoWire *wire)
+{
+    wire_ = wire;
+    stats_started_us_ = micros();
+    return restart(millis());
+}
+
+bool Vl6180xSampler::restart(uint32_t now_ms)
+{
+    // Measurements may still be running from before, they must have stopped before the configuration changes
+    configure_pending_ = true;
+    next_poll_ms_ = now_ms + VL6180X_PERIOD_MS;
+    last_reading_ms_ = now_ms;
+    return stop();
+}
+
+bool Vl6180xSampler::stop()
+{
+    bool ok = writeRegister(SYSALS__START, STOP);
+    return writeRegister(SYSRANGE__START, STOP) && ok;
+}
+
+bool Vl6180xSampler::configure(uint32_t now_ms)
+{
+    configure_pending_ = false;
+    last_reading_ms_ = now_ms;
+    next_poll_ms_ = now_ms + VL6180X_PERIOD_MS;
+
+    // The interleaved cycle is timed by the ALS period (10ms units), ranging starts when the integration ends
+    bool ok = writeRegister(SYSTEM__INTERRUPT_CONFIG_GPIO, INTERRUPT_NEW_SAMPLE_READY) &&
+              writeRegister(SYSRANGE__MAX_CONVERGENCE_TIME, VL6180X_RANGE_MAX_CONVERGENCE_MS) &&
+              writeRegister(SYSALS__ANALOGUE_GAIN, ALS_GAIN_1) &&
+              writeRegister16(SYSALS__INTEGRATION_PERIOD, VL6180X_ALS_INTEGRATION_MS - 1) &&
+              writeRegister(SYSALS__INTERMEASUREMENT_PERIOD, VL6180X_PERIOD_MS / 10 - 1) &&
+              writeRegister(INTERLEAVED_MODE__ENABLE, 1) &&
+              writeRegister(SYSTEM__INTERRUPT_CLEAR, INTERRUPT_CLEAR_ALL) &&
+              writeRegister(SYSALS__START, START_CONTINUOUS);
+    if (!ok)
+    {
+        // Left to the stall check, which retries with backoff
+        LOGE("Failed to start VL6180X interleaved mode");
+    }
+    return ok;
+}
+
+bool Vl6180xSampler::poll(Vl6180xReading *reading)
+{
+    uint32_t now_ms = millis();
+    if (wire_ == nullptr || (int32_t)(now_ms - next_poll_ms_) < 0)
+    {
+        return false;
+    }
+
+    if (configure_pending_)
+    {
+        configure(now_ms);
+        return false;
+    }
+
+    if (now_ms - last_reading_ms_ > stall_ms_)
+    {
+        LOGW("VL6180X delivered nothing for %dms, restarting", stall_ms_);
+        stats_.restarts++;
+        stall_ms_ = min<uint32_t>(stall_ms_ * 2, VL6180X_MAX_STALL_MS);
+        restart(now_ms);
+        return false;
+    }
+
+    // RESULT__RANGE_STATUS, RESULT__ALS_STATUS, RESULT__INTERRUPT_STATUS_GPIO and RESULT__ALS_VAL in one burst
+    uint8_t results[5];
+    stats_.status_polls++;
+    if (!readRegisters(RESULT__RANGE_STATUS, results, sizeof(results)))
+    {
+        next_poll_ms_ = now_ms + VL6180X_POLL_INTERVAL_MS;
+        return false;
+    }
+
+    // Ranging runs last in the cycle, its flag means the ALS value is there as well
+    uint8_t interrupt_status = results[2];
+    if ((interrupt_status & 0x07) != 0x04)
+    {
+        next_poll_ms_ = now_ms + VL6180X_POLL_INTERVAL_MS;
+        return false;
+    }
+
+    // The flag stays set until cleared, a failed read is simply retried on the next poll
+    uint8_t range_mm = 0;
+    if (!readRegisters(RESULT__RANGE_VAL, &range_mm, 1))
+    {
+        next_poll_ms_ = now_ms + VL6180X_POLL_INTERVAL_MS;
+        return false;
+    }
+    writeRegister(SYSTEM__INTERRUPT_CLEAR, INTERRUPT_CLEAR_ALL);
+
+    uint16_t als_counts = (results[3] << 8) | results[4];
+    reading->range_mm = range_mm;
+    reading->range_status = results[0] >> 4;
+    reading->lux = als_counts * ALS_LUX_PER_COUNT / ALS_GAIN_1_VALUE * (100.0f / VL6180X_ALS_INTEGRATION_MS);
+    reading->captured_us = micros();
+
+    stats_.readings++;
+    last_reading_ms_ = now_ms;
+    stall_ms_ = VL6180X_STALL_PERIODS * VL6180X_PERIOD_MS;
+    // The next cycle completes one period after this one, give or take the polling interval
+    next_poll_ms_ = now_ms + VL6180X_PERIOD_MS - VL6180X_POLL_INTERVAL_MS;
+    return true;
+}
+
+I2cBusStats Vl6180xSampler::takeStats()
+{
+    uint32_t now_us = micros();
+    I2cBusStats stats = stats_;
+    stats.window_us = now_us - stats_started_us_;
+    stats_ = {};
+    stats_started_us_ = now_us;
+    return stats;
+}
+
+bool Vl6180xSampler::writeRegister(uint16_t reg, uint8_t value)
+{
+    uint32_t started_us = micros();
+    wire_->beginTransmission(VL6180X_ADDRESS);
+    wire_->write(reg >> 8);
+    wire_->write(reg & 0xFF);
+    wire_->write(value);
+    bool ok = wire_->endTransmission() == 0;
+    recordTransaction(started_us, 4);
+    return ok;
+}
+
+bool Vl6180xSampler::writeRegister16(uint16_t reg, uint16_t value)
+{
+    uint32_t started_us = micros();
+    wire_->beginTransmission(VL6180X_ADDRESS);
+    wire_->write(reg >> 8);
+    wire_->write(reg & 0xFF);
+    wire_->write(value >> 8);
+    wire_->write(value & 0xFF);
+    bool ok = wire_->endTransmission() == 0;
+    recordTransaction(started_us, 5);
+    return ok;
+}
+
+bool Vl6180xSampler::readRegisters(uint16_t reg, uint8_t *values, uint8_t count)
+{
+    uint32_t started_us = micros();
+    wire_->beginTransmission(VL6180X_ADDRESS);
+    wire_->write(reg >> 8);
+    wire_->write(reg & 0xFF);
+    // Repeated start, the register index auto-increments through the burst
+    bool ok = wire_->endTransmission(false) == 0 && wire_->requestFrom(VL6180X_ADDRESS, count) == count;
+    for (uint8_t i = 0; ok && i < count; i++)
+    {
+        values[i] = wire_->read();
+    }
+    // Address byte, register index, address byte again and the data
+    recordTransaction(started_us, 4 + count);
+    return ok;
+}
+
+void Vl6180xSampler::recordTransaction(uint32_t started_us, uint8_t bytes)
+{
+    stats_.transactions++;
+    stats_.bytes += bytes;
+    stats_.busy_us += micros() - started_us;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Wire.h>
+
+const uint8_t VL6180X_ADDRESS = 0x29;
+
+// Interleaved cycle: one ALS integration followed by one range measurement
+const uint16_t VL6180X_PERIOD_MS = 50;
+const uint16_t VL6180X_ALS_INTEGRATION_MS = 20;
+const uint8_t VL6180X_RANGE_MAX_CONVERGENCE_MS = 20;
+// After the expected completion the status is polled this often until the result is there
+const uint8_t VL6180X_POLL_INTERVAL_MS = 2;
+// No result for this many periods restarts the measurements
+const uint8_t VL6180X_STALL_PERIODS = 10;
+// Every restart that brings no result doubles the wait before the next one, up to this
+const uint16_t VL6180X_MAX_STALL_MS = 16000;
+
+// One interleaved cycle
+struct Vl6180xReading
+{
+    uint8_t range_mm;
+    // Error code of the range measurement, 0 is a valid range
+    uint8_t range_status;
+    float lux;
+    // micros() when the result was seen
+    uint32_t captured_us;
+};
+
+// I2C traffic of the sampler over one stats window
+struct I2cBusStats
+{
+    uint32_t transactions;
+    uint32_t bytes;
+    // Time spent inside Wire calls, the bus is held for all of it
+    uint32_t busy_us;
+    uint32_t window_us;
+    uint32_t status_polls;
+    uint32_t readings;
+    uint32_t restarts;
+};
+
+// Runs the VL6180X in interleaved mode, which measures ambient light and then
+// range back to back every VL6180X_PERIOD_MS without being asked.
+//
+// Single shot readRange() and readLux() block the caller for the whole
+// conversion while polling the status over I2C. Here poll() returns right
+// away: it only reads the interrupt status once a cycle is due, and reads the
+// results in one burst once the sensor flags them. GPIO1 of the sensor is not
+// wired on the board, so completion is polled rather than signalled. A
+// restart doesn't wait either: the measurements are stopped and poll()
+// configures the sensor again once the running one has finished.
+//
+// Adafruit_VL6180X::begin() must have loaded the sensor's settings first.
+class Vl6180xSampler
+{
+public:
+    // False if the sensor didn't respond, poll() keeps retrying either way
+    bool begin(TwoWire *wire);
+
+    // New reading if a cycle completed since the last call, never waits for the sensor
+    bool poll(Vl6180xReading *reading);
+
+    // Counters since the last call
+    I2cBusStats takeStats();
+
+private:
+    TwoWire *wire_ = nullptr;
+    uint32_t next_poll_ms_ = 0;
+    uint32_t last_reading_ms_ = 0;
+    uint32_t stall_ms_ = VL6180X_STALL_PERIODS * VL6180X_PERIOD_MS;
+    bool configure_pending_ = false;
+    I2cBusStats stats_ = {};
+    uint32_t stats_started_us_ = 0;
+
+    bool restart(uint32_t now_ms);
+    bool stop();
+    bool configure(uint32_t now_ms);
+    bool writeRegister(uint16_t reg, uint8_t value);
+    bool writeRegister16(uint16_t reg, uint16_t value);
+    bool readRegisters(uint16_t reg, uint8_t *values, uint8_t count);
+    void recordTransaction(uint32_t started_us, uint8_t bytes);
+};
@@ -14,12 +14,13 @@ static SerialProtocolProtobuf *singleton_for_packet_serial = 0;
 static const uint16_t MIN_STATE_INTERVAL_MILLIS = 1000;
 static const uint16_t PERIODIC_STATE_INTERVAL_MILLIS = 5000;
 
-SerialProtocolProtobuf::SerialProtocolProtobuf(Stream &stream, Configuration *configuration, ConfigCallback config_callback, MotorCalibrationCallback motor_calibration_callback, StrainCalibrationCallback strain_calibration_callback) : SerialProtocol(),
+SerialProtocolProtobuf::SerialProtocolProtobuf(Stream &stream, Configuration *configuration, ConfigCallback config_callback, MotorCalibrationCallback motor_calibration_callback, StrainCalibrationCallback strain_calibration_callback, LedEffectProgramCallback led_effect_program_callback) : SerialProtocol(),
                                                                                                                                                                                                                                            stream_(stream),
                                                                                                                                                                                                                                            configuration_(configuration),
                                                                                                                                                                                                                                            config_callback_(config_callback),
                                                                                                                                                                                                                                            motor_calibration_callback_(motor_calibration_callback),
                                                                                                                                                                                                                                            strain_calibration_callback_(strain_calibration_callback),
+                                                                                                                                                                                                                                           led_effect_program_callback_(led_effect_program_callback),
                                                                                                                                                                                                                                            packet_serial_()
 {
     packet_serial_.setStream(&stream);
@@ -134,6 +135,15 @@ void SerialProtocolProtobuf::loop()
         last_sent_state_ = latest_state_;
         last_sent_state_millis_ = millis();
     }
+
+    // New AudioFeatures batches go out as soon as the stream publishes them. read() only writes the
+    // payload when there is a new batch and then fills all of it, so the buffer needs no clearing.
+    AudioFeatureStream &audio_features = AudioFeatureStream::getInstance();
+    if (audio_features.enabled(AUDIO_FEATURE_LINK_SERIAL) && audio_features.read(&pb_tx_buffer_.payload.audio_features, &audio_features_sequence_))
+    {
+        pb_tx_buffer_.which_payload = PB_FromSmartKnob_audio_features_tag;
+        sendPbTxBuffer();
+    }
     delay(1);
 }
 
@@ -192,6 +202,16 @@ void SerialProtocolProtobuf::handlePacket(const uint8_t *buffer, size_t size)
         strain_calibration_callback_(pb_rx_buffer_.payload.strain_calibration.calibration_weight);
         break;
     }
+    case PB_ToSmartknob_led_effect_program_tag:
+    {
+        led_effect_program_callback_(pb_rx_buffer_.payload.led_effect_program);
+        break;
+    }
+    case PB_ToSmartknob_audio_feature_config_tag:
+    {
+        AudioFeatureStream::getInstance().configure(pb_rx_buffer_.payload.audio_feature_config, AUDIO_FEATURE_LINK_SERIAL);
+        break;
+    }
     case PB_ToSmartknob_smartknob_command_tag:
     {
         // Handle command
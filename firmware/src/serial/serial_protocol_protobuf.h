@@ -5,6 +5,7 @@
 #include "../proto_gen/smartknob.pb.h"
 
 #include "interface_callbacks.h"
+#include "microphone/audio_feature_stream.h"
 #include "motor_foc/motor_task.h"
 #include "serial_protocol.h"
 #include "uart_stream.h"
@@ -12,7 +13,7 @@
 class SerialProtocolProtobuf : public SerialProtocol
 {
 public:
-    SerialProtocolProtobuf(Stream &stream, Configuration *configuration, ConfigCallback config_callback, MotorCalibrationCallback motor_calibration_callback, FactoryStrainCalibrationCallback factory_strain_calibration_callback);
+    SerialProtocolProtobuf(Stream &stream, Configuration *configuration, ConfigCallback config_callback, MotorCalibrationCallback motor_calibration_callback, FactoryStrainCalibrationCallback factory_strain_calibration_callback, LedEffectProgramCallback led_effect_program_callback);
     ~SerialProtocolProtobuf(){};
     void log(const char *msg) override;
     void log(const PB_LogLevel log_level, bool isVerbose_, const char *origin, const char *msg) override;
@@ -27,6 +28,7 @@ private:
     ConfigCallback config_callback_;
     MotorCalibrationCallback motor_calibration_callback_;
     StrainCalibrationCallback strain_calibration_callback_;
+    LedEffectProgramCallback led_effect_program_callback_;
 
     PB_FromSmartKnob pb_tx_buffer_;
     PB_ToSmartknob pb_rx_buffer_;
@@ -43,6 +45,9 @@ private:
 
     bool state_requested_;
 
+    // Off until the host sends an AudioFeatureConfig
+    uint32_t audio_features_sequence_ = 0;
+
     void sendPbTxBuffer();
     void handlePacket(const uint8_t *buffer, size_t size);
     void ack(uint32_t nonce);
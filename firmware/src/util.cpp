@@ -6,63 +6,11 @@ float lerp(const float value, const float inMin, const float inMax, const float
     return ((value - inMin) / (inMax - inMin)) * (max - min) + min;
 }
 
-MovingAverage::MovingAverage(int filterLength)
+int32_t smoothstepQ8(int32_t t)
 {
-    this->filterLength = filterLength;
-    this->filterPointer = new float[filterLength];
-    this->lastValue = 0.0;
-    initFilter();
-}
-
-float MovingAverage::addSample(float newValue)
-{
-    shiftFilter(newValue);
-    computeAverage();
-    return this->lastValue;
-}
-
-float MovingAverage::getValue()
-{
-    return this->lastValue;
-}
-
-void MovingAverage::dumpFilter()
-{
-    this->lastValue = 0.0;
-    initFilter();
-}
-
-void MovingAverage::shiftFilter(float nextValue)
-{
-    for (int i = this->filterLength - 1; i > -1; i--)
-    {
-        if (i == 0)
-        {
-            *(filterPointer) = nextValue;
-        }
-        else
-        {
-            *(filterPointer + i) = *(filterPointer + (i - 1));
-        }
-    }
-}
-
-void MovingAverage::computeAverage()
-{
-    double sum = 0.0;
-    for (int i = 0; i < this->filterLength; i++)
-    {
-        sum += *(filterPointer + i);
-    }
-    this->lastValue = sum / this->filterLength;
-}
-
-void MovingAverage::initFilter()
-{
-    for (int i = 0; i < this->filterLength; i++)
-    {
-        *(filterPointer + i) = 0.0;
-    }
+    t = CLAMP<int32_t>(t, 0, 256);
+    // t * t * (3 - 2t), every product rescaled back to Q8
+    return (t * t * (3 * 256 - 2 * t)) >> 16;
 }
 
 uint32_t rgbToUint32(uint8_t r, uint8_t g, uint8_t b)
@@ -13,6 +13,9 @@ T CLAMP(const T &value, const T &low, const T &high)
 
 float lerp(const float value, const float inMin, const float inMax, const float min, const float max);
 
+// Smoothstep easing in Q8 fixed point, t and the result are 0..256
+int32_t smoothstepQ8(int32_t t);
+
 template <typename T>
 int sgn(T val)
 {
@@ -40,25 +43,6 @@ struct HEXColor
     uint8_t b;
 };
 
-// source: https://github.com/careyi3/MovingAverage/blob/master/src/MovingAverage.cpp
-class MovingAverage
-{
-public:
-    MovingAverage(int filterLength);
-    float addSample(float newValue);
-    float getValue();
-    void dumpFilter();
-
-private:
-    float *filterPointer;
-    int filterLength;
-    float lastValue;
-
-    void initFilter();
-    void shiftFilter(float nextValue);
-    void computeAverage();
-};
-
 HEXColor hToHEX(float h);
 HSVColor ToHSV(RGBColor color);
 uint32_t ToRGBA(float h);
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdint.h>
+
+// Button codes of the strain gauge press, the *_PRESSED and *_RELEASED codes are edges
+const uint8_t VIRTUAL_BUTTON_IDLE = 0;
+const uint8_t VIRTUAL_BUTTON_SHORT_PRESSED = 1;
+const uint8_t VIRTUAL_BUTTON_SHORT_RELEASED = 2;
+const uint8_t VIRTUAL_BUTTON_LONG_PRESSED = 3;
+const uint8_t VIRTUAL_BUTTON_LONG_RELEASED = 4;
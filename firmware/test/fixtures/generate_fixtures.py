@@ -0,0 +1,204 @@
+"""
+Generates the synthetic fixtures of the native test suites.
+
+Run it after changing a fixture below:
+
+    python3 firmware/test/fixtures/generate_fixtures.py
+
+Every fixture is built from a fixed seed, so the output only changes when this
+script does. Clips are mono 16-bit PCM WAV, the format WavAudioSource plays on
+the device. Recordings can be added next to them under their own names.
+"""
+
+from pathlib import Path
+import math
+import random
+import struct
+import wave
+
+FIXTURES_DIR = Path(__file__).resolve().parent
+
+CAPTURE_RATE = 48000
+ANALYSIS_RATE = 16000
+
+
+def write_wav(name, rate, samples):
+    """Writes float samples in [-1, 1) as 16-bit PCM."""
+    frames = bytearray()
+    for sample in samples:
+        frames += struct.pack("<h", max(-32768, min(32767, int(round(sample * 32768)))))
+    with wave.open(str(FIXTURES_DIR / name), "wb") as clip:
+        clip.setnchannels(1)
+        clip.setsampwidth(2)
+        clip.setframerate(rate)
+        clip.writeframes(bytes(frames))
+
+
+def write_labels(name, comment, values):
+    """Writes one value per line after a comment line, the format loadNumbers() reads."""
+    with open(FIXTURES_DIR / name, "w") as labels:
+        labels.write("# %s\n" % comment)
+        for value in values:
+            labels.write("%d\n" % value)
+
+
+def mix(*tracks):
+    return [sum(samples) for samples in zip(*tracks)]
+
+
+def noise(rate, seconds, level):
+    return [random.gauss(0, level) for _ in range(int(rate * seconds))]
+
+
+def clap(rate, level):
+    """A noise burst with a 1ms attack and a 10ms decay, the shape ClapDetector looks for."""
+    attack = rate // 1000
+    return [random.uniform(-level, level) * (i / attack if i < attack else math.exp(-(i - attack) / (rate / 100)))
+            for i in range(rate // 20)]
+
+
+def kick(rate):
+    """A sine falling from 150Hz to 50Hz over a 150ms decay."""
+    samples = []
+    phase = 0
+    for i in range(rate // 3):
+        t = i / rate
+        phase += 2 * math.pi * (50 + 100 * math.exp(-t / 0.03)) / rate
+        samples.append(0.5 * math.sin(phase) * math.exp(-t / 0.15))
+    return samples
+
+
+def hihat(rate):
+    """Third difference of noise (almost all above 8kHz) with a 20ms decay."""
+    history = [0, 0, 0]
+    samples = []
+    for i in range(rate // 10):
+        x = random.uniform(-1, 1)
+        samples.append(0.05 * (x - 3 * history[0] + 3 * history[1] - history[2]) * math.exp(-i / (rate / 50)))
+        history = [x, history[0], history[1]]
+    return samples
+
+
+def place(track, rate, at_ms, sound):
+    start = int(at_ms * rate / 1000)
+    for i, sample in enumerate(sound[:len(track) - start]):
+        track[start + i] += sample
+
+
+def music(rate, seconds, bpm):
+    """Kicks on the beat, hi-hats on every eighth and a sustained bass note and chord."""
+    track = [0.1 * math.sin(2 * math.pi * 110 * i / rate)
+             + 0.03 * sum(math.sin(2 * math.pi * f * i / rate) for f in (440, 554.4, 659.3))
+             for i in range(int(rate * seconds))]
+    beat_ms = 60000 / bpm
+    at_ms = 0
+    while at_ms < seconds * 1000:
+        place(track, rate, at_ms, kick(rate))
+        place(track, rate, at_ms, hihat(rate))
+        place(track, rate, at_ms + beat_ms / 2, hihat(rate))
+        at_ms += beat_ms
+    return track
+
+
+def snare(rate):
+    """A 180Hz body under a noise burst, both decaying over 60ms."""
+    return [(0.2 * math.sin(2 * math.pi * 180 * i / rate) + random.uniform(-0.2, 0.2)) * math.exp(-i / (0.06 * rate))
+            for i in range(rate // 4)]
+
+
+def groove(rate, seconds, bpm):
+    """music() with a snare on beats two and four, what the tempo clips are made of."""
+    track = music(rate, seconds, bpm)
+    beat_ms = 60000 / bpm
+    at_ms = beat_ms
+    while at_ms < seconds * 1000:
+        place(track, rate, at_ms, snare(rate))
+        at_ms += 2 * beat_ms
+    return track
+
+
+def claps(rate, seconds, level, at_ms):
+    track = [0.0] * int(rate * seconds)
+    for ms in at_ms:
+        place(track, rate, ms, clap(rate, level))
+    return track
+
+
+def write_trace(name, readings):
+    """Writes (ms, reading) pairs as "ms,reading" lines, the format SK_STRAIN_BENCHMARK records."""
+    with open(FIXTURES_DIR / name, "w") as trace:
+        for ms, reading in readings:
+            trace.write("%d,%.2f\n" % (ms, reading))
+
+
+def strain_trace(seconds, noise, presses, drift=lambda t: 0, glitches=()):
+    """
+    Strain readings at the HX711's 80 samples/s, in grams. presses are (start ms, held ms, grams),
+    each ramping over 40ms. Pressing reads negative, like PRESS_WEIGHT. Conversions jitter by a
+    millisecond, like their capture times on the device, and the ones numbered in glitches read
+    -8000g, as a bit error in the conversion would.
+    """
+    readings = []
+    ms = 0.0
+    while ms < seconds * 1000:
+        reading = 300 + drift(ms / 1000) + random.gauss(0, noise)
+        for start, held, grams in presses:
+            if start <= ms < start + held + 40:
+                ramp = min(1, (ms - start) / 40, (start + held + 40 - ms) / 40)
+                reading -= grams * ramp
+        if len(readings) in glitches:
+            reading = -8000
+        readings.append((round(ms), reading))
+        ms += 12.5 + random.uniform(-1, 1)
+    return readings
+
+
+def strain_fixture(name, trace, presses):
+    write_trace(name + ".csv", trace)
+    write_labels(name + ".txt", "press starts in ms", [start for start, _, _ in presses])
+
+
+def tone_1khz():
+    """Half a second of 1kHz at -12dBFS, on a bin of the 16kHz analysis FFT."""
+    rate = CAPTURE_RATE
+    return [0.25 * math.sin(2 * math.pi * 1000 * i / rate) for i in range(rate // 2)]
+
+
+def main():
+    random.seed(1)
+    write_wav("tone_1khz.wav", CAPTURE_RATE, tone_1khz())
+
+    # Claps in a quiet room and over 120 BPM music, the second one on a kick, and music alone.
+    # The first 500ms let the detector learn the floor and hold no labels.
+    rate = CAPTURE_RATE
+    quiet_ms = [550, 900, 1300, 1700]
+    write_wav("clap_quiet.wav", rate, mix(noise(rate, 2, 0.001), claps(rate, 2, 0.5, quiet_ms)))
+    write_labels("clap_quiet.txt", "clap onsets in ms", quiet_ms)
+    music_ms = [600, 1000, 1350, 1750]
+    write_wav("clap_music.wav", rate, mix(music(rate, 2, 120), claps(rate, 2, 0.5, music_ms)))
+    write_labels("clap_music.txt", "clap onsets in ms", music_ms)
+    write_wav("noclap_music.wav", rate, music(rate, 2, 120))
+    write_labels("noclap_music.txt", "no claps, every detection is a false positive", [])
+
+    # Tempo clips are written at the analysis rate, the tests feed them past the decimator.
+    # 7s fill the tracker's 6s history.
+    for bpm in (90, 128, 150):
+        write_wav("tempo_%03d.wav" % bpm, ANALYSIS_RATE, groove(ANALYSIS_RATE, 7, bpm))
+
+    # Strain traces, with a press weight of 50g. The first second is left at rest for the baseline.
+    presses = [(1500, 150, 90), (3000, 250, 120), (4200, 100, 70), (6000, 300, 200), (7500, 200, 80), (9000, 150, 100)]
+    strain_fixture("strain_presses", strain_trace(11, 1.5, presses), presses)
+    presses = [(1500, 1500, 100), (4500, 3000, 150), (9000, 900, 80)]
+    strain_fixture("strain_long_presses", strain_trace(11, 1.5, presses), presses)
+    presses = [(2000, 200, 60), (4000, 300, 58), (6000, 250, 62)]
+    strain_fixture("strain_light_presses", strain_trace(8, 1, presses), presses)
+    # Turning the knob rocks the load cell by up to 20g, and a few single conversions come out as glitches
+    strain_fixture("strain_turning",
+                   strain_trace(8, 2, [], drift=lambda t: 20 * math.sin(2 * math.pi * 1.5 * t) * (2 < t < 7),
+                                glitches=(250, 440, 500)), [])
+    # Warming up drifts the reading by 150g over the trace, three times the press weight
+    strain_fixture("strain_drift", strain_trace(30, 1.5, [], drift=lambda t: -5 * t), [])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,124 @@
+#pragma once
+
+// The part of the ESP32 Arduino core the portable modules and the apps use,
+// for the native test environment. millis() and micros() follow the host
+// clock unless a test freezes them.
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <thread>
+
+// The core pulls FreeRTOS in with Arduino.h, the modules rely on that
+#include "FreeRTOS.h"
+
+using std::abs;
+using std::max;
+using std::min;
+
+typedef uint8_t byte;
+
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+inline long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+    const long run = in_max - in_min;
+    return run == 0 ? out_min : (x - in_min) * (out_max - out_min) / run + out_min;
+}
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define PROGMEM
+#define IRAM_ATTR
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+
+// Frozen time in microseconds, or UINT64_MAX while the clock runs
+inline uint64_t &hostFrozenMicros()
+{
+    static uint64_t frozen_us = UINT64_MAX;
+    return frozen_us;
+}
+
+inline uint64_t hostMicros()
+{
+    if (hostFrozenMicros() != UINT64_MAX)
+    {
+        return hostFrozenMicros();
+    }
+    static const std::chrono::steady_clock::time_point started_at = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started_at).count();
+}
+
+// Stops millis() and micros() at ms, until hostReleaseClock()
+inline void hostFreezeClock(uint32_t ms)
+{
+    hostFrozenMicros() = (uint64_t)ms * 1000;
+}
+
+inline void hostReleaseClock()
+{
+    hostFrozenMicros() = UINT64_MAX;
+}
+
+inline unsigned long millis()
+{
+    return (unsigned long)(hostMicros() / 1000);
+}
+
+inline unsigned long micros()
+{
+    return (unsigned long)hostMicros();
+}
+
+// A frozen clock moves on by ms instead of waiting
+inline void delay(uint32_t ms)
+{
+    if (hostFrozenMicros() != UINT64_MAX)
+    {
+        hostFrozenMicros() += (uint64_t)ms * 1000;
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// Same contract as the core's: [0, max) and [min, max), seeded for repeatable runs
+inline long random(long max_value)
+{
+    return max_value > 0 ? rand() % max_value : 0;
+}
+
+inline long random(long min_value, long max_value)
+{
+    return min_value < max_value ? min_value + random(max_value - min_value) : min_value;
+}
+
+inline void randomSeed(unsigned long seed)
+{
+    srand(seed);
+}
+
+// Nanoseconds stand in for the CPU cycle counter, only differences are meaningful
+class EspClass
+{
+public:
+    uint32_t getCycleCount()
+    {
+        return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+};
+
+static EspClass ESP __attribute__((unused));
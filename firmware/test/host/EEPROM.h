@@ -0,0 +1,3 @@
+#pragma once
+
+// Included by configuration.h, nothing of it is used on the host
@@ -0,0 +1,12 @@
+#pragma once
+
+// The apps only mount and unmount FFat through FatGuard, the host has nothing to mount
+
+class HostFFat
+{
+public:
+    bool begin(bool = false) { return false; }
+    void end() {}
+};
+
+static HostFFat FFat __attribute__((unused));
@@ -0,0 +1,108 @@
+#pragma once
+
+// The part of FastLED 3.5 the LED compositor and the LED program interpreter
+// use, for the native test environment. The math follows FastLED's default
+// FASTLED_SCALE8_FIXED and FASTLED_BLEND_FIXED builds, so results match the
+// device bit for bit.
+
+#include <stdint.h>
+
+typedef uint8_t fract8;
+
+inline uint8_t qadd8(uint8_t i, uint8_t j)
+{
+    unsigned int t = i + j;
+    return t > 255 ? 255 : t;
+}
+
+inline uint8_t scale8(uint8_t i, fract8 scale)
+{
+    return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8;
+}
+
+inline uint8_t blend8(uint8_t a, uint8_t b, uint8_t amount_of_b)
+{
+    uint16_t partial = (a << 8) | b;
+    partial -= a * amount_of_b;
+    partial += b * amount_of_b;
+    return partial >> 8;
+}
+
+struct CRGB
+{
+    union
+    {
+        struct
+        {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+        };
+        uint8_t raw[3];
+    };
+
+    CRGB() = default;
+    CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+
+    uint8_t &operator[](uint8_t x) { return raw[x]; }
+    const uint8_t &operator[](uint8_t x) const { return raw[x]; }
+
+    CRGB &setRGB(uint8_t nr, uint8_t ng, uint8_t nb)
+    {
+        r = nr;
+        g = ng;
+        b = nb;
+        return *this;
+    }
+
+    CRGB &setColorCode(uint32_t colorcode)
+    {
+        r = (colorcode >> 16) & 0xFF;
+        g = (colorcode >> 8) & 0xFF;
+        b = colorcode & 0xFF;
+        return *this;
+    }
+
+    CRGB &nscale8(uint8_t scaledown)
+    {
+        r = scale8(r, scaledown);
+        g = scale8(g, scaledown);
+        b = scale8(b, scaledown);
+        return *this;
+    }
+};
+
+inline bool operator==(const CRGB &lhs, const CRGB &rhs)
+{
+    return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b;
+}
+
+inline bool operator!=(const CRGB &lhs, const CRGB &rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline CRGB &nblend(CRGB &existing, const CRGB &overlay, fract8 amount_of_overlay)
+{
+    if (amount_of_overlay == 0)
+    {
+        return existing;
+    }
+    if (amount_of_overlay == 255)
+    {
+        existing = overlay;
+        return existing;
+    }
+    existing.r = blend8(existing.r, overlay.r, amount_of_overlay);
+    existing.g = blend8(existing.g, overlay.g, amount_of_overlay);
+    existing.b = blend8(existing.b, overlay.b, amount_of_overlay);
+    return existing;
+}
+
+inline CRGB blend(const CRGB &p1, const CRGB &p2, fract8 amount_of_p2)
+{
+    CRGB result(p1);
+    nblend(result, p2, amount_of_p2);
+    return result;
+}
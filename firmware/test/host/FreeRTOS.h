@@ -0,0 +1,92 @@
+#pragma once
+
+// The FreeRTOS queues and mutexes the apps use, for the native test
+// environment. The suites run on one thread, so a mutex only has to be taken
+// and given back; queues are plain FIFOs of fixed-size items.
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <deque>
+#include <thread>
+#include <vector>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define portMAX_DELAY 0xFFFFFFFF
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+struct HostQueue
+{
+    size_t item_size;
+    size_t length;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+typedef HostQueue *QueueHandle_t;
+typedef HostQueue *SemaphoreHandle_t;
+
+inline QueueHandle_t xQueueCreate(size_t length, size_t item_size)
+{
+    return new HostQueue{item_size, length, {}};
+}
+
+inline BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t)
+{
+    if (queue->items.size() >= queue->length)
+    {
+        return pdFALSE;
+    }
+    const uint8_t *bytes = (const uint8_t *)item;
+    queue->items.emplace_back(bytes, bytes + queue->item_size);
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    return xQueueSendToBack(queue, item, ticks);
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t)
+{
+    if (queue->items.empty())
+    {
+        return pdFALSE;
+    }
+    memcpy(item, queue->items.front().data(), queue->item_size);
+    queue->items.pop_front();
+    return pdTRUE;
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return xQueueCreate(1, 0);
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t)
+{
+    return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t)
+{
+    return pdTRUE;
+}
+
+// Waiting on another task means giving the host thread up
+inline void vTaskDelay(TickType_t)
+{
+    std::this_thread::yield();
+}
+
+inline void taskYIELD()
+{
+    std::this_thread::yield();
+}
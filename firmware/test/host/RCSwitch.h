@@ -0,0 +1,11 @@
+#pragma once
+
+// rc-switch for the native test environment, commands go nowhere
+
+class RCSwitch
+{
+public:
+    void enableTransmit(int) {}
+    void setPulseLength(int) {}
+    void send(const char *) {}
+};
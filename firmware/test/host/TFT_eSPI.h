@@ -0,0 +1,1003 @@
+#pragma once
+
+// The part of TFT_eSPI 2.5.0 the apps and gfx/ use, for the native test
+// environment. Sprites render into memory with the library's pixel formats:
+// 16-bit pixels byte swapped, 8-bit as RGB332 and 4-bit as palette indices,
+// even pixels in the high nibble. The primitives and the free font text follow
+// the library's algorithms so frames come out as on the device; the screen
+// itself (TFT_eSPI) only keeps a frame pushed to it.
+
+#include <Arduino.h>
+
+#include <vector>
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_DARKCYAN 0x03EF
+#define TFT_MAROON 0x7800
+#define TFT_PURPLE 0x780F
+#define TFT_OLIVE 0x7BE0
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_DARKGREY 0x7BEF
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+#define TFT_ORANGE 0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK 0xFE19
+#define TFT_BROWN 0x9A60
+#define TFT_GOLD 0xFEA0
+#define TFT_SILVER 0xC618
+#define TFT_SKYBLUE 0x867D
+#define TFT_VIOLET 0x915C
+#define TFT_TRANSPARENT 0x0120
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+// Fill colour of the smooth primitives that makes them blend with the pixels already drawn
+#define TFT_eSPI_NO_BACKGROUND 0x00FFFFFF
+
+typedef struct
+{
+    uint32_t bitmapOffset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+} GFXglyph;
+
+typedef struct
+{
+    uint8_t *bitmap;
+    GFXglyph *glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+} GFXfont;
+
+#ifdef LOAD_GFXFF
+// The library's custom fonts are not part of the tree. Text the apps set in
+// Roboto_Thin_24 uses the repo's bold cut of the same size on the host, so
+// the goldens keep the layout but not the exact strokes of that text.
+#include "../../src/font/roboto_thin_bold_24.h"
+#define Roboto_Thin_24 Roboto_Thin_Bold_24
+#endif
+
+class TFT_eSPI
+{
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT) : _width(w), _height(h) {}
+    virtual ~TFT_eSPI() {}
+
+    void init() {}
+    void begin() {}
+    void setRotation(uint8_t) {}
+    void invertDisplay(bool) {}
+
+    int16_t width() { return _width; }
+    int16_t height() { return _height; }
+
+    // Pixel writes, every other primitive is built on these three
+    virtual void drawPixel(int32_t, int32_t, uint32_t) {}
+    virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+    {
+        for (int32_t i = 0; i < w; i++)
+        {
+            drawPixel(x + i, y, color);
+        }
+    }
+    virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+    {
+        for (int32_t j = 0; j < h; j++)
+        {
+            drawFastHLine(x, y + j, w, color);
+        }
+    }
+    virtual uint16_t readPixel(int32_t, int32_t) { return 0; }
+
+    void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+    {
+        fillRect(x, y, 1, h, color);
+    }
+
+    void fillScreen(uint32_t color)
+    {
+        fillRect(0, 0, _width, _height, color);
+    }
+
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+    {
+        drawFastHLine(x, y, w, color);
+        drawFastHLine(x, y + h - 1, w, color);
+        // Avoid drawing corner pixels twice
+        drawFastVLine(x, y + 1, h - 2, color);
+        drawFastVLine(x + w - 1, y + 1, h - 2, color);
+    }
+
+    // 1-bit bitmap, rows padded to whole bytes, most significant bit first
+    void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+    {
+        int32_t byteWidth = (w + 7) / 8;
+        for (int32_t j = 0; j < h; j++)
+        {
+            for (int32_t i = 0; i < w; i++)
+            {
+                if (bitmap[j * byteWidth + i / 8] & (128 >> (i & 7)))
+                {
+                    drawPixel(x + i, y + j, color);
+                }
+            }
+        }
+    }
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t fgcolor, uint16_t bgcolor)
+    {
+        int32_t byteWidth = (w + 7) / 8;
+        for (int32_t j = 0; j < h; j++)
+        {
+            for (int32_t i = 0; i < w; i++)
+            {
+                drawPixel(x + i, y + j, bitmap[j * byteWidth + i / 8] & (128 >> (i & 7)) ? fgcolor : bgcolor);
+            }
+        }
+    }
+
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+    {
+        bool steep = abs(y1 - y0) > abs(x1 - x0);
+        if (steep)
+        {
+            std::swap(x0, y0);
+            std::swap(x1, y1);
+        }
+        if (x0 > x1)
+        {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+
+        int32_t dx = x1 - x0, dy = abs(y1 - y0);
+        int32_t err = dx >> 1, ystep = -1, xs = x0, dlen = 0;
+        if (y0 < y1)
+        {
+            ystep = 1;
+        }
+
+        // Split into steep and not steep for runs of horizontal or vertical pixels
+        for (; x0 <= x1; x0++)
+        {
+            dlen++;
+            err -= dy;
+            if (err < 0)
+            {
+                err += dx;
+                if (steep)
+                {
+                    drawFastVLine(y0, xs, dlen, color);
+                }
+                else
+                {
+                    drawFastHLine(xs, y0, dlen, color);
+                }
+                dlen = 0;
+                y0 += ystep;
+                xs = x0 + 1;
+            }
+        }
+        if (dlen)
+        {
+            if (steep)
+            {
+                drawFastVLine(y0, xs, dlen, color);
+            }
+            else
+            {
+                drawFastHLine(xs, y0, dlen, color);
+            }
+        }
+    }
+
+    void drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
+    {
+        if (r <= 0)
+        {
+            return;
+        }
+
+        int32_t f = 1 - r;
+        int32_t ddF_y = -2 * r;
+        int32_t ddF_x = 1;
+        int32_t xs = -1;
+        int32_t xe = 0;
+        int32_t len = 0;
+
+        bool first = true;
+        do
+        {
+            while (f < 0)
+            {
+                ++xe;
+                f += (ddF_x += 2);
+            }
+            f += (ddF_y += 2);
+
+            if (xe - xs > 1)
+            {
+                if (first)
+                {
+                    len = 2 * (xe - xs) - 1;
+                    drawFastHLine(x0 - xe, y0 + r, len, color);
+                    drawFastHLine(x0 - xe, y0 - r, len, color);
+                    drawFastVLine(x0 + r, y0 - xe, len, color);
+                    drawFastVLine(x0 - r, y0 - xe, len, color);
+                    first = false;
+                }
+                else
+                {
+                    len = xe - xs++;
+                    drawFastHLine(x0 - xe, y0 + r, len, color);
+                    drawFastHLine(x0 - xe, y0 - r, len, color);
+                    drawFastHLine(x0 + xs, y0 - r, len, color);
+                    drawFastHLine(x0 + xs, y0 + r, len, color);
+
+                    drawFastVLine(x0 + r, y0 + xs, len, color);
+                    drawFastVLine(x0 + r, y0 - xe, len, color);
+                    drawFastVLine(x0 - r, y0 - xe, len, color);
+                    drawFastVLine(x0 - r, y0 + xs, len, color);
+                }
+            }
+            else
+            {
+                ++xs;
+                drawPixel(x0 - xe, y0 + r, color);
+                drawPixel(x0 - xe, y0 - r, color);
+                drawPixel(x0 + xs, y0 - r, color);
+                drawPixel(x0 + xs, y0 + r, color);
+
+                drawPixel(x0 + r, y0 + xs, color);
+                drawPixel(x0 + r, y0 - xe, color);
+                drawPixel(x0 - r, y0 - xe, color);
+                drawPixel(x0 - r, y0 + xs, color);
+            }
+            xs = xe;
+        } while (xe < --r);
+    }
+
+    void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
+    {
+        int32_t x = 0;
+        int32_t dx = 1;
+        int32_t dy = r + r;
+        int32_t p = -(r >> 1);
+
+        drawFastHLine(x0 - r, y0, dy + 1, color);
+
+        while (x < r)
+        {
+            if (p >= 0)
+            {
+                drawFastHLine(x0 - x, y0 + r, dx, color);
+                drawFastHLine(x0 - x, y0 - r, dx, color);
+                dy -= 2;
+                p -= dy;
+                r--;
+            }
+
+            dx += 2;
+            p += dx;
+            x++;
+
+            drawFastHLine(x0 - r, y0 + x, dy + 1, color);
+            drawFastHLine(x0 - r, y0 - x, dy + 1, color);
+        }
+    }
+
+    // Anti-aliased edge, blended with what is already drawn unless bg_color is given
+    void fillSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg_color = TFT_eSPI_NO_BACKGROUND)
+    {
+        if (r <= 0)
+        {
+            return;
+        }
+
+        drawFastHLine(x - r, y, 2 * r + 1, color);
+        int32_t xs = 1;
+        int32_t cx = 0;
+
+        int32_t r1 = r * r;
+        r++;
+        int32_t r2 = r * r;
+
+        for (int32_t cy = r - 1; cy > 0; cy--)
+        {
+            int32_t dy2 = (r - cy) * (r - cy);
+            for (cx = xs; cx < r; cx++)
+            {
+                int32_t hyp2 = (r - cx) * (r - cx) + dy2;
+                if (hyp2 <= r1)
+                {
+                    break;
+                }
+                if (hyp2 >= r2)
+                {
+                    continue;
+                }
+
+                uint8_t alpha = ~sqrtU8(hyp2);
+                if (alpha > 246)
+                {
+                    break;
+                }
+                xs = cx;
+                if (alpha < 9)
+                {
+                    continue;
+                }
+
+                drawPixelAlpha(x + cx - r, y + cy - r, color, alpha, bg_color);
+                drawPixelAlpha(x - cx + r, y + cy - r, color, alpha, bg_color);
+                drawPixelAlpha(x - cx + r, y - cy + r, color, alpha, bg_color);
+                drawPixelAlpha(x + cx - r, y - cy + r, color, alpha, bg_color);
+            }
+            drawFastHLine(x + cx - r, y + cy - r, 2 * (r - cx) + 1, color);
+            drawFastHLine(x + cx - r, y - cy + r, 2 * (r - cx) + 1, color);
+        }
+    }
+
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+    {
+        int32_t a, b, y, last;
+
+        // Sort coordinates by Y order (y2 >= y1 >= y0)
+        if (y0 > y1)
+        {
+            std::swap(y0, y1);
+            std::swap(x0, x1);
+        }
+        if (y1 > y2)
+        {
+            std::swap(y2, y1);
+            std::swap(x2, x1);
+        }
+        if (y0 > y1)
+        {
+            std::swap(y0, y1);
+            std::swap(x0, x1);
+        }
+
+        if (y0 == y2)
+        {
+            // All on one line
+            a = b = x0;
+            if (x1 < a)
+                a = x1;
+            else if (x1 > b)
+                b = x1;
+            if (x2 < a)
+                a = x2;
+            else if (x2 > b)
+                b = x2;
+            drawFastHLine(a, y0, b - a + 1, color);
+            return;
+        }
+
+        int32_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+
+        // The y1 scanline belongs to the upper part only if the lower part is flat
+        last = y1 == y2 ? y1 : y1 - 1;
+
+        for (y = y0; y <= last; y++)
+        {
+            a = x0 + sa / dy01;
+            b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b)
+            {
+                std::swap(a, b);
+            }
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+
+        sa = dx12 * (y - y1);
+        sb = dx02 * (y - y0);
+        for (; y <= y2; y++)
+        {
+            a = x1 + sa / dy12;
+            b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b)
+            {
+                std::swap(a, b);
+            }
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+    }
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+
+    // Blends fgc over bgc, alpha 255 is all fgc
+    uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc)
+    {
+        // Split out and blend 5-bit red and blue channels
+        uint32_t rxb = bgc & 0xF81F;
+        rxb += ((fgc & 0xF81F) - rxb) * (alpha >> 2) >> 6;
+        // Split out and blend 6-bit green channel
+        uint32_t xgx = bgc & 0x07E0;
+        xgx += ((fgc & 0x07E0) - xgx) * alpha >> 8;
+        return (rxb & 0xF81F) | (xgx & 0x07E0);
+    }
+
+    // Text, GFX free fonts only. Without a font nothing is drawn.
+    void setFreeFont(const GFXfont *f)
+    {
+        gfxFont = f;
+        glyph_ab = 0;
+        glyph_bb = 0;
+        if (f == nullptr)
+        {
+            return;
+        }
+
+        // Biggest offsets above and below the baseline
+        uint16_t numChars = f->last - f->first;
+        for (uint16_t c = 0; c < numChars; c++)
+        {
+            const GFXglyph *glyph = &f->glyph[c];
+            int8_t ab = -glyph->yOffset;
+            if (ab > glyph_ab)
+            {
+                glyph_ab = ab;
+            }
+            int8_t bb = glyph->height - ab;
+            if (bb > glyph_bb)
+            {
+                glyph_bb = bb;
+            }
+        }
+    }
+
+    void setTextFont(uint8_t) { setFreeFont(nullptr); }
+    void setTextSize(uint8_t s) { textsize = s > 0 ? s : 1; }
+    void setTextColor(uint16_t c)
+    {
+        textcolor = textbgcolor = c;
+    }
+    void setTextColor(uint16_t c, uint16_t b, bool = false)
+    {
+        textcolor = c;
+        textbgcolor = b;
+    }
+    void setTextDatum(uint8_t d) { textdatum = d; }
+    uint8_t getTextDatum() { return textdatum; }
+    void setTextPadding(uint16_t x_width) { padX = x_width; }
+
+    int16_t fontHeight() { return gfxFont != nullptr ? gfxFont->yAdvance * textsize : 0; }
+
+    int16_t textWidth(const char *string)
+    {
+        if (gfxFont == nullptr)
+        {
+            return 0;
+        }
+
+        int32_t str_width = 0;
+        uint16_t len = strlen(string);
+        uint16_t n = 0;
+        while (n < len)
+        {
+            uint16_t uniCode = decodeUTF8((const uint8_t *)string, &n, len - n);
+            if (uniCode < gfxFont->first || uniCode > gfxFont->last)
+            {
+                continue;
+            }
+            const GFXglyph *glyph = &gfxFont->glyph[uniCode - gfxFont->first];
+            // The last character counts its ink, not its advance, unless digits are padded
+            if (n < len || isDigits)
+            {
+                str_width += glyph->xAdvance;
+            }
+            else
+            {
+                str_width += glyph->xOffset + glyph->width;
+            }
+        }
+        return str_width * textsize;
+    }
+
+    int16_t drawString(const char *string, int32_t poX, int32_t poY, uint8_t = 1)
+    {
+        if (gfxFont == nullptr)
+        {
+            return 0;
+        }
+
+        int16_t sumX = 0;
+        int32_t cwidth = textWidth(string);
+        int32_t cheight = glyph_ab * textsize;
+        int32_t baseline = cheight;
+        // Free fonts are drawn from their baseline
+        poY += cheight;
+        if (textdatum == BL_DATUM || textdatum == BC_DATUM || textdatum == BR_DATUM)
+        {
+            // Make room for the descenders
+            cheight += glyph_bb * textsize;
+        }
+
+        switch (textdatum)
+        {
+        case TC_DATUM:
+            poX -= cwidth / 2;
+            break;
+        case TR_DATUM:
+            poX -= cwidth;
+            break;
+        case ML_DATUM:
+            poY -= cheight / 2;
+            break;
+        case MC_DATUM:
+            poX -= cwidth / 2;
+            poY -= cheight / 2;
+            break;
+        case MR_DATUM:
+            poX -= cwidth;
+            poY -= cheight / 2;
+            break;
+        case BL_DATUM:
+            poY -= cheight;
+            break;
+        case BC_DATUM:
+            poX -= cwidth / 2;
+            poY -= cheight;
+            break;
+        case BR_DATUM:
+            poX -= cwidth;
+            poY -= cheight;
+            break;
+        case L_BASELINE:
+            poY -= baseline;
+            break;
+        case C_BASELINE:
+            poX -= cwidth / 2;
+            poY -= baseline;
+            break;
+        case R_BASELINE:
+            poX -= cwidth;
+            poY -= baseline;
+            break;
+        }
+
+        if (textcolor != textbgcolor)
+        {
+            // A background colour fills the string's box, widened for a negative first offset
+            uint16_t len = strlen(string);
+            uint16_t n = 0;
+            uint16_t c2 = 0;
+            while (n < len && c2 == 0)
+            {
+                c2 = decodeUTF8((const uint8_t *)string, &n, len - n);
+            }
+            if (c2 >= gfxFont->first && c2 <= gfxFont->last)
+            {
+                int8_t xo = gfxFont->glyph[c2 - gfxFont->first].xOffset * textsize;
+                if (xo > 0)
+                {
+                    xo = 0;
+                }
+                else
+                {
+                    cwidth -= xo;
+                }
+                fillRect(poX + xo, poY - glyph_ab * textsize, cwidth, (glyph_ab + glyph_bb) * textsize, textbgcolor);
+            }
+        }
+
+        uint16_t len = strlen(string);
+        uint16_t n = 0;
+        while (n < len)
+        {
+            uint16_t uniCode = decodeUTF8((const uint8_t *)string, &n, len - n);
+            sumX += drawChar(uniCode, poX + sumX, poY);
+        }
+
+        return sumX;
+    }
+
+    int16_t drawNumber(long intNumber, int32_t poX, int32_t poY, uint8_t font = 1)
+    {
+        isDigits = true;
+        char str[12];
+        snprintf(str, sizeof(str), "%ld", intNumber);
+        int16_t width = drawString(str, poX, poY, font);
+        isDigits = false;
+        return width;
+    }
+
+    int16_t drawFloat(float floatNumber, uint8_t dp, int32_t poX, int32_t poY, uint8_t font = 1)
+    {
+        isDigits = true;
+        char str[24];
+        snprintf(str, sizeof(str), "%.*f", dp, floatNumber);
+        int16_t width = drawString(str, poX, poY, font);
+        isDigits = false;
+        return width;
+    }
+
+    // Glyph of a free font with its baseline at y, returns the advance
+    int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y)
+    {
+        if (gfxFont == nullptr || uniCode < gfxFont->first || uniCode > gfxFont->last)
+        {
+            return 0;
+        }
+
+        const GFXglyph *glyph = &gfxFont->glyph[uniCode - gfxFont->first];
+        const uint8_t *bitmap = gfxFont->bitmap;
+        uint32_t bo = glyph->bitmapOffset;
+        uint8_t w = glyph->width, h = glyph->height;
+        int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+        uint8_t bits = 0, bit = 0;
+        int16_t xo16 = 0, yo16 = 0;
+        if (textsize > 1)
+        {
+            xo16 = xo;
+            yo16 = yo;
+        }
+
+        // Runs of set pixels become horizontal lines
+        uint16_t hpc = 0;
+        for (uint8_t yy = 0; yy < h; yy++)
+        {
+            for (uint8_t xx = 0; xx < w; xx++)
+            {
+                if (bit == 0)
+                {
+                    bits = bitmap[bo++];
+                    bit = 0x80;
+                }
+
+                if (bits & bit)
+                {
+                    hpc++;
+                }
+                else if (hpc)
+                {
+                    drawGlyphRun(x, y, xo, yo, xo16, yo16, xx, yy, hpc);
+                    hpc = 0;
+                }
+                bit >>= 1;
+            }
+            if (hpc)
+            {
+                drawGlyphRun(x, y, xo, yo, xo16, yo16, w, yy, hpc);
+                hpc = 0;
+            }
+        }
+
+        return glyph->xAdvance * textsize;
+    }
+
+protected:
+    int32_t _width;
+    int32_t _height;
+
+    const GFXfont *gfxFont = nullptr;
+    int8_t glyph_ab = 0;
+    int8_t glyph_bb = 0;
+    uint8_t textsize = 1;
+    uint8_t textdatum = TL_DATUM;
+    uint16_t textcolor = TFT_WHITE;
+    uint16_t textbgcolor = TFT_WHITE;
+    uint16_t padX = 0;
+    bool isDigits = false;
+
+    void drawGlyphRun(int32_t x, int32_t y, int8_t xo, int8_t yo, int16_t xo16, int16_t yo16, int32_t xx, int32_t yy, uint16_t hpc)
+    {
+        if (textsize == 1)
+        {
+            drawFastHLine(x + xo + xx - hpc, y + yo + yy, hpc, textcolor);
+        }
+        else
+        {
+            fillRect(x + (xo16 + xx - hpc) * textsize, y + (yo16 + yy) * textsize, textsize * hpc, textsize, textcolor);
+        }
+    }
+
+    void drawPixelAlpha(int32_t x, int32_t y, uint32_t color, uint8_t alpha, uint32_t bg_color)
+    {
+        if (x < 0 || y < 0 || x >= _width || y >= _height)
+        {
+            return;
+        }
+        uint16_t bg = bg_color == TFT_eSPI_NO_BACKGROUND ? readPixel(x, y) : bg_color;
+        drawPixel(x, y, alphaBlend(alpha, color, bg));
+    }
+
+    // 255 * the fractional part of sqrt(num), how far a pixel is past the radius
+    static uint8_t sqrtU8(uint32_t num)
+    {
+        return (uint8_t)((sqrtf((float)num) - floorf(sqrtf((float)num))) * 255);
+    }
+
+    static uint16_t decodeUTF8(const uint8_t *buf, uint16_t *index, uint16_t remaining)
+    {
+        uint16_t c = buf[(*index)++];
+
+        // 7 bit Unicode
+        if ((c & 0x80) == 0x00)
+        {
+            return c;
+        }
+        // 11 bit Unicode
+        if (((c & 0xE0) == 0xC0) && (remaining > 1))
+        {
+            return ((c & 0x1F) << 6) | (buf[(*index)++] & 0x3F);
+        }
+        // 16 bit Unicode
+        if (((c & 0xF0) == 0xE0) && (remaining > 2))
+        {
+            c = ((c & 0x0F) << 12) | ((buf[(*index)++] & 0x3F) << 6);
+            return c | (buf[(*index)++] & 0x3F);
+        }
+        // Not a valid sequence, pass the byte through
+        return c;
+    }
+};
+
+class TFT_eSprite : public TFT_eSPI
+{
+public:
+    explicit TFT_eSprite(TFT_eSPI *tft) : TFT_eSPI(0, 0), _tft(tft) {}
+    ~TFT_eSprite() { deleteSprite(); }
+
+    void *createSprite(int16_t w, int16_t h, uint8_t = 1)
+    {
+        if (_created)
+        {
+            return _img.data();
+        }
+        if (w < 1 || h < 1)
+        {
+            return nullptr;
+        }
+        if (_bpp == 4)
+        {
+            // Rows start on a byte boundary
+            w = (w + 1) & ~1;
+        }
+        _width = w;
+        _height = h;
+        _img.assign((size_t)w * h * _bpp / 8 + 1, 0);
+        _created = true;
+        return _img.data();
+    }
+
+    void deleteSprite()
+    {
+        _img.clear();
+        _img.shrink_to_fit();
+        _created = false;
+        _width = 0;
+        _height = 0;
+    }
+
+    bool created() { return _created; }
+
+    void *setColorDepth(int8_t b)
+    {
+        uint8_t bpp = b == 8 || b == 4 || b == 1 ? b : 16;
+        if (_created && bpp == _bpp)
+        {
+            return _img.data();
+        }
+        _bpp = bpp;
+        if (_created)
+        {
+            int16_t w = _width;
+            int16_t h = _height;
+            deleteSprite();
+            return createSprite(w, h);
+        }
+        return nullptr;
+    }
+    int8_t getColorDepth() { return _bpp; }
+
+    void *getPointer() { return _created ? _img.data() : nullptr; }
+
+    // Palette of 4-bit sprites, used only when the sprite is pushed
+    void setPaletteColor(uint8_t index, uint16_t color)
+    {
+        if (index < 16)
+        {
+            _palette[index] = color;
+        }
+    }
+    uint16_t getPaletteColor(uint8_t index) { return index < 16 ? _palette[index] : 0; }
+
+    void fillSprite(uint32_t color)
+    {
+        fillRect(0, 0, _width, _height, color);
+    }
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override
+    {
+        if (!_created || x < 0 || y < 0 || x >= _width || y >= _height)
+        {
+            return;
+        }
+        writePixel(x, y, color);
+    }
+
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override
+    {
+        fillRect(x, y, w, 1, color);
+    }
+
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override
+    {
+        if (!_created)
+        {
+            return;
+        }
+        if (x < 0)
+        {
+            w += x;
+            x = 0;
+        }
+        if (y < 0)
+        {
+            h += y;
+            y = 0;
+        }
+        if (x + w > _width)
+        {
+            w = _width - x;
+        }
+        if (y + h > _height)
+        {
+            h = _height - y;
+        }
+        if (w < 1 || h < 1)
+        {
+            return;
+        }
+
+        for (int32_t yp = y; yp < y + h; yp++)
+        {
+            for (int32_t xp = x; xp < x + w; xp++)
+            {
+                writePixel(xp, yp, color);
+            }
+        }
+    }
+
+    // RGB565 of a pixel. 4-bit sprites give the palette index.
+    uint16_t readPixel(int32_t x, int32_t y) override
+    {
+        if (!_created || x < 0 || y < 0 || x >= _width || y >= _height)
+        {
+            return 0xFFFF;
+        }
+        switch (_bpp)
+        {
+        case 16:
+        {
+            uint16_t color = ((uint16_t *)_img.data())[x + y * _width];
+            return (color >> 8) | (color << 8);
+        }
+        case 8:
+        {
+            uint8_t color = _img[x + y * _width];
+            uint16_t blue = color & 0x03;
+            return ((color & 0xE0) << 8) | ((color & 0xC0) << 5) | ((color & 0x1C) << 6) | ((color & 0x1C) << 3) |
+                   (blue ? (blue << 3) | (blue << 1) | (blue >> 1) : 0);
+        }
+        case 4:
+        {
+            uint8_t color = _img[(x + y * _width) >> 1];
+            return (x & 1) ? color & 0x0F : color >> 4;
+        }
+        default:
+            return (_img[(x + y * _width) >> 3] >> (7 - ((x + y * _width) & 7))) & 1 ? 0xFFFF : 0;
+        }
+    }
+
+    // Copies the sprite onto the screen, with 4-bit sprites through their palette
+    void pushSprite(int32_t x, int32_t y)
+    {
+        pushTo(_tft, x, y, false, 0);
+    }
+    void pushSprite(int32_t x, int32_t y, uint16_t transparent)
+    {
+        pushTo(_tft, x, y, true, transparent);
+    }
+    bool pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y)
+    {
+        pushTo(dspr, x, y, false, 0);
+        return true;
+    }
+    bool pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t transparent)
+    {
+        pushTo(dspr, x, y, true, transparent);
+        return true;
+    }
+
+protected:
+    TFT_eSPI *_tft;
+    std::vector<uint8_t> _img;
+    uint8_t _bpp = 16;
+    bool _created = false;
+    uint16_t _palette[16] = {TFT_BLACK, TFT_NAVY, TFT_DARKGREEN, TFT_DARKCYAN, TFT_MAROON, TFT_PURPLE, TFT_OLIVE, TFT_LIGHTGREY,
+                             TFT_DARKGREY, TFT_BLUE, TFT_GREEN, TFT_CYAN, TFT_RED, TFT_MAGENTA, TFT_YELLOW, TFT_WHITE};
+
+    void writePixel(int32_t x, int32_t y, uint32_t color)
+    {
+        switch (_bpp)
+        {
+        case 16:
+            ((uint16_t *)_img.data())[x + y * _width] = (uint16_t)((color >> 8) | (color << 8));
+            break;
+        case 8:
+            _img[x + y * _width] = (uint8_t)((color & 0xE000) >> 8 | (color & 0x0700) >> 6 | (color & 0x0018) >> 3);
+            break;
+        case 4:
+        {
+            uint8_t &pixels = _img[(x + y * _width) >> 1];
+            pixels = (x & 1) ? (pixels & 0xF0) | (color & 0x0F) : (pixels & 0x0F) | (uint8_t)(color << 4);
+            break;
+        }
+        default:
+        {
+            uint32_t bit = x + y * _width;
+            uint8_t mask = 0x80 >> (bit & 7);
+            _img[bit >> 3] = color ? _img[bit >> 3] | mask : _img[bit >> 3] & ~mask;
+            break;
+        }
+        }
+    }
+
+    void pushTo(TFT_eSPI *dst, int32_t x, int32_t y, bool use_transparent, uint16_t transparent)
+    {
+        if (!_created || dst == nullptr)
+        {
+            return;
+        }
+        for (int32_t yp = 0; yp < _height; yp++)
+        {
+            for (int32_t xp = 0; xp < _width; xp++)
+            {
+                uint16_t color = readPixel(xp, yp);
+                if (use_transparent && color == transparent)
+                {
+                    continue;
+                }
+                dst->drawPixel(x + xp, y + yp, _bpp == 4 ? _palette[color] : color);
+            }
+        }
+    }
+};
@@ -0,0 +1,245 @@
+#pragma once
+
+// The part of cJSON the apps use, for the native test environment. Objects,
+// arrays and values are built and printed like the library does; parsing is
+// not needed by the suites, so cJSON_Parse() gives NULL like malformed input.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+#define cJSON_Invalid (0)
+#define cJSON_False (1 << 0)
+#define cJSON_True (1 << 1)
+#define cJSON_NULL (1 << 2)
+#define cJSON_Number (1 << 3)
+#define cJSON_String (1 << 4)
+#define cJSON_Array (1 << 5)
+#define cJSON_Object (1 << 6)
+
+typedef struct cJSON
+{
+    struct cJSON *next;
+    struct cJSON *prev;
+    struct cJSON *child;
+    int type;
+    char *valuestring;
+    int valueint;
+    double valuedouble;
+    char *string;
+} cJSON;
+
+typedef int cJSON_bool;
+
+inline cJSON *cJSON_New(int type)
+{
+    cJSON *item = (cJSON *)calloc(1, sizeof(cJSON));
+    item->type = type;
+    return item;
+}
+
+inline void cJSON_Delete(cJSON *item)
+{
+    while (item != NULL)
+    {
+        cJSON *next = item->next;
+        cJSON_Delete(item->child);
+        free(item->valuestring);
+        free(item->string);
+        free(item);
+        item = next;
+    }
+}
+
+inline void cJSON_free(void *object)
+{
+    free(object);
+}
+
+inline cJSON *cJSON_Parse(const char *)
+{
+    return NULL;
+}
+
+inline cJSON *cJSON_CreateObject() { return cJSON_New(cJSON_Object); }
+inline cJSON *cJSON_CreateArray() { return cJSON_New(cJSON_Array); }
+inline cJSON *cJSON_CreateNull() { return cJSON_New(cJSON_NULL); }
+inline cJSON *cJSON_CreateBool(cJSON_bool b) { return cJSON_New(b ? cJSON_True : cJSON_False); }
+
+inline cJSON *cJSON_CreateNumber(double num)
+{
+    cJSON *item = cJSON_New(cJSON_Number);
+    item->valuedouble = num;
+    item->valueint = (int)num;
+    return item;
+}
+
+inline cJSON *cJSON_CreateString(const char *string)
+{
+    cJSON *item = cJSON_New(cJSON_String);
+    item->valuestring = strdup(string);
+    return item;
+}
+
+inline cJSON_bool cJSON_AddItemToArray(cJSON *array, cJSON *item)
+{
+    if (array == NULL || item == NULL)
+    {
+        return 0;
+    }
+    if (array->child == NULL)
+    {
+        array->child = item;
+        return 1;
+    }
+    cJSON *last = array->child;
+    while (last->next != NULL)
+    {
+        last = last->next;
+    }
+    last->next = item;
+    item->prev = last;
+    return 1;
+}
+
+inline cJSON_bool cJSON_AddItemToObject(cJSON *object, const char *name, cJSON *item)
+{
+    if (item == NULL)
+    {
+        return 0;
+    }
+    free(item->string);
+    item->string = strdup(name);
+    return cJSON_AddItemToArray(object, item);
+}
+
+inline cJSON *cJSON_AddNumberToObject(cJSON *object, const char *name, double number)
+{
+    cJSON *item = cJSON_CreateNumber(number);
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
+
+inline cJSON *cJSON_AddBoolToObject(cJSON *object, const char *name, cJSON_bool boolean)
+{
+    cJSON *item = cJSON_CreateBool(boolean);
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
+
+inline cJSON *cJSON_AddNullToObject(cJSON *object, const char *name)
+{
+    cJSON *item = cJSON_CreateNull();
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
+
+inline cJSON *cJSON_AddStringToObject(cJSON *object, const char *name, const char *string)
+{
+    cJSON *item = cJSON_CreateString(string);
+    cJSON_AddItemToObject(object, name, item);
+    return item;
+}
+
+inline cJSON *cJSON_GetArrayItem(const cJSON *array, int index)
+{
+    cJSON *item = array != NULL ? array->child : NULL;
+    while (item != NULL && index-- > 0)
+    {
+        item = item->next;
+    }
+    return item;
+}
+
+inline cJSON *cJSON_GetObjectItemCaseSensitive(const cJSON *object, const char *name)
+{
+    cJSON *item = object != NULL ? object->child : NULL;
+    while (item != NULL && (item->string == NULL || strcmp(item->string, name) != 0))
+    {
+        item = item->next;
+    }
+    return item;
+}
+
+inline cJSON *cJSON_GetObjectItem(const cJSON *object, const char *name)
+{
+    cJSON *item = object != NULL ? object->child : NULL;
+    while (item != NULL && (item->string == NULL || strcasecmp(item->string, name) != 0))
+    {
+        item = item->next;
+    }
+    return item;
+}
+
+#define cJSON_ArrayForEach(element, array) for (element = (array != NULL) ? (array)->child : NULL; element != NULL; element = element->next)
+
+inline cJSON_bool cJSON_IsNull(const cJSON *item) { return item != NULL && (item->type & 0xFF) == cJSON_NULL; }
+inline cJSON_bool cJSON_IsBool(const cJSON *item) { return item != NULL && (item->type & (cJSON_True | cJSON_False)) != 0; }
+inline cJSON_bool cJSON_IsTrue(const cJSON *item) { return item != NULL && (item->type & 0xFF) == cJSON_True; }
+inline cJSON_bool cJSON_IsNumber(const cJSON *item) { return item != NULL && (item->type & 0xFF) == cJSON_Number; }
+inline cJSON_bool cJSON_IsString(const cJSON *item) { return item != NULL && (item->type & 0xFF) == cJSON_String; }
+
+inline void cJSON_PrintTo(const cJSON *item, std::string &out)
+{
+    char number[32];
+    switch (item->type & 0xFF)
+    {
+    case cJSON_False:
+        out += "false";
+        break;
+    case cJSON_True:
+        out += "true";
+        break;
+    case cJSON_NULL:
+        out += "null";
+        break;
+    case cJSON_Number:
+        // Integers print without a fraction, like the library
+        if (item->valuedouble == (double)item->valueint)
+        {
+            snprintf(number, sizeof(number), "%d", item->valueint);
+        }
+        else
+        {
+            snprintf(number, sizeof(number), "%1.15g", item->valuedouble);
+        }
+        out += number;
+        break;
+    case cJSON_String:
+        out += '"';
+        out += item->valuestring;
+        out += '"';
+        break;
+    case cJSON_Array:
+    case cJSON_Object:
+    {
+        bool object = (item->type & 0xFF) == cJSON_Object;
+        out += object ? '{' : '[';
+        for (const cJSON *child = item->child; child != NULL; child = child->next)
+        {
+            if (object)
+            {
+                out += '"';
+                out += child->string;
+                out += "\":";
+            }
+            cJSON_PrintTo(child, out);
+            if (child->next != NULL)
+            {
+                out += ',';
+            }
+        }
+        out += object ? '}' : ']';
+        break;
+    }
+    }
+}
+
+inline char *cJSON_PrintUnformatted(const cJSON *item)
+{
+    std::string out;
+    cJSON_PrintTo(item, out);
+    return strdup(out.c_str());
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+// The host has no PSRAM, capability allocations come from the heap
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void *heap_caps_malloc(size_t size, uint32_t)
+{
+    return malloc(size);
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+// ESP-NOW for the native test environment: peers are accepted and frames
+// dropped, there is no radio
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_NOW_ETH_ALEN 6
+
+typedef struct
+{
+    uint8_t peer_addr[ESP_NOW_ETH_ALEN];
+    uint8_t channel;
+    bool encrypt;
+} esp_now_peer_info_t;
+
+inline esp_err_t esp_now_add_peer(const esp_now_peer_info_t *)
+{
+    return ESP_OK;
+}
+
+inline esp_err_t esp_now_send(const uint8_t *, const uint8_t *, size_t)
+{
+    return ESP_OK;
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// FreeRTOS keeps queues in their own header, the host one has them all
+#include "FreeRTOS.h"
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+#include "microphone/wav_clip.h"
+
+// The native environment points this at firmware/test/fixtures
+#ifndef SK_TEST_FIXTURES_DIR
+#define SK_TEST_FIXTURES_DIR "firmware/test/fixtures"
+#endif
+
+// Whole file from the fixtures directory, empty if it can't be read
+inline std::vector<uint8_t> readFixture(const char *name)
+{
+    std::string path = std::string(SK_TEST_FIXTURES_DIR) + "/" + name;
+    std::vector<uint8_t> bytes;
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return bytes;
+    }
+
+    uint8_t buffer[4096];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        bytes.insert(bytes.end(), buffer, buffer + read);
+    }
+    fclose(file);
+    return bytes;
+}
+
+// Samples of a WAV fixture as 24-bit, through the parser WavAudioSource uses on the device
+inline bool loadWavFixture(const char *name, std::vector<int32_t> *samples, uint32_t *sample_rate)
+{
+    std::vector<uint8_t> file = readFixture(name);
+    WavClip clip;
+    if (!parseWav(name, file.data(), file.size(), &clip))
+    {
+        return false;
+    }
+
+    samples->resize(clip.num_samples);
+    for (size_t i = 0; i < clip.num_samples; i++)
+    {
+        (*samples)[i] = clip.sampleAt(i);
+    }
+    *sample_rate = clip.sample_rate;
+    return true;
+}
+
+// Every number of a text fixture in order: label files hold one per line, traces are CSV.
+// Anything after '#' on a line is a comment. Empty if the file can't be read.
+inline std::vector<float> loadNumbers(const char *name)
+{
+    std::vector<uint8_t> text = readFixture(name);
+    text.push_back('\n');
+    std::vector<float> numbers;
+    size_t i = 0;
+    while (i < text.size())
+    {
+        if (text[i] == '#')
+        {
+            while (text[i] != '\n')
+            {
+                i++;
+            }
+        }
+        else if ((text[i] >= '0' && text[i] <= '9') || text[i] == '-' || text[i] == '.')
+        {
+            const char *start = (const char *)&text[i];
+            char *end;
+            numbers.push_back(strtof(start, &end));
+            i += end > start ? end - start : 1;
+        }
+        else
+        {
+            i++;
+        }
+    }
+    return numbers;
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include <zlib.h>
+
+// 8-bit RGB PNGs for the render goldens, through the host's zlib. Reading
+// takes non-interlaced 8-bit RGB only, as written here or by an image editor
+// that kept the format.
+
+static const uint8_t PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+inline void pngPutU32(std::vector<uint8_t> &out, uint32_t value)
+{
+    out.push_back(value >> 24);
+    out.push_back(value >> 16);
+    out.push_back(value >> 8);
+    out.push_back(value);
+}
+
+inline uint32_t pngGetU32(const uint8_t *bytes)
+{
+    return (uint32_t)bytes[0] << 24 | (uint32_t)bytes[1] << 16 | (uint32_t)bytes[2] << 8 | bytes[3];
+}
+
+inline void pngPutChunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data)
+{
+    pngPutU32(out, data.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    pngPutU32(out, crc32(0, &out[start], out.size() - start));
+}
+
+// rgb holds width * height pixels, three bytes each, rows top to bottom
+inline bool writePng(const char *path, uint32_t width, uint32_t height, const std::vector<uint8_t> &rgb)
+{
+    // Filter type 0 on every row, zlib does well enough on flat UI colours
+    std::vector<uint8_t> raw;
+    raw.reserve((width * 3 + 1) * height);
+    for (uint32_t y = 0; y < height; y++)
+    {
+        raw.push_back(0);
+        raw.insert(raw.end(), &rgb[y * width * 3], &rgb[y * width * 3] + width * 3);
+    }
+    uLongf packed_size = compressBound(raw.size());
+    std::vector<uint8_t> packed(packed_size);
+    if (compress2(packed.data(), &packed_size, raw.data(), raw.size(), Z_BEST_COMPRESSION) != Z_OK)
+    {
+        return false;
+    }
+    packed.resize(packed_size);
+
+    std::vector<uint8_t> header;
+    pngPutU32(header, width);
+    pngPutU32(header, height);
+    // 8 bits per channel, RGB, deflate, adaptive filtering, no interlace
+    header.insert(header.end(), {8, 2, 0, 0, 0});
+
+    std::vector<uint8_t> out(PNG_SIGNATURE, PNG_SIGNATURE + 8);
+    pngPutChunk(out, "IHDR", header);
+    pngPutChunk(out, "IDAT", packed);
+    pngPutChunk(out, "IEND", {});
+
+    FILE *file = fopen(path, "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool written = fwrite(out.data(), 1, out.size(), file) == out.size();
+    return fclose(file) == 0 && written;
+}
+
+inline uint8_t pngPaeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+inline bool readPng(const std::vector<uint8_t> &file, uint32_t *width, uint32_t *height, std::vector<uint8_t> *rgb)
+{
+    if (file.size() < 8 || memcmp(file.data(), PNG_SIGNATURE, 8) != 0)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> packed;
+    bool has_header = false;
+    size_t pos = 8;
+    while (pos + 12 <= file.size())
+    {
+        uint32_t length = pngGetU32(&file[pos]);
+        const uint8_t *type = &file[pos + 4];
+        const uint8_t *data = &file[pos + 8];
+        if (pos + 12 + length > file.size() || pngGetU32(data + length) != crc32(0, type, length + 4))
+        {
+            return false;
+        }
+        if (memcmp(type, "IHDR", 4) == 0)
+        {
+            *width = pngGetU32(data);
+            *height = pngGetU32(data + 4);
+            // 8-bit RGB, no interlace
+            if (length < 13 || data[8] != 8 || data[9] != 2 || data[12] != 0)
+            {
+                return false;
+            }
+            has_header = true;
+        }
+        else if (memcmp(type, "IDAT", 4) == 0)
+        {
+            packed.insert(packed.end(), data, data + length);
+        }
+        else if (memcmp(type, "IEND", 4) == 0)
+        {
+            break;
+        }
+        pos += 12 + length;
+    }
+    if (!has_header)
+    {
+        return false;
+    }
+
+    const size_t stride = *width * 3;
+    std::vector<uint8_t> raw((stride + 1) * *height);
+    uLongf raw_size = raw.size();
+    if (uncompress(raw.data(), &raw_size, packed.data(), packed.size()) != Z_OK || raw_size != raw.size())
+    {
+        return false;
+    }
+
+    // Undo the row filters, each row predicted from the one above and the pixel to the left
+    rgb->assign(stride * *height, 0);
+    for (uint32_t y = 0; y < *height; y++)
+    {
+        uint8_t filter = raw[y * (stride + 1)];
+        const uint8_t *in = &raw[y * (stride + 1) + 1];
+        uint8_t *row = &(*rgb)[y * stride];
+        const uint8_t *above = y > 0 ? row - stride : nullptr;
+        for (size_t x = 0; x < stride; x++)
+        {
+            uint8_t a = x >= 3 ? row[x - 3] : 0;
+            uint8_t b = above != nullptr ? above[x] : 0;
+            uint8_t c = above != nullptr && x >= 3 ? above[x - 3] : 0;
+            switch (filter)
+            {
+            case 0:
+                row[x] = in[x];
+                break;
+            case 1:
+                row[x] = in[x] + a;
+                break;
+            case 2:
+                row[x] = in[x] + b;
+                break;
+            case 3:
+                row[x] = in[x] + (a + b) / 2;
+                break;
+            case 4:
+                row[x] = in[x] + pngPaeth(a, b, c);
+                break;
+            default:
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector>
+
+// Textbook DFT in double precision, the ground truth for the FFT tests. Windows the
+// 24-bit samples with the same symmetric Hann window as RealFft and returns the
+// magnitudes of bins 0..size/2, in the units of RealFft::magnitudes().
+inline std::vector<double> referenceMagnitudes(const int32_t *samples, size_t size)
+{
+    std::vector<double> windowed(size);
+    for (size_t n = 0; n < size; n++)
+    {
+        double window = 0.5 * (1.0 - cos(2.0 * M_PI * n / (size - 1)));
+        windowed[n] = samples[n] / 8388608.0 * window;
+    }
+
+    std::vector<double> magnitudes(size / 2 + 1);
+    for (size_t k = 0; k <= size / 2; k++)
+    {
+        double re = 0;
+        double im = 0;
+        for (size_t n = 0; n < size; n++)
+        {
+            // k * n wraps at size, which keeps the angle small and exact
+            double angle = 2.0 * M_PI * ((k * n) % size) / size;
+            re += windowed[n] * cos(angle);
+            im -= windowed[n] * sin(angle);
+        }
+        magnitudes[k] = sqrt(re * re + im * im);
+    }
+    return magnitudes;
+}
+
+// Largest absolute difference between two spectra, relative to the peak of the reference
+template <typename T>
+double maxErrorOfPeak(const std::vector<double> &reference, const T *actual)
+{
+    double peak = 0;
+    double error = 0;
+    for (size_t k = 0; k < reference.size(); k++)
+    {
+        peak = fmax(peak, reference[k]);
+        error = fmax(error, fabs(reference[k] - actual[k]));
+    }
+    return peak > 0 ? error / peak : error;
+}
+
+// Two tones and noise at the given amplitude, the signal the FFT benchmarks use
+inline std::vector<int32_t> twoToneFrame(size_t size, int32_t amplitude, uint32_t seed)
+{
+    srand(seed);
+    std::vector<int32_t> samples(size);
+    int32_t noise = amplitude / 100 + 1;
+    for (size_t i = 0; i < size; i++)
+    {
+        samples[i] = amplitude * sin(2.0 * M_PI * 37.3 * i / size) + amplitude / 4 * sin(2.0 * M_PI * 201.7 * i / size) + (rand() % (2 * noise)) - noise;
+    }
+    return samples;
+}
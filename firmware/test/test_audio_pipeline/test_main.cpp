@@ -0,0 +1,188 @@
+// WAV parsing and the MicrophoneTask analysis chain, fed from clips instead of I2S
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "microphone/audio_pipeline.h"
+#include "microphone/wav_clip.h"
+#include "fixtures.h"
+
+void setUp() {}
+void tearDown() {}
+
+// RIFF image of a mono PCM clip, with an odd-sized chunk before the samples like some editors write
+static std::vector<uint8_t> wavImage(uint16_t format, uint16_t channels, uint16_t bits, const std::vector<uint8_t> &data)
+{
+    std::vector<uint8_t> image;
+    auto put32 = [&image](uint32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            image.push_back(value >> (8 * i));
+        }
+    };
+    auto put16 = [&image](uint16_t value)
+    {
+        image.push_back(value);
+        image.push_back(value >> 8);
+    };
+    auto tag = [&image](const char *name)
+    {
+        image.insert(image.end(), name, name + 4);
+    };
+
+    tag("RIFF");
+    put32(0);
+    tag("WAVE");
+    tag("fmt ");
+    put32(16);
+    put16(format);
+    put16(channels);
+    put32(44100);
+    put32(44100 * channels * bits / 8);
+    put16(channels * bits / 8);
+    put16(bits);
+    tag("LIST");
+    put32(3);
+    image.insert(image.end(), {'a', 'b', 'c', 0});
+    tag("data");
+    put32(data.size());
+    image.insert(image.end(), data.begin(), data.end());
+    return image;
+}
+
+void test_parses_16_24_and_32_bit()
+{
+    WavClip clip;
+    std::vector<uint8_t> image = wavImage(1, 1, 16, {0x00, 0x80, 0xff, 0x7f, 0x01, 0x00});
+    TEST_ASSERT_TRUE(parseWav("16-bit", image.data(), image.size(), &clip));
+    TEST_ASSERT_EQUAL(44100, clip.sample_rate);
+    TEST_ASSERT_EQUAL(3, clip.num_samples);
+    TEST_ASSERT_EQUAL(-8388608, clip.sampleAt(0));
+    TEST_ASSERT_EQUAL(32767 * 256, clip.sampleAt(1));
+    TEST_ASSERT_EQUAL(256, clip.sampleAt(2));
+
+    image = wavImage(1, 1, 24, {0x00, 0x00, 0x80, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff});
+    TEST_ASSERT_TRUE(parseWav("24-bit", image.data(), image.size(), &clip));
+    TEST_ASSERT_EQUAL(3, clip.num_samples);
+    TEST_ASSERT_EQUAL(-8388608, clip.sampleAt(0));
+    TEST_ASSERT_EQUAL(8388607, clip.sampleAt(1));
+    TEST_ASSERT_EQUAL(-1, clip.sampleAt(2));
+
+    image = wavImage(1, 1, 32, {0x00, 0x01, 0x00, 0x80, 0xff, 0xff, 0xff, 0x7f});
+    TEST_ASSERT_TRUE(parseWav("32-bit", image.data(), image.size(), &clip));
+    TEST_ASSERT_EQUAL(2, clip.num_samples);
+    TEST_ASSERT_EQUAL(-8388607, clip.sampleAt(0));
+    TEST_ASSERT_EQUAL(8388607, clip.sampleAt(1));
+}
+
+void test_rejects_what_the_device_cannot_play()
+{
+    WavClip clip;
+    std::vector<uint8_t> stereo = wavImage(1, 2, 16, {0, 0, 0, 0});
+    TEST_ASSERT_FALSE(parseWav("stereo", stereo.data(), stereo.size(), &clip));
+    std::vector<uint8_t> floats = wavImage(3, 1, 32, {0, 0, 0, 0});
+    TEST_ASSERT_FALSE(parseWav("float", floats.data(), floats.size(), &clip));
+    std::vector<uint8_t> empty = wavImage(1, 1, 16, {});
+    TEST_ASSERT_FALSE(parseWav("empty", empty.data(), empty.size(), &clip));
+    const uint8_t garbage[] = "RIFX\0\0\0\0WAVE";
+    TEST_ASSERT_FALSE(parseWav("garbage", garbage, sizeof(garbage), &clip));
+}
+
+void test_keeps_samples_of_a_cut_off_clip()
+{
+    // The device loads at most WAV_MAX_FILE_BYTES, the data chunk then claims more than there is
+    std::vector<uint8_t> image = wavImage(1, 1, 16, {1, 0, 2, 0, 3, 0, 4, 0});
+    image.resize(image.size() - 3);
+    WavClip clip;
+    TEST_ASSERT_TRUE(parseWav("cut", image.data(), image.size(), &clip));
+    TEST_ASSERT_EQUAL(2, clip.num_samples);
+    TEST_ASSERT_EQUAL(2 * 256, clip.sampleAt(1));
+}
+
+void test_streams_a_clip_in_dma_blocks()
+{
+    std::vector<int32_t> clip;
+    uint32_t sample_rate;
+    TEST_ASSERT_TRUE(loadWavFixture("tone_1khz.wav", &clip, &sample_rate));
+    TEST_ASSERT_EQUAL(AUDIO_SAMPLE_RATE, sample_rate);
+
+    AudioPipeline pipeline;
+    uint32_t frame_events = 0;
+    for (size_t start = 0; start + AUDIO_MAX_BLOCK_SAMPLES <= clip.size(); start += AUDIO_MAX_BLOCK_SAMPLES)
+    {
+        uint8_t events = pipeline.process(clip.data() + start, AUDIO_MAX_BLOCK_SAMPLES);
+        TEST_ASSERT_FALSE(events & AUDIO_CLAP);
+        frame_events += (events & AUDIO_FRAME) != 0;
+    }
+
+    // A DMA block is less than a hop after decimation, so every hop is analysed
+    size_t streamed = clip.size() / AUDIO_MAX_BLOCK_SAMPLES * AUDIO_MAX_BLOCK_SAMPLES;
+    size_t decimated = streamed / AUDIO_DECIMATION;
+    TEST_ASSERT_EQUAL(decimated / AUDIO_HOP_SAMPLES, pipeline.frames());
+    TEST_ASSERT_EQUAL(pipeline.frames(), frame_events);
+    TEST_ASSERT_EQUAL(0, pipeline.framesSkipped());
+
+    // The newest frame is the decimated clip up to the last hop boundary, oldest sample first
+    Decimator<AUDIO_DECIMATION> decimator;
+    std::vector<int32_t> expected(streamed / AUDIO_DECIMATION + 1);
+    decimator.process(clip.data(), streamed, expected.data());
+    size_t frame_end = pipeline.frames() * AUDIO_HOP_SAMPLES;
+    TEST_ASSERT_EQUAL_MEMORY(expected.data() + frame_end - AUDIO_FFT_SAMPLES, pipeline.frame(), AUDIO_FFT_SAMPLES * sizeof(int32_t));
+}
+
+void test_frame_analysis_finds_the_tone()
+{
+    std::vector<int32_t> clip;
+    uint32_t sample_rate;
+    TEST_ASSERT_TRUE(loadWavFixture("tone_1khz.wav", &clip, &sample_rate));
+
+    AudioPipeline pipeline;
+    for (size_t start = 0; start + AUDIO_MAX_BLOCK_SAMPLES <= clip.size(); start += AUDIO_MAX_BLOCK_SAMPLES)
+    {
+        pipeline.process(clip.data() + start, AUDIO_MAX_BLOCK_SAMPLES);
+    }
+
+    // 1kHz is bin 64 at 16kHz and 1024 points
+    const float *spectrum = pipeline.spectrum();
+    size_t peak = 0;
+    for (size_t k = 1; k <= AUDIO_FFT_SAMPLES / 2; k++)
+    {
+        peak = spectrum[k] > spectrum[peak] ? k : peak;
+    }
+    TEST_ASSERT_EQUAL(64, peak);
+
+    // -12dBFS sine
+    TEST_ASSERT_FLOAT_WITHIN(0.002, 0.25 / sqrt(2), pipeline.frameRms());
+
+    uint8_t loudest = 0;
+    for (uint8_t band = 1; band < AUDIO_NUM_BANDS; band++)
+    {
+        loudest = pipeline.bands().levels()[band] > pipeline.bands().levels()[loudest] ? band : loudest;
+    }
+    TEST_ASSERT_FLOAT_WITHIN(pipeline.bands().centerHz(loudest) * 0.3f, 1000, pipeline.bands().centerHz(loudest));
+}
+
+void test_skips_hops_that_arrive_together()
+{
+    std::vector<int32_t> samples(3 * AUDIO_HOP_SAMPLES, 1000);
+    AudioPipeline pipeline;
+    TEST_ASSERT_EQUAL(AUDIO_FRAME, pipeline.processDecimated(samples.data(), samples.size()) & AUDIO_FRAME);
+    TEST_ASSERT_EQUAL(1, pipeline.frames());
+    TEST_ASSERT_EQUAL(2, pipeline.framesSkipped());
+
+    // Half a hop later nothing is due yet
+    TEST_ASSERT_EQUAL(0, pipeline.processDecimated(samples.data(), AUDIO_HOP_SAMPLES / 2));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_parses_16_24_and_32_bit);
+    RUN_TEST(test_rejects_what_the_device_cannot_play);
+    RUN_TEST(test_keeps_samples_of_a_cut_off_clip);
+    RUN_TEST(test_streams_a_clip_in_dma_blocks);
+    RUN_TEST(test_frame_analysis_finds_the_tone);
+    RUN_TEST(test_skips_hops_that_arrive_together);
+    return UNITY_END();
+}
@@ -0,0 +1,245 @@
+// ClapDetector on synthetic claps and on the labelled clips in firmware/test/fixtures
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "microphone/clap_detector.h"
+#include "fixtures.h"
+
+static const uint32_t SAMPLE_RATE = 48000;
+// Size of the blocks MicrophoneTask reads from I2S
+static const size_t BLOCK_SAMPLES = 256;
+// A detection this close to a label is a hit
+static const uint32_t TOLERANCE_MS = 30;
+// The floor starts at zero and needs a few hundred ms to learn the room. MicrophoneTask runs the
+// detector from boot, so only detections after this are scored.
+static const uint32_t WARM_UP_MS = 500;
+static const uint32_t CLAP_EVERY_MS = 500;
+static const uint8_t SYNTHETIC_CLAPS = 14;
+// Noise bursts whose random envelope peaks twice fail the attack check now and then, and kicks
+// landing on a clap hide some more
+static const uint8_t QUIET_MISSES = 1;
+static const uint8_t MUSIC_MISSES = 3;
+static const size_t SYNTHETIC_SAMPLES = SAMPLE_RATE * (WARM_UP_MS + CLAP_EVERY_MS * SYNTHETIC_CLAPS) / 1000;
+
+void setUp()
+{
+    randomSeed(1);
+}
+void tearDown() {}
+
+static float noiseSample()
+{
+    return random(-(1 << 23), 1 << 23);
+}
+
+// Noise burst with a 1ms attack and a 10ms decay at full scale * level, starting at sample 0
+static float clapSample(uint32_t t, float level)
+{
+    const uint32_t attack = SAMPLE_RATE / 1000;
+    float shape = t < attack ? (float)t / attack : expf(-(float)(t - attack) / (SAMPLE_RATE / 100));
+    return noiseSample() * level * shape;
+}
+
+// Onsets of every clap the detector accepts after the warm-up, in ms, fed in DMA sized blocks
+static std::vector<uint32_t> detectClaps(const std::vector<int32_t> &samples)
+{
+    ClapDetector detector(SAMPLE_RATE);
+    std::vector<uint32_t> claps_ms;
+    for (size_t i = 0; i < samples.size(); i += BLOCK_SAMPLES)
+    {
+        if (!detector.process(samples.data() + i, min(BLOCK_SAMPLES, samples.size() - i)))
+        {
+            continue;
+        }
+        uint32_t clap_ms = (uint64_t)detector.lastClapSample() * 1000 / SAMPLE_RATE;
+        if (clap_ms >= WARM_UP_MS)
+        {
+            claps_ms.push_back(clap_ms);
+        }
+    }
+    return claps_ms;
+}
+
+struct Score
+{
+    uint32_t hits;
+    uint32_t misfires;
+};
+
+static Score score(const std::vector<uint32_t> &claps_ms, const std::vector<float> &labels_ms)
+{
+    Score result = {0, 0};
+    std::vector<bool> matched(labels_ms.size(), false);
+    for (uint32_t clap_ms : claps_ms)
+    {
+        bool hit = false;
+        for (size_t i = 0; i < labels_ms.size() && !hit; i++)
+        {
+            if (!matched[i] && fabsf(clap_ms - labels_ms[i]) <= TOLERANCE_MS)
+            {
+                matched[i] = true;
+                hit = true;
+            }
+        }
+        result.hits += hit;
+        result.misfires += !hit;
+    }
+    return result;
+}
+
+static std::vector<float> syntheticLabels()
+{
+    std::vector<float> labels_ms;
+    for (uint8_t i = 0; i < SYNTHETIC_CLAPS; i++)
+    {
+        labels_ms.push_back(WARM_UP_MS + CLAP_EVERY_MS / 2 + i * CLAP_EVERY_MS);
+    }
+    return labels_ms;
+}
+
+// Kick on every beat at 120 BPM, a hi-hat on every eighth and a bass note, each about as loud
+// as the claps laid over them
+static std::vector<float> music(size_t length)
+{
+    std::vector<float> track(length);
+    const uint32_t eighth = SAMPLE_RATE / 4;
+    float history[3] = {};
+    double kick_phase = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        uint32_t t = i % (2 * eighth);
+        float kick_hz = 50 + 100 * expf(-(float)t / (0.03f * SAMPLE_RATE));
+        kick_phase += 2 * M_PI * kick_hz / SAMPLE_RATE;
+        float kick = sinf(kick_phase) * expf(-(float)t / (0.15f * SAMPLE_RATE));
+
+        // Third difference of noise, nearly all of it above 8kHz
+        float x = noiseSample();
+        float hat = (x - 3 * history[0] + 3 * history[1] - history[2]) * expf(-(float)(i % eighth) / (SAMPLE_RATE / 50));
+        history[2] = history[1];
+        history[1] = history[0];
+        history[0] = x;
+
+        float bass = sinf(2 * M_PI * 110 * i / SAMPLE_RATE);
+        track[i] = 0.4f * kick * (1 << 23) + 0.04f * hat + 0.1f * bass * (1 << 23);
+    }
+    return track;
+}
+
+static std::vector<int32_t> withClaps(const std::vector<float> &background, float level, bool band_limited)
+{
+    std::vector<int32_t> samples(background.size());
+    const uint32_t warm_up = SAMPLE_RATE * WARM_UP_MS / 1000;
+    const uint32_t every = SAMPLE_RATE * CLAP_EVERY_MS / 1000;
+    float lowpass = 0;
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        // Claps start half a period after the warm-up and then every period
+        uint32_t t = (i + 2 * every - warm_up - every / 2) % every;
+        float clap = i >= warm_up && t < SAMPLE_RATE / 20 ? clapSample(t, level) : 0;
+        // A one-pole low-pass at about 2.5kHz, claps recorded through a small speaker or from across a room
+        lowpass += (clap - lowpass) * 0.3f;
+        samples[i] = background[i] + (band_limited ? 2 * lowpass : clap);
+    }
+    return samples;
+}
+
+static std::vector<float> roomNoise(size_t length)
+{
+    std::vector<float> noise(length);
+    for (float &sample : noise)
+    {
+        sample = noiseSample() / 1000;
+    }
+    return noise;
+}
+
+void test_finds_claps_in_a_quiet_room()
+{
+    for (bool band_limited : {false, true})
+    {
+        Score result = score(detectClaps(withClaps(roomNoise(SYNTHETIC_SAMPLES), 0.3f, band_limited)), syntheticLabels());
+        char message[64];
+        snprintf(message, sizeof(message), "%s: %u/%u claps, %u false", band_limited ? "band-limited" : "broadband",
+                 result.hits, SYNTHETIC_CLAPS, result.misfires);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_GREATER_OR_EQUAL_MESSAGE(SYNTHETIC_CLAPS - QUIET_MISSES, result.hits, message);
+        TEST_ASSERT_EQUAL_MESSAGE(0, result.misfires, message);
+    }
+}
+
+void test_finds_claps_over_music()
+{
+    std::vector<float> background = music(SYNTHETIC_SAMPLES);
+    for (bool band_limited : {false, true})
+    {
+        Score result = score(detectClaps(withClaps(background, 0.3f, band_limited)), syntheticLabels());
+        char message[64];
+        snprintf(message, sizeof(message), "%s: %u/%u claps, %u false", band_limited ? "band-limited" : "broadband",
+                 result.hits, SYNTHETIC_CLAPS, result.misfires);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_GREATER_OR_EQUAL_MESSAGE(SYNTHETIC_CLAPS - MUSIC_MISSES, result.hits, message);
+        TEST_ASSERT_EQUAL_MESSAGE(0, result.misfires, message);
+    }
+}
+
+void test_ignores_kicks_and_hihats()
+{
+    std::vector<float> background = music(SAMPLE_RATE * 6);
+    std::vector<int32_t> samples(background.begin(), background.end());
+    TEST_ASSERT_EQUAL(0, detectClaps(samples).size());
+}
+
+void test_ignores_silence()
+{
+    std::vector<int32_t> samples(SAMPLE_RATE * 2, 0);
+    TEST_ASSERT_EQUAL(0, detectClaps(samples).size());
+}
+
+void test_labelled_clips()
+{
+    const char *clips[] = {"clap_quiet", "clap_music", "noclap_music"};
+    for (const char *clip : clips)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "%s.wav", clip);
+        std::vector<int32_t> samples;
+        uint32_t sample_rate;
+        TEST_ASSERT_TRUE_MESSAGE(loadWavFixture(name, &samples, &sample_rate), name);
+        TEST_ASSERT_EQUAL(SAMPLE_RATE, sample_rate);
+
+        snprintf(name, sizeof(name), "%s.txt", clip);
+        std::vector<float> labels_ms = loadNumbers(name);
+        Score result = score(detectClaps(samples), labels_ms);
+
+        char message[64];
+        snprintf(message, sizeof(message), "%s: %u/%u claps, %u false", clip, result.hits, (uint32_t)labels_ms.size(), result.misfires);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_EQUAL_MESSAGE(labels_ms.size(), result.hits, message);
+        TEST_ASSERT_EQUAL_MESSAGE(0, result.misfires, message);
+    }
+}
+
+void test_reset_forgets_the_floor()
+{
+    std::vector<float> background = music(SAMPLE_RATE);
+    std::vector<int32_t> loud(background.begin(), background.end());
+    ClapDetector detector(SAMPLE_RATE);
+    detector.process(loud.data(), loud.size());
+    TEST_ASSERT_GREATER_THAN(0, detector.noiseFloor());
+
+    detector.reset();
+    TEST_ASSERT_EQUAL(0, detector.noiseFloor());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_finds_claps_in_a_quiet_room);
+    RUN_TEST(test_finds_claps_over_music);
+    RUN_TEST(test_ignores_kicks_and_hihats);
+    RUN_TEST(test_ignores_silence);
+    RUN_TEST(test_labelled_clips);
+    RUN_TEST(test_reset_forgets_the_floor);
+    return UNITY_END();
+}
@@ -0,0 +1,158 @@
+// Decimator frequency response and streaming behaviour
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "microphone/decimator.h"
+
+static const uint32_t SAMPLE_RATE = 48000;
+static const double AMPLITUDE = 4000000;
+
+void setUp() {}
+void tearDown() {}
+
+// Gain of a sine at hz through a fresh decimator, in dB, measured after the filter settled
+template <uint8_t FACTOR>
+static double gainDb(double hz)
+{
+    const size_t settle = 4 * Decimator<FACTOR>::TAPS;
+    const size_t length = 8192;
+    std::vector<int32_t> in(settle + length);
+    for (size_t i = 0; i < in.size(); i++)
+    {
+        in[i] = AMPLITUDE * sin(2 * M_PI * hz * i / SAMPLE_RATE);
+    }
+
+    Decimator<FACTOR> decimator;
+    std::vector<int32_t> out(in.size() / FACTOR + 1);
+    size_t produced = decimator.process(in.data(), in.size(), out.data());
+
+    double power = 0;
+    size_t measured = 0;
+    for (size_t i = settle / FACTOR; i < produced; i++)
+    {
+        power += (double)out[i] * out[i];
+        measured++;
+    }
+    return 10 * log10(power / measured / (AMPLITUDE * AMPLITUDE / 2) + 1e-20);
+}
+
+template <uint8_t FACTOR>
+static void checkResponse()
+{
+    const double output_nyquist = SAMPLE_RATE / 2.0 / FACTOR;
+    // Fractions of the output Nyquist frequency, the transition band between them is where aliases may remain
+    const double passband[] = {0.02, 0.1, 0.4, 0.7};
+    const double stopband[] = {1.3, 1.6, FACTOR - 0.05};
+
+    char message[64];
+    for (double probe : passband)
+    {
+        double gain_db = gainDb<FACTOR>(probe * output_nyquist);
+        snprintf(message, sizeof(message), "%dx at %.0fHz: %.2fdB", FACTOR, probe * output_nyquist, gain_db);
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.05, 0, gain_db, message);
+    }
+    for (double probe : stopband)
+    {
+        double gain_db = gainDb<FACTOR>(probe * output_nyquist);
+        snprintf(message, sizeof(message), "%dx at %.0fHz: %.1fdB", FACTOR, probe * output_nyquist, gain_db);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_LESS_THAN_MESSAGE(-70, gain_db, message);
+    }
+}
+
+void test_response_2x()
+{
+    checkResponse<2>();
+}
+
+void test_response_3x()
+{
+    checkResponse<3>();
+}
+
+void test_response_4x()
+{
+    checkResponse<4>();
+}
+
+void test_analysis_band_passes_at_16khz()
+{
+    // MicrophoneTask's bands reach up to 7kHz, near the top of the 3x passband
+    TEST_ASSERT_FLOAT_WITHIN(0.05, 0, gainDb<3>(6000));
+    TEST_ASSERT_FLOAT_WITHIN(0.5, 0, gainDb<3>(7000));
+}
+
+void test_dc_passes_unchanged()
+{
+    std::vector<int32_t> in(4096, 1234567);
+    std::vector<int32_t> out(in.size() / 3 + 1);
+    Decimator<3> decimator;
+    size_t produced = decimator.process(in.data(), in.size(), out.data());
+    TEST_ASSERT_EQUAL(in.size() / 3, produced);
+    for (size_t i = Decimator<3>::TAPS / 3; i < produced; i++)
+    {
+        TEST_ASSERT_INT_WITHIN(2, 1234567, out[i]);
+    }
+}
+
+void test_block_size_does_not_change_output()
+{
+    srand(7);
+    std::vector<int32_t> in(10000);
+    for (int32_t &sample : in)
+    {
+        sample = rand() % 16000000 - 8000000;
+    }
+
+    Decimator<3> whole;
+    std::vector<int32_t> expected(in.size() / 3 + 1);
+    size_t expected_count = whole.process(in.data(), in.size(), expected.data());
+
+    // Odd block lengths, the phase has to carry over between calls
+    Decimator<3> blocks;
+    std::vector<int32_t> out(in.size() / 3 + 1);
+    std::vector<int32_t> block_out(300 / 3 + 1);
+    size_t produced = 0;
+    for (size_t start = 0; start < in.size();)
+    {
+        size_t count = min<size_t>(1 + rand() % 300, in.size() - start);
+        size_t n = blocks.process(in.data() + start, count, block_out.data());
+        TEST_ASSERT_LESS_OR_EQUAL(count / 3 + 1, n);
+        memcpy(out.data() + produced, block_out.data(), n * sizeof(int32_t));
+        produced += n;
+        start += count;
+    }
+
+    TEST_ASSERT_EQUAL(expected_count, produced);
+    TEST_ASSERT_EQUAL_MEMORY(expected.data(), out.data(), produced * sizeof(int32_t));
+}
+
+void test_reset_forgets_history()
+{
+    std::vector<int32_t> loud(1000, 8000000);
+    std::vector<int32_t> silence(300, 0);
+    std::vector<int32_t> out(loud.size() / 3 + 1);
+
+    Decimator<3> decimator;
+    decimator.process(loud.data(), loud.size(), out.data());
+    decimator.reset();
+    size_t produced = decimator.process(silence.data(), silence.size(), out.data());
+    for (size_t i = 0; i < produced; i++)
+    {
+        TEST_ASSERT_EQUAL(0, out[i]);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_response_2x);
+    RUN_TEST(test_response_3x);
+    RUN_TEST(test_response_4x);
+    RUN_TEST(test_analysis_band_passes_at_16khz);
+    RUN_TEST(test_dc_passes_unchanged);
+    RUN_TEST(test_block_size_does_not_change_output);
+    RUN_TEST(test_reset_forgets_history);
+    return UNITY_END();
+}
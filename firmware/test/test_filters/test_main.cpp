@@ -0,0 +1,260 @@
+// Streaming filters against references computed over the whole window, and their cost per sample
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <deque>
+
+#include "filters.h"
+
+void setUp() {}
+void tearDown() {}
+
+// Strain-like input: a slow press with noise and the occasional spike
+static float input(uint32_t i)
+{
+    float noise = (float)((i * 1103515245u + 12345u) >> 16 & 0x3FF) / 1024.0f - 0.5f;
+    float spike = i % 97 == 0 ? 50.0f : 0.0f;
+    return 1000.0f * sinf(i * 0.01f) + 20.0f * noise + spike;
+}
+
+// Mean of the last n samples, summed again in double for every sample, with zeros before the first
+class WindowMean
+{
+public:
+    WindowMean(size_t n) : window_(n, 0.0f) {}
+
+    double addSample(float value)
+    {
+        window_.pop_front();
+        window_.push_back(value);
+        double sum = 0;
+        for (float sample : window_)
+        {
+            sum += sample;
+        }
+        return sum / window_.size();
+    }
+
+private:
+    std::deque<float> window_;
+};
+
+void test_moving_average_matches_the_window_mean()
+{
+    MovingAverage<10> average;
+    WindowMean reference(10);
+    double max_error = 0;
+    for (uint32_t i = 0; i < 100000; i++)
+    {
+        float x = input(i);
+        max_error = max(max_error, fabs(average.addSample(x) - reference.addSample(x)));
+    }
+    TEST_ASSERT_LESS_THAN(0.001, max_error);
+}
+
+void test_moving_average_does_not_drift()
+{
+    // Twenty million samples around a value with few spare mantissa bits. An uncompensated
+    // running sum ends up hundreds of units off here.
+    MovingAverage<10> average;
+    float window[10] = {};
+    const uint32_t samples = 20000000;
+    double max_error = 0;
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        float x = 12345.0f + (float)(i % 7) * 0.37f - (float)(i % 3) * 0.11f;
+        window[i % 10] = x;
+        float result = average.addSample(x);
+        if (i >= 10 && i % 1000 == 0)
+        {
+            double exact = 0;
+            for (float sample : window)
+            {
+                exact += sample;
+            }
+            max_error = max(max_error, fabs(result - exact / 10));
+        }
+    }
+    // One float ulp at 12345
+    TEST_ASSERT_LESS_OR_EQUAL(1.0 / 1024, max_error);
+}
+
+void test_median_matches_a_sorted_window()
+{
+    MedianFilter<5> median;
+    float history[5] = {};
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        float x = input(i);
+        history[i % 5] = x;
+        float result = median.addSample(x);
+        if (i >= 4)
+        {
+            float sorted[5];
+            memcpy(sorted, history, sizeof(sorted));
+            std::sort(sorted, sorted + 5);
+            TEST_ASSERT_EQUAL_FLOAT(sorted[2], result);
+        }
+    }
+}
+
+void test_median_removes_single_spikes()
+{
+    MedianFilter<3> median;
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        float result = median.addSample(i % 10 == 5 ? 5000 : 100);
+        if (i > 0)
+        {
+            TEST_ASSERT_EQUAL_FLOAT(100, result);
+        }
+    }
+}
+
+void test_ewma_and_biquad_settle_on_a_step()
+{
+    Ewma ewma(Ewma::alphaFor(2, 120));
+    Biquad low_pass(BiquadCoefficients::lowPass(5, 120));
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        ewma.addSample(100);
+        low_pass.addSample(100);
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 100, ewma.getValue());
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 100, low_pass.getValue());
+
+    // reset(value) starts from the steady state, so there is no step response to wait for
+    low_pass.reset(-40);
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.01, -40, low_pass.addSample(-40));
+    }
+}
+
+void test_ewma_alpha_gives_the_cutoff()
+{
+    // A first order low-pass is 3dB down at its cutoff
+    const float rate = 1000;
+    const float cutoff = 10;
+    Ewma ewma(Ewma::alphaFor(cutoff, rate));
+    float peak = 0;
+    for (uint32_t i = 0; i < 5000; i++)
+    {
+        float y = ewma.addSample(sinf(2 * PI * cutoff * i / rate));
+        if (i > 2000)
+        {
+            peak = max(peak, fabsf(y));
+        }
+    }
+    TEST_ASSERT_FLOAT_WITHIN(0.02, 1 / sqrtf(2), peak);
+}
+
+// Peak output for a unit sine at hz once the filter settled
+static float biquadGain(const BiquadCoefficients &coefficients, float hz, float rate)
+{
+    Biquad filter(coefficients);
+    float peak = 0;
+    for (uint32_t i = 0; i < 4000; i++)
+    {
+        float y = filter.addSample(sinf(2 * PI * hz * i / rate));
+        if (i > 2000)
+        {
+            peak = max(peak, fabsf(y));
+        }
+    }
+    return peak;
+}
+
+void test_biquad_response()
+{
+    // Butterworth: 3dB down at the cutoff, 12dB per octave beyond it
+    BiquadCoefficients low_pass = BiquadCoefficients::lowPass(5, 120);
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 1, biquadGain(low_pass, 0.5f, 120));
+    TEST_ASSERT_FLOAT_WITHIN(0.02, 1 / sqrtf(2), biquadGain(low_pass, 5, 120));
+    TEST_ASSERT_LESS_THAN(0.05, biquadGain(low_pass, 40, 120));
+
+    BiquadCoefficients high_pass = BiquadCoefficients::highPass(5, 120);
+    TEST_ASSERT_LESS_THAN(0.02, biquadGain(high_pass, 0.5f, 120));
+    TEST_ASSERT_FLOAT_WITHIN(0.02, 1 / sqrtf(2), biquadGain(high_pass, 5, 120));
+    TEST_ASSERT_FLOAT_WITHIN(0.02, 1, biquadGain(high_pass, 25.1f, 120));
+}
+
+void test_one_euro_smooths_at_rest_and_follows_ramps()
+{
+    OneEuroFilter one_euro(1, 0.05f);
+    float rest_jitter = 0;
+    for (uint32_t i = 0; i < 240; i++)
+    {
+        float y = one_euro.addSample(i % 2 == 0 ? 1 : -1, 1 / 120.0f);
+        if (i > 120)
+        {
+            rest_jitter = max(rest_jitter, fabsf(y));
+        }
+    }
+    TEST_ASSERT_LESS_THAN(0.2, rest_jitter);
+
+    // A plain 1Hz low-pass would lag a 1200/s ramp by ~190
+    float ramp_lag = 0;
+    for (uint32_t i = 0; i < 120; i++)
+    {
+        float target = i * 10.0f;
+        ramp_lag = fabsf(one_euro.addSample(target, 1 / 120.0f) - target);
+    }
+    TEST_ASSERT_LESS_THAN(30, ramp_lag);
+}
+
+template <typename F>
+static float nsPerSample(F &&add_sample, uint32_t samples)
+{
+    // The sink keeps the compiler from dropping the filter work
+    volatile float sink = 0;
+    uint32_t started_at = ESP.getCycleCount();
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        sink = add_sample(input(i));
+    }
+    (void)sink;
+    return (float)(ESP.getCycleCount() - started_at) / samples;
+}
+
+void test_moving_average_cost_does_not_grow_with_the_window()
+{
+    const uint32_t samples = 200000;
+    MovingAverage<10> average10;
+    MovingAverage<64> average64;
+    WindowMean window64(64);
+
+    float ns10 = nsPerSample([&](float x)
+                             { return average10.addSample(x); },
+                             samples);
+    float ns64 = nsPerSample([&](float x)
+                             { return average64.addSample(x); },
+                             samples);
+    float window_ns64 = nsPerSample([&](float x)
+                                    { return (float)window64.addSample(x); },
+                                    samples);
+
+    char message[96];
+    snprintf(message, sizeof(message), "MovingAverage<10> %.1fns, <64> %.1fns, summing 64 again %.1fns per sample",
+             ns10, ns64, window_ns64);
+    TEST_MESSAGE(message);
+    // Generous bounds, the host may be busy with other suites
+    TEST_ASSERT_LESS_THAN(2 * ns10 + 20, ns64);
+    TEST_ASSERT_LESS_THAN(window_ns64, ns64);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_moving_average_matches_the_window_mean);
+    RUN_TEST(test_moving_average_does_not_drift);
+    RUN_TEST(test_median_matches_a_sorted_window);
+    RUN_TEST(test_median_removes_single_spikes);
+    RUN_TEST(test_ewma_and_biquad_settle_on_a_step);
+    RUN_TEST(test_ewma_alpha_gives_the_cutoff);
+    RUN_TEST(test_biquad_response);
+    RUN_TEST(test_one_euro_smooths_at_rest_and_follows_ramps);
+    RUN_TEST(test_moving_average_cost_does_not_grow_with_the_window);
+    return UNITY_END();
+}
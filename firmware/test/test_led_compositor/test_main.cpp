@@ -0,0 +1,265 @@
+// LedCompositor blends against float references, layer bookkeeping and the cost of compose() per frame
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "led_ring/led_compositor.h"
+
+// A gamma of 1 makes the LUT the identity, so the tests read the blended values directly
+static const float LINEAR = 1;
+
+void setUp()
+{
+    randomSeed(1);
+}
+void tearDown() {}
+
+static float reference(float dst, float src, LedBlendMode mode)
+{
+    switch (mode)
+    {
+    case LED_BLEND_ADD:
+        return min(255.0f, dst + src);
+    case LED_BLEND_MULTIPLY:
+        return dst * src / 255;
+    case LED_BLEND_SCREEN:
+        return 255 - (255 - dst) * (255 - src) / 255;
+    case LED_BLEND_LIGHTEN:
+        return max(dst, src);
+    case LED_BLEND_NORMAL:
+    default:
+        return src;
+    }
+}
+
+static const LedBlendMode MODES[] = {LED_BLEND_NORMAL, LED_BLEND_ADD, LED_BLEND_MULTIPLY, LED_BLEND_SCREEN, LED_BLEND_LIGHTEN};
+
+// One LED per source value, the arc layer blends src over dst on each of them
+static std::vector<CRGB> composeRamp(uint8_t dst, LedBlendMode mode, uint8_t alpha, uint8_t opacity)
+{
+    LedCompositor compositor(256, LINEAR);
+    compositor.setEnabled(LED_LAYER_ARC, true);
+    compositor.setBlendMode(LED_LAYER_ARC, mode);
+    compositor.setOpacity(LED_LAYER_ARC, opacity);
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        compositor.pixels(LED_LAYER_BASE)[i] = CRGB(dst, 255 - dst, dst / 2);
+        compositor.pixels(LED_LAYER_ARC)[i] = CRGB(i, 255 - i, i / 3);
+        compositor.alpha(LED_LAYER_ARC)[i] = alpha;
+    }
+    std::vector<CRGB> out(256);
+    compositor.compose(out.data());
+    return out;
+}
+
+void test_blend_modes_match_the_float_blend()
+{
+    for (LedBlendMode mode : MODES)
+    {
+        float max_error = 0;
+        for (uint16_t dst = 0; dst < 256; dst++)
+        {
+            std::vector<CRGB> out = composeRamp(dst, mode, 255, 255);
+            CRGB base(dst, 255 - dst, dst / 2);
+            for (uint16_t i = 0; i < 256; i++)
+            {
+                CRGB src(i, 255 - i, i / 3);
+                for (uint8_t c = 0; c < 3; c++)
+                {
+                    max_error = max(max_error, fabsf(out[i].raw[c] - reference(base.raw[c], src.raw[c], mode)));
+                }
+            }
+        }
+        char message[32];
+        snprintf(message, sizeof(message), "mode %d: max error %.2f", mode, max_error);
+        // Truncating shifts instead of dividing by 255, at most one step low
+        TEST_ASSERT_LESS_THAN_MESSAGE(1, max_error, message);
+    }
+}
+
+void test_coverage_and_opacity_weight_the_blend()
+{
+    for (uint8_t weight : {1, 64, 128, 200, 254})
+    {
+        for (uint16_t dst = 0; dst < 256; dst += 15)
+        {
+            std::vector<CRGB> by_alpha = composeRamp(dst, LED_BLEND_NORMAL, weight, 255);
+            std::vector<CRGB> by_opacity = composeRamp(dst, LED_BLEND_NORMAL, 255, weight);
+            for (uint16_t i = 0; i < 256; i++)
+            {
+                float expected = dst + (i - (float)dst) * weight / 255;
+                TEST_ASSERT_FLOAT_WITHIN(2, expected, by_alpha[i].r);
+                TEST_ASSERT_FLOAT_WITHIN(2, expected, by_opacity[i].r);
+            }
+        }
+    }
+}
+
+void test_full_and_zero_weight_are_exact()
+{
+    for (uint16_t dst = 0; dst < 256; dst += 5)
+    {
+        std::vector<CRGB> opaque = composeRamp(dst, LED_BLEND_NORMAL, 255, 255);
+        std::vector<CRGB> uncovered = composeRamp(dst, LED_BLEND_SCREEN, 0, 255);
+        for (uint16_t i = 0; i < 256; i++)
+        {
+            TEST_ASSERT_TRUE(opaque[i] == CRGB(i, 255 - i, i / 3));
+            TEST_ASSERT_TRUE(uncovered[i] == CRGB(dst, 255 - dst, dst / 2));
+        }
+    }
+}
+
+void test_hidden_layers_leave_the_base()
+{
+    LedCompositor compositor(24, LINEAR);
+    for (uint16_t i = 0; i < 24; i++)
+    {
+        compositor.pixels(LED_LAYER_BASE)[i] = CRGB(10 * i, 20, 30);
+        compositor.pixels(LED_LAYER_ARC)[i] = CRGB(255, 255, 255);
+        compositor.alpha(LED_LAYER_ARC)[i] = 255;
+        compositor.pixels(LED_LAYER_FLASH)[i] = CRGB(255, 0, 0);
+        compositor.alpha(LED_LAYER_FLASH)[i] = 255;
+    }
+    compositor.setEnabled(LED_LAYER_FLASH, true);
+    compositor.setOpacity(LED_LAYER_FLASH, 0);
+
+    // The arc is disabled, the flash fully transparent
+    CRGB out[24];
+    compositor.compose(out);
+    for (uint16_t i = 0; i < 24; i++)
+    {
+        TEST_ASSERT_TRUE(out[i] == CRGB(10 * i, 20, 30));
+    }
+
+    // The base cannot be switched off
+    compositor.setEnabled(LED_LAYER_BASE, false);
+    TEST_ASSERT_TRUE(compositor.enabled(LED_LAYER_BASE));
+}
+
+void test_base_blends_against_black()
+{
+    LedCompositor compositor(24, LINEAR);
+    for (uint16_t i = 0; i < 24; i++)
+    {
+        compositor.pixels(LED_LAYER_BASE)[i] = CRGB(200, 100, 255);
+    }
+    CRGB out[24];
+
+    compositor.setOpacity(LED_LAYER_BASE, 128);
+    compositor.compose(out);
+    TEST_ASSERT_UINT8_WITHIN(1, 100, out[0].r);
+    TEST_ASSERT_UINT8_WITHIN(1, 50, out[0].g);
+    TEST_ASSERT_UINT8_WITHIN(1, 128, out[0].b);
+
+    // Black times anything stays black, black plus the base is the base
+    compositor.setOpacity(LED_LAYER_BASE, 255);
+    compositor.setBlendMode(LED_LAYER_BASE, LED_BLEND_MULTIPLY);
+    compositor.compose(out);
+    TEST_ASSERT_TRUE(out[0] == CRGB(0, 0, 0));
+    compositor.setBlendMode(LED_LAYER_BASE, LED_BLEND_ADD);
+    compositor.compose(out);
+    TEST_ASSERT_TRUE(out[0] == CRGB(200, 100, 255));
+}
+
+void test_gamma_lut()
+{
+    LedCompositor compositor(256);
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        compositor.pixels(LED_LAYER_BASE)[i] = CRGB(i, i, i);
+    }
+    std::vector<CRGB> out(256);
+    compositor.compose(out.data());
+
+    TEST_ASSERT_EQUAL_UINT8(0, out[0].r);
+    TEST_ASSERT_EQUAL_UINT8(255, out[255].r);
+    for (uint16_t i = 0; i < 256; i++)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.51, powf(i / 255.0f, LED_GAMMA) * 255, out[i].r);
+        if (i > 0)
+        {
+            TEST_ASSERT_GREATER_OR_EQUAL(out[i - 1].r, out[i].r);
+        }
+    }
+}
+
+void test_only_changes_mark_the_stack_dirty()
+{
+    LedCompositor compositor(24);
+    CRGB out[24];
+    TEST_ASSERT_TRUE(compositor.dirty());
+    compositor.compose(out);
+    TEST_ASSERT_FALSE(compositor.dirty());
+
+    compositor.setOpacity(LED_LAYER_ARC, 255);
+    compositor.setBlendMode(LED_LAYER_ARC, LED_BLEND_NORMAL);
+    compositor.setEnabled(LED_LAYER_ARC, false);
+    TEST_ASSERT_FALSE(compositor.dirty());
+
+    compositor.setOpacity(LED_LAYER_ARC, 100);
+    TEST_ASSERT_TRUE(compositor.dirty());
+    compositor.compose(out);
+    compositor.clear(LED_LAYER_FLASH);
+    TEST_ASSERT_TRUE(compositor.dirty());
+}
+
+// Every layer enabled, partly transparent and covering every pixel, as in LedCompositor::benchmark()
+static float nsPerFrame(uint16_t num_leds, uint32_t frames)
+{
+    LedCompositor compositor(num_leds);
+    std::vector<CRGB> out(num_leds);
+    for (uint8_t l = 0; l < LED_LAYER_COUNT; l++)
+    {
+        LedLayerId id = (LedLayerId)l;
+        compositor.setEnabled(id, true);
+        compositor.setOpacity(id, 200);
+        for (uint16_t i = 0; i < num_leds; i++)
+        {
+            compositor.pixels(id)[i] = CRGB(random(256), random(256), random(256));
+            if (id != LED_LAYER_BASE)
+            {
+                compositor.alpha(id)[i] = 1 + random(255);
+            }
+        }
+    }
+    compositor.setBlendMode(LED_LAYER_ARC, LED_BLEND_SCREEN);
+    compositor.setBlendMode(LED_LAYER_FLASH, LED_BLEND_ADD);
+
+    uint32_t started_at = ESP.getCycleCount();
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        compositor.compose(out.data());
+    }
+    return (float)(ESP.getCycleCount() - started_at) / frames;
+}
+
+void test_cost_grows_linearly_with_the_ring()
+{
+    const uint16_t sizes[] = {24, 64, 128, 256};
+    float ns_per_led[4];
+    for (uint8_t s = 0; s < 4; s++)
+    {
+        float ns = nsPerFrame(sizes[s], 2000);
+        ns_per_led[s] = ns / sizes[s];
+
+        char message[64];
+        snprintf(message, sizeof(message), "%d LEDs: %.0fns per frame, %.1fns per LED", sizes[s], ns, ns_per_led[s]);
+        TEST_MESSAGE(message);
+    }
+    // No per-frame cost beyond the pixels themselves. Generous, the host may be busy with other suites.
+    TEST_ASSERT_LESS_THAN(2 * ns_per_led[0] + 5, ns_per_led[3]);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_blend_modes_match_the_float_blend);
+    RUN_TEST(test_coverage_and_opacity_weight_the_blend);
+    RUN_TEST(test_full_and_zero_weight_are_exact);
+    RUN_TEST(test_hidden_layers_leave_the_base);
+    RUN_TEST(test_base_blends_against_black);
+    RUN_TEST(test_gamma_lut);
+    RUN_TEST(test_only_changes_mark_the_stack_dirty);
+    RUN_TEST(test_cost_grows_linearly_with_the_ring);
+    return UNITY_END();
+}
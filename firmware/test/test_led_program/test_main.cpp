@@ -0,0 +1,307 @@
+// LedProgram validation, what each instruction draws, and the bounded cost of a frame
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "led_ring/led_program.h"
+
+// NUM_LEDS is the ring of the native environment
+
+void setUp()
+{
+    randomSeed(1);
+}
+void tearDown() {}
+
+// Header followed by the given instructions
+static std::vector<uint8_t> program(std::initializer_list<uint8_t> instructions)
+{
+    std::vector<uint8_t> code = {'L', 'P', LED_PROGRAM_VERSION, 0};
+    code.insert(code.end(), instructions);
+    return code;
+}
+
+static bool validate(const std::vector<uint8_t> &code)
+{
+    return LedProgram::validate(code.data(), code.size());
+}
+
+static void load(LedProgram &led_program, const std::vector<uint8_t> &code)
+{
+    TEST_ASSERT_TRUE(led_program.load(code.data(), code.size(), NUM_LEDS));
+}
+
+static void assertAll(const CRGB *pixels, CRGB expected)
+{
+    for (uint16_t i = 0; i < NUM_LEDS; i++)
+    {
+        TEST_ASSERT_EQUAL_HEX8(expected.r, pixels[i].r);
+        TEST_ASSERT_EQUAL_HEX8(expected.g, pixels[i].g);
+        TEST_ASSERT_EQUAL_HEX8(expected.b, pixels[i].b);
+    }
+}
+
+void test_validate_accepts_complete_programs()
+{
+    TEST_ASSERT_TRUE(validate(program({LED_OP_END})));
+    TEST_ASSERT_TRUE(validate(program({LED_OP_FILL, 1, 2, 3, LED_OP_WAIT, 10, LED_OP_LOOP})));
+    TEST_ASSERT_TRUE(validate(program({LED_OP_GRADIENT, 1, 2, 3, 4, 5, 6, LED_OP_SET, 0, 3, 1, 2, 3,
+                                       LED_OP_FADE, 5, 1, 2, 3, LED_OP_ROTATE, 0xFF, LED_OP_DIM, 128,
+                                       LED_OP_FILL_MAIN, LED_OP_END})));
+}
+
+void test_validate_rejects_broken_programs()
+{
+    TEST_ASSERT_FALSE(LedProgram::validate(nullptr, 8));
+    // Header only
+    TEST_ASSERT_FALSE(validate(program({})));
+
+    std::vector<uint8_t> code = program({LED_OP_END});
+    code[0] = 'X';
+    TEST_ASSERT_FALSE(validate(code));
+    code = program({LED_OP_END});
+    code[2] = LED_PROGRAM_VERSION + 1;
+    TEST_ASSERT_FALSE(validate(code));
+
+    TEST_ASSERT_FALSE(validate(program({LED_OP_COUNT, LED_OP_END})));
+    TEST_ASSERT_FALSE(validate(program({0xFF, LED_OP_END})));
+    // Arguments cut off by the end of the program
+    TEST_ASSERT_FALSE(validate(program({LED_OP_END, LED_OP_FILL, 1, 2})));
+    // Runs off the end
+    TEST_ASSERT_FALSE(validate(program({LED_OP_FILL, 1, 2, 3})));
+    TEST_ASSERT_FALSE(validate(program({LED_OP_FILL, 1, 2, 3, LED_OP_WAIT, 4})));
+
+    code = program({});
+    code.resize(LED_PROGRAM_MAX_SIZE, LED_OP_FILL_MAIN);
+    code.push_back(LED_OP_END);
+    TEST_ASSERT_FALSE(validate(code));
+}
+
+void test_load_keeps_only_valid_programs()
+{
+    LedProgram led_program;
+    std::vector<uint8_t> valid = program({LED_OP_END});
+    std::vector<uint8_t> invalid = program({LED_OP_FILL});
+    TEST_ASSERT_FALSE(led_program.load(invalid.data(), invalid.size(), NUM_LEDS));
+    TEST_ASSERT_FALSE(led_program.load(valid.data(), valid.size(), 0));
+    TEST_ASSERT_FALSE(led_program.loaded());
+
+    load(led_program, valid);
+    TEST_ASSERT_TRUE(led_program.loaded());
+    led_program.unload();
+    TEST_ASSERT_FALSE(led_program.loaded());
+
+    CRGB pixels[NUM_LEDS];
+    TEST_ASSERT_FALSE(led_program.renderFrame(pixels, 0));
+}
+
+void test_fill_set_and_end()
+{
+    LedProgram led_program;
+    load(led_program, program({LED_OP_FILL, 1, 2, 3, LED_OP_SET, NUM_LEDS - 1, 2, 9, 8, 7, LED_OP_END}));
+    CRGB pixels[NUM_LEDS];
+    TEST_ASSERT_TRUE(led_program.renderFrame(pixels, 0));
+    TEST_ASSERT_TRUE(led_program.finished());
+
+    // The SET wraps round the ring
+    TEST_ASSERT_TRUE(pixels[NUM_LEDS - 1] == CRGB(9, 8, 7));
+    TEST_ASSERT_TRUE(pixels[0] == CRGB(9, 8, 7));
+    for (uint16_t i = 1; i < NUM_LEDS - 1; i++)
+    {
+        TEST_ASSERT_TRUE(pixels[i] == CRGB(1, 2, 3));
+    }
+
+    // The last frame stays
+    TEST_ASSERT_FALSE(led_program.renderFrame(pixels, 0));
+    TEST_ASSERT_TRUE(pixels[1] == CRGB(1, 2, 3));
+
+    led_program.restart();
+    TEST_ASSERT_FALSE(led_program.finished());
+}
+
+void test_wait_holds_for_its_frames()
+{
+    LedProgram led_program;
+    load(led_program, program({LED_OP_FILL, 1, 1, 1, LED_OP_WAIT, 3, LED_OP_FILL, 2, 2, 2, LED_OP_WAIT, 1, LED_OP_LOOP}));
+    CRGB pixels[NUM_LEDS];
+
+    // Frames 1-3 show the first colour, frame 4 the second, frame 5 loops back to the first
+    const uint8_t expected[] = {1, 1, 1, 2, 1, 1, 1, 2};
+    const bool changed[] = {true, false, false, true, true, false, false, true};
+    for (uint8_t frame = 0; frame < sizeof(expected); frame++)
+    {
+        TEST_ASSERT_EQUAL(changed[frame], led_program.renderFrame(pixels, 0));
+        assertAll(pixels, CRGB(expected[frame], expected[frame], expected[frame]));
+    }
+}
+
+void test_fade_reaches_its_keyframe()
+{
+    LedProgram led_program;
+    load(led_program, program({LED_OP_FILL, 0, 200, 0, LED_OP_FADE, 4, 200, 0, 100, LED_OP_END}));
+    CRGB pixels[NUM_LEDS];
+
+    uint8_t last_r = 0;
+    for (uint8_t frame = 0; frame < 4; frame++)
+    {
+        TEST_ASSERT_TRUE(led_program.renderFrame(pixels, 0));
+        TEST_ASSERT_GREATER_THAN(last_r, pixels[0].r);
+        last_r = pixels[0].r;
+    }
+    assertAll(pixels, CRGB(200, 0, 100));
+
+    TEST_ASSERT_FALSE(led_program.renderFrame(pixels, 0));
+    TEST_ASSERT_TRUE(led_program.finished());
+}
+
+void test_rotate_dim_gradient_and_main_colour()
+{
+    LedProgram led_program;
+    CRGB pixels[NUM_LEDS];
+
+    // Positive steps move pixel i to i + steps
+    load(led_program, program({LED_OP_FILL, 0, 0, 0, LED_OP_SET, 0, 1, 255, 0, 0, LED_OP_ROTATE, 3, LED_OP_WAIT, 1,
+                               LED_OP_ROTATE, (uint8_t)-5, LED_OP_END}));
+    led_program.renderFrame(pixels, 0);
+    TEST_ASSERT_TRUE(pixels[3] == CRGB(255, 0, 0));
+    led_program.renderFrame(pixels, 0);
+    TEST_ASSERT_TRUE(pixels[NUM_LEDS - 2] == CRGB(255, 0, 0));
+
+    load(led_program, program({LED_OP_FILL, 200, 100, 50, LED_OP_DIM, 127, LED_OP_END}));
+    led_program.renderFrame(pixels, 0);
+    assertAll(pixels, CRGB(100, 50, 25));
+
+    load(led_program, program({LED_OP_GRADIENT, 255, 0, 0, 0, 0, 255, LED_OP_END}));
+    led_program.renderFrame(pixels, 0);
+    TEST_ASSERT_TRUE(pixels[0] == CRGB(255, 0, 0));
+    TEST_ASSERT_TRUE(pixels[NUM_LEDS - 1] == CRGB(0, 0, 255));
+    for (uint16_t i = 1; i < NUM_LEDS; i++)
+    {
+        TEST_ASSERT_LESS_THAN(pixels[i - 1].r + 1, pixels[i].r);
+        TEST_ASSERT_GREATER_THAN(pixels[i - 1].b - 1, pixels[i].b);
+    }
+
+    load(led_program, program({LED_OP_FILL_MAIN, LED_OP_END}));
+    led_program.renderFrame(pixels, 0x123456);
+    assertAll(pixels, CRGB(0x12, 0x34, 0x56));
+}
+
+void test_a_frame_runs_at_most_the_instruction_budget()
+{
+    // Never waits. Every frame runs LED_PROGRAM_MAX_OPS_PER_FRAME instructions, half of them rotations.
+    LedProgram led_program;
+    load(led_program, program({LED_OP_ROTATE, 1, LED_OP_LOOP}));
+    CRGB pixels[NUM_LEDS] = {};
+    pixels[0] = CRGB(255, 255, 255);
+
+    for (uint16_t frame = 1; frame <= 100; frame++)
+    {
+        TEST_ASSERT_TRUE(led_program.renderFrame(pixels, 0));
+        TEST_ASSERT_TRUE(pixels[(frame * LED_PROGRAM_MAX_OPS_PER_FRAME / 2) % NUM_LEDS] == CRGB(255, 255, 255));
+        TEST_ASSERT_FALSE(led_program.finished());
+    }
+}
+
+void test_random_programs()
+{
+    // Whatever passes validation must run without reading past the program
+    const uint8_t ops[] = {LED_OP_LOOP, LED_OP_WAIT, LED_OP_FILL, LED_OP_SET, LED_OP_FADE, LED_OP_ROTATE, LED_OP_DIM, LED_OP_GRADIENT, LED_OP_FILL_MAIN};
+    const uint8_t lengths[] = {1, 2, 4, 6, 5, 2, 2, 7, 1};
+    uint32_t valid = 0;
+    for (uint32_t n = 0; n < 2000; n++)
+    {
+        std::vector<uint8_t> code = program({});
+        while (code.size() < (size_t)(8 + random(LED_PROGRAM_MAX_SIZE - 16)))
+        {
+            uint8_t op = random(sizeof(ops));
+            code.push_back(ops[op]);
+            for (uint8_t i = 1; i < lengths[op]; i++)
+            {
+                code.push_back(random(256));
+            }
+        }
+        code.push_back(random(2) ? LED_OP_END : LED_OP_LOOP);
+        // Some of them get damaged
+        if (random(4) == 0)
+        {
+            code[LED_PROGRAM_HEADER_SIZE + random(code.size() - LED_PROGRAM_HEADER_SIZE)] = random(256);
+        }
+        if (random(4) == 0)
+        {
+            code.resize(LED_PROGRAM_HEADER_SIZE + random(code.size() - LED_PROGRAM_HEADER_SIZE));
+        }
+
+        LedProgram led_program;
+        if (!led_program.load(code.data(), code.size(), NUM_LEDS))
+        {
+            continue;
+        }
+        valid++;
+        CRGB pixels[NUM_LEDS] = {};
+        for (uint16_t frame = 0; frame < 200; frame++)
+        {
+            led_program.renderFrame(pixels, 0x00FF00);
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(1000, valid);
+}
+
+static float nsPerFrame(const std::vector<uint8_t> &code, uint16_t num_leds, uint32_t frames)
+{
+    LedProgram led_program;
+    TEST_ASSERT_TRUE(led_program.load(code.data(), code.size(), num_leds));
+    std::vector<CRGB> pixels(num_leds);
+    uint32_t started_at = ESP.getCycleCount();
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        led_program.renderFrame(pixels.data(), 0x008080);
+    }
+    return (float)(ESP.getCycleCount() - started_at) / frames;
+}
+
+void test_frame_cost_is_bounded()
+{
+    // The programs LedProgram::benchmark() times on the device
+    std::vector<uint8_t> typical = program({LED_OP_FILL_MAIN, LED_OP_SET, 0, 3, 255, 255, 255, LED_OP_FADE, 20, 0, 0, 0,
+                                            LED_OP_ROTATE, 1, LED_OP_WAIT, 2, LED_OP_LOOP});
+    std::vector<uint8_t> worst = program({});
+    for (uint8_t i = 0; i < LED_PROGRAM_MAX_OPS_PER_FRAME; i++)
+    {
+        const uint8_t gradient[] = {LED_OP_GRADIENT, i, 0, 255, 255, 0, i};
+        worst.insert(worst.end(), gradient, gradient + sizeof(gradient));
+    }
+    worst.push_back(LED_OP_LOOP);
+    // Loops forever within a frame
+    std::vector<uint8_t> spinning = program({LED_OP_GRADIENT, 0, 0, 255, 255, 0, 0, LED_OP_GRADIENT, 9, 0, 255, 255, 0, 9, LED_OP_LOOP});
+
+    for (uint16_t num_leds : {24, 256})
+    {
+        float typical_ns = nsPerFrame(typical, num_leds, 20000);
+        float worst_ns = nsPerFrame(worst, num_leds, 2000);
+        float spinning_ns = nsPerFrame(spinning, num_leds, 2000);
+
+        char message[112];
+        snprintf(message, sizeof(message), "%d LEDs: typical %.0fns, worst case %.0fns, endless loop %.0fns per frame",
+                 num_leds, typical_ns, worst_ns, spinning_ns);
+        TEST_MESSAGE(message);
+        // The endless loop runs out of budget like the longest program. Generous, the host may be busy with other suites.
+        TEST_ASSERT_LESS_THAN_MESSAGE(2 * worst_ns, spinning_ns, message);
+        TEST_ASSERT_LESS_THAN_MESSAGE(worst_ns, typical_ns, message);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_validate_accepts_complete_programs);
+    RUN_TEST(test_validate_rejects_broken_programs);
+    RUN_TEST(test_load_keeps_only_valid_programs);
+    RUN_TEST(test_fill_set_and_end);
+    RUN_TEST(test_wait_holds_for_its_frames);
+    RUN_TEST(test_fade_reaches_its_keyframe);
+    RUN_TEST(test_rotate_dim_gradient_and_main_colour);
+    RUN_TEST(test_a_frame_runs_at_most_the_instruction_budget);
+    RUN_TEST(test_random_programs);
+    RUN_TEST(test_frame_cost_is_bounded);
+    return UNITY_END();
+}
@@ -0,0 +1,122 @@
+// RealFft against a double precision DFT and against the ArduinoFFT path it replaced
+
+#include <Arduino.h>
+#include <arduinoFFT.h>
+#include <unity.h>
+
+#include "microphone/real_fft.h"
+#include "reference_dft.h"
+
+// Float rounding over log2(size) butterfly stages stays far below this
+static const double MAX_ERROR_OF_PEAK = 1e-5;
+
+void setUp() {}
+void tearDown() {}
+
+static double realFftError(size_t size, int32_t amplitude, uint32_t seed)
+{
+    std::vector<int32_t> samples = twoToneFrame(size, amplitude, seed);
+    RealFft fft(size);
+    std::vector<float> out(fft.bins());
+    fft.loadWindowed(samples.data());
+    fft.magnitudes(out.data());
+    return maxErrorOfPeak(referenceMagnitudes(samples.data(), size), out.data());
+}
+
+void test_matches_dft_at_every_size()
+{
+    for (size_t size = 4; size <= 1024; size <<= 1)
+    {
+        char message[48];
+        snprintf(message, sizeof(message), "%d points", (int)size);
+        TEST_ASSERT_LESS_THAN_MESSAGE(MAX_ERROR_OF_PEAK, realFftError(size, 2000000, size), message);
+    }
+}
+
+void test_matches_dft_from_full_scale_to_silence()
+{
+    const int32_t amplitudes[] = {8388607 / 2, 2000000, 40000, 300};
+    for (int32_t amplitude : amplitudes)
+    {
+        char message[48];
+        snprintf(message, sizeof(message), "amplitude %d", (int)amplitude);
+        TEST_ASSERT_LESS_THAN_MESSAGE(MAX_ERROR_OF_PEAK, realFftError(1024, amplitude, amplitude), message);
+    }
+}
+
+void test_tone_lands_in_its_bin()
+{
+    const size_t size = 1024;
+    std::vector<int32_t> samples(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        samples[i] = 1000000 * sin(2.0 * M_PI * 100 * i / size);
+    }
+
+    RealFft fft(size);
+    std::vector<float> out(fft.bins());
+    fft.loadWindowed(samples.data());
+    fft.magnitudes(out.data());
+
+    size_t peak = 0;
+    for (size_t k = 1; k < out.size(); k++)
+    {
+        peak = out[k] > out[peak] ? k : peak;
+    }
+    TEST_ASSERT_EQUAL(100, peak);
+    // The Hann window spreads a bin centred tone over three bins, far from it only leakage is left
+    TEST_ASSERT_LESS_THAN(out[peak] * 1e-3, out[peak + 5]);
+    TEST_ASSERT_LESS_THAN(out[peak] * 1e-3, out[0]);
+}
+
+void test_matches_arduino_fft_and_is_faster()
+{
+    const size_t size = 1024;
+    const uint16_t iterations = 200;
+    std::vector<int32_t> samples = twoToneFrame(size, 2000000, 1);
+
+    RealFft fft(size);
+    std::vector<float> out(fft.bins());
+    unsigned long started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        fft.loadWindowed(samples.data());
+        fft.magnitudes(out.data());
+    }
+    unsigned long real_us = micros() - started_at;
+
+    // What MicrophoneTask did before: window with cos() per sample, complex FFT on real data
+    ArduinoFFT<float> reference;
+    std::vector<float> re(size), im(size);
+    started_at = micros();
+    for (uint16_t i = 0; i < iterations; i++)
+    {
+        for (size_t j = 0; j < size; j++)
+        {
+            re[j] = samples[j] * FFT_NORMALIZE_24BIT * 0.5f * (1.0f - cos(2.0f * M_PI * j / (size - 1)));
+            im[j] = 0;
+        }
+        reference.compute(re.data(), im.data(), size, FFT_FORWARD);
+        reference.complexToMagnitude(re.data(), im.data(), size);
+    }
+    unsigned long reference_us = micros() - started_at;
+
+    std::vector<double> expected(re.begin(), re.begin() + fft.bins());
+    TEST_ASSERT_LESS_THAN(1e-4, maxErrorOfPeak(expected, out.data()));
+
+    char message[96];
+    snprintf(message, sizeof(message), "1024 points: RealFft %.1fus, ArduinoFFT %.1fus per frame",
+             (float)real_us / iterations, (float)reference_us / iterations);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_LESS_THAN(reference_us, real_us);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_matches_dft_at_every_size);
+    RUN_TEST(test_matches_dft_from_full_scale_to_silence);
+    RUN_TEST(test_tone_lands_in_its_bin);
+    RUN_TEST(test_matches_arduino_fft_and_is_faster);
+    return UNITY_END();
+}
@@ -0,0 +1,101 @@
+// RealFftQ15 against a double precision DFT, from full scale down to the microphone's noise floor
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "microphone/real_fft.h"
+#include "microphone/real_fft_q15.h"
+#include "reference_dft.h"
+
+// A 16-bit datapath that halves every stage lands around 55dB. Without the block exponent
+// quiet frames fall far below this, so the bound catches it.
+static const double MIN_SNR_DB = 50;
+
+void setUp() {}
+void tearDown() {}
+
+// Spectrum error energy against the DFT, in dB below the signal
+static double q15SnrDb(const std::vector<int32_t> &samples)
+{
+    RealFftQ15 fft(samples.size());
+    std::vector<float> out(fft.bins());
+    fft.loadWindowed(samples.data());
+    fft.magnitudes(out.data());
+
+    std::vector<double> expected = referenceMagnitudes(samples.data(), samples.size());
+    double signal = 0;
+    double noise = 0;
+    for (size_t k = 0; k < expected.size(); k++)
+    {
+        double error = out[k] - expected[k];
+        signal += expected[k] * expected[k];
+        noise += error * error;
+    }
+    return 10 * log10(signal / noise);
+}
+
+void test_snr_from_full_scale_to_noise_floor()
+{
+    // -6, -26 and -46dBFS, then the two quiet frames the block exponent is for
+    const int32_t amplitudes[] = {4194303, 419430, 41943, 4000, 400};
+    const size_t sizes[] = {512, 1024};
+    for (size_t size : sizes)
+    {
+        for (int32_t amplitude : amplitudes)
+        {
+            double snr_db = q15SnrDb(twoToneFrame(size, amplitude, amplitude));
+            char message[64];
+            snprintf(message, sizeof(message), "%d points, amplitude %d: %.1fdB", (int)size, (int)amplitude, snr_db);
+            TEST_MESSAGE(message);
+            TEST_ASSERT_GREATER_THAN_MESSAGE(MIN_SNR_DB, snr_db, message);
+        }
+    }
+}
+
+void test_full_scale_square_wave_does_not_overflow()
+{
+    const size_t size = 1024;
+    std::vector<int32_t> samples(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        samples[i] = (i / 2) % 2 ? 8388607 : -8388608;
+    }
+
+    RealFftQ15 fft(size);
+    std::vector<float> out(fft.bins());
+    fft.loadWindowed(samples.data());
+    fft.magnitudes(out.data());
+    TEST_ASSERT_LESS_THAN(1e-2, maxErrorOfPeak(referenceMagnitudes(samples.data(), size), out.data()));
+}
+
+void test_silence_gives_zero_spectrum()
+{
+    const size_t size = 256;
+    std::vector<int32_t> samples(size, 0);
+
+    RealFftQ15 fft(size);
+    std::vector<float> out(fft.bins(), -1);
+    fft.loadWindowed(samples.data());
+    fft.magnitudes(out.data());
+    for (float magnitude : out)
+    {
+        TEST_ASSERT_EQUAL_FLOAT(0, magnitude);
+    }
+}
+
+void test_takes_less_memory_than_float()
+{
+    RealFft reference(1024);
+    RealFftQ15 fft(1024);
+    TEST_ASSERT_LESS_THAN(reference.memoryBytes() * 3 / 5, fft.memoryBytes());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_snr_from_full_scale_to_noise_floor);
+    RUN_TEST(test_full_scale_square_wave_does_not_overflow);
+    RUN_TEST(test_silence_gives_zero_spectrum);
+    RUN_TEST(test_takes_less_memory_than_float);
+    return UNITY_END();
+}
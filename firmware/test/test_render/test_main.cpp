@@ -0,0 +1,380 @@
+// Every app rendered into a host TFT_eSprite and compared with its PNG golden, and the cost of each render
+//
+// Goldens live in fixtures/render. After an intended visual change, run the suite with
+// SK_UPDATE_GOLDENS=1 set to write them again and review the new images before committing.
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <functional>
+
+#include "apps/apps.h"
+#include "gfx/glyph_cache.h"
+#include "fixtures.h"
+#include "png.h"
+
+// Renders per state after the first one, which is timed on its own with cold caches
+static const uint8_t RENDER_FRAMES = 10;
+
+// millis() at which every state is rendered, the stopwatch and the pomodoro count from here
+static const uint32_t CLOCK_START_MS = 1000000;
+
+static TFT_eSPI tft;
+static TFT_eSprite spr(&tft);
+
+void setUp()
+{
+    randomSeed(1);
+    hostFreezeClock(CLOCK_START_MS);
+    // As DisplayTask sets the sprite up, with the centre datum the menu leaves behind. Most apps rely on it.
+    spr.fillSprite(TFT_BLACK);
+    spr.setTextSize(1);
+    spr.setTextColor(TFT_WHITE, TFT_BLACK);
+    spr.setTextDatum(CC_DATUM);
+}
+
+void tearDown()
+{
+    hostReleaseClock();
+}
+
+static std::string goldenPath(const char *name, const char *suffix)
+{
+    return std::string(SK_TEST_FIXTURES_DIR) + "/render/" + name + suffix;
+}
+
+// The framebuffer as 8-bit RGB, every 565 channel widened by repeating its top bits
+static std::vector<uint8_t> framebufferRgb()
+{
+    std::vector<uint8_t> rgb;
+    rgb.reserve(spr.width() * spr.height() * 3);
+    for (int32_t y = 0; y < spr.height(); y++)
+    {
+        for (int32_t x = 0; x < spr.width(); x++)
+        {
+            uint16_t color = spr.readPixel(x, y);
+            uint8_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+            rgb.push_back(r << 3 | r >> 2);
+            rgb.push_back(g << 2 | g >> 4);
+            rgb.push_back(b << 3 | b >> 2);
+        }
+    }
+    return rgb;
+}
+
+static void compareWithGolden(const char *name)
+{
+    std::vector<uint8_t> actual = framebufferRgb();
+    char message[160];
+
+    if (getenv("SK_UPDATE_GOLDENS") != nullptr)
+    {
+        TEST_ASSERT_TRUE_MESSAGE(writePng(goldenPath(name, ".png").c_str(), spr.width(), spr.height(), actual), name);
+        snprintf(message, sizeof(message), "%s: golden written", name);
+        TEST_MESSAGE(message);
+        return;
+    }
+
+    std::string file_name = std::string("render/") + name + ".png";
+    uint32_t width = 0, height = 0;
+    std::vector<uint8_t> golden;
+    if (!readPng(readFixture(file_name.c_str()), &width, &height, &golden))
+    {
+        snprintf(message, sizeof(message), "%s: no readable golden, run with SK_UPDATE_GOLDENS=1 to record it", name);
+        TEST_FAIL_MESSAGE(message);
+    }
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(spr.width(), width, name);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(spr.height(), height, name);
+
+    uint32_t differing = 0;
+    for (size_t i = 0; i < actual.size(); i += 3)
+    {
+        if (memcmp(&actual[i], &golden[i], 3) != 0)
+        {
+            differing++;
+        }
+    }
+    if (differing > 0)
+    {
+        // Left next to the golden for a side by side look, git ignores it
+        writePng(goldenPath(name, ".actual.png").c_str(), spr.width(), spr.height(), actual);
+        snprintf(message, sizeof(message), "%s: %u pixels differ from the golden, see %s.actual.png", name, differing, name);
+        TEST_FAIL_MESSAGE(message);
+    }
+}
+
+// Renders on a cleared sprite like the benchmark on the device did, checks the first frame
+// against the golden and reports what the render costs
+static void renderState(const char *name, std::function<TFT_eSprite *()> render)
+{
+    spr.fillSprite(TFT_BLACK);
+    uint32_t started_at = ESP.getCycleCount();
+    render();
+    uint32_t first_ns = ESP.getCycleCount() - started_at;
+    compareWithGolden(name);
+
+    uint64_t total_ns = 0;
+    uint32_t max_ns = 0;
+    for (uint8_t i = 0; i < RENDER_FRAMES; i++)
+    {
+        spr.fillSprite(TFT_BLACK);
+        started_at = ESP.getCycleCount();
+        render();
+        uint32_t elapsed_ns = ESP.getCycleCount() - started_at;
+        total_ns += elapsed_ns;
+        max_ns = max(max_ns, elapsed_ns);
+    }
+
+    char message[128];
+    snprintf(message, sizeof(message), "%-24s first %6.1fus, then avg %6.1fus, max %6.1fus", name,
+             first_ns / 1000.0f, total_ns / 1000.0f / RENDER_FRAMES, max_ns / 1000.0f);
+    TEST_MESSAGE(message);
+}
+
+static void renderApp(const char *name, App *app)
+{
+    renderState(name, [app]()
+                { return app->render(); });
+}
+
+static void turnTo(App *app, int32_t position, float sub_position_unit = 0)
+{
+    PB_SmartKnobState state = {};
+    state.current_position = position;
+    state.sub_position_unit = sub_position_unit;
+    state.has_config = true;
+    state.config = app->getMotorConfig();
+    app->updateStateFromKnob(state);
+}
+
+static App *load(Apps &apps, const char *slug)
+{
+    char app_id[64];
+    char friendly_name[64] = "Living room";
+    char entity_id[64];
+    snprintf(app_id, sizeof(app_id), "%s.render", slug);
+    snprintf(entity_id, sizeof(entity_id), "%s_render", slug);
+    App *app = apps.loadApp(0, slug, app_id, friendly_name, entity_id);
+    TEST_ASSERT_NOT_NULL_MESSAGE(app, slug);
+    return app;
+}
+
+// The start of the knob range, its middle and its end. Unbounded apps walk a few detents around the start.
+static void renderRange(const char *slug)
+{
+    Apps apps(&spr);
+    App *app = load(apps, slug);
+    PB_SmartKnobConfig config = app->getMotorConfig();
+    int32_t positions[3] = {config.position - 5, config.position, config.position + 5};
+    if (config.min_position <= config.max_position)
+    {
+        positions[0] = config.min_position;
+        positions[1] = (config.min_position + config.max_position) / 2;
+        positions[2] = config.max_position;
+    }
+
+    const char *states[3] = {"min", "mid", "max"};
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        turnTo(app, positions[i]);
+        std::string name = std::string(slug) + "_" + states[i];
+        renderApp(name.c_str(), app);
+    }
+}
+
+void test_climate()
+{
+    renderRange(APP_SLUG_CLIMATE);
+}
+
+void test_blinds()
+{
+    renderRange(APP_SLUG_BLINDS);
+}
+
+void test_music()
+{
+    renderRange(APP_SLUG_MUSIC);
+}
+
+void test_3d_printer()
+{
+    renderRange(APP_SLUG_3D_PRINTER);
+}
+
+void test_light_dimmer()
+{
+    renderRange(APP_SLUG_LIGHT_DIMMER);
+}
+
+void test_light_switch()
+{
+    renderRange(APP_SLUG_LIGHT_SWITCH);
+}
+
+void test_stopwatch()
+{
+    renderRange(APP_SLUG_STOPWATCH);
+
+    // Started by turning past the detent, then three laps. The clock only moves when the test moves it.
+    Apps apps(&spr);
+    App *app = load(apps, APP_SLUG_STOPWATCH);
+    turnTo(app, 0, 4);
+    turnTo(app, 0, 0);
+    hostFreezeClock(CLOCK_START_MS + 83456);
+    renderApp("stopwatch_running", app);
+
+    hostFreezeClock(CLOCK_START_MS + 20000);
+    app->navigationNext();
+    hostFreezeClock(CLOCK_START_MS + 41500);
+    app->navigationNext();
+    hostFreezeClock(CLOCK_START_MS + 60250);
+    app->navigationNext();
+    hostFreezeClock(CLOCK_START_MS + 83456);
+    renderApp("stopwatch_laps", app);
+}
+
+void test_discoball()
+{
+    renderRange(APP_SLUG_DISCOBALL);
+
+    // The spectrum view shows whatever the microphone published last
+    AudioBands bands = {};
+    bands.num_bands = 16;
+    for (uint8_t i = 0; i < bands.num_bands; i++)
+    {
+        bands.bands[i] = 0.1f + 0.05f * ((i * 7) % 16);
+    }
+    bands.beat_count = 3;
+    bands.bpm = 124;
+    AudioBandsChannel::getInstance().publish(bands);
+
+    // Speed, colour, then the spectrum. Gradual colour leads to the mode type and speed pages instead.
+    Apps apps(&spr);
+    App *app = load(apps, APP_SLUG_DISCOBALL);
+    app->navigationNext();
+    turnTo(app, COLOR_BLUE);
+    renderApp("discoball_color", app);
+    app->navigationNext();
+    renderApp("discoball_spectrum", app);
+    app->navigationNext();
+    app->navigationNext();
+    turnTo(app, COLOR_GRADUAL);
+    app->navigationNext();
+    turnTo(app, MODE_BREATHE);
+    renderApp("discoball_mode_type", app);
+    app->navigationNext();
+    turnTo(app, 3);
+    renderApp("discoball_mode_speed", app);
+}
+
+void test_pomodoro()
+{
+    // Not one of the loadable apps, but the other timer that depends on millis()
+    PomodoroApp pomodoro(&spr);
+    App *app = &pomodoro;
+    renderApp("pomodoro_idle", app);
+    app->navigationNext();
+    hostFreezeClock(CLOCK_START_MS + 7 * 60000 + 13000);
+    renderApp("pomodoro_work", app);
+}
+
+void test_menu()
+{
+    Apps apps(&spr);
+    const char *slugs[] = {APP_SLUG_CLIMATE, APP_SLUG_LIGHT_DIMMER, APP_SLUG_MUSIC, APP_SLUG_STOPWATCH};
+    char friendly_name[64] = "Living room";
+    char app_id[64] = "menu.render";
+    char entity_id[64] = "menu_render";
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        apps.loadApp(i, slugs[i], app_id, friendly_name, entity_id);
+    }
+    apps.updateMenu();
+
+    // The second item selected, then turned part of the way towards the third
+    AppState state = {};
+    state.motor_state.current_position = 1;
+    apps.update(state);
+    renderState("menu", [&apps]()
+                { return apps.renderActive(); });
+    state.motor_state.sub_position_unit = 0.4f;
+    apps.update(state);
+    renderState("menu_scrolling", [&apps]()
+                { return apps.renderActive(); });
+}
+
+// The glyph cache writes into the framebuffer itself and has to land on the same pixels as TFT_eSPI
+void test_glyph_cache_matches_draw_string()
+{
+    const GFXfont *fonts[] = {&NDS1210pt7b, &Pixel62mr11pt7b, &NDS125_small, &Roboto_Thin_20};
+    const uint8_t datums[] = {TL_DATUM, MC_DATUM, BR_DATUM, L_BASELINE, C_BASELINE};
+    TFT_eSprite reference(&tft);
+    reference.createSprite(TFT_WIDTH, TFT_HEIGHT);
+
+    for (const GFXfont *font : fonts)
+    {
+        for (uint8_t datum : datums)
+        {
+            spr.fillSprite(TFT_BLACK);
+            reference.fillSprite(TFT_BLACK);
+            spr.setTextDatum(datum);
+            reference.setTextDatum(datum);
+
+            GlyphCache::getInstance().drawString(&spr, font, "Living room 21.5C", 120, 120, TFT_ORANGE);
+            reference.setFreeFont(font);
+            reference.setTextColor(TFT_ORANGE);
+            reference.drawString("Living room 21.5C", 120, 120, 1);
+
+            TEST_ASSERT_EQUAL_MEMORY(reference.getPointer(), spr.getPointer(), TFT_WIDTH * TFT_HEIGHT * 2);
+        }
+    }
+}
+
+// Layouts in gfx/ read sprite memory directly, so the host sprite keeps TFT_eSPI's pixel formats
+void test_sprite_pixel_formats()
+{
+    TFT_eSprite sprite(&tft);
+    sprite.createSprite(4, 2);
+    sprite.drawPixel(1, 0, TFT_ORANGE);
+    TEST_ASSERT_EQUAL_HEX16(0xA0FD, ((uint16_t *)sprite.getPointer())[1]);
+    TEST_ASSERT_EQUAL_HEX16(TFT_ORANGE, sprite.readPixel(1, 0));
+
+    sprite.setColorDepth(8);
+    sprite.drawPixel(1, 0, TFT_ORANGE);
+    TEST_ASSERT_EQUAL_HEX8(0xF4, ((uint8_t *)sprite.getPointer())[1]);
+
+    sprite.setColorDepth(4);
+    sprite.fillSprite(3);
+    sprite.drawPixel(0, 1, 12);
+    TEST_ASSERT_EQUAL_HEX8(0x33, ((uint8_t *)sprite.getPointer())[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xC3, ((uint8_t *)sprite.getPointer())[2]);
+    TEST_ASSERT_EQUAL_UINT16(12, sprite.readPixel(0, 1));
+    sprite.deleteSprite();
+
+    TEST_ASSERT_EQUAL_HEX16(TFT_BLACK, spr.alphaBlend(0, TFT_WHITE, TFT_BLACK));
+    TEST_ASSERT_EQUAL_HEX16(TFT_DARKGREY, spr.alphaBlend(128, TFT_WHITE, TFT_BLACK));
+    TEST_ASSERT_EQUAL_HEX16(TFT_ORANGE, spr.color565(255, 180, 0));
+}
+
+int main(int argc, char **argv)
+{
+    spr.setColorDepth(16);
+    spr.createSprite(TFT_WIDTH, TFT_HEIGHT);
+    SpriteArena::getInstance().begin(&tft);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_sprite_pixel_formats);
+    RUN_TEST(test_glyph_cache_matches_draw_string);
+    RUN_TEST(test_climate);
+    RUN_TEST(test_blinds);
+    RUN_TEST(test_music);
+    RUN_TEST(test_3d_printer);
+    RUN_TEST(test_light_dimmer);
+    RUN_TEST(test_light_switch);
+    RUN_TEST(test_stopwatch);
+    RUN_TEST(test_discoball);
+    RUN_TEST(test_pomodoro);
+    RUN_TEST(test_menu);
+    return UNITY_END();
+}
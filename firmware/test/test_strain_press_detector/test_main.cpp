@@ -0,0 +1,238 @@
+// StrainPressDetector on synthetic readings and on the labelled traces in firmware/test/fixtures
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "sensors/strain_press_detector.h"
+#include "virtual_button.h"
+#include "fixtures.h"
+
+// The device's PRESS_WEIGHT, pressing reads negative
+static const float PRESS_WEIGHT = -50;
+// A press detected this long after its label is a hit, later ones are false and the label is missed
+static const uint32_t TOLERANCE_MS = 300;
+// HX711 at 80 samples/s
+static const uint32_t SAMPLE_US = 12500;
+static const float REST_GRAMS = 300;
+
+void setUp()
+{
+    randomSeed(1);
+}
+void tearDown() {}
+
+static float noise(float sigma)
+{
+    // Sum of uniforms, close enough to a normal for the noise tracking
+    float sum = 0;
+    for (int i = 0; i < 12; i++)
+    {
+        sum += random(10000) / 10000.0f;
+    }
+    return (sum - 6) * sigma;
+}
+
+// Feeds readings at rest for ms and returns the edges
+static std::vector<uint8_t> feed(StrainPressDetector &detector, uint32_t *now_us, uint32_t ms, float grams, float sigma)
+{
+    std::vector<uint8_t> edges;
+    for (uint32_t t = 0; t < ms * 1000; t += SAMPLE_US)
+    {
+        if (detector.addSample(grams + noise(sigma), *now_us))
+        {
+            edges.push_back(detector.buttonCode());
+        }
+        *now_us += SAMPLE_US;
+    }
+    return edges;
+}
+
+static int count(const std::vector<uint8_t> &edges, uint8_t code)
+{
+    return std::count(edges.begin(), edges.end(), code);
+}
+
+void test_short_press_edges()
+{
+    StrainPressDetector detector(PRESS_WEIGHT);
+    uint32_t now_us = 0;
+    TEST_ASSERT_EQUAL(0, feed(detector, &now_us, 2000, REST_GRAMS, 1).size());
+
+    std::vector<uint8_t> edges = feed(detector, &now_us, 200, REST_GRAMS + 2 * PRESS_WEIGHT, 1);
+    std::vector<uint8_t> released = feed(detector, &now_us, 500, REST_GRAMS, 1);
+    edges.insert(edges.end(), released.begin(), released.end());
+
+    std::vector<uint8_t> expected = {VIRTUAL_BUTTON_SHORT_PRESSED, VIRTUAL_BUTTON_SHORT_RELEASED, VIRTUAL_BUTTON_IDLE};
+    TEST_ASSERT_EQUAL(expected.size(), edges.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), edges.data(), expected.size());
+}
+
+void test_long_press_is_timed_from_its_capture()
+{
+    StrainPressDetector detector(PRESS_WEIGHT);
+    uint32_t now_us = 0;
+    feed(detector, &now_us, 2000, REST_GRAMS, 1);
+
+    uint32_t pressed_us = now_us;
+    std::vector<uint8_t> edges = feed(detector, &now_us, 1000, REST_GRAMS + 2 * PRESS_WEIGHT, 1);
+    TEST_ASSERT_EQUAL(2, edges.size());
+    TEST_ASSERT_EQUAL(VIRTUAL_BUTTON_LONG_PRESSED, edges[1]);
+    // The 8Hz smoothing takes a few conversions to cross the threshold
+    TEST_ASSERT_UINT32_WITHIN(5 * SAMPLE_US, pressed_us, detector.pressedAtUs());
+
+    edges = feed(detector, &now_us, 500, REST_GRAMS, 1);
+    TEST_ASSERT_EQUAL(VIRTUAL_BUTTON_LONG_RELEASED, edges[0]);
+}
+
+void test_noise_widens_the_hysteresis()
+{
+    StrainPressDetector quiet(PRESS_WEIGHT);
+    StrainPressDetector noisy(PRESS_WEIGHT);
+    uint32_t quiet_us = 0;
+    uint32_t noisy_us = 0;
+    feed(quiet, &quiet_us, 20000, REST_GRAMS, 1);
+    std::vector<uint8_t> edges = feed(noisy, &noisy_us, 20000, REST_GRAMS, 10);
+
+    TEST_ASSERT_EQUAL_FLOAT(STRAIN_PRESS_LEVEL, quiet.pressThreshold());
+    TEST_ASSERT_EQUAL_FLOAT(STRAIN_RELEASE_LEVEL, quiet.releaseThreshold());
+    TEST_ASSERT_FLOAT_WITHIN(2, 10, noisy.noise());
+    TEST_ASSERT_GREATER_THAN(STRAIN_PRESS_LEVEL, noisy.pressThreshold());
+    TEST_ASSERT_GREATER_THAN(STRAIN_RELEASE_LEVEL, noisy.releaseThreshold());
+    TEST_ASSERT_EQUAL(0, edges.size());
+}
+
+void test_stuck_press_becomes_the_rest_position()
+{
+    StrainPressDetector detector(PRESS_WEIGHT);
+    uint32_t now_us = 0;
+    feed(detector, &now_us, 2000, REST_GRAMS, 1);
+
+    std::vector<uint8_t> edges = feed(detector, &now_us, STRAIN_STUCK_PRESS_MS + 1000, REST_GRAMS + 2 * PRESS_WEIGHT, 1);
+    std::vector<uint8_t> expected = {VIRTUAL_BUTTON_SHORT_PRESSED, VIRTUAL_BUTTON_LONG_PRESSED, VIRTUAL_BUTTON_LONG_RELEASED, VIRTUAL_BUTTON_IDLE};
+    TEST_ASSERT_EQUAL(expected.size(), edges.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.data(), edges.data(), expected.size());
+    TEST_ASSERT_FLOAT_WITHIN(5, REST_GRAMS + 2 * PRESS_WEIGHT, detector.baseline());
+}
+
+void test_reset_releases_a_press()
+{
+    StrainPressDetector detector(PRESS_WEIGHT);
+    uint32_t now_us = 0;
+    feed(detector, &now_us, 2000, REST_GRAMS, 1);
+    feed(detector, &now_us, 1000, REST_GRAMS + 2 * PRESS_WEIGHT, 1);
+    TEST_ASSERT_EQUAL(VIRTUAL_BUTTON_LONG_PRESSED, detector.buttonCode());
+
+    TEST_ASSERT_EQUAL(VIRTUAL_BUTTON_LONG_RELEASED, detector.reset());
+    TEST_ASSERT_EQUAL(VIRTUAL_BUTTON_IDLE, detector.buttonCode());
+    TEST_ASSERT_EQUAL(VIRTUAL_BUTTON_IDLE, detector.reset());
+}
+
+void test_single_glitches_are_ignored()
+{
+    StrainPressDetector detector(PRESS_WEIGHT);
+    uint32_t now_us = 0;
+    feed(detector, &now_us, 2000, REST_GRAMS, 1);
+    for (int i = 0; i < 20; i++)
+    {
+        TEST_ASSERT_FALSE(detector.addSample(-8000, now_us));
+        TEST_ASSERT_EQUAL(1, detector.consecutiveGlitches());
+        now_us += SAMPLE_US;
+        TEST_ASSERT_EQUAL(0, feed(detector, &now_us, 200, REST_GRAMS, 1).size());
+    }
+}
+
+struct TraceResult
+{
+    uint32_t hits;
+    uint32_t false_presses;
+    uint32_t long_presses;
+    uint32_t max_latency_ms;
+};
+
+// Replays "ms,reading" lines through a fresh detector and matches each press to the earliest
+// label at most TOLERANCE_MS before it
+static TraceResult replay(const std::vector<float> &readings, const std::vector<float> &labels_ms)
+{
+    StrainPressDetector detector(PRESS_WEIGHT);
+    TraceResult result = {0, 0, 0, 0};
+    std::vector<bool> matched(labels_ms.size(), false);
+    for (size_t i = 0; i + 1 < readings.size(); i += 2)
+    {
+        uint32_t reading_ms = readings[i];
+        if (!detector.addSample(readings[i + 1], reading_ms * 1000))
+        {
+            continue;
+        }
+        result.long_presses += detector.buttonCode() == VIRTUAL_BUTTON_LONG_PRESSED;
+        if (detector.buttonCode() != VIRTUAL_BUTTON_SHORT_PRESSED)
+        {
+            continue;
+        }
+
+        bool hit = false;
+        for (size_t l = 0; l < labels_ms.size() && !hit; l++)
+        {
+            uint32_t label_ms = labels_ms[l];
+            if (!matched[l] && reading_ms >= label_ms && reading_ms - label_ms <= TOLERANCE_MS)
+            {
+                matched[l] = true;
+                hit = true;
+                result.max_latency_ms = max(result.max_latency_ms, reading_ms - label_ms);
+            }
+        }
+        result.hits += hit;
+        result.false_presses += !hit;
+    }
+    return result;
+}
+
+struct StrainTrace
+{
+    const char *name;
+    // Presses held past STRAIN_LONG_PRESS_MS
+    uint32_t long_presses;
+};
+
+// Written by generate_fixtures.py. Traces without presses (knob turns, drift) only count towards the false presses.
+static const StrainTrace STRAIN_TRACES[] = {
+    {"strain_presses", 0},
+    {"strain_long_presses", 3},
+    {"strain_light_presses", 0},
+    {"strain_turning", 0},
+    {"strain_drift", 0},
+};
+
+void test_labelled_traces()
+{
+    for (const StrainTrace &trace : STRAIN_TRACES)
+    {
+        char name[48];
+        snprintf(name, sizeof(name), "%s.csv", trace.name);
+        std::vector<float> readings = loadNumbers(name);
+        TEST_ASSERT_GREATER_THAN_MESSAGE(0, readings.size(), name);
+        snprintf(name, sizeof(name), "%s.txt", trace.name);
+        std::vector<float> labels_ms = loadNumbers(name);
+
+        TraceResult result = replay(readings, labels_ms);
+        char message[96];
+        snprintf(message, sizeof(message), "%s: %u/%u presses, %u false, %u long, max latency %ums", trace.name,
+                 result.hits, (uint32_t)labels_ms.size(), result.false_presses, result.long_presses, result.max_latency_ms);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_EQUAL_MESSAGE(labels_ms.size(), result.hits, message);
+        TEST_ASSERT_EQUAL_MESSAGE(0, result.false_presses, message);
+        TEST_ASSERT_EQUAL_MESSAGE(trace.long_presses, result.long_presses, message);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_short_press_edges);
+    RUN_TEST(test_long_press_is_timed_from_its_capture);
+    RUN_TEST(test_noise_widens_the_hysteresis);
+    RUN_TEST(test_stuck_press_becomes_the_rest_position);
+    RUN_TEST(test_reset_releases_a_press);
+    RUN_TEST(test_single_glitches_are_ignored);
+    RUN_TEST(test_labelled_traces);
+    return UNITY_END();
+}
@@ -0,0 +1,169 @@
+// TempoTracker on synthetic onset envelopes, and the whole analysis chain on clips of known tempo
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <memory>
+
+#include "microphone/audio_pipeline.h"
+#include "fixtures.h"
+
+// Estimates within this share of the true tempo count as correct
+static const float TOLERANCE = 0.04f;
+// Clicks are exact, so their tempo must be found much closer
+static const float CLICK_TOLERANCE = 0.02f;
+
+void setUp()
+{
+    randomSeed(1);
+}
+void tearDown() {}
+
+// Whether frame i holds a click, one every period frames starting at frame 0. Fractional periods
+// put each click on the first frame at or after its time.
+static bool isClick(uint32_t i, float period)
+{
+    return i == 0 || (uint32_t)(i / period) != (uint32_t)((i - 1) / period);
+}
+
+// Onset envelope of the clicks over a little noise
+
+static float clickFlux(uint32_t i, float period)
+{
+    return isClick(i, period) ? 1.0f : random(100) / 1000.0f;
+}
+
+// Bare clicks carry nothing that rules out half their tempo, so the cases stay where the prior
+// favours the true one
+void test_finds_the_tempo_of_clicks()
+{
+    for (float bpm : {70.0f, 90.0f, 120.0f, 128.0f, 150.0f})
+    {
+        TempoTracker tracker(AUDIO_ANALYSIS_RATE, AUDIO_HOP_SAMPLES);
+        float period = tracker.frameRate() * 60 / bpm;
+        uint32_t frames = tracker.frameRate() * TEMPO_HISTORY_MS / 1000 + tracker.frameRate();
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            tracker.addFrame(clickFlux(i, period), i > 0 && isClick(i - 1, period));
+        }
+
+        char message[48];
+        snprintf(message, sizeof(message), "%.0f BPM: got %.1f", bpm, tracker.bpm());
+        TEST_ASSERT_FLOAT_WITHIN_MESSAGE(bpm * CLICK_TOLERANCE, bpm, tracker.bpm(), message);
+        TEST_ASSERT_GREATER_THAN_MESSAGE(TEMPO_MIN_CONFIDENCE, tracker.confidence(), message);
+    }
+}
+
+void test_beats_land_on_the_clicks()
+{
+    TempoTracker tracker(AUDIO_ANALYSIS_RATE, AUDIO_HOP_SAMPLES);
+    float period = tracker.frameRate() * 0.5f;
+    uint32_t settled = tracker.frameRate() * TEMPO_HISTORY_MS / 1000;
+    uint32_t frames = settled + tracker.frameRate() * 10;
+    uint32_t beats = 0;
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        // The detector reports an onset one frame after its peak
+        bool beat = tracker.addFrame(clickFlux(i, period), i > 0 && isClick(i - 1, period));
+        if (!beat || i < settled)
+        {
+            continue;
+        }
+        beats++;
+        float phase = fmodf(i, period);
+        float offset = min(phase, period - phase);
+        TEST_ASSERT_LESS_OR_EQUAL(2, offset);
+    }
+    // 20 clicks in the last ten seconds
+    TEST_ASSERT_INT_WITHIN(1, 20, beats);
+}
+
+void test_goes_quiet_after_the_music_stops()
+{
+    TempoTracker tracker(AUDIO_ANALYSIS_RATE, AUDIO_HOP_SAMPLES);
+    float period = tracker.frameRate() * 0.5f;
+    uint32_t frames = tracker.frameRate() * TEMPO_HISTORY_MS / 1000;
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        tracker.addFrame(clickFlux(i, period), i > 0 && isClick(i - 1, period));
+    }
+
+    // The grid keeps going through TEMPO_HOLD_MS of silence, then stops
+    uint32_t hold = tracker.frameRate() * TEMPO_HOLD_MS / 1000;
+    uint32_t held_beats = 0;
+    uint32_t late_beats = 0;
+    for (uint32_t i = 0; i < 3 * hold; i++)
+    {
+        bool beat = tracker.addFrame(0, false);
+        held_beats += beat && i < hold - period;
+        late_beats += beat && i > hold;
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL(TEMPO_HOLD_MS / 500 - 1, held_beats);
+    TEST_ASSERT_EQUAL(0, late_beats);
+}
+
+void test_silence_has_no_tempo()
+{
+    TempoTracker tracker(AUDIO_ANALYSIS_RATE, AUDIO_HOP_SAMPLES);
+    uint32_t beats = 0;
+    for (uint32_t i = 0; i < tracker.frameRate() * 8; i++)
+    {
+        beats += tracker.addFrame(0, false);
+    }
+    TEST_ASSERT_EQUAL(0, beats);
+    TEST_ASSERT_EQUAL_FLOAT(0, tracker.bpm());
+}
+
+struct TempoClip
+{
+    const char *name;
+    float bpm;
+};
+
+// Written at AUDIO_ANALYSIS_RATE by generate_fixtures.py, so they go straight past the decimator
+static const TempoClip TEMPO_CLIPS[] = {
+    {"tempo_090.wav", 90},
+    {"tempo_128.wav", 128},
+    {"tempo_150.wav", 150},
+};
+
+void test_labelled_clips()
+{
+    for (const TempoClip &clip : TEMPO_CLIPS)
+    {
+        std::vector<int32_t> samples;
+        uint32_t sample_rate;
+        TEST_ASSERT_TRUE_MESSAGE(loadWavFixture(clip.name, &samples, &sample_rate), clip.name);
+        TEST_ASSERT_EQUAL(AUDIO_ANALYSIS_RATE, sample_rate);
+
+        std::unique_ptr<AudioPipeline> pipeline(new AudioPipeline());
+        uint32_t beats = 0;
+        for (size_t i = 0; i + AUDIO_HOP_SAMPLES <= samples.size(); i += AUDIO_HOP_SAMPLES)
+        {
+            beats += (pipeline->processDecimated(samples.data() + i, AUDIO_HOP_SAMPLES) & AUDIO_BEAT) != 0;
+        }
+
+        // Double or half the tempo is the usual failure, it is reported apart from plain misses
+        float bpm = pipeline->tempo().bpm();
+        float error = fabsf(bpm - clip.bpm) / clip.bpm;
+        float octave_error = min(fabsf(bpm - 2 * clip.bpm) / (2 * clip.bpm), fabsf(bpm - clip.bpm / 2) / (clip.bpm / 2));
+        char message[80];
+        snprintf(message, sizeof(message), "%s: expected %.0f BPM, got %.1f (confidence %.2f)%s, %u beats",
+                 clip.name, clip.bpm, bpm, pipeline->tempo().confidence(),
+                 error >= TOLERANCE && octave_error < TOLERANCE ? ", octave error" : "", beats);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_LESS_THAN_MESSAGE(TOLERANCE, error, message);
+        TEST_ASSERT_GREATER_THAN_MESSAGE(0, beats, message);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_finds_the_tempo_of_clicks);
+    RUN_TEST(test_beats_land_on_the_clicks);
+    RUN_TEST(test_goes_quiet_after_the_music_stops);
+    RUN_TEST(test_silence_has_no_tempo);
+    RUN_TEST(test_labelled_clips);
+    return UNITY_END();
+}
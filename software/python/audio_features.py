@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""Decode the SmartKnob AudioFeatures stream and report its throughput.
+
+The stream is enabled with an AudioFeatureConfig on the link it should run on:
+
+    python audio_features.py mqtt --host 192.168.1.10
+    python audio_features.py serial --port /dev/ttyACM0 --interval-ms 20 --batch 4
+
+MQTT needs paho-mqtt, serial needs pyserial. Level codes are decoded with the
+ranges from firmware/src/microphone/audio_feature_stream.h.
+"""
+
+import argparse
+import os
+import random
+import sys
+import threading
+import time
+import zlib
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), 'proto_gen'))
+
+import smartknob_pb2  # noqa: E402
+
+PROTOBUF_PROTOCOL_VERSION = 1
+
+AUDIO_FEATURES_TOPIC = 'smartknob/audio/features'
+AUDIO_FEATURES_CONFIG_TOPIC = 'smartknob/audio/features/config'
+
+BAND_MIN_DB, BAND_MAX_DB = -80.0, 50.0
+RMS_MIN_DB, RMS_MAX_DB = -100.0, 0.0
+
+
+def decode_level(code, min_db, max_db):
+    return min_db + code * (max_db - min_db) / 255.0
+
+
+class Throughput:
+    """Counts batches as they arrive and prints rates every period seconds."""
+
+    def __init__(self, period, verbose):
+        self.period = period
+        self.verbose = verbose
+        self.lock = threading.Lock()
+        self.last_sequence = None
+        self.total_lost = 0
+        self.bpm = 0
+        self.reset(time.monotonic())
+
+    def reset(self, now):
+        self.started = now
+        self.messages = 0
+        self.bytes = 0
+        self.frames = 0
+        self.beats = 0
+        self.lost = 0
+
+    def add(self, batch, wire_bytes):
+        with self.lock:
+            if self.last_sequence is not None and batch.sequence > self.last_sequence:
+                self.lost += batch.sequence - self.last_sequence - 1
+            self.last_sequence = batch.sequence
+            self.messages += 1
+            self.bytes += wire_bytes
+            self.frames += len(batch.frames)
+            self.beats += sum(1 for frame in batch.frames if frame.beat)
+            self.bpm = batch.bpm
+
+        if self.verbose:
+            for frame in batch.frames:
+                bars = ''.join(' .:-=+*#%@'[min(9, code // 26)] for code in frame.bands)
+                print('%10d %s %6.1f dBFS %s' % (batch.start_ms + frame.offset_ms, bars,
+                                                 decode_level(frame.rms, RMS_MIN_DB, RMS_MAX_DB),
+                                                 'BEAT' if frame.beat else ''))
+
+    def report(self):
+        now = time.monotonic()
+        with self.lock:
+            elapsed = now - self.started
+            if elapsed < self.period:
+                return
+            self.total_lost += self.lost
+            if self.messages > 0:
+                print('%5.1f msg/s  %7.1f B/s  %5.1f frames/s  %5.1f B/frame  %d beats  %d lost (%d total)  %.1f BPM' % (
+                    self.messages / elapsed, self.bytes / elapsed, self.frames / elapsed,
+                    float(self.bytes) / max(1, self.frames), self.beats, self.lost, self.total_lost, self.bpm))
+            else:
+                print('no AudioFeatures received in %.1fs' % elapsed)
+            self.reset(now)
+
+
+def make_config(args):
+    return smartknob_pb2.AudioFeatureConfig(enabled=not args.disable,
+                                            frame_interval_ms=args.interval_ms,
+                                            batch_frames=args.batch)
+
+
+def run_mqtt(args, stats):
+    import paho.mqtt.client as mqtt
+
+    def on_connect(client, userdata, flags, rc):
+        client.subscribe(AUDIO_FEATURES_TOPIC)
+        client.publish(AUDIO_FEATURES_CONFIG_TOPIC, make_config(args).SerializeToString())
+
+    def on_message(client, userdata, message):
+        batch = smartknob_pb2.AudioFeatures.FromString(message.payload)
+        # Payload only, the MQTT header and topic add about 30 bytes per message
+        stats.add(batch, len(message.payload))
+
+    client = mqtt.Client()
+    if args.user:
+        client.username_pw_set(args.user, args.password)
+    client.on_connect = on_connect
+    client.on_message = on_message
+    client.connect(args.host, args.mqtt_port)
+    client.loop_start()
+    try:
+        while True:
+            time.sleep(0.2)
+            stats.report()
+    finally:
+        client.loop_stop()
+
+
+def cobs_encode(data):
+    out = bytearray()
+    block = bytearray()
+    for b in data:
+        if b == 0:
+            out.append(len(block) + 1)
+            out += block
+            block = bytearray()
+        else:
+            block.append(b)
+            if len(block) == 254:
+                out.append(255)
+                out += block
+                block = bytearray()
+    out.append(len(block) + 1)
+    out += block
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data) + 1:
+            raise ValueError('bad COBS packet')
+        out += data[i + 1:i + code]
+        i += code
+        if code < 255 and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def send_packet(port, message):
+    payload = message.SerializeToString()
+    payload += (zlib.crc32(payload) & 0xFFFFFFFF).to_bytes(4, 'little')
+    port.write(cobs_encode(payload) + b'\x00')
+
+
+def run_serial(args, stats):
+    import serial
+
+    port = serial.Serial(args.port, args.baud, timeout=0.1)
+    # A zero byte switches the knob from the plaintext to the protobuf protocol
+    port.write(b'\x00')
+    time.sleep(0.1)
+    send_packet(port, smartknob_pb2.ToSmartknob(protocol_version=PROTOBUF_PROTOCOL_VERSION,
+                                                nonce=random.randint(1, 2**32 - 1),
+                                                audio_feature_config=make_config(args)))
+
+    buffer = bytearray()
+    while True:
+        buffer += port.read(port.in_waiting or 1)
+        while b'\x00' in buffer:
+            end = buffer.index(b'\x00')
+            packet, buffer = bytes(buffer[:end]), buffer[end + 1:]
+            try:
+                decoded = cobs_decode(packet)
+            except ValueError:
+                continue
+            if len(decoded) <= 4 or zlib.crc32(decoded[:-4]) & 0xFFFFFFFF != int.from_bytes(decoded[-4:], 'little'):
+                continue
+            message = smartknob_pb2.FromSmartKnob.FromString(decoded[:-4])
+            if message.WhichOneof('payload') == 'audio_features':
+                # COBS overhead and the delimiter included, this is what the link carries
+                stats.add(message.audio_features, len(packet) + 1)
+        stats.report()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--interval-ms', type=int, default=0, help='frame interval, 0 selects the device default')
+    parser.add_argument('--batch', type=int, default=0, help='frames per message, 0 selects the device default')
+    parser.add_argument('--disable', action='store_true', help='stop the stream on this link')
+    parser.add_argument('--period', type=float, default=5, help='seconds between throughput reports')
+    parser.add_argument('--verbose', action='store_true', help='print every frame')
+    links = parser.add_subparsers(dest='link', required=True)
+
+    mqtt_args = links.add_parser('mqtt')
+    mqtt_args.add_argument('--host', required=True)
+    mqtt_args.add_argument('--mqtt-port', type=int, default=1883)
+    mqtt_args.add_argument('--user')
+    mqtt_args.add_argument('--password')
+
+    serial_args = links.add_parser('serial')
+    serial_args.add_argument('--port', required=True)
+    serial_args.add_argument('--baud', type=int, default=921600)
+
+    args = parser.parse_args()
+    stats = Throughput(args.period, args.verbose)
+    try:
+        if args.link == 'mqtt':
+            run_mqtt(args, stats)
+        else:
+            run_serial(args, stats)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()
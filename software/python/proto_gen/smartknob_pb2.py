@@ -16,7 +16,7 @@ _sym_db = _symbol_database.Default()
 import nanopb_pb2 as nanopb__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0fsmartknob.proto\x12\x02PB\x1a\x0cnanopb.proto\"\x9a\x02\n\rFromSmartKnob\x12\x1f\n\x10protocol_version\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x18\n\x04knob\x18\x03 \x01(\x0b\x32\x08.PB.KnobH\x00\x12\x16\n\x03\x61\x63k\x18\x04 \x01(\x0b\x32\x07.PB.AckH\x00\x12\x16\n\x03log\x18\x05 \x01(\x0b\x32\x07.PB.LogH\x00\x12-\n\x0fsmartknob_state\x18\x06 \x01(\x0b\x32\x12.PB.SmartKnobStateH\x00\x12\x30\n\x11motor_calib_state\x18\x07 \x01(\x0b\x32\x13.PB.MotorCalibStateH\x00\x12\x32\n\x12strain_calib_state\x18\x08 \x01(\x0b\x32\x14.PB.StrainCalibStateH\x00\x42\t\n\x07payload\"\x8c\x02\n\x0bToSmartknob\x12\x1f\n\x10protocol_version\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\r\n\x05nonce\x18\x02 \x01(\r\x12)\n\rrequest_state\x18\x03 \x01(\x0b\x32\x10.PB.RequestStateH\x00\x12/\n\x10smartknob_config\x18\x04 \x01(\x0b\x32\x13.PB.SmartKnobConfigH\x00\x12\x31\n\x11smartknob_command\x18\x05 \x01(\x0e\x32\x14.PB.SmartKnobCommandH\x00\x12\x33\n\x12strain_calibration\x18\x06 \x01(\x0b\x32\x15.PB.StrainCalibrationH\x00\x42\t\n\x07payload\"u\n\x04Knob\x12\x1a\n\x0bmac_address\x18\x01 \x01(\tB\x05\x92?\x02p2\x12\x19\n\nip_address\x18\x02 \x01(\tB\x05\x92?\x02p2\x12\x36\n\x11persistent_config\x18\x03 \x01(\x0b\x32\x1b.PB.PersistentConfiguration\"%\n\x0fMotorCalibState\x12\x12\n\ncalibrated\x18\x01 \x01(\x08\"6\n\x10StrainCalibState\x12\x0c\n\x04step\x18\x01 \x01(\r\x12\x14\n\x0cstrain_scale\x18\x02 \x01(\x02\"\x14\n\x03\x41\x63k\x12\r\n\x05nonce\x18\x01 \x01(\r\"b\n\x03Log\x12\x13\n\x03msg\x18\x01 \x01(\tB\x06\x92?\x03p\xff\x01\x12\x1b\n\x05level\x18\x02 \x01(\x0e\x32\x0c.PB.LogLevel\x12\x16\n\x06origin\x18\x03 \x01(\tB\x06\x92?\x03p\x80\x01\x12\x11\n\tisVerbose\x18\x04 \x01(\x08\"\x86\x01\n\x0eSmartKnobState\x12\x18\n\x10\x63urrent_position\x18\x01 \x01(\x05\x12\x19\n\x11sub_position_unit\x18\x02 \x01(\x02\x12#\n\x06\x63onfig\x18\x03 \x01(\x0b\x32\x13.PB.SmartKnobConfig\x12\x1a\n\x0bpress_nonce\x18\x04 \x01(\rB\x05\x92?\x02\x38\x08\"\xe1\x02\n\x0fSmartKnobConfig\x12\x10\n\x08position\x18\x01 \x01(\x05\x12\x19\n\x11sub_position_unit\x18\x02 \x01(\x02\x12\x1d\n\x0eposition_nonce\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\x12\x14\n\x0cmin_position\x18\x04 \x01(\x05\x12\x14\n\x0cmax_position\x18\x05 \x01(\x05\x12\x1e\n\x16position_width_radians\x18\x06 \x01(\x02\x12\x1c\n\x14\x64\x65tent_strength_unit\x18\x07 \x01(\x02\x12\x1d\n\x15\x65ndstop_strength_unit\x18\x08 \x01(\x02\x12\x12\n\nsnap_point\x18\t \x01(\x02\x12\x13\n\x04text\x18\n \x01(\tB\x05\x92?\x02p2\x12\x1f\n\x10\x64\x65tent_positions\x18\x0b \x03(\x05\x42\x05\x92?\x02\x10\x05\x12\x17\n\x0fsnap_point_bias\x18\x0c \x01(\x02\x12\x16\n\x07led_hue\x18\r \x01(\x05\x42\x05\x92?\x02\x38\x10\"\x0e\n\x0cRequestState\"e\n\x17PersistentConfiguration\x12\x0f\n\x07version\x18\x01 \x01(\r\x12#\n\x05motor\x18\x02 \x01(\x0b\x32\x14.PB.MotorCalibration\x12\x14\n\x0cstrain_scale\x18\x03 \x01(\x02\"p\n\x10MotorCalibration\x12\x12\n\ncalibrated\x18\x01 \x01(\x08\x12\x1e\n\x16zero_electrical_offset\x18\x02 \x01(\x02\x12\x14\n\x0c\x64irection_cw\x18\x03 \x01(\x08\x12\x12\n\npole_pairs\x18\x04 \x01(\r\"8\n\x0bStrainState\x12\x14\n\x0cpress_weight\x18\x01 \x01(\x05\x12\x13\n\x0bpress_value\x18\x02 \x01(\x02\"/\n\x11StrainCalibration\x12\x1a\n\x12\x63\x61libration_weight\x18\x01 \x01(\x02*D\n\x08LogLevel\x12\x08\n\x04INFO\x10\x00\x12\x0b\n\x07WARNING\x10\x01\x12\t\n\x05\x45RROR\x10\x02\x12\t\n\x05\x44\x45\x42UG\x10\x03\x12\x0b\n\x07VERBOSE\x10\x04*P\n\x10SmartKnobCommand\x12\x11\n\rGET_KNOB_INFO\x10\x00\x12\x13\n\x0fMOTOR_CALIBRATE\x10\x01\x12\x14\n\x10STRAIN_CALIBRATE\x10\x02\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0fsmartknob.proto\x12\x02PB\x1a\x0cnanopb.proto\"\xc7\x02\n\rFromSmartKnob\x12\x1f\n\x10protocol_version\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x18\n\x04knob\x18\x03 \x01(\x0b\x32\x08.PB.KnobH\x00\x12\x16\n\x03\x61\x63k\x18\x04 \x01(\x0b\x32\x07.PB.AckH\x00\x12\x16\n\x03log\x18\x05 \x01(\x0b\x32\x07.PB.LogH\x00\x12-\n\x0fsmartknob_state\x18\x06 \x01(\x0b\x32\x12.PB.SmartKnobStateH\x00\x12\x30\n\x11motor_calib_state\x18\x07 \x01(\x0b\x32\x13.PB.MotorCalibStateH\x00\x12\x32\n\x12strain_calib_state\x18\x08 \x01(\x0b\x32\x14.PB.StrainCalibStateH\x00\x12+\n\x0e\x61udio_features\x18\t \x01(\x0b\x32\x11.PB.AudioFeaturesH\x00\x42\t\n\x07payload\"\xf8\x02\n\x0bToSmartknob\x12\x1f\n\x10protocol_version\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\r\n\x05nonce\x18\x02 \x01(\r\x12)\n\rrequest_state\x18\x03 \x01(\x0b\x32\x10.PB.RequestStateH\x00\x12/\n\x10smartknob_config\x18\x04 \x01(\x0b\x32\x13.PB.SmartKnobConfigH\x00\x12\x31\n\x11smartknob_command\x18\x05 \x01(\x0e\x32\x14.PB.SmartKnobCommandH\x00\x12\x33\n\x12strain_calibration\x18\x06 \x01(\x0b\x32\x15.PB.StrainCalibrationH\x00\x12\x32\n\x12led_effect_program\x18\x07 \x01(\x0b\x32\x14.PB.LedEffectProgramH\x00\x12\x36\n\x14\x61udio_feature_config\x18\x08 \x01(\x0b\x32\x16.PB.AudioFeatureConfigH\x00\x42\t\n\x07payload\"u\n\x04Knob\x12\x1a\n\x0bmac_address\x18\x01 \x01(\tB\x05\x92?\x02p2\x12\x19\n\nip_address\x18\x02 \x01(\tB\x05\x92?\x02p2\x12\x36\n\x11persistent_config\x18\x03 \x01(\x0b\x32\x1b.PB.PersistentConfiguration\"%\n\x0fMotorCalibState\x12\x12\n\ncalibrated\x18\x01 \x01(\x08\"6\n\x10StrainCalibState\x12\x0c\n\x04step\x18\x01 \x01(\r\x12\x14\n\x0cstrain_scale\x18\x02 \x01(\x02\"\x14\n\x03\x41\x63k\x12\r\n\x05nonce\x18\x01 \x01(\r\"b\n\x03Log\x12\x13\n\x03msg\x18\x01 \x01(\tB\x06\x92?\x03p\xff\x01\x12\x1b\n\x05level\x18\x02 \x01(\x0e\x32\x0c.PB.LogLevel\x12\x16\n\x06origin\x18\x03 \x01(\tB\x06\x92?\x03p\x80\x01\x12\x11\n\tisVerbose\x18\x04 \x01(\x08\"\x86\x01\n\x0eSmartKnobState\x12\x18\n\x10\x63urrent_position\x18\x01 \x01(\x05\x12\x19\n\x11sub_position_unit\x18\x02 \x01(\x02\x12#\n\x06\x63onfig\x18\x03 \x01(\x0b\x32\x13.PB.SmartKnobConfig\x12\x1a\n\x0bpress_nonce\x18\x04 \x01(\rB\x05\x92?\x02\x38\x08\"\xe1\x02\n\x0fSmartKnobConfig\x12\x10\n\x08position\x18\x01 \x01(\x05\x12\x19\n\x11sub_position_unit\x18\x02 \x01(\x02\x12\x1d\n\x0eposition_nonce\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\x12\x14\n\x0cmin_position\x18\x04 \x01(\x05\x12\x14\n\x0cmax_position\x18\x05 \x01(\x05\x12\x1e\n\x16position_width_radians\x18\x06 \x01(\x02\x12\x1c\n\x14\x64\x65tent_strength_unit\x18\x07 \x01(\x02\x12\x1d\n\x15\x65ndstop_strength_unit\x18\x08 \x01(\x02\x12\x12\n\nsnap_point\x18\t \x01(\x02\x12\x13\n\x04text\x18\n \x01(\tB\x05\x92?\x02p2\x12\x1f\n\x10\x64\x65tent_positions\x18\x0b \x03(\x05\x42\x05\x92?\x02\x10\x05\x12\x17\n\x0fsnap_point_bias\x18\x0c \x01(\x02\x12\x16\n\x07led_hue\x18\r \x01(\x05\x42\x05\x92?\x02\x38\x10\"\x0e\n\x0cRequestState\"e\n\x17PersistentConfiguration\x12\x0f\n\x07version\x18\x01 \x01(\r\x12#\n\x05motor\x18\x02 \x01(\x0b\x32\x14.PB.MotorCalibration\x12\x14\n\x0cstrain_scale\x18\x03 \x01(\x02\"p\n\x10MotorCalibration\x12\x12\n\ncalibrated\x18\x01 \x01(\x08\x12\x1e\n\x16zero_electrical_offset\x18\x02 \x01(\x02\x12\x14\n\x0c\x64irection_cw\x18\x03 \x01(\x08\x12\x12\n\npole_pairs\x18\x04 \x01(\r\"8\n\x0bStrainState\x12\x14\n\x0cpress_weight\x18\x01 \x01(\x05\x12\x13\n\x0bpress_value\x18\x02 \x01(\x02\"/\n\x11StrainCalibration\x12\x1a\n\x12\x63\x61libration_weight\x18\x01 \x01(\x02\"_\n\x10LedEffectProgram\x12\x13\n\x04slot\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x17\n\x07program\x18\x02 \x01(\x0c\x42\x06\x92?\x03\x08\x80\x02\x12\x0f\n\x07persist\x18\x03 \x01(\x08\x12\x0c\n\x04play\x18\x04 \x01(\x08\"e\n\x11\x41udioFeatureFrame\x12\x18\n\toffset_ms\x18\x01 \x01(\rB\x05\x92?\x02\x38\x10\x12\x14\n\x05\x62\x61nds\x18\x02 \x01(\x0c\x42\x05\x92?\x02\x08 \x12\x12\n\x03rms\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\x12\x0c\n\x04\x62\x65\x61t\x18\x04 \x01(\x08\"n\n\rAudioFeatures\x12\x10\n\x08sequence\x18\x01 \x01(\r\x12\x10\n\x08start_ms\x18\x02 \x01(\r\x12\x0b\n\x03\x62pm\x18\x03 \x01(\x02\x12,\n\x06\x66rames\x18\x04 \x03(\x0b\x32\x15.PB.AudioFeatureFrameB\x05\x92?\x02\x10\x08\"d\n\x12\x41udioFeatureConfig\x12\x0f\n\x07\x65nabled\x18\x01 \x01(\x08\x12 \n\x11\x66rame_interval_ms\x18\x02 \x01(\rB\x05\x92?\x02\x38\x10\x12\x1b\n\x0c\x62\x61tch_frames\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08*D\n\x08LogLevel\x12\x08\n\x04INFO\x10\x00\x12\x0b\n\x07WARNING\x10\x01\x12\t\n\x05\x45RROR\x10\x02\x12\t\n\x05\x44\x45\x42UG\x10\x03\x12\x0b\n\x07VERBOSE\x10\x04*P\n\x10SmartKnobCommand\x12\x11\n\rGET_KNOB_INFO\x10\x00\x12\x13\n\x0fMOTOR_CALIBRATE\x10\x01\x12\x14\n\x10STRAIN_CALIBRATE\x10\x02\x62\x06proto3')
 
 _LOGLEVEL = DESCRIPTOR.enum_types_by_name['LogLevel']
 LogLevel = enum_type_wrapper.EnumTypeWrapper(_LOGLEVEL)
@@ -46,6 +46,10 @@ _PERSISTENTCONFIGURATION = DESCRIPTOR.message_types_by_name['PersistentConfigura
 _MOTORCALIBRATION = DESCRIPTOR.message_types_by_name['MotorCalibration']
 _STRAINSTATE = DESCRIPTOR.message_types_by_name['StrainState']
 _STRAINCALIBRATION = DESCRIPTOR.message_types_by_name['StrainCalibration']
+_LEDEFFECTPROGRAM = DESCRIPTOR.message_types_by_name['LedEffectProgram']
+_AUDIOFEATUREFRAME = DESCRIPTOR.message_types_by_name['AudioFeatureFrame']
+_AUDIOFEATURES = DESCRIPTOR.message_types_by_name['AudioFeatures']
+_AUDIOFEATURECONFIG = DESCRIPTOR.message_types_by_name['AudioFeatureConfig']
 FromSmartKnob = _reflection.GeneratedProtocolMessageType('FromSmartKnob', (_message.Message,), {
   'DESCRIPTOR' : _FROMSMARTKNOB,
   '__module__' : 'smartknob_pb2'
@@ -144,6 +148,34 @@ StrainCalibration = _reflection.GeneratedProtocolMessageType('StrainCalibration'
   })
 _sym_db.RegisterMessage(StrainCalibration)
 
+LedEffectProgram = _reflection.GeneratedProtocolMessageType('LedEffectProgram', (_message.Message,), {
+  'DESCRIPTOR' : _LEDEFFECTPROGRAM,
+  '__module__' : 'smartknob_pb2'
+  # @@protoc_insertion_point(class_scope:PB.LedEffectProgram)
+  })
+_sym_db.RegisterMessage(LedEffectProgram)
+
+AudioFeatureFrame = _reflection.GeneratedProtocolMessageType('AudioFeatureFrame', (_message.Message,), {
+  'DESCRIPTOR' : _AUDIOFEATUREFRAME,
+  '__module__' : 'smartknob_pb2'
+  # @@protoc_insertion_point(class_scope:PB.AudioFeatureFrame)
+  })
+_sym_db.RegisterMessage(AudioFeatureFrame)
+
+AudioFeatures = _reflection.GeneratedProtocolMessageType('AudioFeatures', (_message.Message,), {
+  'DESCRIPTOR' : _AUDIOFEATURES,
+  '__module__' : 'smartknob_pb2'
+  # @@protoc_insertion_point(class_scope:PB.AudioFeatures)
+  })
+_sym_db.RegisterMessage(AudioFeatures)
+
+AudioFeatureConfig = _reflection.GeneratedProtocolMessageType('AudioFeatureConfig', (_message.Message,), {
+  'DESCRIPTOR' : _AUDIOFEATURECONFIG,
+  '__module__' : 'smartknob_pb2'
+  # @@protoc_insertion_point(class_scope:PB.AudioFeatureConfig)
+  })
+_sym_db.RegisterMessage(AudioFeatureConfig)
+
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
@@ -169,36 +201,60 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _SMARTKNOBCONFIG.fields_by_name['detent_positions']._serialized_options = b'\222?\002\020\005'
   _SMARTKNOBCONFIG.fields_by_name['led_hue']._options = None
   _SMARTKNOBCONFIG.fields_by_name['led_hue']._serialized_options = b'\222?\0028\020'
-  _LOGLEVEL._serialized_start=1762
-  _LOGLEVEL._serialized_end=1830
-  _SMARTKNOBCOMMAND._serialized_start=1832
-  _SMARTKNOBCOMMAND._serialized_end=1912
+  _LEDEFFECTPROGRAM.fields_by_name['slot']._options = None
+  _LEDEFFECTPROGRAM.fields_by_name['slot']._serialized_options = b'\222?\0028\010'
+  _LEDEFFECTPROGRAM.fields_by_name['program']._options = None
+  _LEDEFFECTPROGRAM.fields_by_name['program']._serialized_options = b'\222?\003\010\200\002'
+  _AUDIOFEATUREFRAME.fields_by_name['offset_ms']._options = None
+  _AUDIOFEATUREFRAME.fields_by_name['offset_ms']._serialized_options = b'\222?\0028\020'
+  _AUDIOFEATUREFRAME.fields_by_name['bands']._options = None
+  _AUDIOFEATUREFRAME.fields_by_name['bands']._serialized_options = b'\222?\002\010 '
+  _AUDIOFEATUREFRAME.fields_by_name['rms']._options = None
+  _AUDIOFEATUREFRAME.fields_by_name['rms']._serialized_options = b'\222?\0028\010'
+  _AUDIOFEATURES.fields_by_name['frames']._options = None
+  _AUDIOFEATURES.fields_by_name['frames']._serialized_options = b'\222?\002\020\010'
+  _AUDIOFEATURECONFIG.fields_by_name['frame_interval_ms']._options = None
+  _AUDIOFEATURECONFIG.fields_by_name['frame_interval_ms']._serialized_options = b'\222?\0028\020'
+  _AUDIOFEATURECONFIG.fields_by_name['batch_frames']._options = None
+  _AUDIOFEATURECONFIG.fields_by_name['batch_frames']._serialized_options = b'\222?\0028\010'
+  _LOGLEVEL._serialized_start=2329
+  _LOGLEVEL._serialized_end=2397
+  _SMARTKNOBCOMMAND._serialized_start=2399
+  _SMARTKNOBCOMMAND._serialized_end=2479
   _FROMSMARTKNOB._serialized_start=38
-  _FROMSMARTKNOB._serialized_end=320
-  _TOSMARTKNOB._serialized_start=323
-  _TOSMARTKNOB._serialized_end=591
-  _KNOB._serialized_start=593
-  _KNOB._serialized_end=710
-  _MOTORCALIBSTATE._serialized_start=712
-  _MOTORCALIBSTATE._serialized_end=749
-  _STRAINCALIBSTATE._serialized_start=751
-  _STRAINCALIBSTATE._serialized_end=805
-  _ACK._serialized_start=807
-  _ACK._serialized_end=827
-  _LOG._serialized_start=829
-  _LOG._serialized_end=927
-  _SMARTKNOBSTATE._serialized_start=930
-  _SMARTKNOBSTATE._serialized_end=1064
-  _SMARTKNOBCONFIG._serialized_start=1067
-  _SMARTKNOBCONFIG._serialized_end=1420
-  _REQUESTSTATE._serialized_start=1422
-  _REQUESTSTATE._serialized_end=1436
-  _PERSISTENTCONFIGURATION._serialized_start=1438
-  _PERSISTENTCONFIGURATION._serialized_end=1539
-  _MOTORCALIBRATION._serialized_start=1541
-  _MOTORCALIBRATION._serialized_end=1653
-  _STRAINSTATE._serialized_start=1655
-  _STRAINSTATE._serialized_end=1711
-  _STRAINCALIBRATION._serialized_start=1713
-  _STRAINCALIBRATION._serialized_end=1760
+  _FROMSMARTKNOB._serialized_end=365
+  _TOSMARTKNOB._serialized_start=368
+  _TOSMARTKNOB._serialized_end=744
+  _KNOB._serialized_start=746
+  _KNOB._serialized_end=863
+  _MOTORCALIBSTATE._serialized_start=865
+  _MOTORCALIBSTATE._serialized_end=902
+  _STRAINCALIBSTATE._serialized_start=904
+  _STRAINCALIBSTATE._serialized_end=958
+  _ACK._serialized_start=960
+  _ACK._serialized_end=980
+  _LOG._serialized_start=982
+  _LOG._serialized_end=1080
+  _SMARTKNOBSTATE._serialized_start=1083
+  _SMARTKNOBSTATE._serialized_end=1217
+  _SMARTKNOBCONFIG._serialized_start=1220
+  _SMARTKNOBCONFIG._serialized_end=1573
+  _REQUESTSTATE._serialized_start=1575
+  _REQUESTSTATE._serialized_end=1589
+  _PERSISTENTCONFIGURATION._serialized_start=1591
+  _PERSISTENTCONFIGURATION._serialized_end=1692
+  _MOTORCALIBRATION._serialized_start=1694
+  _MOTORCALIBRATION._serialized_end=1806
+  _STRAINSTATE._serialized_start=1808
+  _STRAINSTATE._serialized_end=1864
+  _STRAINCALIBRATION._serialized_start=1866
+  _STRAINCALIBRATION._serialized_end=1913
+  _LEDEFFECTPROGRAM._serialized_start=1915
+  _LEDEFFECTPROGRAM._serialized_end=2010
+  _AUDIOFEATUREFRAME._serialized_start=2012
+  _AUDIOFEATUREFRAME._serialized_end=2113
+  _AUDIOFEATURES._serialized_start=2115
+  _AUDIOFEATURES._serialized_end=2225
+  _AUDIOFEATURECONFIG._serialized_start=2227
+  _AUDIOFEATURECONFIG._serialized_end=2327
 # @@protoc_insertion_point(module_scope)